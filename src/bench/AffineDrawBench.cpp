@@ -0,0 +1,91 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * CPU cost of building and handing off the per draw MVP for the 2D render path: a GenoMatrix4f
+ * (sixteen floats) against a GenoAffine2f (six floats). The glUniform call is stood in for by a copy
+ * into a uniform staging buffer since there is no context here, so driver time is not included.
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/AffineDrawBench.cpp src/geno/math/linear/GenoMathInstantiations.cpp
+**/
+
+#include <iostream>
+#include <cstring>
+#include <vector>
+
+#include "../geno/math/linear/GenoMatrix4.h"
+#include "../geno/math/linear/GenoAffine2.h"
+
+#include "GenoBench.h"
+
+constexpr uint32 NUM_DRAWS  = 10000;
+constexpr uint32 NUM_FRAMES = 2000;
+
+struct Sprite {
+	GenoVector2f position;
+	GenoVector2f dimensions;
+};
+
+float uniform[16];
+
+template <typename Function>
+void run(const char * name, Function function) {
+	auto allocations = GenoBench::getAllocations();
+	auto begin = GenoBench::getTime();
+	for (uint32 i = 0; i < NUM_FRAMES; ++i) {
+		for (uint32 j = 0; j < NUM_DRAWS; ++j)
+			function(j);
+		GenoBench::keep(uniform);
+	}
+	auto end = GenoBench::getTime();
+	allocations = GenoBench::getAllocations() - allocations;
+	std::cout << name << (double) (end - begin) / (NUM_FRAMES * 1000.0) << " us/10k draws, "
+	          << (double) allocations / (NUM_FRAMES * NUM_DRAWS) << " allocations/draw" << std::endl;
+}
+
+int32 main() {
+	std::vector<Sprite> sprites;
+	for (uint32 i = 0; i < NUM_DRAWS; ++i)
+		sprites.push_back({ { (float) (i % 100), (float) (i / 100) }, { 1.0f + i % 3, 1.0f + i % 2 } });
+
+	GenoVector2f cameraPosition = { 12.0f, 4.0f };
+
+	GenoMatrix4f view = GenoMatrix4f::makeIdentity();
+	view.setTranslateXY(-cameraPosition);
+	GenoMatrix4f projectionView = GenoMatrix4f::makeOrthographic(0, 32, 18, 0, 0, 1) * view;
+	GenoAffine2f affineProjectionView = translate2D(GenoAffine2f::makeOrthographic(0, 32, 18, 0), -cameraPosition);
+
+	run("GenoMatrix4f: ", [&](uint32 i) {
+		GenoMatrix4f mvp = translate2D(projectionView, sprites[i].position).scale2D(sprites[i].dimensions);
+		memcpy(uniform, mvp.m, sizeof(float) * 16);
+	});
+	run("GenoAffine2f: ", [&](uint32 i) {
+		GenoAffine2f mvp = translate2D(affineProjectionView, sprites[i].position).scale2D(sprites[i].dimensions);
+		memcpy(uniform, mvp.m, sizeof(float) * 6);
+	});
+
+	return 0;
+}
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Compares the cost of reading each GenoClock backend, checks the TSC clock against the monotonic clock, and runs
+ * ten seconds of a 144 Hz GenoLoop with 240 Hz fixed steps on a GenoVirtualClock to show it runs faster than real
+ * time and hits the same frame counts as real time would, with a coroutine resuming once per fixed step
+ *
+ * Build: g++ -O2 -std=c++20 -Isrc src/bench/GenoBench.cpp src/bench/ClockBench.cpp src/geno/thread/GenoClock.cpp src/geno/thread/GenoPacer.cpp src/geno/thread/GenoTime.cpp src/geno/thread/GenoCoroutine.cpp src/geno/engine/GenoLoop.cpp src/geno/engine/GenoFrameStats.cpp -lpthread
+**/
+
+#include <iostream>
+#include <cmath>
+
+#include "../geno/thread/GenoTime.h"
+#include "../geno/thread/GenoClock.h"
+#include "../geno/thread/GenoCoroutine.h"
+#include "../geno/engine/GenoLoop.h"
+
+#include "GenoBench.h"
+
+const uint32 READ_COUNT = 10000000;
+
+const double SIMULATED_SECONDS = 10;
+const double FRAME_RATE        = 144;
+const double STEP_RATE         = 240;
+
+GenoLoop * loop;
+uint32 frames = 0;
+uint32 steps  = 0;
+uint32 resumes = 0;
+double resumedDelta = 0;
+GenoCoroutine counter;
+
+GenoCoroutine countSteps() {
+	while (true) {
+		resumedDelta += co_await GenoCoroutine::nextFrame();
+		++resumes;
+	}
+}
+
+void frame() {
+	++frames;
+	if (GenoTime::getTime(seconds) >= SIMULATED_SECONDS)
+		loop->stop();
+}
+
+void step() {
+	if (steps++ == 0)
+		counter = countSteps();
+}
+
+double measureReads(GenoClock * clock) {
+	uint64 sum = 0;
+	uint64 start = GenoBench::getTime();
+	for (uint32 i = 0; i < READ_COUNT; ++i)
+		sum += clock->getTime();
+	GenoBench::keep(sum);
+	return (double) (GenoBench::getTime() - start) / READ_COUNT;
+}
+
+int32 main() {
+	GenoMonotonicClock monotonic;
+	GenoTscClock tsc;
+	GenoVirtualClock virtualClock;
+
+	std::cout << "ns per read: monotonic " << measureReads(&monotonic)
+	          << ", tsc " << measureReads(&tsc)
+	          << ", virtual " << measureReads(&virtualClock) << std::endl;
+
+	// Both real clocks must agree over a sleep, the TSC only drifts by its calibration error
+	uint64 monotonicStart = monotonic.getTime();
+	uint64 tscStart = tsc.getTime();
+	GenoTime::sleep(200, milliseconds);
+	double monotonicElapsed = (double) (monotonic.getTime() - monotonicStart);
+	double tscElapsed = (double) (tsc.getTime() - tscStart);
+	double drift = fabs(tscElapsed - monotonicElapsed) / monotonicElapsed;
+	std::cout << "tsc " << 1 / tsc.getNanosPerTick() << " GHz, drift against monotonic " << drift * 1000000 << " ppm" << std::endl;
+	if (drift > 0.001) {
+		std::cout << "INVALID: tsc clock drifted from the monotonic clock" << std::endl;
+		return 1;
+	}
+
+	GenoTime::setClock(&virtualClock);
+
+	GenoLoopCreateInfo loopInfo = {};
+	loopInfo.targetFps     = FRAME_RATE;
+	loopInfo.deltaScale    = 1;
+	loopInfo.callback      = frame;
+	loopInfo.fixedFps      = STEP_RATE;
+	loopInfo.fixedCallback = step;
+	loop = new GenoLoop(loopInfo);
+
+	uint64 start = GenoBench::getTime();
+	loop->start();
+	double wall = (GenoBench::getTime() - start) / 1000000000.0;
+	counter = GenoCoroutine();
+	delete loop;
+
+	GenoTime::setClock(0);
+
+	std::cout << SIMULATED_SECONDS << " simulated seconds in " << wall * 1000 << " ms of wall time, "
+	          << frames << " frames, " << steps << " fixed steps" << std::endl;
+	if (fabs(frames - SIMULATED_SECONDS * FRAME_RATE) > 2 || fabs(steps - SIMULATED_SECONDS * STEP_RATE) > 2) {
+		std::cout << "INVALID: virtual clock loop missed its frame or step count" << std::endl;
+		return 1;
+	}
+	// The coroutine starts inside the first step and resumes at the end of every step from then on
+	std::cout << resumes << " coroutine resumes covering " << resumedDelta << " s" << std::endl;
+	if (resumes != steps || fabs(resumedDelta - resumes / STEP_RATE) > 0.000001) {
+		std::cout << "INVALID: coroutines did not resume once per fixed step" << std::endl;
+		return 1;
+	}
+	return 0;
+}
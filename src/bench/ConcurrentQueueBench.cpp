@@ -0,0 +1,161 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Pushes and pops 2M elements through GenoConcurrentQueue at 1 to 16 threads, one at a time and in bulk, next to a
+ * GenoQueue behind a mutex. Every thread pushes then pops so the queue stays shallow and every operation contends
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/ConcurrentQueueBench.cpp src/geno/exceptions/GenoException.cpp src/geno/exceptions/GenoMaxCapacityException.cpp -lpthread
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <atomic>
+
+#include "../geno/template/GenoQueue.h"
+#include "../geno/template/GenoConcurrentQueue.h"
+
+#include "GenoBench.h"
+
+const uint32 OPERATION_COUNT = 1 << 21;
+const uint32 BULK_SIZE       = 16;
+const uint32 THREAD_COUNTS[] = { 1, 2, 4, 8, 16 };
+
+struct LockedQueue {
+	std::mutex mutex;
+	GenoQueue<uint64> queue;
+
+	bool tryPush(uint64 element) {
+		std::lock_guard<std::mutex> lock(mutex);
+		queue.enqueue(element);
+		return true;
+	}
+
+	bool tryPop(uint64 & element) {
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!queue.hasNext())
+			return false;
+		element = queue.dequeue();
+		return true;
+	}
+};
+
+template <typename Queue>
+void runSingle(Queue & queue, uint32 first, uint32 count, uint64 & sum) {
+	uint64 total = 0;
+	for (uint32 i = 0; i < count; ++i) {
+		while (!queue.tryPush(first + i))
+			std::this_thread::yield();
+		uint64 element;
+		while (!queue.tryPop(element))
+			std::this_thread::yield();
+		total += element;
+	}
+	sum = total;
+}
+
+void runBulk(GenoConcurrentQueue<uint64> & queue, uint32 first, uint32 count, uint64 & sum) {
+	uint64 total = 0;
+	uint64 elements[BULK_SIZE];
+	for (uint32 i = 0; i < count; i += BULK_SIZE) {
+		uint32 batch = count - i < BULK_SIZE ? count - i : BULK_SIZE;
+		for (uint32 j = 0; j < batch; ++j)
+			elements[j] = first + i + j;
+		for (uint32 pushed = 0; pushed < batch;) {
+			uint32 claimed = queue.tryPushBulk(elements + pushed, batch - pushed);
+			if (claimed == 0)
+				std::this_thread::yield();
+			pushed += claimed;
+		}
+		for (uint32 popped = 0; popped < batch;) {
+			uint32 claimed = queue.tryPopBulk(elements, batch - popped);
+			if (claimed == 0)
+				std::this_thread::yield();
+			for (uint32 j = 0; j < claimed; ++j)
+				total += elements[j];
+			popped += claimed;
+		}
+	}
+	sum = total;
+}
+
+/** Runs body on threadCount threads and returns nanoseconds per push and pop pair, clearing valid on a bad sum **/
+template <typename Body>
+double measure(uint32 threadCount, Body body, bool & valid) {
+	std::vector<std::thread> threads;
+	std::vector<uint64> sums(threadCount);
+	uint32 count = OPERATION_COUNT / threadCount;
+	uint64 start = GenoBench::getTime();
+	for (uint32 i = 0; i < threadCount; ++i)
+		threads.emplace_back(body, i * count, count, std::ref(sums[i]));
+	for (std::thread & thread : threads)
+		thread.join();
+	uint64 time = GenoBench::getTime() - start;
+
+	uint64 total = 0;
+	uint64 expected = 0;
+	for (uint32 i = 0; i < threadCount; ++i)
+		total += sums[i];
+	for (uint64 i = 0; i < (uint64) count * threadCount; ++i)
+		expected += i;
+	valid = valid && total == expected;
+	return (double) time / (count * threadCount);
+}
+
+int main() {
+	bool valid = true;
+	std::cout << std::fixed << std::setprecision(1);
+	std::cout << "threads  mutex GenoQueue  concurrent  concurrent bulk " << BULK_SIZE << "  (ns per push + pop)\n";
+	for (uint32 threadCount : THREAD_COUNTS) {
+		LockedQueue locked;
+		GenoConcurrentQueue<uint64> single(1024);
+		GenoConcurrentQueue<uint64> bulk(1024);
+		double lockedTime = measure(threadCount, [&](uint32 first, uint32 count, uint64 & sum) { runSingle(locked, first, count, sum); }, valid);
+		double singleTime = measure(threadCount, [&](uint32 first, uint32 count, uint64 & sum) { runSingle(single, first, count, sum); }, valid);
+		double bulkTime   = measure(threadCount, [&](uint32 first, uint32 count, uint64 & sum) { runBulk(bulk, first, count, sum); }, valid);
+		std::cout << std::setw(7) << threadCount
+		          << std::setw(17) << lockedTime
+		          << std::setw(12) << singleTime
+		          << std::setw(17) << bulkTime << '\n';
+	}
+
+	// A full queue rejects pushes and an empty one rejects pops without blocking
+	GenoConcurrentQueue<uint64> small(4);
+	uint64 elements[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+	valid = valid && small.getCapacity() == 4 && small.tryPushBulk(elements, 8) == 4 && !small.tryPush(9);
+	valid = valid && small.getSize() == 4 && small.tryPopBulk(elements + 4, 8) == 4 && elements[4] == 1 && elements[7] == 4;
+	uint64 element;
+	valid = valid && !small.tryPop(element) && small.getSize() == 0;
+
+	if (!valid) {
+		std::cout << "INVALID: popped elements do not match the pushed ones\n";
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,200 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Drives GenoCoroutineScheduler by hand the way GenoLoop does: thousands of short coroutines that wait on frames,
+ * loop time and pool jobs, counting heap allocations per coroutine with pooled frames against plain new / delete,
+ * and checks that waits resume on the right update and that destroying a waiting coroutine cancels it
+ *
+ * Build: g++ -O2 -std=c++20 -Isrc src/bench/GenoBench.cpp src/bench/CoroutineBench.cpp src/geno/thread/GenoCoroutine.cpp src/geno/thread/GenoThreadPool.cpp -lpthread
+**/
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <coroutine>
+
+#include "../geno/thread/GenoCoroutine.h"
+#include "../geno/thread/GenoThreadPool.h"
+
+#include "GenoBench.h"
+
+const uint32 COROUTINE_COUNT = 2000;
+const uint32 ROUNDS          = 20;
+const double FRAME_TIME      = 1.0 / 60;
+
+/** The same coroutine body with frames from the global heap **/
+struct HeapCoroutine {
+	struct promise_type {
+		HeapCoroutine get_return_object() {
+			return { std::coroutine_handle<promise_type>::from_promise(*this) };
+		}
+		std::suspend_never initial_suspend() const noexcept { return {}; }
+		std::suspend_always final_suspend() const noexcept { return {}; }
+		void return_void() const noexcept {}
+		void unhandled_exception() const { throw; }
+	};
+
+	std::coroutine_handle<promise_type> handle;
+};
+
+struct HeapFrameAwaiter {
+	std::vector<std::coroutine_handle<>> * waiters;
+	bool await_ready() const noexcept { return false; }
+	void await_suspend(std::coroutine_handle<> handle) { waiters->push_back(handle); }
+	void await_resume() const noexcept {}
+};
+
+HeapCoroutine heapTimeline(std::vector<std::coroutine_handle<>> * waiters, uint32 * counter) {
+	for (uint32 i = 0; i < 4; ++i) {
+		co_await HeapFrameAwaiter{ waiters };
+		++*counter;
+	}
+}
+
+GenoCoroutine timeline(uint32 * counter) {
+	for (uint32 i = 0; i < 4; ++i) {
+		co_await GenoCoroutine::nextFrame();
+		++*counter;
+	}
+}
+
+GenoCoroutine fade(float * value, float to) {
+	float from = *value;
+	for (double time = 0; time < 0.25; time += co_await GenoCoroutine::nextFrame())
+		*value = from + (to - from) * (time / 0.25);
+	*value = to;
+}
+
+GenoCoroutine sequence(GenoThreadPool * pool, float * value, uint32 * result, double * finished, GenoCoroutineScheduler * scheduler) {
+	*result = co_await pool->submit([]() {
+		uint32 sum = 0;
+		for (uint32 i = 0; i < 1000; ++i)
+			sum += i;
+		return sum;
+	});
+	co_await fade(value, 1);
+	co_await GenoCoroutine::seconds(0.5);
+	co_await fade(value, 0);
+	*finished = scheduler->getTime();
+}
+
+int32 main() {
+	bool valid = true;
+	GenoCoroutineScheduler scheduler;
+	GenoCoroutineScheduler::setCurrent(&scheduler);
+
+	// Pooled frames against heap frames, both resumed once per update
+	std::vector<GenoCoroutine> coroutines(COROUTINE_COUNT);
+	std::vector<std::coroutine_handle<>> waiters;
+	std::vector<std::coroutine_handle<>> resuming;
+	waiters.reserve(COROUTINE_COUNT);
+	resuming.reserve(COROUTINE_COUNT);
+	uint32 counter = 0;
+	uint64 pooledAllocations = 0;
+	uint64 heapAllocations = 0;
+	uint64 pooledTime = 0;
+	uint64 heapTime = 0;
+	for (uint32 round = 0; round < ROUNDS; ++round) {
+		uint64 allocations = GenoBench::getAllocations();
+		uint64 start = GenoBench::getTime();
+		for (uint32 i = 0; i < COROUTINE_COUNT; ++i)
+			coroutines[i] = timeline(&counter);
+		while (scheduler.getNumWaiting() > 0)
+			scheduler.update(FRAME_TIME);
+		for (uint32 i = 0; i < COROUTINE_COUNT; ++i)
+			coroutines[i] = GenoCoroutine();
+		if (round > 0) {
+			pooledTime += GenoBench::getTime() - start;
+			pooledAllocations += GenoBench::getAllocations() - allocations;
+		}
+
+		std::vector<HeapCoroutine> heapCoroutines;
+		heapCoroutines.reserve(COROUTINE_COUNT);
+		allocations = GenoBench::getAllocations();
+		start = GenoBench::getTime();
+		for (uint32 i = 0; i < COROUTINE_COUNT; ++i)
+			heapCoroutines.push_back(heapTimeline(&waiters, &counter));
+		while (waiters.size() > 0) {
+			resuming.swap(waiters);
+			for (std::coroutine_handle<> handle : resuming)
+				handle.resume();
+			resuming.clear();
+		}
+		for (HeapCoroutine & coroutine : heapCoroutines)
+			coroutine.handle.destroy();
+		if (round > 0) {
+			heapTime += GenoBench::getTime() - start;
+			heapAllocations += GenoBench::getAllocations() - allocations;
+		}
+	}
+	valid = valid && counter == ROUNDS * COROUTINE_COUNT * 4 * 2;
+	double count = (double) (ROUNDS - 1) * COROUTINE_COUNT;
+	std::cout << "pooled frames: " << pooledTime / count << " ns/coroutine, " << pooledAllocations / count << " allocations/coroutine" << std::endl;
+	std::cout << "heap frames:   " << heapTime / count << " ns/coroutine, " << heapAllocations / count << " allocations/coroutine" << std::endl;
+
+	// A job, two fades and a timed wait in a row, resumed on the updates they are due
+	GenoThreadPool pool(2);
+	float value = 0;
+	uint32 result = 0;
+	double finished = 0;
+	double start = scheduler.getTime();
+	GenoCoroutine chain = sequence(&pool, &value, &result, &finished, &scheduler);
+	uint32 updates = 0;
+	while (!chain.isDone() && updates < 10000) {
+		// A real loop sleeps between frames, which is when the pool gets to run on a busy machine
+		std::this_thread::yield();
+		scheduler.update(FRAME_TIME);
+		++updates;
+	}
+	double elapsed = finished - start;
+	std::cout << "sequence: done after " << updates << " updates, " << elapsed << " s of loop time" << std::endl;
+	valid = valid && chain.isDone() && result == 499500 && value == 0 && elapsed >= 1.0 && elapsed < 1.0 + 5 * FRAME_TIME;
+
+	// Destroying waiting coroutines, one of them mid update, must never resume them
+	uint32 cancelled = 0;
+	GenoCoroutine victim;
+	GenoCoroutine killer = [](GenoCoroutine * victim) -> GenoCoroutine {
+		co_await GenoCoroutine::nextFrame();
+		*victim = GenoCoroutine();
+	}(&victim);
+	// The victim waits behind the killer so it is destroyed after the update has already picked it to resume
+	victim = timeline(&cancelled);
+	GenoCoroutine sleeper = [](uint32 * cancelled) -> GenoCoroutine {
+		co_await GenoCoroutine::seconds(1);
+		++*cancelled;
+	}(&cancelled);
+	sleeper = GenoCoroutine();
+	for (uint32 i = 0; i < 120; ++i)
+		scheduler.update(FRAME_TIME);
+	valid = valid && cancelled == 0 && victim.isDone() && killer.isDone() && scheduler.getNumWaiting() == 0;
+
+	if (!valid) {
+		std::cout << "INVALID: coroutines resumed at the wrong time or after being destroyed" << std::endl;
+		return 1;
+	}
+	return 0;
+}
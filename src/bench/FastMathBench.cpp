@@ -0,0 +1,164 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Checks the fast* square root functions against the exact path and times them
+ *
+ * fastInverseSqrt and fastSqrt are compared with double precision results over the whole range of normal positive
+ * floats, fastGetLength, fastSetLength and fastNormalize with their exact GenoVector2/3/4 counterparts on random
+ * vectors. Any error above the bound documented in GenoFastMath.h fails the run with exit code 1.
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/FastMathBench.cpp src/geno/math/linear/GenoMathInstantiations.cpp
+ *        add -DGENO_NO_SIMD to check the scalar estimate
+**/
+
+#include <cfloat>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../geno/math/GenoFastMath.h"
+#include "../geno/math/linear/GenoVector2.h"
+#include "../geno/math/linear/GenoVector3.h"
+#include "../geno/math/linear/GenoVector4.h"
+
+#include "GenoBench.h"
+
+#if defined(GENO_SSE)
+	constexpr double BOUND = 5e-7;
+#else
+	constexpr double BOUND = 5e-6;
+#endif
+
+// Rounding of the products around the estimate, on top of the estimate's own error
+constexpr double VECTOR_BOUND = BOUND + 4 * FLT_EPSILON;
+
+constexpr uint32 NUM_VECTORS = 4096;
+constexpr uint32 NUM_PASSES  = 2000;
+
+bool report(const char * name, double error, double bound) {
+	bool pass = error <= bound;
+	std::cout << name << error;
+	if (!pass)
+		std::cout << "  FAILED, bound is " << bound;
+	std::cout << std::endl;
+	return pass;
+}
+
+template <uint32 N>
+double vectorError(const GenoVector<N, float> & actual, const GenoVector<N, float> & expected) {
+	double error = 0;
+	double length = expected.getLength();
+	for (uint32 i = 0; i < N; ++i)
+		error = std::fmax(error, std::fabs((double) actual.v[i] - expected.v[i]) / length);
+	return error;
+}
+
+template <uint32 N>
+bool checkVectors(const char * name, std::mt19937 & random) {
+	std::uniform_real_distribution<float> exponent(-12, 12);
+	std::uniform_real_distribution<float> component(-1, 1);
+	double lengthError    = 0;
+	double setLengthError = 0;
+	double normalizeError = 0;
+	for (uint32 i = 0; i < 100000; ++i) {
+		GenoVector<N, float> vector;
+		float scale = std::exp2(exponent(random));
+		for (uint32 j = 0; j < N; ++j)
+			vector.v[j] = component(random) * scale;
+		if (vector.getLengthSquared() < FLT_MIN)
+			continue;
+		float length = std::exp2(exponent(random));
+		lengthError    = std::fmax(lengthError, std::fabs((double) vector.fastGetLength() - vector.getLength()) / vector.getLength());
+		setLengthError = std::fmax(setLengthError, vectorError(fastSetLength(vector, length), setLength(vector, length)));
+		normalizeError = std::fmax(normalizeError, vectorError(fastNormalize(vector), normalize(vector)));
+	}
+	std::cout << name << std::endl;
+	bool pass = report("  fastGetLength: ", lengthError,    VECTOR_BOUND);
+	pass &=     report("  fastSetLength: ", setLengthError, VECTOR_BOUND);
+	pass &=     report("  fastNormalize: ", normalizeError, VECTOR_BOUND);
+	return pass;
+}
+
+template <typename Function>
+void run(const char * name, Function function) {
+	auto begin = GenoBench::getTime();
+	for (uint32 i = 0; i < NUM_PASSES; ++i)
+		function();
+	auto end = GenoBench::getTime();
+	std::cout << name << (double) (end - begin) / (NUM_PASSES * NUM_VECTORS) << " ns/vector" << std::endl;
+}
+
+int32 main() {
+	double inverseError = 0;
+	double sqrtError    = 0;
+	// Every 7th bit pattern from FLT_MIN up to infinity
+	for (uint32 bits = 0x00800000; bits < 0x7F800000; bits += 7) {
+		float value;
+		memcpy(&value, &bits, sizeof(float));
+		double exact = std::sqrt((double) value);
+		inverseError = std::fmax(inverseError, std::fabs(fastInverseSqrt(value) * exact - 1));
+		sqrtError    = std::fmax(sqrtError,    std::fabs(fastSqrt(value) / exact - 1));
+	}
+	std::cout << "scalars" << std::endl;
+	bool pass = report("  fastInverseSqrt: ", inverseError, BOUND);
+	pass &=     report("  fastSqrt:        ", sqrtError,    BOUND);
+
+	std::mt19937 random(45);
+	pass &= checkVectors<2>("GenoVector2f", random);
+	pass &= checkVectors<3>("GenoVector3f", random);
+	pass &= checkVectors<4>("GenoVector4f", random);
+
+	std::vector<GenoVector2f> vectors(NUM_VECTORS);
+	std::vector<GenoVector2f> targets(NUM_VECTORS);
+	std::uniform_real_distribution<float> component(1, 100);
+	for (auto & vector : vectors)
+		vector = { component(random), component(random) };
+
+	run("normalize, exact: ", [&]() {
+		for (uint32 i = 0; i < NUM_VECTORS; ++i)
+			normalize(vectors[i], targets[i]);
+		GenoBench::keep(targets[0]);
+	});
+	run("normalize, fast:  ", [&]() {
+		for (uint32 i = 0; i < NUM_VECTORS; ++i)
+			fastNormalize(vectors[i], targets[i]);
+		GenoBench::keep(targets[0]);
+	});
+	run("setLength, exact: ", [&]() {
+		for (uint32 i = 0; i < NUM_VECTORS; ++i)
+			setLength(vectors[i], 15.0f, targets[i]);
+		GenoBench::keep(targets[0]);
+	});
+	run("setLength, fast:  ", [&]() {
+		for (uint32 i = 0; i < NUM_VECTORS; ++i)
+			fastSetLength(vectors[i], 15.0f, targets[i]);
+		GenoBench::keep(targets[0]);
+	});
+
+	return pass ? 0 : 1;
+}
@@ -0,0 +1,101 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Paces a frame loop to fixed frame boundaries at 144 and 240 Hz, once by sleeping for the remaining time as
+ * GenoTime did and once with GenoPacer, and reports how far past each boundary the loop woke up
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/FramePacingBench.cpp src/geno/thread/GenoPacer.cpp -lpthread
+**/
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <chrono>
+
+#include "../geno/thread/GenoPacer.h"
+
+#include "GenoBench.h"
+
+const uint32 FRAME_COUNT = 1000;
+const uint32 FRAME_WORK  = 100000;
+
+void sleepRelative(uint64 deadline) {
+	uint64 now = GenoPacer::getTicks();
+	if (deadline > now)
+		std::this_thread::sleep_for(std::chrono::nanoseconds(deadline - now));
+}
+
+/** Returns how late each frame woke in nanoseconds, or -1 if one woke before its boundary **/
+std::vector<int64> measure(double fps, void (*sleepUntil)(uint64)) {
+	std::vector<int64> lateness;
+	uint64 period = (uint64) (1000000000 / fps);
+	uint64 deadline = GenoPacer::getTicks() + period;
+	for (uint32 i = 0; i < FRAME_COUNT; ++i, deadline += period) {
+		uint32 value = 1;
+		for (uint32 j = 0; j < FRAME_WORK; ++j)
+			value = value * 1664525 + 1013904223;
+		GenoBench::keep(value);
+
+		sleepUntil(deadline);
+		int64 late = (int64) (GenoPacer::getTicks() - deadline);
+		lateness.push_back(late < 0 ? -1 : late);
+		// A frame that overran its boundary starts the next one from now instead of bursting to catch up
+		uint64 now = GenoPacer::getTicks();
+		if (now > deadline + period)
+			deadline = now;
+	}
+	return lateness;
+}
+
+bool report(const char * name, std::vector<int64> & samples) {
+	std::sort(samples.begin(), samples.end());
+	if (samples.front() < 0) {
+		std::cout << "INVALID: " << name << " woke before the frame boundary" << std::endl;
+		return false;
+	}
+	std::cout << "  " << name
+	          << " p50 " << samples[samples.size() / 2] / 1000.0
+	          << " us, p99 " << samples[samples.size() * 99 / 100] / 1000.0
+	          << " us, p99.9 " << samples[samples.size() * 999 / 1000] / 1000.0
+	          << " us, max " << samples.back() / 1000.0 << " us" << std::endl;
+	return true;
+}
+
+int32 main() {
+	double rates[] = { 144, 240 };
+	bool valid = true;
+	for (double fps : rates) {
+		std::cout << fps << " Hz, lateness past the frame boundary:" << std::endl;
+		auto relative = measure(fps, sleepRelative);
+		auto paced = measure(fps, GenoPacer::sleepUntil);
+		valid = report("relative sleep_for:", relative) && valid;
+		valid = report("GenoPacer:         ", paced) && valid;
+		std::cout << "  calibrated spin margin " << GenoPacer::getMargin() / 1000.0 << " us" << std::endl;
+	}
+	return valid ? 0 : 1;
+}
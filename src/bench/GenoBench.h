@@ -0,0 +1,63 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_BENCH
+#define GNARLY_BENCH
+
+#include "../geno/GenoInts.h"
+
+/**
+ * Shared helpers for the standalone benchmark programs in src/bench
+ *
+ * Linking GenoBench.cpp replaces the global operator new / delete so that every heap allocation made by the
+ * program is counted
+**/
+class GenoBench final {
+	public:
+
+		/**
+		 * Returns the number of heap allocations made since the program started
+		**/
+		static uint64 getAllocations();
+
+		/**
+		 * Returns a monotonic timestamp in nanoseconds
+		**/
+		static uint64 getTime();
+
+		/**
+		 * Prevents the optimizer from discarding a value that is computed but never used
+		 *
+		 * @param value - The value to keep alive
+		**/
+		template <typename T>
+		static void keep(const T & value) {
+			asm volatile("" : : "r"(&value) : "memory");
+		}
+};
+
+#define GNARLY_BENCH_FORWARD
+#endif // GNARLY_BENCH
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Runs a decode -> pad -> upload frame, 8 wide with the upload on the main thread, as three barrier separated
+ * GenoThreadPool stages and as one GenoJobGraph submitted every frame. Also checks ordering, reruns without heap
+ * allocations and cancellation
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/JobGraphBench.cpp src/geno/thread/GenoThreadPool.cpp src/geno/thread/GenoJobGraph.cpp -lpthread
+**/
+
+#include <iostream>
+#include <thread>
+#include <atomic>
+
+#include "../geno/thread/GenoThreadPool.h"
+#include "../geno/thread/GenoJobGraph.h"
+
+#include "GenoBench.h"
+
+const uint32 WIDTH  = 8;
+const uint32 FRAMES = 2000;
+
+struct Asset {
+	std::atomic<uint32> stage;
+	bool valid;
+	uint64 value;
+};
+
+Asset assets[WIDTH];
+std::thread::id mainThread;
+
+void work(Asset & asset, uint32 stage) {
+	asset.valid = asset.valid && asset.stage.load() == stage;
+	for (uint32 i = 0; i < 2000; ++i)
+		asset.value = asset.value * 6364136223846793005 + 1442695040888963407;
+	asset.stage.store(stage + 1);
+}
+
+void decode(GenoThreadPoolJobData data) {
+	work(*(Asset *) data, 0);
+}
+
+void pad(GenoThreadPoolJobData data) {
+	work(*(Asset *) data, 1);
+}
+
+void upload(GenoThreadPoolJobData) {
+	for (uint32 i = 0; i < WIDTH; ++i) {
+		assets[i].valid = assets[i].valid && std::this_thread::get_id() == mainThread;
+		work(assets[i], 2);
+	}
+}
+
+void reset() {
+	for (uint32 i = 0; i < WIDTH; ++i)
+		assets[i].stage.store(0);
+}
+
+template <typename Function>
+void run(const char * name, Function function) {
+	for (uint32 i = 0; i < WIDTH; ++i)
+		assets[i].valid = true;
+	auto allocations = GenoBench::getAllocations();
+	auto begin = GenoBench::getTime();
+	for (uint32 i = 0; i < FRAMES; ++i) {
+		reset();
+		function();
+	}
+	auto end = GenoBench::getTime();
+	bool valid = true;
+	for (uint32 i = 0; i < WIDTH; ++i)
+		valid = valid && assets[i].valid && assets[i].stage.load() == 3;
+	std::cout << name << (double) (end - begin) / FRAMES / 1000 << " us/frame, "
+	          << (double) (GenoBench::getAllocations() - allocations) / FRAMES << " allocations/frame"
+	          << (valid ? "" : " INVALID") << std::endl;
+}
+
+int32 main() {
+	mainThread = std::this_thread::get_id();
+	GenoThreadPool pool(4);
+
+	GenoJobGraph graph(&pool);
+	auto uploadNode = graph.addJob(upload, 0, true);
+	for (uint32 i = 0; i < WIDTH; ++i)
+		graph.addDependency(graph.then(graph.addJob(decode, &assets[i]), pad, &assets[i]), uploadNode);
+
+	run("barriers:  ", [&]() {
+		for (uint32 i = 0; i < WIDTH; ++i)
+			pool.submitJob(decode, &assets[i]);
+		pool.wait();
+		for (uint32 i = 0; i < WIDTH; ++i)
+			pool.submitJob(pad, &assets[i]);
+		pool.wait();
+		upload(0);
+	});
+	run("job graph: ", [&]() {
+		graph.submit();
+		graph.wait();
+	});
+
+	reset();
+	graph.submit();
+	graph.cancel();
+	graph.wait();
+	uint32 skipped = 0;
+	for (uint32 i = 0; i < WIDTH; ++i)
+		skipped += assets[i].stage.load() < 3;
+	std::cout << "cancelled: " << skipped << " of " << WIDTH << " assets skipped the upload" << std::endl;
+	return 0;
+}
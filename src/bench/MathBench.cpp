@@ -0,0 +1,263 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Microbenchmarks for the math layer: GenoVector2/3/4 arithmetic, GenoMatrix4 multiply, translate and scale,
+ * and the generic GenoVector / GenoMatrixN operations
+ *
+ * Every operation reports its median ns/op over several repetitions, heap allocations/op and bytes written to std::cout
+ * per op, then gets compared against a saved baseline. Allocating or printing more than the baseline is a hidden cost
+ * and always fails the run with exit code 1. Being slower than the baseline by more than the tolerance is flagged,
+ * but timings are only as stable as the machine, so it only fails the run with --strict.
+ *
+ * Timings are compared as ratios. The baseline is first scaled by the median of this run's ns/op over the baseline's
+ * across all operations, so a baseline saved on another machine or under different load still lines up, and only
+ * operations that got slower relative to the rest are flagged.
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/MathBench.cpp src/geno/math/linear/GenoMathInstantiations.cpp
+ * Run:   MathBench [baseline path] [--save] [--strict]
+ *        the baseline defaults to src/bench/MathBench.baseline, --save overwrites it with this run, save it from a
+ *        build with exactly the flags above
+**/
+
+#include <algorithm>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdio>
+
+#include "../geno/math/linear/GenoVector.h"
+#include "../geno/math/linear/GenoVector2.h"
+#include "../geno/math/linear/GenoVector3.h"
+#include "../geno/math/linear/GenoVector4.h"
+#include "../geno/math/linear/GenoMatrix4.h"
+#include "../geno/math/linear/GenoMatrixN.h"
+
+#include "GenoBench.h"
+
+constexpr uint32 NUM_INPUTS      = 1024;
+constexpr uint32 NUM_REPETITIONS = 5;
+constexpr double TOLERANCE       = 0.25;
+
+/**
+ * Counts what gets written to a stream without storing it
+**/
+class CountingBuffer : public std::streambuf {
+	public:
+		uint64 count = 0;
+	protected:
+		int_type overflow(int_type character) override {
+			++count;
+			return character;
+		}
+
+		std::streamsize xsputn(const char *, std::streamsize length) override {
+			count += length;
+			return length;
+		}
+};
+
+struct Result {
+	std::string name;
+	double nanoseconds;
+	double allocations;
+	double output;
+};
+
+std::vector<Result> results;
+
+template <typename Function>
+void run(const char * name, uint32 iterations, Function function) {
+	for (uint32 i = 0; i < iterations / 16; ++i)
+		function(i % NUM_INPUTS);
+
+	CountingBuffer counter;
+	auto output = std::cout.rdbuf(&counter);
+	auto allocations = GenoBench::getAllocations();
+	uint64 times[NUM_REPETITIONS];
+	for (uint32 i = 0; i < NUM_REPETITIONS; ++i) {
+		auto begin = GenoBench::getTime();
+		for (uint32 j = 0; j < iterations; ++j)
+			function(j % NUM_INPUTS);
+		times[i] = GenoBench::getTime() - begin;
+	}
+	std::sort(times, times + NUM_REPETITIONS);
+	allocations = GenoBench::getAllocations() - allocations;
+	std::cout.rdbuf(output);
+
+	results.push_back({
+		name,
+		(double) times[NUM_REPETITIONS / 2] / iterations,
+		(double) allocations / ((uint64) iterations * NUM_REPETITIONS),
+		(double) counter.count / ((uint64) iterations * NUM_REPETITIONS)
+	});
+}
+
+template <typename T>
+T randomRange(T min, T max) {
+	return min + (max - min) * (T) rand() / (T) RAND_MAX;
+}
+
+int32 main(int32 argc, char ** argv) {
+	const char * baselinePath = "src/bench/MathBench.baseline";
+	bool save   = false;
+	bool strict = false;
+	for (int32 i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "--save") == 0)
+			save = true;
+		else if (strcmp(argv[i], "--strict") == 0)
+			strict = true;
+		else
+			baselinePath = argv[i];
+	}
+
+	constexpr uint32 N = 5;
+
+	std::vector<GenoVector2f> vector2s;
+	std::vector<GenoVector3f> vector3s;
+	std::vector<GenoVector4f> vector4s;
+	std::vector<GenoMatrix4f> matrix4s;
+	std::vector<GenoVector<N, float>>  vectorNs;
+	std::vector<GenoMatrixNf<N>>      matrixNs;
+	for (uint32 i = 0; i < NUM_INPUTS; ++i) {
+		vector2s.push_back({ randomRange(-8.0f, 8.0f), randomRange(-8.0f, 8.0f) });
+		vector3s.push_back({ randomRange(-8.0f, 8.0f), randomRange(-8.0f, 8.0f), randomRange(-8.0f, 8.0f) });
+		vector4s.push_back({ randomRange(-8.0f, 8.0f), randomRange(-8.0f, 8.0f), randomRange(-8.0f, 8.0f), randomRange(-8.0f, 8.0f) });
+		matrix4s.push_back(GenoMatrix4f::makeOrthographic(0, randomRange(8.0f, 64.0f), randomRange(8.0f, 64.0f), 0, 0, 1));
+		vectorNs.emplace_back();
+		matrixNs.emplace_back();
+		for (uint32 j = 0; j < N; ++j)
+			vectorNs.back().v[j] = randomRange(-8.0f, 8.0f);
+		for (uint32 j = 0; j < N * N; ++j)
+			matrixNs.back().m[j] = randomRange(-8.0f, 8.0f);
+	}
+	auto next = [](uint32 i) { return (i + 1) % NUM_INPUTS; };
+
+	run("GenoVector2f add",         10000000, [&](uint32 i) { GenoBench::keep(vector2s[i] + vector2s[next(i)]); });
+	run("GenoVector2f multiply",    10000000, [&](uint32 i) { GenoBench::keep(vector2s[i] * vector2s[next(i)]); });
+	run("GenoVector2f dot",         10000000, [&](uint32 i) { GenoBench::keep(dot(vector2s[i], vector2s[next(i)])); });
+	run("GenoVector2f normalize",   10000000, [&](uint32 i) { GenoBench::keep(normalize(vector2s[i])); });
+	run("GenoVector3f add",         10000000, [&](uint32 i) { GenoBench::keep(vector3s[i] + vector3s[next(i)]); });
+	run("GenoVector3f cross",       10000000, [&](uint32 i) { GenoBench::keep(cross(vector3s[i], vector3s[next(i)])); });
+	run("GenoVector3f normalize",   10000000, [&](uint32 i) { GenoBench::keep(normalize(vector3s[i])); });
+	run("GenoVector4f add",         10000000, [&](uint32 i) { GenoBench::keep(vector4s[i] + vector4s[next(i)]); });
+	run("GenoVector4f scale",       10000000, [&](uint32 i) { GenoBench::keep(vector4s[i] * 0.5f); });
+	run("GenoVector4f dot",         10000000, [&](uint32 i) { GenoBench::keep(dot(vector4s[i], vector4s[next(i)])); });
+
+	run("GenoMatrix4f multiply",    10000000, [&](uint32 i) { GenoBench::keep(matrix4s[i] * matrix4s[next(i)]); });
+	run("GenoMatrix4f * vector",    10000000, [&](uint32 i) { GenoBench::keep(matrix4s[i] * vector4s[i]); });
+	run("GenoMatrix4f translate2D", 10000000, [&](uint32 i) { GenoBench::keep(translate2D(matrix4s[i], vector2s[i])); });
+	run("GenoMatrix4f scale2D",     10000000, [&](uint32 i) { GenoBench::keep(scale2D(matrix4s[i], vector2s[i])); });
+	run("GenoMatrix4f mvp",         10000000, [&](uint32 i) { GenoBench::keep(translate2D(matrix4s[i], vector2s[i]).scale2D(vector2s[next(i)])); });
+
+	run("GenoVector5f copy",         1000000, [&](uint32 i) { GenoVector<N, float> copy = vectorNs[i]; GenoBench::keep(copy); });
+	run("GenoVector5f add",          1000000, [&](uint32 i) { GenoBench::keep(vectorNs[i] + vectorNs[next(i)]); });
+	run("GenoMatrixN5f add",         1000000, [&](uint32 i) { GenoBench::keep(matrixNs[i] + matrixNs[next(i)]); });
+	run("GenoMatrixN5f multiply",    1000000, [&](uint32 i) { GenoBench::keep(matrixNs[i] * matrixNs[next(i)]); });
+	run("GenoMatrixN5f * vector",    1000000, [&](uint32 i) { GenoBench::keep(matrixNs[i] * vectorNs[i]); });
+	run("GenoMatrixN5f det",          100000, [&](uint32 i) { GenoBench::keep(det(matrixNs[i])); });
+
+	std::vector<Result> baseline;
+	std::ifstream baselineFile(baselinePath);
+	std::string line;
+	while (std::getline(baselineFile, line)) {
+		auto separator = line.find('\t');
+		if (line.empty() || line[0] == '#' || separator == std::string::npos)
+			continue;
+		Result result;
+		result.name = line.substr(0, separator);
+		std::istringstream(line.substr(separator + 1)) >> result.nanoseconds >> result.allocations >> result.output;
+		baseline.push_back(result);
+	}
+
+	auto find = [](std::vector<Result> & results, const std::string & name) -> const Result * {
+		for (auto & result : results)
+			if (result.name == name)
+				return &result;
+		return 0;
+	};
+
+	// How much slower this whole run is than the baseline run, a single regressed operation barely moves the median
+	std::vector<double> ratios;
+	for (auto & result : results) {
+		const Result * previous = find(baseline, result.name);
+		if (previous != 0 && previous->nanoseconds > 0)
+			ratios.push_back(result.nanoseconds / previous->nanoseconds);
+	}
+	double speed = 1;
+	if (!ratios.empty()) {
+		std::sort(ratios.begin(), ratios.end());
+		speed = ratios[ratios.size() / 2];
+	}
+
+	bool regressed = false;
+	std::cout << "operation                      ns/op  allocs/op  cout B/op   expected ns/op" << std::endl;
+	for (auto & result : results) {
+		const Result * previous = find(baseline, result.name);
+
+		char row[160];
+		snprintf(row, sizeof(row), "%-26s %9.2f %10.2f %10.2f", result.name.c_str(), result.nanoseconds, result.allocations, result.output);
+		std::cout << row;
+		if (previous != 0) {
+			double expected = previous->nanoseconds * speed;
+			snprintf(row, sizeof(row), " %16.2f", expected);
+			std::cout << row;
+			if (result.nanoseconds > expected * (1 + TOLERANCE) + 0.5) {
+				std::cout << "  SLOWER";
+				regressed |= strict;
+			}
+			if (result.allocations > previous->allocations) {
+				std::cout << "  ALLOCATES";
+				regressed = true;
+			}
+			if (result.output > previous->output) {
+				std::cout << "  PRINTS";
+				regressed = true;
+			}
+		}
+		else if (!baseline.empty())
+			std::cout << "              new";
+		std::cout << std::endl;
+	}
+
+	if (save) {
+		std::ofstream out(baselinePath);
+		out << "# MathBench baseline: name<TAB>ns/op allocations/op cout bytes/op\n";
+		for (auto & result : results)
+			out << result.name << '\t' << result.nanoseconds << ' ' << result.allocations << ' ' << result.output << '\n';
+		std::cout << "Saved baseline to " << baselinePath << std::endl;
+		return 0;
+	}
+
+	if (baseline.empty())
+		std::cout << "No baseline at " << baselinePath << ", run with --save to record one" << std::endl;
+
+	return regressed ? 1 : 0;
+}
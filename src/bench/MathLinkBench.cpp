@@ -0,0 +1,107 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Checks that GenoMathInstantiations.cpp defines the members other translation units rely on
+ *
+ * Built without optimizations nothing is inlined, so every member called below through the extern template
+ * declarations becomes an undefined symbol that only GenoMathInstantiations.cpp can resolve. A member it fails to emit
+ * breaks the link, and wrong results fail the run with exit code 1.
+ *
+ * Build: g++ -O0 -std=c++17 -Isrc src/bench/MathLinkBench.cpp src/geno/math/linear/GenoMathInstantiations.cpp
+**/
+
+#include <iostream>
+#include <vector>
+
+#include "../geno/math/linear/GenoVector2.h"
+#include "../geno/math/linear/GenoVector3.h"
+#include "../geno/math/linear/GenoVector4.h"
+#include "../geno/math/linear/GenoMatrix4.h"
+
+template <uint32 N, typename T>
+bool checkVector(const char * name) {
+	// Constructed in place by the allocator, a plain declaration is constant initialized without calling anything
+	std::vector<GenoVector<N, T>> vectors(1);
+	GenoVector<N, T> & vector = vectors[0];
+	GenoVector<N, T> twos(2);
+	GenoVector<N, T> copy(twos);
+	GenoVector<N, T> converted(GenoVector<N, int32>(1));
+	vector = copy;
+	vector += twos;
+	vector -= converted;
+	vector *= 2;
+	vector /= 2;
+	vector.translate(twos).scale(2).scale(converted).negate().negate();
+	vector.set(vector);
+	T sum = vector.x() + vector.y() + vector[N - 1];
+	T lengthSquared = vector.getLengthSquared();
+	vector.getLength();
+	vector.fastGetLength();
+	vector.setLength(1);
+	vector.normalize();
+	vector.isZeroVector();
+
+	// Every component is ((2 + 2 - 1) * 2 / 2 + 2) * 2 = 10 before the length is touched
+	bool pass = sum == 30 && lengthSquared == 100 * N;
+	std::cout << name << (pass ? " valid" : " INVALID") << std::endl;
+	return pass;
+}
+
+template <typename T>
+bool checkMatrix(const char * name) {
+	std::vector<GenoMatrix<4, 4, T>> matrices(1);
+	GenoMatrix<4, 4, T> & matrix = matrices[0];
+	GenoMatrix<4, 4, T> identity = GenoMatrix<4, 4, T>::makeIdentity();
+	GenoMatrix<4, 4, T> copy(identity);
+	matrix = copy;
+	matrix += identity;
+	matrix -= identity;
+	matrix *= GenoMatrix<4, 4, T>::makeTranslate(1, 2, 3);
+	matrix.translate(GenoVector<3, T>(1)).translate(1, 1, 1).transpose().transpose();
+	matrix.rotateZ(0);
+	GenoMatrix<4, 4, T>::makeOrthographic(0, 1, 0, 1, 0, 1);
+
+	bool pass = matrix.m[0] == 1 && matrix.m[12] == 3 && matrix.m[13] == 4 && matrix.m[14] == 5 && matrix.m[15] == 1;
+	std::cout << name << (pass ? " valid" : " INVALID") << std::endl;
+	return pass;
+}
+
+int32 main() {
+	bool pass = checkVector<2, float >("GenoVector2f");
+	pass &=     checkVector<2, double>("GenoVector2d");
+	pass &=     checkVector<2,  int32>("GenoVector2i");
+	pass &=     checkVector<3, float >("GenoVector3f");
+	pass &=     checkVector<3, double>("GenoVector3d");
+	pass &=     checkVector<3,  int32>("GenoVector3i");
+	pass &=     checkVector<4, float >("GenoVector4f");
+	pass &=     checkVector<4, double>("GenoVector4d");
+	pass &=     checkVector<4,  int32>("GenoVector4i");
+	pass &=     checkMatrix<float >("GenoMatrix4f");
+	pass &=     checkMatrix<double>("GenoMatrix4d");
+	pass &=     checkMatrix< int32>("GenoMatrix4i");
+	return pass ? 0 : 1;
+}
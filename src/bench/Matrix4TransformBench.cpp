@@ -0,0 +1,100 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Compares transforming arrays one matrix * vector at a time against the GenoMatrix4fTransform kernels,
+ * single threaded and split across a GenoThreadPool
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/Matrix4TransformBench.cpp src/geno/math/linear/GenoMathInstantiations.cpp src/geno/math/linear/GenoMatrix4fTransform.cpp src/geno/math/linear/GenoVector2fBatch.cpp src/geno/thread/GenoThreadPool.cpp src/geno/thread/GenoParallel.cpp -lpthread
+**/
+
+#include <iostream>
+#include <vector>
+
+#include "../geno/math/linear/GenoMatrix4fTransform.h"
+#include "../geno/thread/GenoThreadPool.h"
+
+#include "GenoBench.h"
+
+template <typename Function>
+void run(const char * name, uint32 count, uint32 passes, Function function) {
+	auto begin = GenoBench::getTime();
+	for (uint32 i = 0; i < passes; ++i)
+		function();
+	auto end = GenoBench::getTime();
+	std::cout << name << (double) (end - begin) / ((uint64) passes * count) << " ns/vector" << std::endl;
+}
+
+void runSize(uint32 count, GenoThreadPool & pool) {
+	uint32 passes = 200000000 / count / 16 + 1;
+	GenoMatrix4f matrix = GenoMatrix4f::makeTranslateXY(3, 4).scaleXY(2, 3);
+
+	std::vector<GenoVector4f> vectors(count);
+	std::vector<GenoVector4f> vectorTargets(count);
+	std::vector<GenoVector2f> points(count);
+	std::vector<GenoVector2f> pointTargets(count);
+	for (uint32 i = 0; i < count; ++i) {
+		vectors[i] = { (float) i, (float) (i % 7), (float) (i % 3), 1.0f };
+		points[i]  = { (float) i, (float) (i % 7) };
+	}
+
+	std::cout << count << " vectors" << std::endl;
+	run("  vector4, per vector:  ", count, passes, [&]() {
+		for (uint32 i = 0; i < count; ++i)
+			vectorTargets[i] = matrix * vectors[i];
+		GenoBench::keep(vectorTargets[0]);
+	});
+	run("  vector4, array:       ", count, passes, [&]() {
+		transform(matrix, vectors.data(), vectorTargets.data(), count);
+		GenoBench::keep(vectorTargets[0]);
+	});
+	run("  vector4, pool:        ", count, passes, [&]() {
+		transform(matrix, vectors.data(), vectorTargets.data(), count, &pool);
+		GenoBench::keep(vectorTargets[0]);
+	});
+	run("  points 2D, per point: ", count, passes, [&]() {
+		for (uint32 i = 0; i < count; ++i) {
+			GenoVector4f point = matrix * GenoVector4f(points[i].v[0], points[i].v[1], 0, 1);
+			pointTargets[i] = { point.v[0], point.v[1] };
+		}
+		GenoBench::keep(pointTargets[0]);
+	});
+	run("  points 2D, array:     ", count, passes, [&]() {
+		transformPoints2D(matrix, points.data(), pointTargets.data(), count);
+		GenoBench::keep(pointTargets[0]);
+	});
+	run("  points 2D, pool:      ", count, passes, [&]() {
+		transformPoints2D(matrix, points.data(), pointTargets.data(), count, &pool);
+		GenoBench::keep(pointTargets[0]);
+	});
+}
+
+int32 main() {
+	GenoThreadPool pool;
+	for (uint32 count : { 1024, 65536, 1048576 })
+		runSize(count, pool);
+	return 0;
+}
@@ -0,0 +1,139 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Measures the cost of building one model-view-projection matrix the way Platform::render does:
+ * translate2D(camera->getVPMatrix(), position).scale2D(dimensions)
+ *
+ * The legacy path reproduces the previous heap backed GenoMatrix4f: a fresh 16 float allocation for the copied
+ * view-projection, another for the translated result, and scalar math throughout
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/MatrixMvpBench.cpp src/geno/math/linear/GenoMathInstantiations.cpp
+**/
+
+#include <iostream>
+
+#include "../geno/math/linear/GenoMatrix4.h"
+
+#include "GenoBench.h"
+
+struct LegacyMatrix4f {
+	float * m;
+
+	LegacyMatrix4f(float * m) :
+		m(m) {}
+
+	LegacyMatrix4f(const LegacyMatrix4f & matrix) :
+		m(new float[4 * 4]) {
+		for (uint32 i = 0; i < 16; ++i)
+			m[i] = matrix.m[i];
+	}
+
+	LegacyMatrix4f(LegacyMatrix4f && matrix) noexcept :
+		m(matrix.m) {
+		matrix.m = 0;
+	}
+
+	LegacyMatrix4f & scale2D(const GenoVector2f & scale) {
+		for (uint32 i = 0; i < 4; ++i) {
+			m[i    ] *= scale.v[0];
+			m[i + 4] *= scale.v[1];
+		}
+		return *this;
+	}
+
+	~LegacyMatrix4f() {
+		delete [] m;
+	}
+};
+
+LegacyMatrix4f legacyTranslate2D(const LegacyMatrix4f & matrix, const GenoVector2f & translate) {
+	auto m = new float[4 * 4];
+	for (uint32 i = 0; i < 12; ++i)
+		m[i] = matrix.m[i];
+	for (uint32 i = 0; i < 4; ++i)
+		m[i + 12] = matrix.m[i] * translate.v[0] + matrix.m[i + 4] * translate.v[1] + matrix.m[i + 12];
+	return m;
+}
+
+struct LegacyCamera {
+	LegacyMatrix4f projectionView;
+
+	LegacyMatrix4f getVPMatrix() {
+		return projectionView;
+	}
+};
+
+struct Camera {
+	GenoMatrix4f projectionView;
+
+	const GenoMatrix4f & getVPMatrix() const {
+		return projectionView;
+	}
+};
+
+template <typename Function>
+void run(const char * name, Function function) {
+	constexpr uint32 NUM_ITERATIONS = 10000000;
+	auto allocations = GenoBench::getAllocations();
+	auto begin = GenoBench::getTime();
+	for (uint32 i = 0; i < NUM_ITERATIONS; ++i)
+		function(i);
+	auto end = GenoBench::getTime();
+	allocations = GenoBench::getAllocations() - allocations;
+	std::cout << name << (double) (end - begin) / NUM_ITERATIONS << " ns/op, "
+	          << (double) allocations / NUM_ITERATIONS << " allocations/op" << std::endl;
+}
+
+int32 main() {
+	auto projection = GenoMatrix4f::makeOrthographic(0, 32, 18, 0, 0, 1);
+
+	LegacyCamera legacyCamera = { new float[4 * 4] };
+	for (uint32 i = 0; i < 16; ++i)
+		legacyCamera.projectionView.m[i] = projection.m[i];
+	Camera camera = { projection };
+
+	GenoVector2f dimensions = { 3.0f, 40.0f };
+
+	run("legacy mvp: ", [&](uint32 i) {
+		GenoVector2f position = { (float) (i & 31), 2.0f };
+		GenoBench::keep(legacyTranslate2D(legacyCamera.getVPMatrix(), position).scale2D(dimensions).m[0]);
+	});
+
+	run("inline mvp: ", [&](uint32 i) {
+		GenoVector2f position = { (float) (i & 31), 2.0f };
+		GenoBench::keep(translate2D(camera.getVPMatrix(), position).scale2D(dimensions).m[0]);
+	});
+
+	GenoMatrix4f view = GenoMatrix4f::makeTranslateXY(-0.25f, 0.125f);
+	GenoMatrix4f accumulated = projection;
+	run("multiply: ", [&](uint32) {
+		accumulated = accumulated * view;
+	});
+	GenoBench::keep(accumulated);
+
+	return 0;
+}
@@ -0,0 +1,160 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Compares the GenoMatrixN operations against the scalar code they replaced: multiply, matrix * vector, transpose and
+ * det. invert and solve are new and get timed on their own. 4 x 4 matrices go through GenoMatrix4 and are left out.
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/MatrixNBench.cpp src/geno/math/linear/GenoMathInstantiations.cpp
+ *        add -DGENO_NO_SIMD to time the scalar fallbacks instead of the SSE / AVX kernels
+**/
+
+#include <iostream>
+#include <vector>
+
+#include "../geno/math/linear/GenoVector.h"
+#include "../geno/math/linear/GenoVector2.h"
+#include "../geno/math/linear/GenoVector3.h"
+#include "../geno/math/linear/GenoVector4.h"
+#include "../geno/math/linear/GenoMatrixN.h"
+
+#include "GenoBench.h"
+
+constexpr uint32 NUM_MATRICES = 64;
+
+/**
+ * The previous implementations, kept here as the reference
+**/
+namespace Previous {
+	template <uint32 N>
+	GenoMatrix<N, N, float> multiply(const GenoMatrix<N, N, float> & left, const GenoMatrix<N, N, float> & right) {
+		auto product = new float[N * N];
+		for (uint32 i = 0; i < N; ++i) {
+			for (uint32 j = 0; j < N; ++j) {
+				product[j * N + i] = 0;
+				for (uint32 k = 0; k < N; ++k)
+					product[j * N + i] += left.m[k * N + i] * right.m[j * N + k];
+			}
+		}
+		return product;
+	}
+
+	template <uint32 N>
+	GenoVector<N, float> transform(const GenoMatrix<N, N, float> & matrix, const GenoVector<N, float> & vector) {
+		GenoVector<N, float> product;
+		for (uint32 i = 0; i < N; ++i) {
+			product.v[i] = 0;
+			for (uint32 j = 0; j < N; ++j)
+				product.v[i] += matrix.m[j * N + i] * vector.v[j];
+		}
+		return product;
+	}
+
+	template <uint32 N>
+	void transpose(const float * matrix, float * target) {
+		for (uint32 i = 0; i < N; ++i)
+			for (uint32 j = 0; j < N; ++j)
+				target[j * N + i] = matrix[i * N + j];
+	}
+
+	template <uint32 N>
+	float det(const GenoMatrix<N, N, float> & matrix) {
+		if constexpr (N == 2)
+			return matrix.m[0] * matrix.m[3] - matrix.m[2] * matrix.m[1];
+		else {
+			auto ret  = 0.0f;
+			auto sign = 1.0f;
+			GenoMatrix<N - 1, N - 1, float> storage;
+			for (uint32 i = 0; i < N; ++i) {
+				auto offset = uint32( -1 );
+				for (uint32 j = 0; j < N * N; ++j)
+					if (j % N != 0 && j / N != i)
+						storage.m[++offset] = matrix.m[j];
+				ret  += sign * matrix.m[i * N] * det<N - 1>(storage);
+				sign *= -1;
+			}
+			return ret;
+		}
+	}
+}
+
+template <typename Function>
+double time(uint32 passes, Function function) {
+	auto begin = GenoBench::getTime();
+	for (uint32 i = 0; i < passes; ++i)
+		for (uint32 j = 0; j < NUM_MATRICES; ++j)
+			function(j);
+	auto end = GenoBench::getTime();
+	return (double) (end - begin) / ((uint64) passes * NUM_MATRICES);
+}
+
+void report(const char * name, double previous, double current) {
+	std::cout << "  " << name << previous << " ns -> " << current << " ns" << std::endl;
+}
+
+template <uint32 N>
+void runSize() {
+	uint32 passes = 20000 / (N * N);
+	std::vector<GenoMatrix<N, N, float>> matrices(NUM_MATRICES);
+	std::vector<GenoVector<N, float>> vectors(NUM_MATRICES);
+	for (uint32 j = 0; j < NUM_MATRICES; ++j) {
+		for (uint32 i = 0; i < N * N; ++i)
+			matrices[j].m[i] = (float) ((i * 7 + j * 13) % 17) - 8 + (i % (N + 1) == 0 ? N * 4 : 0);
+		for (uint32 i = 0; i < N; ++i)
+			vectors[j].v[i] = (float) (i + j % 5);
+	}
+	GenoMatrix<N, N, float> product;
+
+	std::cout << "N = " << N << std::endl;
+	report("multiply:  ",
+		time(passes, [&](uint32 j) { GenoBench::keep(Previous::multiply<N>(matrices[j], matrices[(j + 1) % NUM_MATRICES])); }),
+		time(passes, [&](uint32 j) { GenoBench::keep(matrices[j] * matrices[(j + 1) % NUM_MATRICES]); })
+	);
+	report("transform: ",
+		time(passes, [&](uint32 j) { GenoBench::keep(Previous::transform<N>(matrices[j], vectors[j])); }),
+		time(passes, [&](uint32 j) { GenoBench::keep(matrices[j] * vectors[j]); })
+	);
+	report("transpose: ",
+		time(passes, [&](uint32 j) { Previous::transpose<N>(matrices[j].m, product.m); GenoBench::keep(product.m[0]); }),
+		time(passes, [&](uint32 j) { GenoBench::keep(transpose(matrices[j], product)); })
+	);
+	report("det:       ",
+		time(passes / (N > 6 ? 50 : 1) + 1, [&](uint32 j) { GenoBench::keep(Previous::det<N>(matrices[j])); }),
+		time(passes, [&](uint32 j) { GenoBench::keep(det(matrices[j])); })
+	);
+	std::cout << "  invert:    " << time(passes, [&](uint32 j) { GenoBench::keep(invert(matrices[j], product)); }) << " ns" << std::endl;
+	std::cout << "  solve:     " << time(passes, [&](uint32 j) { GenoBench::keep(solve(matrices[j], vectors[j])); }) << " ns" << std::endl;
+}
+
+int32 main() {
+	runSize<2>();
+	runSize<3>();
+	runSize<5>();
+	runSize<6>();
+	runSize<7>();
+	runSize<8>();
+	return 0;
+}
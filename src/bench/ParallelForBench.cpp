@@ -0,0 +1,185 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Times parallelFor, parallelForRange and parallelReduce against plain loops on the workloads that motivated them: an
+ * RGBA fill as in GenoImage::create, the per row sprite padding of GenoSpritesheet::create and a float sum. Results
+ * are compared with the serial loops and a mismatch fails the run with exit code 1.
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/ParallelForBench.cpp src/geno/thread/GenoThreadPool.cpp src/geno/thread/GenoParallel.cpp -lpthread
+**/
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <atomic>
+
+#include "../geno/thread/GenoThreadPool.h"
+#include "../geno/thread/GenoParallel.h"
+
+#include "GenoBench.h"
+
+const uint32 PASSES = 20;
+
+template <typename Function>
+uint64 time(Function function) {
+	auto begin = GenoBench::getTime();
+	for (uint32 i = 0; i < PASSES; ++i)
+		function();
+	return (GenoBench::getTime() - begin) / PASSES;
+}
+
+void report(const char * name, uint64 serial, uint64 parallel) {
+	std::cout << name << serial / 1000.0 << " us serial, " << parallel / 1000.0 << " us parallel, "
+	          << (double) serial / parallel << "x" << std::endl;
+}
+
+void pad(const uint8 * data, uint8 * padded, uint32 i, uint32 numSpritesX, uint32 width, uint32 height) {
+	uint32 padWidth     = width  + 2;
+	uint32 padHeight    = height + 2;
+	uint32 fullWidth    = width * numSpritesX;
+	uint32 fullPadWidth = padWidth * numSpritesX;
+	uint32 sprite  = i / padHeight;
+	uint32 pixelY  = i % padHeight;
+	uint32 spriteX = sprite % numSpritesX;
+	uint32 spriteY = sprite / numSpritesX;
+	uint32 targetY = pixelY == padHeight - 1 ? pixelY - 2 : (pixelY > 0 ? pixelY - 1 : 0);
+	for (uint32 pixelX = 0; pixelX < padWidth; ++pixelX) {
+		uint32 targetX = pixelX == padWidth - 1 ? pixelX - 2 : (pixelX > 0 ? pixelX - 1 : 0);
+		uint32 writeIndex = ((pixelY  + padHeight * spriteY) * fullPadWidth + pixelX  + padWidth * spriteX) * 4;
+		uint32 readIndex  = ((targetY + height    * spriteY) * fullWidth    + targetX + width    * spriteX) * 4;
+		memcpy(padded + writeIndex, data + readIndex, 4);
+	}
+}
+
+int32 main() {
+	GenoThreadPool pool;
+	bool valid = true;
+	std::cout << pool.getNumThreads() << " pool threads" << std::endl;
+
+	// A 4096 x 4096 RGBA fill
+	uint32 numPixels = 4096 * 4096;
+	std::vector<uint8> serialImage(numPixels * 4);
+	std::vector<uint8> parallelImage(numPixels * 4);
+	auto serial = time([&]() {
+		uint8 * image = serialImage.data();
+		for (uint32 i = 0; i < numPixels; ++i) {
+			image[i * 4    ] = 1;
+			image[i * 4 + 1] = 2;
+			image[i * 4 + 2] = 3;
+			image[i * 4 + 3] = 4;
+		}
+	});
+	auto parallel = time([&]() {
+		uint8 * image = parallelImage.data();
+		parallelFor(&pool, 0, numPixels, 0, [image](uint32 i) {
+			image[i * 4    ] = 1;
+			image[i * 4 + 1] = 2;
+			image[i * 4 + 2] = 3;
+			image[i * 4 + 3] = 4;
+		});
+	});
+	valid = valid && serialImage == parallelImage;
+	report("RGBA fill 4096^2:        ", serial, parallel);
+
+	// A single worker runs the range inline instead of paying for the handoff
+	GenoThreadPool singlePool(1);
+	std::fill(parallelImage.begin(), parallelImage.end(), 0);
+	parallel = time([&]() {
+		uint8 * image = parallelImage.data();
+		parallelFor(&singlePool, 0, numPixels, 0, [image](uint32 i) {
+			image[i * 4    ] = 1;
+			image[i * 4 + 1] = 2;
+			image[i * 4 + 2] = 3;
+			image[i * 4 + 3] = 4;
+		});
+	});
+	valid = valid && serialImage == parallelImage;
+	report("RGBA fill on 1 worker:   ", serial, parallel);
+
+	// An 8 x 2 sheet of 512 x 1024 sprites padded by a pixel
+	uint32 numSpritesX = 8;
+	uint32 numSpritesY = 2;
+	uint32 width       = 512;
+	uint32 height      = 1024;
+	uint32 numRows     = numSpritesX * numSpritesY * (height + 2);
+	std::vector<uint8> padded((width + 2) * (height + 2) * numSpritesX * numSpritesY * 4);
+	std::vector<uint8> parallelPadded(padded.size());
+	serial = time([&]() {
+		for (uint32 i = 0; i < numRows; ++i)
+			pad(serialImage.data(), padded.data(), i, numSpritesX, width, height);
+	});
+	parallel = time([&]() {
+		parallelFor(&pool, 0, numRows, 8, [&](uint32 i) {
+			pad(serialImage.data(), parallelPadded.data(), i, numSpritesX, width, height);
+		});
+	});
+	valid = valid && padded == parallelPadded;
+	report("sprite padding 8x2 sheet:", serial, parallel);
+
+	// A float sum, the chunked result has to match itself across thread counts
+	uint32 count = 1 << 24;
+	std::vector<float> values(count);
+	for (uint32 i = 0; i < count; ++i)
+		values[i] = (float) (i % 1000) * 0.001f;
+	float serialSum = 0;
+	float parallelSum = 0;
+	serial = time([&]() {
+		float sum = 0;
+		for (uint32 i = 0; i < count; ++i)
+			sum += values[i];
+		serialSum = sum;
+	});
+	parallel = time([&]() {
+		parallelSum = parallelReduce(&pool, 0, count, 65536, 0.0f, [&](uint32 i) { return values[i]; }, [](float left, float right) { return left + right; });
+	});
+	float singleSum = parallelReduce(&singlePool, 0, count, 65536, 0.0f, [&](uint32 i) { return values[i]; }, [](float left, float right) { return left + right; });
+	valid = valid && parallelSum == singleSum;
+	report("float sum 16M:           ", serial, parallel);
+	std::cout << "  sums: serial " << serialSum << ", chunked " << parallelSum << ", chunked on 1 thread " << singleSum << std::endl;
+
+	// Ranges that split into uneven and empty looking tails
+	for (uint32 end : { 0, 1, 5, 257, 1000, 100001 }) {
+		std::vector<uint32> hits(end);
+		std::atomic<uint32> emptyChunks(0);
+		parallelForRange(&pool, 0, end, 3, [&](uint32 begin, uint32 end) {
+			if (begin >= end)
+				++emptyChunks;
+			for (uint32 i = begin; i < end; ++i)
+				++hits[i];
+		});
+		valid = valid && emptyChunks.load() == 0;
+		for (uint32 hit : hits)
+			valid = valid && hit == 1;
+		uint64 sum = parallelReduce(&pool, 0, end, 7, (uint64) 0, [](uint32 i) { return (uint64) i; }, [](uint64 left, uint64 right) { return left + right; });
+		valid = valid && sum == (uint64) end * (end == 0 ? 0 : end - 1) / 2;
+	}
+
+	if (!valid)
+		std::cout << "INVALID results" << std::endl;
+	return valid ? 0 : 1;
+}
@@ -0,0 +1,169 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Measures what a GENO_PROFILE_ZONE costs on the calling thread, then records zones from GenoThreadPool workers
+ * and the main thread, dumps them and checks the trace holds every thread and zone. Then dumps repeatedly while another
+ * thread records and checks no zone was torn by the overwrite
+ *
+ * Build: g++ -O2 -std=c++17 -DGENO_PROFILE -Isrc src/bench/GenoBench.cpp src/bench/ProfilerBench.cpp src/geno/thread/GenoProfiler.cpp src/geno/thread/GenoPacer.cpp src/geno/thread/GenoThreadPool.cpp -lpthread
+ * Run:   ProfilerBench [trace path]
+ *        the trace defaults to ProfilerBench.json in the system temp directory
+**/
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+
+#include "../geno/thread/GenoProfiler.h"
+#include "../geno/thread/GenoThreadPool.h"
+
+#include "GenoBench.h"
+
+const uint32 ZONE_COUNT = 10000000;
+const uint32 JOB_COUNT  = 1000;
+const uint32 DUMP_COUNT = 50;
+
+void job(GenoThreadPoolJobData) {
+	GENO_PROFILE_ZONE("bench job");
+	uint32 value = 1;
+	for (uint32 i = 0; i < 1000; ++i)
+		value = value * 1664525 + 1013904223;
+	GenoBench::keep(value);
+}
+
+std::string read(const char * path) {
+	std::ifstream file(path);
+	std::stringstream stream;
+	stream << file.rdbuf();
+	return stream.str();
+}
+
+uint32 count(const std::string & text, const std::string & pattern) {
+	uint32 found = 0;
+	for (size_t at = text.find(pattern); at != std::string::npos; at = text.find(pattern, at + 1))
+		++found;
+	return found;
+}
+
+int32 main(int32 argc, char ** argv) {
+#if !defined(GENO_PROFILE)
+	std::cout << "INVALID: build with -DGENO_PROFILE" << std::endl;
+	return 1;
+#endif
+	std::string defaultPath = (std::filesystem::temp_directory_path() / "ProfilerBench.json").string();
+	const char * path = argc > 1 ? argv[1] : defaultPath.c_str();
+	uint64 benchStart = GenoBench::getTime();
+
+	uint64 start = GenoBench::getTime();
+	for (uint32 i = 0; i < ZONE_COUNT; ++i)
+		GenoBench::keep(i);
+	uint64 empty = GenoBench::getTime() - start;
+
+	GENO_PROFILE_THREAD("bench main");
+	uint64 allocations = GenoBench::getAllocations();
+	start = GenoBench::getTime();
+	for (uint32 i = 0; i < ZONE_COUNT; ++i) {
+		GENO_PROFILE_ZONE("bench zone");
+		GenoBench::keep(i);
+	}
+	uint64 zoned = GenoBench::getTime() - start;
+
+	// A zone reads the timestamp twice, on virtual machines that read alone can cost more than the rest of the zone
+	uint64 sum = 0;
+	start = GenoBench::getTime();
+	for (uint32 i = 0; i < ZONE_COUNT; ++i)
+		sum += GenoProfiler::getTicks();
+	GenoBench::keep(sum);
+	uint64 ticks = GenoBench::getTime() - start;
+
+	std::cout << "ns per zone: " << (double) (zoned - empty) / ZONE_COUNT
+	          << " (timestamp reads " << 2.0 * (ticks - empty) / ZONE_COUNT << ")"
+	          << ", allocations while recording: " << GenoBench::getAllocations() - allocations << std::endl;
+
+	GenoThreadPoolCreateInfo poolInfo = {};
+	poolInfo.numThreads           = 4;
+	poolInfo.initialQueueCapacity = 16;
+	poolInfo.name                 = "bench worker";
+	GenoThreadPool * pool = new GenoThreadPool(poolInfo);
+	for (uint32 i = 0; i < JOB_COUNT; ++i)
+		pool->submitJob(job);
+	pool->wait();
+	delete pool;
+
+	start = GenoBench::getTime();
+	if (!GenoProfiler::dump(path)) {
+		std::cout << "INVALID: could not write " << path << std::endl;
+		return 1;
+	}
+	std::cout << "dumped in " << (GenoBench::getTime() - start) / 1000000.0 << " ms to " << path << std::endl;
+
+	std::string trace = read(path);
+
+	uint32 mainZones   = count(trace, "\"name\":\"bench zone\"");
+	uint32 jobZones    = count(trace, "\"name\":\"bench job\"");
+	uint32 poolZones   = count(trace, "\"name\":\"GenoThreadPool job\"");
+	uint32 workerNames = count(trace, "\"name\":\"bench worker ");
+	std::cout << mainZones << " main thread zones kept, " << jobZones << " job zones inside " << poolZones
+	          << " pool zones, " << workerNames << " named workers" << std::endl;
+	// The main thread overflowed its ring and keeps only the newest zones
+	if (trace.rfind("{\"displayTimeUnit\"", 0) != 0 || trace.find("]}") == std::string::npos
+		|| mainZones == 0 || mainZones >= ZONE_COUNT || jobZones != JOB_COUNT || poolZones != JOB_COUNT || workerNames != 4) {
+		std::cout << "INVALID: trace is missing zones or threads" << std::endl;
+		return 1;
+	}
+
+	// A zone mixing a new start with an old end wraps to a duration longer than the whole run
+	std::atomic<bool> recording(true);
+	std::thread writer([&recording]() {
+		GENO_PROFILE_THREAD("bench writer");
+		while (recording.load(std::memory_order_relaxed)) {
+			GENO_PROFILE_ZONE("bench torn");
+		}
+	});
+	uint32 torn = 0;
+	for (uint32 i = 0; i < DUMP_COUNT; ++i) {
+		GenoProfiler::dump(path);
+		double runMicros = (GenoBench::getTime() - benchStart) / 1000.0;
+		trace = read(path);
+		for (size_t at = trace.find("\"dur\":"); at != std::string::npos; at = trace.find("\"dur\":", at + 1))
+			if (std::strtod(trace.c_str() + at + 6, 0) > runMicros)
+				++torn;
+	}
+	recording.store(false, std::memory_order_relaxed);
+	writer.join();
+	std::cout << torn << " torn zones in " << DUMP_COUNT << " dumps while recording" << std::endl;
+	if (torn != 0) {
+		std::cout << "INVALID: a dump kept a zone overwritten while copying it" << std::endl;
+		return 1;
+	}
+	return 0;
+}
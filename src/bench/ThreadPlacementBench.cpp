@@ -0,0 +1,119 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Measures main thread frame time jitter while a GenoThreadPool is saturated with background work, first with
+ * default workers and then with named, lower priority workers kept off a reserved core
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/ThreadPlacementBench.cpp src/geno/thread/GenoThreadPool.cpp -lpthread
+**/
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+
+#include "../geno/thread/GenoThreadPool.h"
+
+#include "GenoBench.h"
+
+const uint32 FRAME_COUNT     = 300;
+const uint32 FRAME_WORK      = 200000;
+const uint32 LOAD_PER_THREAD = 2;
+
+std::atomic_bool loading;
+
+/** Stands in for asset decoding, spins until the frames are done **/
+void loadJob(GenoThreadPoolJobData) {
+	volatile uint32 sink = 0;
+	while (loading.load(std::memory_order_relaxed))
+		for (uint32 i = 0; i < 1000; ++i)
+			sink = sink + i;
+}
+
+/** Stands in for one frame of game logic and rendering, always the same amount of work **/
+uint64 frame() {
+	uint64 start = GenoBench::getTime();
+	uint32 value = 1;
+	for (uint32 i = 0; i < FRAME_WORK; ++i)
+		value = value * 1664525 + 1013904223;
+	GenoBench::keep(value);
+	return GenoBench::getTime() - start;
+}
+
+void report(const char * name, std::vector<uint64> & samples) {
+	std::sort(samples.begin(), samples.end());
+	uint64 p50 = samples[samples.size() / 2];
+	uint64 p99 = samples[samples.size() * 99 / 100];
+	std::cout << "  " << name
+	          << " p50 " << p50 / 1000.0
+	          << " us, p99 " << p99 / 1000.0
+	          << " us, max " << samples.back() / 1000.0
+	          << " us, p99 - p50 " << (p99 - p50) / 1000.0 << " us" << std::endl;
+}
+
+std::vector<uint64> measure(const GenoThreadPoolCreateInfo * info) {
+	std::vector<uint64> samples;
+	GenoThreadPool * pool = 0;
+	if (info != 0) {
+		pool = new GenoThreadPool(*info);
+		loading.store(true);
+		for (uint32 i = 0; i < info->numThreads * LOAD_PER_THREAD; ++i)
+			pool->submitJob(loadJob);
+	}
+	for (uint32 i = 0; i < FRAME_COUNT; ++i)
+		samples.push_back(frame());
+	if (pool != 0) {
+		loading.store(false);
+		delete pool;
+	}
+	return samples;
+}
+
+int32 main() {
+	uint32 numCores = GenoThreadPool::physicalThreadCount();
+	uint32 numThreads = numCores > 1 ? numCores : 2;
+	std::cout << numCores << " cores, " << numThreads << " loading workers" << std::endl;
+
+	GenoThreadPoolCreateInfo defaultInfo = {};
+	defaultInfo.numThreads           = numThreads;
+	defaultInfo.initialQueueCapacity = 16;
+
+	GenoThreadPoolCreateInfo placedInfo = defaultInfo;
+	placedInfo.name          = "asset loader";
+	placedInfo.reservedCores = 1;
+	placedInfo.pinThreads    = true;
+	placedInfo.background    = true;
+
+	auto idle = measure(0);
+	auto busyDefault = measure(&defaultInfo);
+	auto busyPlaced = measure(&placedInfo);
+
+	report("idle:                ", idle);
+	report("default workers:     ", busyDefault);
+	report("background, reserved:", busyPlaced);
+	return 0;
+}
@@ -0,0 +1,183 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Runs 1M tiny jobs through GenoThreadPool at increasing thread counts, submitted from the main thread and fanned out
+ * from inside jobs, next to the single mutex LIFO pool it replaced
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/ThreadPoolBench.cpp src/geno/thread/GenoThreadPool.cpp -lpthread
+**/
+
+#include <iostream>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <atomic>
+
+#include "../geno/thread/GenoThreadPool.h"
+
+#include "GenoBench.h"
+
+const uint32 JOB_COUNT = 1000000;
+const uint32 FAN_OUT   = 1000;
+
+namespace Previous {
+	class GenoThreadPool {
+		private:
+			struct GenoThreadPoolJobPackage {
+				GenoThreadPoolJob job;
+				GenoThreadPoolJobData data;
+			};
+
+			std::atomic_bool isActive;
+			uint32 numThreads;
+			std::mutex jobMutex;
+			std::vector<std::thread> threads;
+			std::vector<GenoThreadPoolJobPackage> jobs;
+			uint32 activeThreads;
+
+			static void threadLoop(GenoThreadPool * pool) {
+				while (pool->isActive.load()) {
+					GenoThreadPoolJobPackage job;
+					bool found = false;
+					{
+						std::lock_guard<std::mutex> lock(pool->jobMutex);
+						if (pool->jobs.size() > 0) {
+							job = pool->jobs.back();
+							pool->jobs.pop_back();
+							++pool->activeThreads;
+							found = true;
+						}
+					}
+					if (found) {
+						job.job(job.data);
+						std::lock_guard<std::mutex> lock(pool->jobMutex);
+						--pool->activeThreads;
+					}
+					else
+						std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(1));
+				}
+			}
+
+		public:
+			GenoThreadPool(uint32 numThreads) :
+				isActive(true),
+				numThreads(numThreads),
+				activeThreads(0) {
+				for (uint32 i = 0; i < numThreads; ++i)
+					threads.emplace_back(threadLoop, this);
+			}
+
+			void submitJob(GenoThreadPoolJob job, GenoThreadPoolJobData data = 0) {
+				std::lock_guard<std::mutex> lock(jobMutex);
+				jobs.push_back({ job, data });
+			}
+
+			void wait() {
+				bool busy = true;
+				while (busy) {
+					{
+						std::lock_guard<std::mutex> lock(jobMutex);
+						busy = jobs.size() > 0 || activeThreads > 0;
+					}
+					if (busy)
+						std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(1));
+				}
+			}
+
+			~GenoThreadPool() {
+				isActive.store(false);
+				for (auto & thread : threads)
+					thread.join();
+			}
+	};
+}
+
+std::vector<uint32> counters(JOB_COUNT);
+
+void tinyJob(GenoThreadPoolJobData data) {
+	++*(uint32 *) data;
+}
+
+template <typename Pool>
+struct FanOut {
+	Pool * pool;
+	uint32 begin;
+	uint32 end;
+};
+
+template <typename Pool>
+void fanOutJob(GenoThreadPoolJobData data) {
+	auto & fanOut = *(FanOut<Pool> *) data;
+	for (uint32 i = fanOut.begin; i < fanOut.end; ++i)
+		fanOut.pool->submitJob(tinyJob, &counters[i]);
+}
+
+bool verify() {
+	bool valid = true;
+	for (uint32 & counter : counters) {
+		valid = valid && counter == 1;
+		counter = 0;
+	}
+	return valid;
+}
+
+template <typename Pool>
+void runPool(const char * name, uint32 numThreads) {
+	Pool pool(numThreads);
+
+	auto begin = GenoBench::getTime();
+	for (uint32 i = 0; i < JOB_COUNT; ++i)
+		pool.submitJob(tinyJob, &counters[i]);
+	pool.wait();
+	auto end = GenoBench::getTime();
+	bool valid = verify();
+	std::cout << "  " << name << " main thread:  " << (double) JOB_COUNT * 1000 / (end - begin) << " M jobs/s" << (valid ? "" : " INVALID") << std::endl;
+
+	std::vector<FanOut<Pool>> fanOuts(JOB_COUNT / FAN_OUT);
+	begin = GenoBench::getTime();
+	for (uint32 i = 0; i < fanOuts.size(); ++i) {
+		fanOuts[i] = { &pool, i * FAN_OUT, (i + 1) * FAN_OUT };
+		pool.submitJob(fanOutJob<Pool>, &fanOuts[i]);
+	}
+	pool.wait();
+	end = GenoBench::getTime();
+	valid = verify();
+	std::cout << "  " << name << " inside jobs:  " << (double) JOB_COUNT * 1000 / (end - begin) << " M jobs/s" << (valid ? "" : " INVALID") << std::endl;
+}
+
+int32 main() {
+	uint32 maxThreads = GenoThreadPool::physicalThreadCount();
+	if (maxThreads < 4)
+		maxThreads = 4;
+	std::cout << JOB_COUNT << " jobs, " << GenoThreadPool::physicalThreadCount() << " hardware threads" << std::endl;
+	for (uint32 numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+		std::cout << numThreads << " threads" << std::endl;
+		runPool<Previous::GenoThreadPool>("mutex LIFO,   ", numThreads);
+		runPool<GenoThreadPool>          ("work stealing,", numThreads);
+	}
+	return 0;
+}
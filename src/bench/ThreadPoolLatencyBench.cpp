@@ -0,0 +1,86 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Measures GenoThreadPool wakeup latency on an idle pool: from submitJob to the job starting, and from the last job
+ * finishing to wait() returning
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/ThreadPoolLatencyBench.cpp src/geno/thread/GenoThreadPool.cpp -lpthread
+**/
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <atomic>
+
+#include "../geno/thread/GenoThreadPool.h"
+
+#include "GenoBench.h"
+
+const uint32 SAMPLE_COUNT = 500;
+
+struct Timestamps {
+	std::atomic<uint64> start;
+	std::atomic<uint64> end;
+};
+
+void timedJob(GenoThreadPoolJobData data) {
+	auto & timestamps = *(Timestamps *) data;
+	timestamps.start.store(GenoBench::getTime());
+	timestamps.end.store(GenoBench::getTime());
+}
+
+void report(const char * name, std::vector<uint64> & samples) {
+	std::sort(samples.begin(), samples.end());
+	std::cout << "  " << name
+	          << " p50 " << samples[samples.size() / 2] / 1000.0
+	          << " us, p99 " << samples[samples.size() * 99 / 100] / 1000.0
+	          << " us, max " << samples.back() / 1000.0 << " us" << std::endl;
+}
+
+int32 main() {
+	for (uint32 numThreads : { 1, 4 }) {
+		GenoThreadPool pool(numThreads);
+		std::vector<uint64> toStart;
+		std::vector<uint64> toReturn;
+		for (uint32 i = 0; i < SAMPLE_COUNT; ++i) {
+			// Give the workers time to go idle so every sample starts from a parked pool
+			std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(2));
+			Timestamps timestamps;
+			auto submitted = GenoBench::getTime();
+			pool.submitJob(timedJob, &timestamps);
+			pool.wait();
+			auto returned = GenoBench::getTime();
+			toStart.push_back(timestamps.start.load() - submitted);
+			toReturn.push_back(returned - timestamps.end.load());
+		}
+		std::cout << numThreads << " threads, " << SAMPLE_COUNT << " samples" << std::endl;
+		report("submit to start:   ", toStart);
+		report("last job to return:", toReturn);
+	}
+	return 0;
+}
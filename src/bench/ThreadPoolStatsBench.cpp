@@ -0,0 +1,125 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Runs frames of small simulation jobs next to occasional long asset loading jobs on a GenoThreadPool while another
+ * thread polls getStats(), then prints every worker's counters
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/ThreadPoolStatsBench.cpp src/geno/thread/GenoThreadPool.cpp -lpthread
+**/
+
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <atomic>
+
+#include "../geno/thread/GenoThreadPool.h"
+
+#include "GenoBench.h"
+
+const uint32 FRAME_COUNT     = 200;
+const uint32 FRAME_JOBS      = 256;
+const uint32 ASSET_INTERVAL  = 20;
+const uint64 SIMULATION_TIME = 2000;
+const uint64 ASSET_TIME      = 2000000;
+
+void spin(uint64 time) {
+	uint64 end = GenoBench::getTime() + time;
+	while (GenoBench::getTime() < end);
+}
+
+void simulationJob(GenoThreadPoolJobData) {
+	spin(SIMULATION_TIME);
+}
+
+void assetJob(GenoThreadPoolJobData) {
+	spin(ASSET_TIME);
+}
+
+void frameJob(GenoThreadPoolJobData data) {
+	auto pool = (GenoThreadPool *) data;
+	for (uint32 i = 0; i < FRAME_JOBS; ++i)
+		pool->submitJob(simulationJob);
+}
+
+int32 main() {
+	const uint32 numThreads = 4;
+	GenoThreadPool pool(numThreads);
+
+	std::atomic_bool running(true);
+	uint32 snapshots = 0;
+	uint32 maxPending = 0;
+	std::thread observer([&]() {
+		while (running.load()) {
+			GenoThreadPoolStats stats = pool.getStats();
+			maxPending = stats.pendingJobs > maxPending ? stats.pendingJobs : maxPending;
+			++snapshots;
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	});
+
+	uint64 submitted = 0;
+	uint64 start = GenoBench::getTime();
+	for (uint32 frame = 0; frame < FRAME_COUNT; ++frame) {
+		if (frame % ASSET_INTERVAL == 0) {
+			pool.submitJob(assetJob);
+			++submitted;
+		}
+		pool.submitJob(frameJob, &pool);
+		submitted += 1 + FRAME_JOBS;
+		pool.wait();
+	}
+	uint64 time = GenoBench::getTime() - start;
+	running.store(false);
+	observer.join();
+
+	GenoThreadPoolStats stats = pool.getStats();
+	std::cout << FRAME_COUNT << " frames in " << time / 1000000.0 << " ms, " << snapshots << " snapshots taken while running, at most " << maxPending << " jobs pending" << std::endl;
+	std::cout << std::fixed << std::setprecision(1);
+	std::cout << "worker      jobs   busy %   idle %   lock wait us   steals / attempts   queue depth histogram" << std::endl;
+	for (uint32 i = 0; i <= numThreads; ++i) {
+		const GenoThreadPoolWorkerStats & worker = i < numThreads ? stats.workers[i] : stats.total;
+		uint64 accounted = worker.busyTime + worker.idleTime;
+		if (i < numThreads)
+			std::cout << std::setw(6) << i;
+		else
+			std::cout << " total";
+		std::cout << std::setw(10) << worker.jobsExecuted
+		          << std::setw(9) << (accounted > 0 ? 100.0 * worker.busyTime / accounted : 0)
+		          << std::setw(9) << (accounted > 0 ? 100.0 * worker.idleTime / accounted : 0)
+		          << std::setw(15) << worker.lockWaitTime / 1000.0
+		          << std::setw(10) << worker.steals << " / " << std::setw(8) << worker.stealAttempts << "  ";
+		for (uint32 j = 0; j < GENO_THREAD_POOL_DEPTH_BUCKETS; ++j)
+			std::cout << ' ' << worker.queueDepths[j];
+		std::cout << std::endl;
+	}
+
+	if (stats.total.jobsExecuted + stats.helpedJobs != submitted || stats.pendingJobs != 0) {
+		std::cout << "INVALID: the counters saw " << stats.total.jobsExecuted + stats.helpedJobs << " of " << submitted << " jobs" << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Counts the heap allocations made by GenoThreadPool::submit() for lambdas capturing 8 to 64 bytes and times them
+ * against submitJob with a heap allocated context, which is what callers had to do before. Any allocation for a
+ * capture of up to 48 bytes, or a wrong result, fails the run with exit code 1.
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/ThreadPoolSubmitBench.cpp src/geno/thread/GenoThreadPool.cpp -lpthread
+**/
+
+#include <iostream>
+#include <vector>
+
+#include "../geno/thread/GenoThreadPool.h"
+
+#include "GenoBench.h"
+
+const uint32 JOB_COUNT = 100000;
+const uint32 BATCH     = 32;
+
+template <uint32 SIZE>
+struct Capture {
+	uint64 words[SIZE / 8];
+};
+
+template <uint32 SIZE>
+struct Context {
+	Capture<SIZE> capture;
+	uint64 * result;
+};
+
+template <uint32 SIZE>
+uint64 sum(const Capture<SIZE> & capture) {
+	uint64 total = 0;
+	for (uint64 word : capture.words)
+		total += word;
+	return total;
+}
+
+template <uint32 SIZE>
+void contextJob(GenoThreadPoolJobData data) {
+	auto context = (Context<SIZE> *) data;
+	*context->result = sum(context->capture);
+	delete context;
+}
+
+template <uint32 SIZE>
+bool runSize(GenoThreadPool & pool) {
+	Capture<SIZE> capture;
+	for (uint32 i = 0; i < SIZE / 8; ++i)
+		capture.words[i] = i + 1;
+	uint64 expected = sum(capture);
+	bool valid = true;
+
+	std::vector<GenoJobHandle<uint64>> handles(BATCH);
+	// Warm up so the pooled task state and the deques have grown to fit a batch
+	for (uint32 i = 0; i < BATCH; ++i)
+		handles[i] = pool.submit([capture]() { return sum(capture); });
+	pool.wait();
+
+	auto allocations = GenoBench::getAllocations();
+	auto begin = GenoBench::getTime();
+	for (uint32 i = 0; i < JOB_COUNT; i += BATCH) {
+		for (uint32 j = 0; j < BATCH; ++j)
+			handles[j] = pool.submit([capture]() { return sum(capture); });
+		for (uint32 j = 0; j < BATCH; ++j)
+			valid = valid && handles[j].get() == expected;
+	}
+	auto end = GenoBench::getTime();
+	auto submitAllocations = GenoBench::getAllocations() - allocations;
+
+	std::vector<uint64> results(BATCH);
+	allocations = GenoBench::getAllocations();
+	auto contextBegin = GenoBench::getTime();
+	for (uint32 i = 0; i < JOB_COUNT; i += BATCH) {
+		for (uint32 j = 0; j < BATCH; ++j)
+			pool.submitJob(contextJob<SIZE>, new Context<SIZE> { capture, &results[j] });
+		pool.wait();
+		for (uint32 j = 0; j < BATCH; ++j)
+			valid = valid && results[j] == expected;
+	}
+	auto contextEnd = GenoBench::getTime();
+	auto contextAllocations = GenoBench::getAllocations() - allocations;
+
+	bool inlined = SIZE <= 48;
+	std::cout << SIZE << " byte capture" << std::endl
+	          << "  submit:           " << (double) (end - begin) / JOB_COUNT << " ns/job, "
+	          << (double) submitAllocations / JOB_COUNT << " allocations/job" << std::endl
+	          << "  submitJob + new:  " << (double) (contextEnd - contextBegin) / JOB_COUNT << " ns/job, "
+	          << (double) contextAllocations / JOB_COUNT << " allocations/job" << std::endl;
+	if (!valid)
+		std::cout << "  INVALID results" << std::endl;
+	if (inlined && submitAllocations > 0)
+		std::cout << "  FAILED, captures of up to 48 bytes must not allocate" << std::endl;
+	return valid && !(inlined && submitAllocations > 0);
+}
+
+int32 main() {
+	GenoThreadPool pool(4);
+	bool passed = runSize<8>(pool);
+	passed = runSize<16>(pool) && passed;
+	passed = runSize<32>(pool) && passed;
+	passed = runSize<48>(pool) && passed;
+	passed = runSize<64>(pool) && passed;
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,194 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Replays the vector math of one Map frame (player integration, collision, camera follow and the per platform
+ * render transforms) over a level file and reports how many heap allocations it made
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/VectorAllocBench.cpp src/geno/math/linear/GenoMathInstantiations.cpp
+ * Run from the repository root: ./a.out [res/levels/levelN.txt]
+**/
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cmath>
+
+#include "../geno/math/linear/GenoVector2.h"
+#include "../geno/math/linear/GenoVector4.h"
+
+#include "GenoBench.h"
+
+struct Box {
+	GenoVector2f position;
+	GenoVector2f dimensions;
+	GenoVector2f velocity;
+};
+
+constexpr float GRAVITY = 30;
+constexpr float DELTA   = 1 / 144.0f;
+
+uint32 readUInt(std::istream & stream) {
+	uint32 ret = 0;
+	char c;
+	while ((c = stream.get()) >= '0' && c <= '9') {
+		ret *= 10;
+		ret += c - '0';
+	}
+	return ret;
+}
+
+float readInt(std::istream & stream) {
+	float sign = 1;
+	if (stream.peek() == '-') {
+		sign = -1;
+		stream.get();
+	}
+	return sign * readUInt(stream);
+}
+
+float absMin(float a, float b) {
+	return a * a < b * b ? a : b;
+}
+
+bool collide(Box & player, const GenoVector2f & hitboxScale, const Box & platform) {
+	GenoVector2f playerPosition   = player.position + (player.dimensions * (GenoVector2f{ 1, 1 } - hitboxScale)) * 0.5f;
+	GenoVector2f playerDimensions = player.dimensions * hitboxScale;
+	if (playerPosition.x() < platform.position.x() + platform.dimensions.x() && playerPosition.x() + playerDimensions.x() > platform.position.x()
+	 && playerPosition.y() < platform.position.y() + platform.dimensions.y() && playerPosition.y() + playerDimensions.y() > platform.position.y()) {
+		float xPush = absMin(
+			platform.position.x() - (playerPosition.x() + playerDimensions.x()),
+			platform.position.x() + platform.dimensions.x() - playerPosition.x()
+		);
+		float yPush = absMin(
+			platform.position.y() - (playerPosition.y() + playerDimensions.y()),
+			platform.position.y() + platform.dimensions.y() - playerPosition.y()
+		);
+		if (fabs(xPush) < fabs(yPush)) {
+			player.position.x() += xPush;
+			player.velocity.x() = 0;
+		}
+		else {
+			player.position.y() += yPush;
+			player.velocity.y() = 0;
+		}
+		return true;
+	}
+	return false;
+}
+
+void frame(Box & player, const GenoVector2f & hitboxScale, std::vector<Box> & platforms, GenoVector2f & camera, const GenoVector2f & cameraDimensions) {
+	// Player::update
+	GenoVector2f acceleration = { 0, GRAVITY };
+	player.velocity += acceleration * DELTA;
+	player.position += player.velocity * DELTA;
+
+	// Platform::update for the mobile platforms
+	for (auto & platform : platforms) {
+		platform.velocity.y() += GRAVITY * DELTA;
+		platform.position += platform.velocity * DELTA;
+	}
+
+	// Map::update collision
+	for (auto & platform : platforms)
+		collide(player, hitboxScale, platform);
+
+	// Map::update detonation impulse
+	GenoVector2f direction = (player.position - platforms[0].position + (player.dimensions - platforms[0].dimensions) * 0.5f);
+	player.velocity += direction.setLength(1.0f);
+
+	// Map::update camera follow
+	GenoVector2f bounds[] = {
+		camera + cameraDimensions * 0.3f,
+		camera + cameraDimensions * 0.7f,
+	};
+	if (player.position.x() < bounds[0].x())
+		camera.x() += player.position.x() - bounds[0].x();
+	else if (player.position.x() > bounds[1].x())
+		camera.x() += player.position.x() - bounds[1].x();
+
+	// Platform::render transform arguments
+	for (auto & platform : platforms) {
+		float scale = 0.125f;
+		GenoBench::keep(platform.position - GenoVector2f{ scale, scale });
+		GenoBench::keep(platform.dimensions + GenoVector2f{ scale, scale } * 2.0f);
+		GenoBench::keep(platform.position + GenoVector2f{ 0.0625f, 0.0625f } - GenoVector2f{ scale, scale });
+		GenoBench::keep(platform.dimensions - (GenoVector2f{ 0.0625f, 0.0625f } - GenoVector2f{ scale, scale }) * 2.0f);
+		GenoBench::keep(GenoVector4f{ 1, 1, 1, 1 });
+	}
+}
+
+int32 main(int32 argc, char ** argv) {
+	const char * path = argc > 1 ? argv[1] : "res/levels/level3.txt";
+	std::ifstream level(path);
+	if (!level) {
+		std::cerr << "Could not open " << path << std::endl;
+		return 1;
+	}
+
+	readUInt(level);
+	readInt(level);
+	Box player = { { 0.0f, 0.0f }, { 2.0f, 2.0f }, { 0.0f, 0.0f } };
+	player.position = { readInt(level), readInt(level) };
+	readInt(level);
+	readInt(level);
+	uint32 numPlatforms = readUInt(level);
+	std::vector<Box> platforms;
+	platforms.reserve(numPlatforms);
+	for (uint32 i = 0; i < numPlatforms; ++i) {
+		GenoVector2f position   = { readInt(level), readInt(level) };
+		GenoVector2f dimensions = { readInt(level), readInt(level) };
+		platforms.push_back({ position, dimensions, { 0.0f, 0.0f } });
+	}
+	if (platforms.empty()) {
+		std::cerr << path << " has no platforms" << std::endl;
+		return 1;
+	}
+
+	GenoVector2f hitboxScale = { 0.5f, 1.0f };
+	GenoVector2f cameraDimensions = { 32.0f, 18.0f };
+	GenoVector2f camera = player.position + (player.dimensions - cameraDimensions) * 0.5f;
+
+	constexpr uint32 NUM_FRAMES = 10000;
+
+	auto allocations = GenoBench::getAllocations();
+	frame(player, hitboxScale, platforms, camera, cameraDimensions);
+	auto frameAllocations = GenoBench::getAllocations() - allocations;
+
+	auto begin = GenoBench::getTime();
+	for (uint32 i = 0; i < NUM_FRAMES; ++i)
+		frame(player, hitboxScale, platforms, camera, cameraDimensions);
+	auto end = GenoBench::getTime();
+
+	std::cout << "platforms:            " << numPlatforms << '\n'
+	          << "allocations / frame:  " << frameAllocations << '\n'
+	          << "ns / frame:           " << (end - begin) / NUM_FRAMES << std::endl;
+
+	GenoBench::keep(player);
+	GenoBench::keep(camera);
+
+	return frameAllocations == 0 ? 0 : 1;
+}
@@ -0,0 +1,120 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Compares the array-of-structures loops Map::update used to run over every platform against the
+ * GenoVector2fBatch kernels: the collision broad phase, Euler integration under gravity and
+ * normalizing impulse directions
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/VectorBatchBench.cpp src/geno/math/linear/GenoMathInstantiations.cpp src/geno/math/linear/GenoVector2fBatch.cpp
+**/
+
+#include <iostream>
+#include <vector>
+
+#include "../geno/math/linear/GenoVector2fBatch.h"
+
+#include "GenoBench.h"
+
+constexpr uint32 NUM_PLATFORMS = 4096;
+constexpr uint32 NUM_PASSES    = 2000;
+
+constexpr float GRAVITY = 30;
+constexpr float DELTA   = 1 / 144.0f;
+
+struct Platform {
+	GenoVector2f position;
+	GenoVector2f dimensions;
+	GenoVector2f velocity;
+};
+
+template <typename Function>
+void run(const char * name, Function function) {
+	auto allocations = GenoBench::getAllocations();
+	auto begin = GenoBench::getTime();
+	for (uint32 i = 0; i < NUM_PASSES; ++i)
+		function();
+	auto end = GenoBench::getTime();
+	allocations = GenoBench::getAllocations() - allocations;
+	std::cout << name << (double) (end - begin) / (NUM_PASSES * NUM_PLATFORMS) << " ns/platform, "
+	          << (double) allocations / (NUM_PASSES * NUM_PLATFORMS) << " allocations/platform" << std::endl;
+}
+
+int32 main() {
+	std::vector<Platform> platforms;
+	GenoVector2fBatch positions;
+	GenoVector2fBatch dimensions;
+	GenoVector2fBatch velocities;
+	for (uint32 i = 0; i < NUM_PLATFORMS; ++i) {
+		Platform platform = { { (float) (i % 64) * 3, (float) (i / 64) * 3 }, { 2.0f, 1.0f }, { (float) (i % 5), -(float) (i % 3) } };
+		platforms.push_back(platform);
+		positions.push(platform.position);
+		dimensions.push(platform.dimensions);
+		velocities.push(platform.velocity);
+	}
+
+	// Player hitbox in an empty spot so every platform gets tested
+	GenoVector2f player = { -10.0f, -10.0f };
+	GenoVector2f playerDimensions = { 1.0f, 2.0f };
+
+	run("broad phase, per platform: ", [&]() {
+		uint32 hits = 0;
+		for (auto & platform : platforms)
+			hits += player.x() < platform.position.x() + platform.dimensions.x() && player.x() + playerDimensions.x() > platform.position.x()
+			     && player.y() < platform.position.y() + platform.dimensions.y() && player.y() + playerDimensions.y() > platform.position.y();
+		GenoBench::keep(hits);
+	});
+	run("broad phase, batch:        ", [&]() {
+		GenoBench::keep(findOverlap(positions, dimensions, 0, player, playerDimensions));
+	});
+
+	run("integrate, per platform:   ", [&]() {
+		for (auto & platform : platforms) {
+			platform.velocity.y() += GRAVITY * DELTA;
+			platform.position += platform.velocity * DELTA;
+		}
+		GenoBench::keep(platforms[0].position);
+	});
+	run("integrate, batch:          ", [&]() {
+		velocities += GenoVector2f{ 0, GRAVITY * DELTA };
+		multiplyAdd(velocities, DELTA, positions, positions);
+		GenoBench::keep(positions.x[0]);
+	});
+
+	std::vector<GenoVector2f> directions(NUM_PLATFORMS);
+	GenoVector2fBatch normalized;
+	run("normalize, per platform:   ", [&]() {
+		for (uint32 i = 0; i < NUM_PLATFORMS; ++i)
+			directions[i] = normalize(platforms[i].velocity);
+		GenoBench::keep(directions[0]);
+	});
+	run("normalize, batch:          ", [&]() {
+		normalize(velocities, normalized);
+		GenoBench::keep(normalized.x[0]);
+	});
+
+	return 0;
+}
@@ -0,0 +1,113 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * Compares the compound vector expressions from Map.cpp written with the GenoVector2f expression template operators
+ * against the same math written out per component, which is what the expression should reduce to. Also checks both
+ * give the same results
+ *
+ * Build: g++ -O2 -std=c++17 -Isrc src/bench/GenoBench.cpp src/bench/VectorExpressionBench.cpp src/geno/math/linear/GenoMathInstantiations.cpp
+**/
+
+#include <iostream>
+#include <vector>
+
+#include "../geno/math/linear/GenoVector2.h"
+
+#include "GenoBench.h"
+
+constexpr uint32 NUM_ENTITIES = 4096;
+constexpr uint32 NUM_PASSES   = 2000;
+
+struct Entity {
+	GenoVector2f position;
+	GenoVector2f dimensions;
+};
+
+template <typename Function>
+void run(const char * name, std::vector<GenoVector2f> & results, Function function) {
+	auto allocations = GenoBench::getAllocations();
+	auto begin = GenoBench::getTime();
+	for (uint32 i = 0; i < NUM_PASSES; ++i) {
+		for (uint32 j = 0; j < NUM_ENTITIES; ++j)
+			results[j] = function(j);
+		GenoBench::keep(results[0]);
+	}
+	auto end = GenoBench::getTime();
+	allocations = GenoBench::getAllocations() - allocations;
+	std::cout << name << (double) (end - begin) / (NUM_PASSES * NUM_ENTITIES) << " ns/op, "
+	          << (double) allocations / (NUM_PASSES * NUM_ENTITIES) << " allocations/op" << std::endl;
+}
+
+bool same(const std::vector<GenoVector2f> & left, const std::vector<GenoVector2f> & right) {
+	for (uint32 i = 0; i < left.size(); ++i)
+		if (left[i].v[0] != right[i].v[0] || left[i].v[1] != right[i].v[1])
+			return false;
+	return true;
+}
+
+int32 main() {
+	std::vector<Entity> entities;
+	for (uint32 i = 0; i < NUM_ENTITIES; ++i)
+		entities.push_back({ { (float) i, (float) (i % 7) }, { 2.0f, 2.0f } });
+	std::vector<GenoVector2f> results(NUM_ENTITIES);
+	std::vector<GenoVector2f> expected(NUM_ENTITIES);
+
+	GenoVector2f hitboxScale = { 0.5f, 1.0f };
+	GenoVector2f cameraDimensions = { 32.0f, 18.0f };
+
+	// Player::getCollisionPosition
+	run("collision, operators:      ", results, [&](uint32 i) -> GenoVector2f {
+		return entities[i].position + (entities[i].dimensions * (GenoVector2f{ 1, 1 } - hitboxScale)) * 0.5f;
+	});
+	run("collision, per component:  ", expected, [&](uint32 i) {
+		return GenoVector2f{
+			entities[i].position.v[0] + (entities[i].dimensions.v[0] * (1 - hitboxScale.v[0])) * 0.5f,
+			entities[i].position.v[1] + (entities[i].dimensions.v[1] * (1 - hitboxScale.v[1])) * 0.5f
+		};
+	});
+	if (!same(results, expected)) {
+		std::cout << "INVALID: collision operators differ from the per component math" << std::endl;
+		return 1;
+	}
+
+	// Map::Map camera placement
+	run("camera, operators:         ", results, [&](uint32 i) -> GenoVector2f {
+		return entities[i].position + (entities[i].dimensions - cameraDimensions) * 0.5f;
+	});
+	run("camera, per component:     ", expected, [&](uint32 i) {
+		return GenoVector2f{
+			entities[i].position.v[0] + (entities[i].dimensions.v[0] - cameraDimensions.v[0]) * 0.5f,
+			entities[i].position.v[1] + (entities[i].dimensions.v[1] - cameraDimensions.v[1]) * 0.5f
+		};
+	});
+	if (!same(results, expected)) {
+		std::cout << "INVALID: camera operators differ from the per component math" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
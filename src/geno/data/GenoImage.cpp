@@ -29,6 +29,8 @@
 
 #include <PNG\png.h>
 
+#include "../thread/GenoParallel.h"
+#include "../thread/GenoProfiler.h"
 #include "GenoImage.h"
 
 struct GenoBitmapFileHeader {
@@ -56,21 +58,26 @@ struct GenoBitmapInfoHeader {
 GenoImage::GenoImage() {}
 
 GenoImage * GenoImage::create(const GenoImageCreateInfo & info) {
+	GENO_PROFILE_ZONE("GenoImage::create");
 	uint32 width = 0;
 	uint32 height = 0;
 	uint8 * image = 0;
+	GenoThreadPool * pool = info.pool;
 	switch (info.type) {
 		case GENO_IMAGE_TYPE_CREATE: {
 			width = info.width;
 			height = info.height;
-			uint64 size = width * height * 4;
-			image = new uint8[size];
-			for (int32 i = 0; i < size; i += 4) {
-				image[i    ] = info.r;
-				image[i + 1] = info.g;
-				image[i + 2] = info.b;
-				image[i + 3] = info.a;
-			}
+			image = new uint8[width * height * 4];
+			uint8 r = info.r;
+			uint8 g = info.g;
+			uint8 b = info.b;
+			uint8 a = info.a;
+			parallelFor(pool, 0, width * height, 0, [=](uint32 i) {
+				image[i * 4    ] = r;
+				image[i * 4 + 1] = g;
+				image[i * 4 + 2] = b;
+				image[i * 4 + 3] = a;
+			});
 			break;
 		}
 		case GENO_IMAGE_TYPE_BMP: {
@@ -161,17 +168,10 @@ GenoImage * GenoImage::create(const GenoImageCreateInfo & info) {
 			png_read_image(png, rowPointers);
 
 			image = new uint8[width * height * 4];
-			for (int j = 0; j < height; ++j) {
-				png_bytep row = rowPointers[j];
-				for (int i = 0; i < width; ++i) {
-					uint32 pixel = i * 4 + j * width * 4;
-					png_bytep px = row + (i * 4);
-					image[pixel    ] = px[0];
-					image[pixel + 1] = px[1];
-					image[pixel + 2] = px[2];
-					image[pixel + 3] = px[3];
-				}
-			}
+			// Rows are already expanded to RGBA so each one is a straight copy
+			parallelFor(pool, 0, height, 16, [=](uint32 j) {
+				memcpy(image + j * width * 4, rowPointers[j], width * 4);
+			});
 
 			png_destroy_read_struct(&png, &info, NULL);
 			fclose(fp);
@@ -29,6 +29,8 @@
 
 #include "../GenoInts.h"
 
+class GenoThreadPool;
+
 #define GENO_IMAGE_TYPE_CREATE 0x00
 #define GENO_IMAGE_TYPE_PNG    0x01
 #define GENO_IMAGE_TYPE_BMP    0x02
@@ -44,6 +46,8 @@ struct GenoImageCreateInfo {
 	uint8  a;
 
 	const char * path;
+
+	GenoThreadPool * pool;
 };
 
 class GenoImage {
@@ -32,30 +32,52 @@ GenoCamera2D::GenoCamera2D(float left, float right, float bottom, float top, flo
 	projection(GenoMatrix4f::makeOrthographic(left, right, bottom, top, near, far)),
 	view(GenoMatrix4f::makeIdentity()),
 	projectionView(projection),
+	affineProjection(GenoAffine2f::makeOrthographic(left, right, bottom, top)),
+	affineProjectionView(affineProjection),
 	position(),
 	rotation(0) {}
 
 void GenoCamera2D::update() {
 	view.setTranslateXY(-position).rotateZ(-rotation);
 	projectionView = projection * view;
+	affineProjectionView = translate2D(affineProjection, -position);
+	if (rotation != 0)
+		affineProjectionView.rotate2D(-rotation);
 }
 
 void GenoCamera2D::setProjection(float left, float right, float bottom, float top, float near, float far) {
 	projection.setOrthographic(left, right, bottom, top, near, far);
+	affineProjection = GenoAffine2f::makeOrthographic(left, right, bottom, top);
 }
 
-GenoMatrix4f GenoCamera2D::getProjection() {
+const GenoMatrix4f & GenoCamera2D::getProjection() const {
 	return projection;
 }
 
-GenoMatrix4f GenoCamera2D::getView() {
+const GenoMatrix4f & GenoCamera2D::getView() const {
 	return view;
 }
 
-GenoMatrix4f GenoCamera2D::getVPMatrix() {
+const GenoMatrix4f & GenoCamera2D::getVPMatrix() const {
 	return projectionView;
 }
 
+const GenoAffine2f & GenoCamera2D::getAffineProjection() const {
+	return affineProjection;
+}
+
+const GenoAffine2f & GenoCamera2D::getAffineVP() const {
+	return affineProjectionView;
+}
+
+GenoAffine2f GenoCamera2D::getScreenToWorld(float screenWidth, float screenHeight) const {
+	return GenoAffine2f::makeTranslate2D(position).scale2D({ width / screenWidth, height / screenHeight });
+}
+
+GenoAffine2f GenoCamera2D::getWorldToScreen(float screenWidth, float screenHeight) const {
+	return GenoAffine2f::makeScale2D({ screenWidth / width, screenHeight / height }).translate2D(-position);
+}
+
 float GenoCamera2D::getWidth() {
 	return width;
 }
@@ -29,6 +29,7 @@
 
 #include "../math/linear/GenoVector2.h"
 #include "../math/linear/GenoMatrix4.h"
+#include "../math/linear/GenoAffine2.h"
 
 class GenoCamera2D {
 	private:
@@ -38,6 +39,9 @@ class GenoCamera2D {
 		GenoMatrix4f projection;
 		GenoMatrix4f view;
 		GenoMatrix4f projectionView;
+
+		GenoAffine2f affineProjection;
+		GenoAffine2f affineProjectionView;
 	public:
 		GenoVector2f position;
 		float rotation;
@@ -45,9 +49,22 @@ class GenoCamera2D {
 		GenoCamera2D(float left, float right, float bottom, float top, float near, float far);
 		void update();
 		void setProjection(float left, float right, float bottom, float top, float near, float far);
-		GenoMatrix4f getProjection();
-		GenoMatrix4f getView();
-		GenoMatrix4f getVPMatrix();
+		const GenoMatrix4f & getProjection() const;
+		const GenoMatrix4f & getView() const;
+		const GenoMatrix4f & getVPMatrix() const;
+		const GenoAffine2f & getAffineProjection() const;
+		const GenoAffine2f & getAffineVP() const;
+
+		/**
+		 * Maps screen pixels (origin top left) to world coordinates, ignoring rotation
+		**/
+		GenoAffine2f getScreenToWorld(float screenWidth, float screenHeight) const;
+
+		/**
+		 * The inverse of getScreenToWorld
+		**/
+		GenoAffine2f getWorldToScreen(float screenWidth, float screenHeight) const;
+
 		float getWidth();
 		float getHeight();
 		GenoVector2f getDimensions();
@@ -27,6 +27,7 @@
 #include <iostream>
 
 #include "../gl/GenoGL.h"
+#include "../thread/GenoThreadPool.h"
 #include "GenoInput.h"
 #include "GenoMonitor.h"
 
@@ -37,15 +38,31 @@ namespace {
 }
 
 GenoLoopCallback GenoEngine::callback = 0;
+GenoLoopCallback GenoEngine::fixedCallback = 0;
+bool GenoEngine::eventsPolled = false;
 GenoLoop * GenoEngine::loop = 0;
+GenoThreadPool * GenoEngine::threadPool = 0;
 GenoEngine::GenoEventPollFunc GenoEngine::getEvents = 0;
 
 void GenoEngine::defaultLoop() {
-	GenoInput::update();
-	GenoEngine::pollEvents();
+	// With fixed steps input only advances after a step, so a press is seen by exactly one step however many run per frame
+	if (!loop->isFixedStep())
+		GenoInput::update();
+	if (!eventsPolled)
+		GenoEngine::pollEvents();
+	eventsPolled = false;
 	callback();
 }
 
+void GenoEngine::defaultFixedLoop() {
+	if (!eventsPolled) {
+		GenoEngine::pollEvents();
+		eventsPolled = true;
+	}
+	fixedCallback();
+	GenoInput::update();
+}
+
 bool GenoEngine::init() {
 	glfwSetErrorCallback(errorCallback);
 
@@ -58,6 +75,15 @@ bool GenoEngine::init() {
 
 	GenoMonitors::init();
 
+	// Workers stay off core 0 so the thread running the loop always has a core free
+	uint32 numThreads = GenoThreadPool::physicalThreadCount();
+	GenoThreadPoolCreateInfo poolInfo = {};
+	poolInfo.numThreads           = numThreads > 1 ? numThreads - 1 : 1;
+	poolInfo.initialQueueCapacity = 16;
+	poolInfo.name                 = "geno worker";
+	poolInfo.reservedCores        = 1;
+	threadPool = new GenoThreadPool(poolInfo);
+
 	return true;
 }
 
@@ -76,6 +102,10 @@ void GenoEngine::setLoop(GenoLoopCreateInfo info, bool overrideDefault) {
 	if (!overrideDefault) {
 		callback = info.callback;
 		info.callback = defaultLoop;
+		if (info.fixedCallback != 0) {
+			fixedCallback = info.fixedCallback;
+			info.fixedCallback = defaultFixedLoop;
+		}
 	}
 
 	loop = new GenoLoop(info);
@@ -92,6 +122,9 @@ void GenoEngine::stopLoop() {
 void GenoEngine::destroy() {
 	stopLoop();
 	delete loop;
+
+	delete threadPool;
+	threadPool = 0;
 	
 	GenoMonitors::cleanup();
 
@@ -114,6 +147,10 @@ GenoLoop * GenoEngine::getLoop() {
 	return loop;
 }
 
+GenoThreadPool * GenoEngine::getThreadPool() {
+	return threadPool;
+}
+
 GenoEngine::GenoEngine() {}
 GenoEngine::~GenoEngine() {}
 
@@ -31,6 +31,13 @@ class GenoLoop;
 
 #endif // GNARLY_GENOME_LOOP_FORWARD
 
+#ifndef GNARLY_GENOME_THREAD_POOL_FORWARD
+#define GNARLY_GENOME_THREAD_POOL_FORWARD
+
+class GenoThreadPool;
+
+#endif // GNARLY_GENOME_THREAD_POOL_FORWARD
+
 #ifndef GNARLY_GENOME_ENGINE
 #define GNARLY_GENOME_ENGINE
 
@@ -49,10 +56,14 @@ class GenoEngine final {
 		typedef void (*GenoEventPollFunc)();
 
 		static GenoLoopCallback callback;
+		static GenoLoopCallback fixedCallback;
+		static bool eventsPolled;
 		static GenoLoop * loop;
+		static GenoThreadPool * threadPool;
 		static GenoEventPollFunc getEvents;
 
 		static void defaultLoop();
+		static void defaultFixedLoop();
 
 		GenoEngine();
 		~GenoEngine();
@@ -61,7 +72,7 @@ class GenoEngine final {
 		////// PROGRAM FLOW CONTROL METHODS //////
 
 		/**
-		 * Initializes the engine
+		 * Initializes the engine and starts its thread pool
 		**/
 		static bool init();
 
@@ -116,6 +127,11 @@ class GenoEngine final {
 		 * Returns the game loop
 		**/
 		static GenoLoop * getLoop();
+
+		/**
+		 * Returns the engine's thread pool, it has one thread less than the machine so the main thread can join in
+		**/
+		static GenoThreadPool * getThreadPool();
 };
 
 #define GNARLY_GENOME_ENGINE_FORWARD
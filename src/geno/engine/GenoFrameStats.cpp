@@ -0,0 +1,94 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+
+#include "GenoFrameStats.h"
+
+GenoFrameStats::GenoFrameStats(uint32 capacity) :
+	capacity(capacity),
+	count(0),
+	next(0),
+	times(new GenoFrameTimes[capacity]),
+	sorted(new float[capacity]) {}
+
+void GenoFrameStats::push(const GenoFrameTimes & times) {
+	this->times[next] = times;
+	next = (next + 1) % capacity;
+	if (count < capacity)
+		++count;
+}
+
+const GenoFrameTimes & GenoFrameStats::get(uint32 age) const {
+	return times[(next + capacity - 1 - age) % capacity];
+}
+
+uint32 GenoFrameStats::getCount() const {
+	return count;
+}
+
+uint32 GenoFrameStats::getCapacity() const {
+	return capacity;
+}
+
+GenoFrameStatSummary GenoFrameStats::summarize(float GenoFrameTimes::* stat, uint32 window) const {
+	GenoFrameStatSummary summary = {};
+	if (window == 0)
+		return summary;
+
+	float sum = 0;
+	for (uint32 i = 0; i < window; ++i) {
+		sorted[i] = get(i).*stat;
+		sum += sorted[i];
+	}
+	std::sort(sorted, sorted + window);
+
+	summary.min = sorted[0];
+	summary.avg = sum / window;
+	summary.p95 = sorted[(window - 1) * 95 / 100];
+	summary.p99 = sorted[(window - 1) * 99 / 100];
+	summary.max = sorted[window - 1];
+	return summary;
+}
+
+GenoFrameStatsSummary GenoFrameStats::getSummary(uint32 window) const {
+	if (window > count)
+		window = count;
+
+	GenoFrameStatsSummary summary = {};
+	summary.frames  = window;
+	summary.update  = summarize(&GenoFrameTimes::update,  window);
+	summary.render  = summarize(&GenoFrameTimes::render,  window);
+	summary.present = summarize(&GenoFrameTimes::present, window);
+	summary.sleep   = summarize(&GenoFrameTimes::sleep,   window);
+	summary.frame   = summarize(&GenoFrameTimes::frame,   window);
+	return summary;
+}
+
+GenoFrameStats::~GenoFrameStats() {
+	delete [] sorted;
+	delete [] times;
+}
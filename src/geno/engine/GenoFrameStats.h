@@ -0,0 +1,106 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_GENOME_FRAME_STATS
+#define GNARLY_GENOME_FRAME_STATS
+
+#include "../GenoInts.h"
+
+/**
+ * How one frame of a loop callback spent its time, in milliseconds
+**/
+struct GenoFrameTimes {
+	/** Coroutines and fixed steps run before the callback **/
+	float update;
+	/** The callback itself, less present **/
+	float render;
+	/** Buffer swaps made by the callback **/
+	float present;
+	/** Sleeping between the previous frame and this one **/
+	float sleep;
+	/** Since the previous frame **/
+	float frame;
+};
+
+struct GenoFrameStatSummary {
+	float min;
+	float avg;
+	float p95;
+	float p99;
+	float max;
+};
+
+struct GenoFrameStatsSummary {
+	uint32 frames;
+	GenoFrameStatSummary update;
+	GenoFrameStatSummary render;
+	GenoFrameStatSummary present;
+	GenoFrameStatSummary sleep;
+	GenoFrameStatSummary frame;
+};
+
+/**
+ * A rolling record of the last frames of one loop callback
+**/
+class GenoFrameStats {
+	private:
+		uint32 capacity;
+		uint32 count;
+		uint32 next;
+		GenoFrameTimes * times;
+		float * sorted;
+
+		GenoFrameStatSummary summarize(float GenoFrameTimes::* stat, uint32 window) const;
+	public:
+		GenoFrameStats(uint32 capacity);
+
+		/**
+		 * Records a frame, replacing the oldest once full
+		**/
+		void push(const GenoFrameTimes & times);
+
+		/**
+		 * Returns a recorded frame
+		 *
+		 * @param age - How many frames back, 0 being the latest
+		**/
+		const GenoFrameTimes & get(uint32 age) const;
+
+		uint32 getCount() const;
+		uint32 getCapacity() const;
+
+		/**
+		 * Returns min / avg / p95 / p99 / max of each time over the latest frames
+		 *
+		 * @param window - How many frames to cover, clamped to the number recorded
+		**/
+		GenoFrameStatsSummary getSummary(uint32 window) const;
+
+		~GenoFrameStats();
+};
+
+#define GNARLY_GENOME_FRAME_STATS_FORWARD
+#endif // GNARLY_GENOME_FRAME_STATS
@@ -106,7 +106,7 @@ GenoVector2d GenoInput::getRawMouseCoords() {
 }
 
 GenoVector2f GenoInput::getMouseCoords(GenoCamera2D * camera) {
-	return (GenoVector2f) mouseCoords / GenoVector2f(GenoFramebuffer::getCurrentWidth(), GenoFramebuffer::getCurrentHeight()) * camera->getDimensions() + camera->position;
+	return camera->getScreenToWorld(GenoFramebuffer::getCurrentWidth(), GenoFramebuffer::getCurrentHeight()) * (GenoVector2f) mouseCoords;
 }
 
 void GenoInput::setEnabled(bool enabled) {
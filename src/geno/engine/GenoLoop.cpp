@@ -24,9 +24,13 @@
  *
  *******************************************************************************/
 
+#include <cmath>
 #include <iostream>
 
 #include "../thread/GenoTime.h"
+#include "../thread/GenoCoroutine.h"
+#include "../thread/GenoProfiler.h"
+#include "GenoFrameStats.h"
 
 #include "GenoLoop.h"
 
@@ -38,7 +42,21 @@ GenoLoop::GenoLoop(const GenoLoopCreateInfo & info) :
 	deltaScales(new double[callbackCount]),
 	fps(new uint32[callbackCount]),
 	millisPerFrames(new double[callbackCount]),
-	callbacks(new GenoLoopCallback[callbackCount]) {
+	callbacks(new GenoLoopCallback[callbackCount]),
+	scheduler(new GenoCoroutineScheduler()),
+	stats(new GenoFrameStats*[callbackCount]),
+	presentTime(0),
+	sleepTime(0),
+	fixedCallback(info.fixedFps != 0 ? info.fixedCallback : 0),
+	millisPerFixedStep(info.fixedFps != 0 ? 1000 / info.fixedFps : 0),
+	fixedDelta(info.fixedFps != 0 ? info.deltaScale / info.fixedFps : 0),
+	maxFixedSteps(info.maxFixedSteps != 0 ? info.maxFixedSteps : (uint32) ceil(info.fixedFps / 4)),
+	accumulator(0),
+	alpha(1),
+	inFixedStep(false) {
+
+	for (uint32 i = 0; i < callbackCount; ++i)
+		stats[i] = new GenoFrameStats(info.statsFrames != 0 ? info.statsFrames : 1024);
 
 	fps[0] = 0;
 	deltas[0] = 0;
@@ -63,6 +81,26 @@ GenoLoop::GenoLoop(const GenoLoopCreateInfo & info) :
 	}
 }
 
+void GenoLoop::runFixedSteps(double elapsed) {
+	accumulator += elapsed;
+	inFixedStep = true;
+	for (uint32 i = 0; i < maxFixedSteps && accumulator >= millisPerFixedStep; ++i) {
+		GENO_PROFILE_ZONE("GenoLoop fixed step");
+		fixedCallback();
+		{
+			// After the callback so what coroutines move lands between the step's saved and current state
+			GENO_PROFILE_ZONE("GenoLoop coroutines");
+			scheduler->update(fixedDelta);
+		}
+		accumulator -= millisPerFixedStep;
+	}
+	inFixedStep = false;
+	// After a long stall the simulation falls behind instead of running ever more steps to catch up
+	if (accumulator >= millisPerFixedStep)
+		accumulator = fmod(accumulator, millisPerFixedStep);
+	alpha = accumulator / millisPerFixedStep;
+}
+
 void GenoLoop::start() {
 	uint32 * frames = new uint32[callbackCount];
 	double * pastTimes = new double[callbackCount + 1];
@@ -77,6 +115,8 @@ void GenoLoop::start() {
 	pastTimes[callbackCount] = GenoTime::getTime(milliseconds);
 	truePastTimes[callbackCount] = GenoTime::getTime(milliseconds);
 
+	GenoCoroutineScheduler * previousScheduler = GenoCoroutineScheduler::setCurrent(scheduler);
+
 	looping = true;
 	while (looping) {
 		curTime = GenoTime::getTime(milliseconds);
@@ -88,17 +128,53 @@ void GenoLoop::start() {
 			pastTimes[0] += 1000;
 		}
 		for (uint32 i = 0; i < callbackCount; ++i) {
-			if (curTime - pastTimes[i + 1] >= millisPerFrames[i]) {
-				callbacks[i]();
+			// Compares against the same sum the loop sleeps until, a virtual clock stops exactly there and the
+			// difference form could round just short of it forever
+			if (curTime >= pastTimes[i + 1] + millisPerFrames[i]) {
+				uint64 updateStart = GenoTime::getTicks();
+				if (i == 0) {
+					// Coroutines are gameplay, with fixed stepping they resume in every step with the step's delta
+					if (fixedCallback != 0)
+						runFixedSteps(curTime - truePastTimes[1]);
+					else {
+						GENO_PROFILE_ZONE("GenoLoop coroutines");
+						scheduler->update(deltas[0]);
+					}
+				}
+				uint64 renderStart = GenoTime::getTicks();
+				presentTime = 0;
+				{
+					GENO_PROFILE_ZONE("GenoLoop callback");
+					callbacks[i]();
+				}
+				uint64 renderEnd = GenoTime::getTicks();
+
+				GenoFrameTimes times = {};
+				times.update  = (renderStart - updateStart) / 1000000.0f;
+				times.render  = (renderEnd - renderStart - presentTime) / 1000000.0f;
+				times.present = presentTime / 1000000.0f;
+				times.frame   = (float) (curTime - truePastTimes[i + 1]);
+				if (i == 0) {
+					times.sleep = sleepTime / 1000000.0f;
+					sleepTime = 0;
+				}
+				stats[i]->push(times);
+
 				deltas[i] = (curTime - truePastTimes[i + 1]) * deltaScales[i] / milliseconds;
 				pastTimes[i + 1] += millisPerFrames[i];
 				truePastTimes[i + 1] = curTime;
 				++frames[i];
 			}
 		}
-		if (!sanicLoop)
+		if (!sanicLoop) {
+			GENO_PROFILE_ZONE("GenoLoop sleep");
+			uint64 sleepStart = GenoTime::getTicks();
 			GenoTime::sleepUntil(pastTimes[1] + millisPerFrames[0]);
+			sleepTime += GenoTime::getTicks() - sleepStart;
+		}
 	}
+
+	GenoCoroutineScheduler::setCurrent(previousScheduler);
 	
 	delete [] truePastTimes;
 	delete [] pastTimes;
@@ -110,9 +186,23 @@ void GenoLoop::stop() {
 }
 
 double GenoLoop::getDelta(uint32 loopIndex) {
+	if (inFixedStep && loopIndex == 0)
+		return fixedDelta;
 	return deltas[loopIndex];
 }
 
+bool GenoLoop::isFixedStep() {
+	return fixedCallback != 0;
+}
+
+double GenoLoop::getFixedDelta() {
+	return fixedDelta;
+}
+
+double GenoLoop::getAlpha() {
+	return alpha;
+}
+
 uint32 GenoLoop::getFPS(uint32 loopIndex) {
 	return fps[loopIndex];
 }
@@ -129,9 +219,25 @@ void GenoLoop::setCallback(GenoLoopCallback callback, uint32 loopIndex) {
 	callbacks[loopIndex] = callback;
 }
 
+GenoCoroutineScheduler * GenoLoop::getScheduler() {
+	return scheduler;
+}
+
+GenoFrameStats * GenoLoop::getStats(uint32 loopIndex) {
+	return stats[loopIndex];
+}
+
+void GenoLoop::addPresentTime(uint64 time) {
+	presentTime += time;
+}
+
 GenoLoop::~GenoLoop() {
 	delete [] deltas;
 	delete [] deltaScales;
 	delete [] millisPerFrames;
 	delete [] callbacks;
+	delete scheduler;
+	for (uint32 i = 0; i < callbackCount; ++i)
+		delete stats[i];
+	delete [] stats;
 }
\ No newline at end of file
@@ -40,6 +40,9 @@
 
 #include "../GenoInts.h"
 
+class GenoCoroutineScheduler;
+class GenoFrameStats;
+
 typedef void (*GenoLoopCallback)();
 
 struct GenoSubLoopCreateInfo {
@@ -54,6 +57,16 @@ struct GenoLoopCreateInfo {
 	GenoLoopCallback callback;
 	uint32 numSubLoops;
 	GenoSubLoopCreateInfo * subLoops;
+
+	/** The rate of fixed steps, 0 turns fixed stepping off **/
+	double fixedFps;
+	/** Runs once per fixed step, right before callback, as many times as the time since the last frame covers. Coroutines resume at the end of every step instead of once per frame **/
+	GenoLoopCallback fixedCallback;
+	/** The most fixed steps one frame may run before the rest of its time is dropped, 0 allows a quarter second **/
+	uint32 maxFixedSteps;
+
+	/** How many frames of GenoFrameStats each callback keeps, 0 defaults to 1024 **/
+	uint32 statsFrames;
 };
 
 class GenoLoop {
@@ -66,15 +79,68 @@ class GenoLoop {
 		double * deltaScales;
 		double * millisPerFrames;
 		GenoLoopCallback * callbacks;
+		GenoCoroutineScheduler * scheduler;
+		GenoFrameStats ** stats;
+		uint64 presentTime;
+		uint64 sleepTime;
+
+		GenoLoopCallback fixedCallback;
+		double millisPerFixedStep;
+		double fixedDelta;
+		uint32 maxFixedSteps;
+		double accumulator;
+		double alpha;
+		bool inFixedStep;
+
+		void runFixedSteps(double elapsed);
 	public:
 		GenoLoop(const GenoLoopCreateInfo & info);
 		void start();
 		void stop();
+		/**
+		 * Returns the delta of the loop's last frame in seconds, or the fixed step while a fixed step is running
+		**/
 		double getDelta(uint32 loopIndex = 0);
+
+		/**
+		 * Returns whether the loop runs fixed steps
+		**/
+		bool isFixedStep();
+
+		/**
+		 * Returns the length of a fixed step in seconds, scaled like the main loop's delta
+		**/
+		double getFixedDelta();
+
+		/**
+		 * Returns how far the main loop is between the last fixed step and the next one, from 0 to 1. Render
+		 * interpolates from the state before the last step to the state after it by this amount. Always 1 without
+		 * fixed stepping
+		**/
+		double getAlpha();
 		uint32 getFPS(uint32 loopIndex = 0);
 		void setFPS(double fps, uint32 loopIndex = 0);
 		void setDeltaScale(double scale, uint32 loopIndex = 0);
 		void setCallback(GenoLoopCallback callback, uint32 loopIndex = 0);
+
+		/**
+		 * Returns the scheduler that resumes GenoCoroutines, it is updated right before the main loop's callback
+		 * with the same delta getDelta() returns
+		**/
+		GenoCoroutineScheduler * getScheduler();
+
+		/**
+		 * Returns the frame times recorded for a callback
+		**/
+		GenoFrameStats * getStats(uint32 loopIndex = 0);
+
+		/**
+		 * Adds time spent presenting to the frame being recorded, GenoWindow::swap reports here
+		 *
+		 * @param time - The time in nanoseconds
+		**/
+		void addPresentTime(uint64 time);
+
 		~GenoLoop();
 };
 
@@ -24,6 +24,9 @@
  *
  *******************************************************************************/
 
+#include "../thread/GenoTime.h"
+#include "GenoEngine.h"
+#include "GenoLoop.h"
 #include "GenoInput.h"
 
 #include "GenoWindow.h"
@@ -155,7 +158,11 @@ void GenoWindow::bindFramebuffer() const {
 }
 
 void GenoWindow::swap() const {
+	uint64 start = GenoTime::getTicks();
 	glfwSwapBuffers(window);
+	GenoLoop * loop = GenoEngine::getLoop();
+	if (loop != 0)
+		loop->addPresentTime(GenoTime::getTicks() - start);
 }
 
 int32 GenoWindow::getX() const {
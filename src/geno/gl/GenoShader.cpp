@@ -29,6 +29,7 @@
 #include <cstring>
 
 #include "GenoGL.h"
+#include "../thread/GenoProfiler.h"
 
 #include "GenoShader.h"
 
@@ -92,6 +93,7 @@ GenoShader::GenoShader(const char * vert, const char * geom, const char * frag,
 }
 
 uint32 GenoShader::loadShader(const char * path, int32 type, bool file) {
+	GENO_PROFILE_ZONE("GenoShader::loadShader");
 	int length;
 	char * input;
 	if (file) {
@@ -160,19 +162,61 @@ GenoShader::~GenoShader() {
 }
 
 GenoMvpShader::GenoMvpShader(const char * vert, const char * frag, bool file) :
-	GenoShader(vert, frag, file) {
-	mvpLoc = glGetUniformLocation(program, "mvp");
+	GenoShader(vert, frag, file),
+	depthScale(2),
+	depthOffset(-1) {
+	findMvp();
 }
 
 GenoMvpShader::GenoMvpShader(const char * vert, const char * frag, const char * geom, bool file) :
-	GenoShader(vert, frag, geom, file) {
-	mvpLoc = glGetUniformLocation(program, "mvp");
+	GenoShader(vert, frag, geom, file),
+	depthScale(2),
+	depthOffset(-1) {
+	findMvp();
+}
+
+void GenoMvpShader::findMvp() {
+	mvpLoc   = glGetUniformLocation(program, "mvp");
+	depthLoc = glGetUniformLocation(program, "depth");
+
+	const char * name = "mvp";
+	uint32 index = GL_INVALID_INDEX;
+	int32 type = GL_FLOAT_MAT4;
+	glGetUniformIndices(program, 1, &name, &index);
+	if (index != GL_INVALID_INDEX)
+		glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_TYPE, &type);
+	affine = type == GL_FLOAT_MAT3x2;
 }
 
 void GenoMvpShader::setMvp(const GenoMatrix4f & mvp) {
-	glUniformMatrix4fv(mvpLoc, 1, GL_FALSE, mvp.m);
+	setMvp(mvp.m);
 }
 
 void GenoMvpShader::setMvp(const float * mvp) {
-	glUniformMatrix4fv(mvpLoc, 1, GL_FALSE, mvp);
+	if (affine) {
+		float transform[6] = { mvp[0], mvp[1], mvp[4], mvp[5], mvp[12], mvp[13] };
+		glUniformMatrix3x2fv(mvpLoc, 1, GL_FALSE, transform);
+		glUniform2f(depthLoc, mvp[10], mvp[14]);
+	}
+	else
+		glUniformMatrix4fv(mvpLoc, 1, GL_FALSE, mvp);
+}
+
+void GenoMvpShader::setMvp(const GenoAffine2f & mvp) {
+	if (affine) {
+		// Always sent so the z row of an earlier mat4 upload never carries over
+		glUniformMatrix3x2fv(mvpLoc, 1, GL_FALSE, mvp.m);
+		glUniform2f(depthLoc, depthScale, depthOffset);
+	}
+	else {
+		GenoMatrix4f matrix = mvp.getMatrix4();
+		matrix.m[10] = depthScale;
+		matrix.m[14] = depthOffset;
+		glUniformMatrix4fv(mvpLoc, 1, GL_FALSE, matrix.m);
+	}
+}
+
+void GenoMvpShader::setDepthRange(float near, float far) {
+	depthScale  = 2 / (far - near);
+	depthOffset = (near + far) / (near - far);
 }
\ No newline at end of file
@@ -30,6 +30,7 @@
 #include "../GenoInts.h"
 
 #include "../math/linear/GenoMatrix4.h"
+#include "../math/linear/GenoAffine2.h"
 
 #define GENO_SHADER_STRING_IS_SOURCE 0x00
 #define GENO_SHADER_STRING_IS_PATH   0x01
@@ -52,13 +53,36 @@ class GenoShader {
 class GenoMvpShader : public GenoShader {
 	private:
 		uint32 mvpLoc;
+		uint32 depthLoc;
+		bool affine;
+		float depthScale;
+		float depthOffset;
+
+		void findMvp();
 	protected:
 		GenoMvpShader(const char * vert, const char * frag, bool file);
 		GenoMvpShader(const char * vert, const char * frag, const char * geom, bool file);
 	public:
+
+		/**
+		 * Works whether the shader declares mvp as a mat4 or a mat3x2. A mat3x2 shader keeps the x and y rows and
+		 * takes that draw's depth mapping from the z row, so only orthographic matrices without z shear survive the trip.
+		**/
 		void setMvp(const GenoMatrix4f & mvp);
 		void setMvp(const float * mvp);
 
+		/**
+		 * Uploads eight floats instead of sixteen to a mat3x2 shader, a mat4 shader gets the expanded matrix.
+		 * z is mapped by the range from setDepthRange on every call.
+		**/
+		void setMvp(const GenoAffine2f & mvp);
+
+		/**
+		 * Sets the range the affine setMvp maps z from, like GenoMatrix4f::makeOrthographic. The default range is
+		 * [0, 1], what the game's GenoCamera2D uses. Takes effect on the next affine setMvp
+		**/
+		void setDepthRange(float near, float far);
+
 };
 
 #define GNARLY_GENOME_SHADER_FORWARD
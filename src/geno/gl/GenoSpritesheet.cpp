@@ -28,6 +28,8 @@
 
 #include "GenoGL.h"
 #include "../data/GenoImage.h"
+#include "../thread/GenoParallel.h"
+#include "../thread/GenoProfiler.h"
 #include "GenoSpritesheet.h"
 
 GenoSpritesheet::GenoSpritesheet() {}
@@ -50,6 +52,7 @@ GenoSpritesheet * GenoSpritesheet::create(const GenoSpritesheetCreateInfo & info
 		GenoImageCreateInfo imageInfo = {};
 		imageInfo.type = info.type;
 		imageInfo.path = info.texture;
+		imageInfo.pool = info.pool;
 
 		image = GenoImage::create(imageInfo);
 
@@ -76,20 +79,21 @@ GenoSpritesheet * GenoSpritesheet::create(const GenoSpritesheetCreateInfo & info
 		uint32 padWidth  = width  + 2;
 		uint32 padHeight = height + 2;
 		uint8 * newData = new uint8[fullPadWidth * fullPadHeight * 4];
-		uint32 numSprites = info.numSpritesX * info.numSpritesY;
-		uint32 numPixels  = padWidth * padHeight;
-		for (uint32 i = 0; i < numSprites; ++i) {
-			uint32 spriteX = i % info.numSpritesX;
-			uint32 spriteY = i / info.numSpritesX;
+		uint32 numSpritesX = info.numSpritesX;
+		uint32 numSprites  = info.numSpritesX * info.numSpritesY;
+		// One padded row of one sprite per index, sheets often hold only a handful of sprites
+		parallelFor(info.pool, 0, numSprites * padHeight, 8, [=](uint32 i) {
+			uint32 sprite  = i / padHeight;
+			uint32 pixelY  = i % padHeight;
+			uint32 spriteX = sprite % numSpritesX;
+			uint32 spriteY = sprite / numSpritesX;
 			uint32 padOffsetX = padWidth  * spriteX;
 			uint32 padOffsetY = padHeight * spriteY;
 			uint32 offsetX    = width     * spriteX;
 			uint32 offsetY    = height    * spriteY;
-			for (uint32 j = 0; j < numPixels; ++j) {
-				uint32 pixelX  = j % padWidth;
-				uint32 pixelY  = j / padWidth;
+			uint32 targetY = pixelY == padHeight - 1 ? pixelY - 2 : (pixelY > 0 ? pixelY - 1 : 0);
+			for (uint32 pixelX = 0; pixelX < padWidth; ++pixelX) {
 				uint32 targetX = pixelX == padWidth  - 1 ? pixelX - 2 : (pixelX > 0 ? pixelX - 1 : 0);
-				uint32 targetY = pixelY == padHeight - 1 ? pixelY - 2 : (pixelY > 0 ? pixelY - 1 : 0);
 				uint32 writeIndex = ((pixelY  + padOffsetY) * fullPadWidth + pixelX  + padOffsetX) * 4;
 				uint32 readIndex  = ((targetY + offsetY   ) * fullWidth    + targetX + offsetX   ) * 4;
 				newData[writeIndex    ] = data[readIndex    ];
@@ -97,7 +101,7 @@ GenoSpritesheet * GenoSpritesheet::create(const GenoSpritesheetCreateInfo & info
 				newData[writeIndex + 2] = data[readIndex + 2];
 				newData[writeIndex + 3] = data[readIndex + 3];
 			}
-		}
+		});
 		fullWidth  = padWidth  * info.numSpritesX;
 		fullHeight = padHeight * info.numSpritesY;
 		data = newData;
@@ -108,9 +112,12 @@ GenoSpritesheet * GenoSpritesheet::create(const GenoSpritesheetCreateInfo & info
 
 
 	uint32 id;
-	glGenTextures(1, &id);
-	glBindTexture(GL_TEXTURE_2D, id);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, fullWidth, fullHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+	{
+		GENO_PROFILE_ZONE("GenoSpritesheet upload");
+		glGenTextures(1, &id);
+		glBindTexture(GL_TEXTURE_2D, id);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, fullWidth, fullHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+	}
 
 	for (uint32 i = 0; i < info.numParams; ++i) {
 		uint32 index = i * 2;
@@ -127,8 +134,6 @@ GenoSpritesheet * GenoSpritesheet::create(const GenoSpritesheetCreateInfo & info
 	ret->paddingY         = paddingY;
 	ret->fractionalWidth  = fractionalWidth;
 	ret->fractionalHeight = fractionalHeight;
-	ret->scaleX           = fractionalWidth  - paddingX * 2;
-	ret->scaleY           = fractionalHeight - paddingY * 2;
 
 	if (cleanData)
 		delete [] data;
@@ -146,18 +151,15 @@ uint32 GenoSpritesheet::getHeight() const {
 }
 
 GenoMatrix4f GenoSpritesheet::getTransform(uint32 sprite) const {
-	return GenoMatrix4f::makeTranslateXY((sprite % numSpritesX) * fractionalWidth  + paddingX,
-	                                     (sprite / numSpritesX) * fractionalHeight + paddingY).scaleXY(scaleX, scaleY);
+	return makeTransform(sprite % numSpritesX, sprite / numSpritesX, fractionalWidth, fractionalHeight, paddingX, paddingY);
 }
 
 GenoMatrix4f GenoSpritesheet::getTransform(uint32 x, uint32 y) const {
-	return GenoMatrix4f::makeTranslateXY(x * fractionalWidth  + paddingX,
-	                                     y * fractionalHeight + paddingY).scaleXY(scaleX, scaleY);
+	return makeTransform(x, y, fractionalWidth, fractionalHeight, paddingX, paddingY);
 }
 
 GenoMatrix4f GenoSpritesheet::getTransform(const GenoVector2i & coords) const {
-	return GenoMatrix4f::makeTranslateXY(coords.v[0] * fractionalWidth  + paddingX,
-	                                     coords.v[1] * fractionalHeight + paddingY).scaleXY(scaleX, scaleY);
+	return makeTransform(coords.v[0], coords.v[1], fractionalWidth, fractionalHeight, paddingX, paddingY);
 }
 
 void GenoSpritesheet::bind(uint8 textureNum) const {
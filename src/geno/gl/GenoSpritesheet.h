@@ -31,6 +31,13 @@ class GenoTexture;
 
 #endif // GNARLY_GENOME_TEXTURE_FORWARD
 
+#ifndef GNARLY_GENOME_THREAD_POOL_FORWARD
+#define GNARLY_GENOME_THREAD_POOL_FORWARD
+
+class GenoThreadPool;
+
+#endif // GNARLY_GENOME_THREAD_POOL_FORWARD
+
 #ifndef GNARLY_GENOME_SPRITESHEET
 #define GNARLY_GENOME_SPRITESHEET
 
@@ -56,6 +63,8 @@ struct GenoSpritesheetCreateInfo {
 	uint8  * data;
 
 	const char * texture;
+
+	GenoThreadPool * pool;
 };
 
 class GenoSpritesheet : public GenoTexture {
@@ -69,12 +78,17 @@ class GenoSpritesheet : public GenoTexture {
 		float paddingY;
 		float fractionalWidth;
 		float fractionalHeight;
-		float scaleX;
-		float scaleY;
 
 		GenoSpritesheet();
 	public:
 		static GenoSpritesheet * create(const GenoSpritesheetCreateInfo & info);
+
+		static constexpr GenoMatrix4f makeTransform(uint32 x, uint32 y, float fractionalWidth, float fractionalHeight, float paddingX = 0, float paddingY = 0) {
+			return GenoMatrix4f::makeTranslateXY(x * fractionalWidth  + paddingX,
+			                                     y * fractionalHeight + paddingY).scaleXY(fractionalWidth  - paddingX * 2,
+			                                                                              fractionalHeight - paddingY * 2);
+		}
+
 		uint32 getWidth() const;
 		uint32 getHeight() const;
 
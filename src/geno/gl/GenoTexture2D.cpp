@@ -26,6 +26,7 @@
 
 #include "GenoGL.h"
 #include "../data/GenoImage.h"
+#include "../thread/GenoProfiler.h"
 
 #include "GenoTexture2D.h"
 
@@ -59,9 +60,12 @@ GenoTexture2D * GenoTexture2D::create(const GenoTexture2DCreateInfo & info) {
 	}
 
 	uint32 id;
-	glGenTextures(1, &id);
-	glBindTexture(GL_TEXTURE_2D, id);
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+	{
+		GENO_PROFILE_ZONE("GenoTexture2D upload");
+		glGenTextures(1, &id);
+		glBindTexture(GL_TEXTURE_2D, id);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data);
+	}
 	for (uint32 i = 0; i < info.numParams; ++i) {
 		uint32 index = i * 2;
 		glTexParameteri(GL_TEXTURE_2D, info.params[index], info.params[index + 1]);
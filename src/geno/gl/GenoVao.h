@@ -78,7 +78,7 @@ class GenoVao {
 		
 		template <typename T> void rebuffer(uint32 attrib, uint32 num, uint32 stride, const T * data) {
 			glBindVertexArray(vao);
-			glBindBuffer(GL_ARRAY_BUFFER, vbos[attribs]);
+			glBindBuffer(GL_ARRAY_BUFFER, vbos[attrib]);
 			glBufferSubData(GL_ARRAY_BUFFER, 0, stride * num * sizeof(T), data);
 		}
 
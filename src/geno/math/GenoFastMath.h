@@ -0,0 +1,77 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_GENOME_FAST_MATH
+#define GNARLY_GENOME_FAST_MATH
+
+#include <cmath>
+#include <cstring>
+
+#include "../GenoInts.h"
+#include "GenoSimd.h"
+
+/**
+ * Approximate square roots for code that can trade a little accuracy for speed, used by the fast* vector functions
+ *
+ * Maximum relative error against the exact 1 / std::sqrt(x) for normal positive floats:
+ *
+ * SSE    - rsqrtss estimate (1.5 * 2^-12) refined by one Newton-Raphson step, 5e-7
+ * scalar - bit level estimate (3.5e-2) refined by two Newton-Raphson steps, 5e-6
+ *
+ * Other types fall back to the exact expression. fastSqrt has the same bounds and fastSqrt(0) is 0.
+ * fastInverseSqrt of zero, negative, infinite or NaN values is undefined.
+ *
+ * Hardware sqrt and division are often as fast or faster, run FastMathBench before switching a call site over
+**/
+
+template <typename T>
+inline T fastInverseSqrt(T value) {
+	return 1 / std::sqrt(value);
+}
+
+template <>
+inline float fastInverseSqrt<float>(float value) {
+#if defined(GENO_SSE)
+	float estimate = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+	return estimate * (1.5f - 0.5f * value * estimate * estimate);
+#else
+	uint32 bits;
+	memcpy(&bits, &value, sizeof(float));
+	bits = 0x5F375A86 - (bits >> 1);
+	float estimate;
+	memcpy(&estimate, &bits, sizeof(float));
+	estimate *= 1.5f - 0.5f * value * estimate * estimate;
+	return estimate * (1.5f - 0.5f * value * estimate * estimate);
+#endif
+}
+
+template <typename T>
+inline T fastSqrt(T value) {
+	return value == 0 ? 0 : value * fastInverseSqrt(value);
+}
+
+#define GNARLY_GENOME_FAST_MATH_FORWARD
+#endif // GNARLY_GENOME_FAST_MATH
@@ -0,0 +1,261 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_GENOME_AFFINE2
+#define GNARLY_GENOME_AFFINE2
+
+#include <ostream>
+#include <cmath>
+
+#include "../../GenoInts.h"
+#include "GenoVector2.h"
+#include "GenoMatrix4.h"
+
+/**
+ * 2D affine transform stored as a column major 3x2 matrix
+ *
+ * | m[0] m[2] m[4] |
+ * | m[1] m[3] m[5] |
+ *
+ * The layout matches a GLSL mat3x2 so it uploads as six floats where a GenoMatrix4 needs sixteen.
+ * Transforms compose in the same order as GenoMatrix4: translate2D and scale2D multiply on the right.
+**/
+template <typename T>
+class GenoAffine2 {
+	public:
+		T m[6];
+
+		static constexpr GenoAffine2<T> makeIdentity() {
+			return {
+				1, 0, 0,
+				0, 1, 0
+			};
+		}
+
+		static constexpr GenoAffine2<T> makeOrthographic(T left, T right, T bottom, T top) {
+			return {
+				2 / (right - left), 0, (left + right) / (left - right),
+				0, 2 / (top - bottom), (bottom + top) / (bottom - top)
+			};
+		}
+
+		static constexpr GenoAffine2<T> makeTranslate2D(const GenoVector<2, T> & translate) {
+			return {
+				1, 0, translate.v[0],
+				0, 1, translate.v[1]
+			};
+		}
+
+		static constexpr GenoAffine2<T> makeScale2D(const GenoVector<2, T> & scale) {
+			return {
+				scale.v[0], 0, 0,
+				0, scale.v[1], 0
+			};
+		}
+
+		static GenoAffine2<T> makeRotate2D(T rotation) {
+			T sine   = sin(rotation);
+			T cosine = cos(rotation);
+			return {
+				cosine, -sine,   0,
+				sine,    cosine, 0
+			};
+		}
+
+		constexpr GenoAffine2() :
+			m() {}
+
+		constexpr GenoAffine2(T a, T b, T c,
+		                      T d, T e, T f) :
+			m {
+				a, d,
+				b, e,
+				c, f
+			} {}
+
+		constexpr GenoAffine2(const GenoAffine2<T> & affine) :
+			m {
+				affine.m[0], affine.m[1],
+				affine.m[2], affine.m[3],
+				affine.m[4], affine.m[5]
+			} {}
+
+		constexpr GenoAffine2<T> & operator=(const GenoAffine2<T> & affine) {
+			m[0] = affine.m[0]; m[1] = affine.m[1];
+			m[2] = affine.m[2]; m[3] = affine.m[3];
+			m[4] = affine.m[4]; m[5] = affine.m[5];
+			return *this;
+		}
+
+		constexpr GenoAffine2<T> & operator*=(const GenoAffine2<T> & affine) {
+			T newM[] = {
+				m[0] * affine.m[0] + m[2] * affine.m[1],
+				m[1] * affine.m[0] + m[3] * affine.m[1],
+				m[0] * affine.m[2] + m[2] * affine.m[3],
+				m[1] * affine.m[2] + m[3] * affine.m[3],
+				m[0] * affine.m[4] + m[2] * affine.m[5] + m[4],
+				m[1] * affine.m[4] + m[3] * affine.m[5] + m[5]
+			};
+			m[0] = newM[0]; m[1] = newM[1];
+			m[2] = newM[2]; m[3] = newM[3];
+			m[4] = newM[4]; m[5] = newM[5];
+			return *this;
+		}
+
+		constexpr GenoAffine2<T> & translate2D(const GenoVector<2, T> & translate) {
+			m[4] += m[0] * translate.v[0] + m[2] * translate.v[1];
+			m[5] += m[1] * translate.v[0] + m[3] * translate.v[1];
+			return *this;
+		}
+
+		constexpr GenoAffine2<T> & scale2D(T scale) {
+			m[0] *= scale; m[1] *= scale;
+			m[2] *= scale; m[3] *= scale;
+			return *this;
+		}
+
+		constexpr GenoAffine2<T> & scale2D(const GenoVector<2, T> & scale) {
+			m[0] *= scale.v[0]; m[1] *= scale.v[0];
+			m[2] *= scale.v[1]; m[3] *= scale.v[1];
+			return *this;
+		}
+
+		GenoAffine2<T> & rotate2D(T rotation) {
+			return *this *= makeRotate2D(rotation);
+		}
+
+		constexpr T getDeterminant() const {
+			return m[0] * m[3] - m[2] * m[1];
+		}
+
+		/**
+		 * Only defined for transforms with a non-zero determinant
+		**/
+		constexpr GenoAffine2<T> & invert() {
+			T inverseDeterminant = 1 / getDeterminant();
+			T newM[] = {
+				 m[3] * inverseDeterminant,
+				-m[1] * inverseDeterminant,
+				-m[2] * inverseDeterminant,
+				 m[0] * inverseDeterminant
+			};
+			T translateX = -(newM[0] * m[4] + newM[2] * m[5]);
+			T translateY = -(newM[1] * m[4] + newM[3] * m[5]);
+			m[0] = newM[0]; m[1] = newM[1];
+			m[2] = newM[2]; m[3] = newM[3];
+			m[4] = translateX;
+			m[5] = translateY;
+			return *this;
+		}
+
+		constexpr GenoVector<2, T> apply(const GenoVector<2, T> & point) const {
+			return {
+				m[0] * point.v[0] + m[2] * point.v[1] + m[4],
+				m[1] * point.v[0] + m[3] * point.v[1] + m[5]
+			};
+		}
+
+		constexpr GenoVector<2, T> applyDirection(const GenoVector<2, T> & direction) const {
+			return {
+				m[0] * direction.v[0] + m[2] * direction.v[1],
+				m[1] * direction.v[0] + m[3] * direction.v[1]
+			};
+		}
+
+		/**
+		 * Equivalent GenoMatrix4 that leaves z untouched, for shaders that still take a mat4
+		**/
+		constexpr GenoMatrix<4, 4, T> getMatrix4() const {
+			return {{
+				m[0], m[1], 0, 0,
+				m[2], m[3], 0, 0,
+				0,    0,    1, 0,
+				m[4], m[5], 0, 1
+			}};
+		}
+};
+
+template <typename T>
+constexpr GenoAffine2<T> operator*(const GenoAffine2<T> & left, const GenoAffine2<T> & right) {
+	return GenoAffine2<T>(left) *= right;
+}
+
+template <typename T>
+constexpr GenoVector<2, T> operator*(const GenoAffine2<T> & affine, const GenoVector<2, T> & point) {
+	return affine.apply(point);
+}
+
+template <typename T, typename E>
+constexpr GenoVector<2, T> operator*(const GenoAffine2<T> & affine, const GenoVectorExpression<2, T, E> & point) {
+	return affine.apply(point);
+}
+
+template <typename T>
+constexpr GenoAffine2<T> translate2D(const GenoAffine2<T> & affine, const GenoVector<2, T> & translate) {
+	return GenoAffine2<T>(affine).translate2D(translate);
+}
+
+template <typename T, typename E>
+constexpr GenoAffine2<T> translate2D(const GenoAffine2<T> & affine, const GenoVectorExpression<2, T, E> & translate) {
+	return GenoAffine2<T>(affine).translate2D(translate);
+}
+
+template <typename T>
+constexpr GenoAffine2<T> scale2D(const GenoAffine2<T> & affine, T scale) {
+	return GenoAffine2<T>(affine).scale2D(scale);
+}
+
+template <typename T>
+constexpr GenoAffine2<T> scale2D(const GenoAffine2<T> & affine, const GenoVector<2, T> & scale) {
+	return GenoAffine2<T>(affine).scale2D(scale);
+}
+
+template <typename T, typename E>
+constexpr GenoAffine2<T> scale2D(const GenoAffine2<T> & affine, const GenoVectorExpression<2, T, E> & scale) {
+	return GenoAffine2<T>(affine).scale2D(scale);
+}
+
+template <typename T>
+GenoAffine2<T> rotate2D(const GenoAffine2<T> & affine, T rotation) {
+	return affine * GenoAffine2<T>::makeRotate2D(rotation);
+}
+
+template <typename T>
+constexpr GenoAffine2<T> invert(const GenoAffine2<T> & affine) {
+	return GenoAffine2<T>(affine).invert();
+}
+
+template <typename T>
+std::ostream & operator<<(std::ostream & stream, const GenoAffine2<T> & affine) {
+	return stream << '[' << affine.m[0] << ", " << affine.m[2] << ", " << affine.m[4] << "]\n"
+	                 "[" << affine.m[1] << ", " << affine.m[3] << ", " << affine.m[5] << "]\n";
+}
+
+using GenoAffine2f = GenoAffine2<float >;
+using GenoAffine2d = GenoAffine2<double>;
+
+#define GNARLY_GENOME_AFFINE2_FORWARD
+#endif // GNARLY_GENOME_AFFINE2
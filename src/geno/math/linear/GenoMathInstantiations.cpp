@@ -0,0 +1,55 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+/**
+ * The single home of the float, double and int32 instantiations declared extern in the headers
+ *
+ * GENO_MATH_INSTANTIATIONS hides those extern declarations here. Members a header used before the definitions below
+ * are then instantiated like any other template instead of being left to a later definition, which GCC does not emit,
+ * so the headers can be included in any order
+**/
+#define GENO_MATH_INSTANTIATIONS
+
+#include "GenoMatrix4.h"
+#include "GenoVector2.h"
+#include "GenoVector3.h"
+#include "GenoVector4.h"
+
+template class GenoVector<2, float >;
+template class GenoVector<2, double>;
+template class GenoVector<2,  int32>;
+
+template class GenoVector<3, float >;
+template class GenoVector<3, double>;
+template class GenoVector<3,  int32>;
+
+template class GenoVector<4, float >;
+template class GenoVector<4, double>;
+template class GenoVector<4,  int32>;
+
+template class GenoMatrix<4, 4, float >;
+template class GenoMatrix<4, 4, double>;
+template class GenoMatrix<4, 4,  int32>;
@@ -41,6 +41,7 @@ class GenoVector;
 #include <initializer_list>
 
 #include "GenoVector.h"
+#include "GenoVectorView.h"
 
 template <uint32 N, uint32 M, typename T>
 class GenoMatrix {
@@ -117,8 +118,8 @@ class GenoMatrix {
 			return *this;
 		}
 
-		GenoVector<M, T> operator[](uint32 index) const noexcept {
-			return GenoVector<M, T>(index * M, false);
+		GenoVectorView<M, T> operator[](uint32 index) const noexcept {
+			return m + index * M;
 		}
 
 		~GenoMatrix() {
@@ -83,930 +83,898 @@ class GenoMatrix<N, N, T>;
 #include "GenoVector2.h"
 #include "GenoVector3.h"
 #include "GenoVector4.h"
+#include "GenoVectorView.h"
 #include "GenoMatrixN.h"
 
 template <typename T>
 class GenoMatrix<4, 4, T> {
-	private:
-		bool owner = true;
-
-		void clean() {
-			if (owner)
-				delete [] m;
-		}
 	public:
-		T * m;
+		alignas(16) T m[4 * 4];
 
-		static GenoMatrix<4, 4, T> makeIdentity() {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeIdentity() {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeOrthographic(T left, T right, T bottom, T top, T near, T far) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeOrthographic(T left, T right, T bottom, T top, T near, T far) {
+			return {{
 				2 / (right - left), 0, 0, 0,
 				0, 2 / (top - bottom), 0, 0,
 				0, 0, 2 / (far  -  near), 0,
 				(left + right) / (left - right), (bottom + top) / (bottom - top), (near + far) / (near - far), 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makePerspective(T fovY, T aspectRatio, T near, T far) {
-			auto vertical = 1 / tan(fovY / 2);
-			return new T[4 * 4] {
+			T vertical = 1 / tan(fovY / 2);
+			return {{
 				vertical / aspectRatio, 0, 0, 0,
 				0, vertical, 0, 0,
 				0, 0, (near + far) / (near - far), -1,
 				0, 0, (2 * far * near) / (near - far), 0
-			};
+			}};
 		}
 		
 		static GenoMatrix<4, 4, T> makeShear2D(T axisAngle, T shearAngle) {
-			auto sinAxis = sin(axisAngle);
-			auto cosAxis = cos(axisAngle);
-			auto tanShear = tan(shearAngle);
-			return new T[4 * 4] {
+			T sinAxis = sin(axisAngle);
+			T cosAxis = cos(axisAngle);
+			T tanShear = tan(shearAngle);
+			return {{
 				sinAxis * tanShear * cosAxis, -cosAxis * tanShear * cosAxis, 0, 0,
 				sinAxis * tanShear * sinAxis, -cosAxis * tanShear * sinAxis, 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 		
 		static GenoMatrix<4, 4, T> makeShear2D(const GenoVector<2, T> & axis, T shearAngle) {
 			auto unitAxis = normalize(axis); 
-			auto tanShear = tan(shearAngle);
-			return new T[4 * 4] {
+			T tanShear = tan(shearAngle);
+			return {{
 				unitAxis.v[1] * tanShear * unitAxis.v[0], -unitAxis.v[0] * tanShear * unitAxis.v[0], 0, 0,
 				unitAxis.v[1] * tanShear * unitAxis.v[1], -unitAxis.v[0] * tanShear * unitAxis.v[1], 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 		
 		static GenoMatrix<4, 4, T> makeShear2D(T axisAngle, const GenoVector<2, T> & shear) {
-			auto sinAxis = sin(axisAngle);
-			auto cosAxis = cos(axisAngle);
+			T sinAxis = sin(axisAngle);
+			T cosAxis = cos(axisAngle);
 			auto tanShear = shear.v[1] / shear.v[0];
-			return new T[4 * 4] {
+			return {{
 				sinAxis * tanShear * cosAxis, -cosAxis * tanShear * cosAxis, 0, 0,
 				sinAxis * tanShear * sinAxis, -cosAxis * tanShear * sinAxis, 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 		
 		static GenoMatrix<4, 4, T> makeShear2D(const GenoVector<2, T> & axis, const GenoVector<2, T> & shear) {
 			auto unitAxis = normalize(axis);
 			auto tanShear = shear.v[1] / shear.v[0];
-			return new T[4 * 4] {
+			return {{
 				unitAxis.v[1] * tanShear * unitAxis.v[0], -unitAxis.v[0] * tanShear * unitAxis.v[0], 0, 0,
 				unitAxis.v[1] * tanShear * unitAxis.v[1], -unitAxis.v[0] * tanShear * unitAxis.v[1], 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 		
 		static GenoMatrix<4, 4, T> makeShear2DX(T angle) {
-			return new T[4 * 4] {
-				1, -tan(angle), 0, 0,
+			return {{
+				1, (T) -tan(angle), 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 		
-		static GenoMatrix<4, 4, T> makeShear2DX(const GenoVector<2, T> & shear) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeShear2DX(const GenoVector<2, T> & shear) {
+			return {{
 				1, -shear.v[1] / shear.v[0], 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 		
 		static GenoMatrix<4, 4, T> makeShear2DY(T angle) {
-			return new T[4 * 4] {
+			return {{
 				1, 0, 0, 0,
-				tan(angle), 1, 0, 0,
+				(T) tan(angle), 1, 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 		
-		static GenoMatrix<4, 4, T> makeShear2DY(const GenoVector<2, T> & shear) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeShear2DY(const GenoVector<2, T> & shear) {
+			return {{
 				1, 0, 0, 0,
 				shear.v[1] / shear.v[0], 1, 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslate2D(T translateX, T translateY) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslate2D(T translateX, T translateY) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translateX, translateY, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslate2D(const GenoVector<2, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslate2D(const GenoVector<2, T> & translate) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translate.v[0], translate.v[1], 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslate(T translateX, T translateY, T translateZ) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslate(T translateX, T translateY, T translateZ) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translateX, translateY, translateZ, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslate(const GenoVector<3, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslate(const GenoVector<3, T> & translate) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translate.v[0], translate.v[1], translate.v[2], 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotate2D(T rotation) {
-			auto sinZ = sin(rotation);
-			auto cosZ = cos(rotation);
-			return new T[4 * 4] {
+			T sinZ = sin(rotation);
+			T cosZ = cos(rotation);
+			return {{
 				cosZ, sinZ, 0, 0,
 				-sinZ, cosZ, 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScale2D(T scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScale2D(T scale) {
+			return {{
 				scale, 0, 0, 0,
 				0, scale, 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScale2D(T scaleX, T scaleY) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScale2D(T scaleX, T scaleY) {
+			return {{
 				scaleX, 0, 0, 0,
 				0, scaleY, 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScale2D(const GenoVector<2, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScale2D(const GenoVector<2, T> & scale) {
+			return {{
 				scale.v[0], 0, 0, 0,
 				0, scale.v[1], 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScale(T scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScale(T scale) {
+			return {{
 				scale, 0, 0, 0,
 				0, scale, 0, 0,
 				0, 0, scale, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScale(T scaleX, T scaleY, T scaleZ) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScale(T scaleX, T scaleY, T scaleZ) {
+			return {{
 				scaleX, 0, 0, 0,
 				0, scaleY, 0, 0,
 				0, 0, scaleZ, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScale(const GenoVector<3, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScale(const GenoVector<3, T> & scale) {
+			return {{
 				scale.v[0], 0, 0, 0,
 				0, scale.v[1], 0, 0,
 				0, 0, scale.v[2], 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateX(T translateX) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateX(T translateX) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translateX, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateY(T translateY) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateY(T translateY) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				0, translateY, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateZ(T translateZ) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateZ(T translateZ) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				0, 0, translateZ, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateXY(T translateX, T translateY) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateXY(T translateX, T translateY) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translateX, translateY, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateXY(const GenoVector<2, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateXY(const GenoVector<2, T> & translate) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translate.v[0], translate.v[1], 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateXZ(T translateX, T translateZ) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateXZ(T translateX, T translateZ) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translateX, 0, translateZ, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateXZ(const GenoVector<2, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateXZ(const GenoVector<2, T> & translate) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translate.v[0], 0, translate.v[1], 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateYX(const GenoVector<2, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateYX(const GenoVector<2, T> & translate) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translate.v[1], translate.v[0], 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateYZ(T translateY, T translateZ) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateYZ(T translateY, T translateZ) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				0, translateY, translateZ, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateYZ(const GenoVector<2, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateYZ(const GenoVector<2, T> & translate) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				0, translate.v[0], translate.v[1], 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateZX(const GenoVector<2, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateZX(const GenoVector<2, T> & translate) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translate.v[1], 0, translate.v[0], 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateZY(const GenoVector<2, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateZY(const GenoVector<2, T> & translate) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				0, translate.v[1], translate.v[0], 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateXYZ(T translateX, T translateY, T translateZ) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateXYZ(T translateX, T translateY, T translateZ) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translateX, translateY, translateZ, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateXYZ(const GenoVector<3, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateXYZ(const GenoVector<3, T> & translate) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translate.v[0], translate.v[1], translate.v[2], 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateXZY(const GenoVector<3, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateXZY(const GenoVector<3, T> & translate) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translate.v[0], translate.v[2], translate.v[1], 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateYXZ(const GenoVector<3, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateYXZ(const GenoVector<3, T> & translate) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translate.v[1], translate.v[0], translate.v[2], 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateYZX(const GenoVector<3, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateYZX(const GenoVector<3, T> & translate) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translate.v[2], translate.v[0], translate.v[1], 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateZXY(const GenoVector<3, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateZXY(const GenoVector<3, T> & translate) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translate.v[1], translate.v[2], translate.v[0], 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeTranslateZYX(const GenoVector<3, T> & translate) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeTranslateZYX(const GenoVector<3, T> & translate) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				translate.v[2], translate.v[1], translate.v[0], 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateX(T rotateX) {
-			auto sinX = sin(rotateX);
-			auto cosX = cos(rotateX);
-			return new T[4 * 4] {
+			T sinX = sin(rotateX);
+			T cosX = cos(rotateX);
+			return {{
 				1, 0, 0, 0,
 				0, cosX, sinX, 0,
 				0, -sinX, cosX, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateY(T rotateY) {
-			auto sinY = sin(rotateY);
-			auto cosY = cos(rotateY);
-			return new T[4 * 4] {
+			T sinY = sin(rotateY);
+			T cosY = cos(rotateY);
+			return {{
 				cosY, 0, -sinY, 0,
 				0, 1, 0, 0,
 				sinY, 0, cosY, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateZ(T rotateZ) {
-			auto sinZ = sin(rotateZ);
-			auto cosZ = cos(rotateZ);
-			return new T[4 * 4] {
+			T sinZ = sin(rotateZ);
+			T cosZ = cos(rotateZ);
+			return {{
 				cosZ, sinZ, 0, 0,
 				-sinZ, cosZ, 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateXY(T rotateX, T rotateY) {
-			auto sinX = sin(rotateX);
-			auto cosX = cos(rotateX);
-			auto sinY = sin(rotateY);
-			auto cosY = cos(rotateY);
-			return new T[4 * 4] {
+			T sinX = sin(rotateX);
+			T cosX = cos(rotateX);
+			T sinY = sin(rotateY);
+			T cosY = cos(rotateY);
+			return {{
 				cosY, 0, -sinY, 0,
 				sinY * sinX, cosX, cosY * sinX, 0,
 				sinY * cosX, -sinX, cosY * cosX, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateXY(const GenoVector<2, T> & rotate) {
-			auto sinX = sin(rotate.v[0]);
-			auto cosX = cos(rotate.v[0]);
-			auto sinY = sin(rotate.v[1]);
-			auto cosY = cos(rotate.v[1]);
-			return new T[4 * 4] {
+			T sinX = sin(rotate.v[0]);
+			T cosX = cos(rotate.v[0]);
+			T sinY = sin(rotate.v[1]);
+			T cosY = cos(rotate.v[1]);
+			return {{
 				cosY, 0, -sinY, 0,
 				sinY * sinX, cosX, cosY * sinX, 0,
 				sinY * cosX, -sinX, cosY * cosX, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateXZ(T rotateX, T rotateZ) {
-			auto sinX = sin(rotateX);
-			auto cosX = cos(rotateX);
-			auto sinZ = sin(rotateZ);
-			auto cosZ = cos(rotateZ);
-			return new T[4 * 4] {
+			T sinX = sin(rotateX);
+			T cosX = cos(rotateX);
+			T sinZ = sin(rotateZ);
+			T cosZ = cos(rotateZ);
+			return {{
 				cosZ, sinZ, 0, 0,
 				-sinZ * cosX, cosZ * cosX, sinX, 0,
 				sinZ * sinX, -cosZ * sinX, cosX, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateXZ(const GenoVector<2, T> & rotate) {
-			auto sinX = sin(rotate.v[0]);
-			auto cosX = cos(rotate.v[0]);
-			auto sinZ = sin(rotate.v[1]);
-			auto cosZ = cos(rotate.v[1]);
-			return new T[4 * 4] {
+			T sinX = sin(rotate.v[0]);
+			T cosX = cos(rotate.v[0]);
+			T sinZ = sin(rotate.v[1]);
+			T cosZ = cos(rotate.v[1]);
+			return {{
 				cosZ, sinZ, 0, 0,
 				-sinZ * cosX, cosZ * cosX, sinX, 0,
 				sinZ * sinX, -cosZ * sinX, cosX, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateYX(const GenoVector<2, T> & rotate) {
-			auto sinX = sin(rotate.v[1]);
-			auto cosX = cos(rotate.v[1]);
-			auto sinY = sin(rotate.v[0]);
-			auto cosY = cos(rotate.v[0]);
-			return new T[4 * 4] {
+			T sinX = sin(rotate.v[1]);
+			T cosX = cos(rotate.v[1]);
+			T sinY = sin(rotate.v[0]);
+			T cosY = cos(rotate.v[0]);
+			return {{
 				cosY, sinX * sinY, -cosX * sinY, 0,
 				0, cosX, sinX, 0,
 				sinY, -sinX * cosY, cosX * cosY, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateYZ(T rotateY, T rotateZ) {
-			auto sinY = sin(rotateY);
-			auto cosY = cos(rotateY);
-			auto sinZ = sin(rotateZ);
-			auto cosZ = cos(rotateZ);
-			return new T[4 * 4] {
+			T sinY = sin(rotateY);
+			T cosY = cos(rotateY);
+			T sinZ = sin(rotateZ);
+			T cosZ = cos(rotateZ);
+			return {{
 				cosZ * cosY, sinZ * cosY, -sinY, 0,
 				-sinZ, cosZ, 0, 0,
 				cosZ * sinY, sinZ * sinY, cosY, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateYZ(const GenoVector<2, T> & rotate) {
-			auto sinY = sin(rotate.v[0]);
-			auto cosY = cos(rotate.v[0]);
-			auto sinZ = sin(rotate.v[1]);
-			auto cosZ = cos(rotate.v[1]);
-			return new T[4 * 4] {
+			T sinY = sin(rotate.v[0]);
+			T cosY = cos(rotate.v[0]);
+			T sinZ = sin(rotate.v[1]);
+			T cosZ = cos(rotate.v[1]);
+			return {{
 				cosZ * cosY, sinZ * cosY, -sinY, 0,
 				-sinZ, cosZ, 0, 0,
 				cosZ * sinY, sinZ * sinY, cosY, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateZX(const GenoVector<2, T> & rotate) {
-			auto sinX = sin(rotate.v[1]);
-			auto cosX = cos(rotate.v[1]);
-			auto sinZ = sin(rotate.v[0]);
-			auto cosZ = cos(rotate.v[0]);
-			return new T[4 * 4] {
+			T sinX = sin(rotate.v[1]);
+			T cosX = cos(rotate.v[1]);
+			T sinZ = sin(rotate.v[0]);
+			T cosZ = cos(rotate.v[0]);
+			return {{
 				cosZ, cosX * sinZ, sinX * sinZ, 0,
 				-sinZ, cosX * cosZ, sinX * cosZ, 0,
 				0, -sinX, cosX, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateZY(const GenoVector<2, T> & rotate) {
-			auto sinY = sin(rotate.v[1]);
-			auto cosY = cos(rotate.v[1]);
-			auto sinZ = sin(rotate.v[0]);
-			auto cosZ = cos(rotate.v[0]);
-			return new T[4 * 4] {
+			T sinY = sin(rotate.v[1]);
+			T cosY = cos(rotate.v[1]);
+			T sinZ = sin(rotate.v[0]);
+			T cosZ = cos(rotate.v[0]);
+			return {{
 				cosY * cosZ, sinZ, -sinY * cosZ, 0,
 				-cosY * sinZ, cosZ, sinY * sinZ, 0,
 				sinY, 0, cosY, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateXYZ(T rotateX, T rotateY, T rotateZ) {
-			auto sinX = sin(rotateX);
-			auto cosX = cos(rotateX);
-			auto sinY = sin(rotateY);
-			auto cosY = cos(rotateY);
-			auto sinZ = sin(rotateZ);
-			auto cosZ = cos(rotateZ);
-			return new T[4 * 4] {
+			T sinX = sin(rotateX);
+			T cosX = cos(rotateX);
+			T sinY = sin(rotateY);
+			T cosY = cos(rotateY);
+			T sinZ = sin(rotateZ);
+			T cosZ = cos(rotateZ);
+			return {{
 				cosZ * cosY, sinZ * cosY, -sinY, 0,
 				-sinZ * cosX + cosZ * sinY * sinX, cosZ * cosX + sinZ * sinY * sinX, cosY * sinX, 0,
 				sinZ * sinX + cosZ * sinY * cosX, -cosZ * sinX + sinZ * sinY * cosX, cosY * cosX, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateXYZ(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[0]);
-			auto cosX = cos(rotate.v[0]);
-			auto sinY = sin(rotate.v[1]);
-			auto cosY = cos(rotate.v[1]);
-			auto sinZ = sin(rotate.v[2]);
-			auto cosZ = cos(rotate.v[2]);
-			return new T[4 * 4] {
+			T sinX = sin(rotate.v[0]);
+			T cosX = cos(rotate.v[0]);
+			T sinY = sin(rotate.v[1]);
+			T cosY = cos(rotate.v[1]);
+			T sinZ = sin(rotate.v[2]);
+			T cosZ = cos(rotate.v[2]);
+			return {{
 				cosZ * cosY, sinZ * cosY, -sinY, 0,
 				-sinZ * cosX + cosZ * sinY * sinX, cosZ * cosX + sinZ * sinY * sinX, cosY * sinX, 0,
 				sinZ * sinX + cosZ * sinY * cosX, -cosZ * sinX + sinZ * sinY * cosX, cosY * cosX, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateXZY(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[0]);
-			auto cosX = cos(rotate.v[0]);
-			auto sinY = sin(rotate.v[2]);
-			auto cosY = cos(rotate.v[2]);
-			auto sinZ = sin(rotate.v[1]);
-			auto cosZ = cos(rotate.v[1]);
-			return new T[4 * 4] {
+			T sinX = sin(rotate.v[0]);
+			T cosX = cos(rotate.v[0]);
+			T sinY = sin(rotate.v[2]);
+			T cosY = cos(rotate.v[2]);
+			T sinZ = sin(rotate.v[1]);
+			T cosZ = cos(rotate.v[1]);
+			return {{
 				cosY * cosZ, sinZ, -sinY * cosZ, 0,
 				-cosY * sinZ * cosX + sinY * sinX, cosZ * cosX, sinY * sinZ * cosX + cosY * sinX, 0,
 				cosY * sinZ * sinX + sinY * cosX, -cosZ * sinX, -sinY * sinZ * sinX + cosY * cosX, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateYXZ(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[1]);
-			auto cosX = cos(rotate.v[1]);
-			auto sinY = sin(rotate.v[0]);
-			auto cosY = cos(rotate.v[0]);
-			auto sinZ = sin(rotate.v[2]);
-			auto cosZ = cos(rotate.v[2]);
-			return new T[4 * 4] {
+			T sinX = sin(rotate.v[1]);
+			T cosX = cos(rotate.v[1]);
+			T sinY = sin(rotate.v[0]);
+			T cosY = cos(rotate.v[0]);
+			T sinZ = sin(rotate.v[2]);
+			T cosZ = cos(rotate.v[2]);
+			return {{
 				cosZ * cosY - sinZ * sinX * sinY, sinZ * cosY + cosZ * sinX * sinY, -cosX * sinY, 0,
 				-sinZ * cosX, cosZ * cosX, sinX, 0,
 				cosZ * sinY + sinZ * sinX * cosY, sinZ * sinY - cosZ * sinX * cosY, cosX * cosY, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateYZX(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[2]);
-			auto cosX = cos(rotate.v[2]);
-			auto sinY = sin(rotate.v[0]);
-			auto cosY = cos(rotate.v[0]);
-			auto sinZ = sin(rotate.v[1]);
-			auto cosZ = cos(rotate.v[1]);
-			return new T[4 * 4] {
+			T sinX = sin(rotate.v[2]);
+			T cosX = cos(rotate.v[2]);
+			T sinY = sin(rotate.v[0]);
+			T cosY = cos(rotate.v[0]);
+			T sinZ = sin(rotate.v[1]);
+			T cosZ = cos(rotate.v[1]);
+			return {{
 				cosZ * cosY, cosX * sinZ * cosY + sinX * sinY, sinX * sinZ * cosY - cosX * sinY, 0,
 				-sinZ, cosX * cosZ, sinX * cosZ, 0,
 				cosZ * sinY, cosX * sinZ * sinY - sinX * cosY, sinX * sinZ * sinY + cosX * cosY, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateZXY(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[1]);
-			auto cosX = cos(rotate.v[1]);
-			auto sinY = sin(rotate.v[2]);
-			auto cosY = cos(rotate.v[2]);
-			auto sinZ = sin(rotate.v[0]);
-			auto cosZ = cos(rotate.v[0]);
-			return new T[4 * 4] {
+			T sinX = sin(rotate.v[1]);
+			T cosX = cos(rotate.v[1]);
+			T sinY = sin(rotate.v[2]);
+			T cosY = cos(rotate.v[2]);
+			T sinZ = sin(rotate.v[0]);
+			T cosZ = cos(rotate.v[0]);
+			return {{
 				cosY * cosZ + sinY * sinX * sinZ, cosX * sinZ, -sinY * cosZ + cosY * sinX * sinZ, 0,
 				-cosY * sinZ + sinY * sinX * cosZ, cosX * cosZ, sinY * sinZ + cosY * sinX * cosZ, 0,
 				sinY * cosX, -sinX, cosY * cosX, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
 		static GenoMatrix<4, 4, T> makeRotateZYX(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[2]);
-			auto cosX = cos(rotate.v[2]);
-			auto sinY = sin(rotate.v[1]);
-			auto cosY = cos(rotate.v[1]);
-			auto sinZ = sin(rotate.v[0]);
-			auto cosZ = cos(rotate.v[0]);
-			return new T[4 * 4] {
+			T sinX = sin(rotate.v[2]);
+			T cosX = cos(rotate.v[2]);
+			T sinY = sin(rotate.v[1]);
+			T cosY = cos(rotate.v[1]);
+			T sinZ = sin(rotate.v[0]);
+			T cosZ = cos(rotate.v[0]);
+			return {{
 				cosY * cosZ, sinX * sinY * cosZ + cosX * sinZ, -cosX * sinY * cosZ + sinX * sinZ, 0,
 				-cosY * sinZ, -sinX * sinY * sinZ + cosX * cosZ, cosX * sinY * sinZ + sinX * cosZ, 0,
 				sinY, -sinX * cosY, cosX * cosY, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleX(T scaleX) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleX(T scaleX) {
+			return {{
 				scaleX, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleY(T scaleY) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleY(T scaleY) {
+			return {{
 				1, 0, 0, 0,
 				0, scaleY, 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleZ(T scaleZ) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleZ(T scaleZ) {
+			return {{
 				1, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, scaleZ, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleXY(T scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleXY(T scale) {
+			return {{
 				scale, 0, 0, 0,
 				0, scale, 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleXY(T scaleX, T scaleY) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleXY(T scaleX, T scaleY) {
+			return {{
 				scaleX, 0, 0, 0,
 				0, scaleY, 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleXY(const GenoVector<2, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleXY(const GenoVector<2, T> & scale) {
+			return {{
 				scale.v[0], 0, 0, 0,
 				0, scale.v[1], 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleXZ(T scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleXZ(T scale) {
+			return {{
 				scale, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, scale, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleXZ(T scaleX, T scaleZ) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleXZ(T scaleX, T scaleZ) {
+			return {{
 				scaleX, 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, scaleZ, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleXZ(const GenoVector<2, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleXZ(const GenoVector<2, T> & scale) {
+			return {{
 				scale.v[0], 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, scale.v[1], 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleYX(const GenoVector<2, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleYX(const GenoVector<2, T> & scale) {
+			return {{
 				scale.v[1], 0, 0, 0,
 				0, scale.v[0], 0, 0,
 				0, 0, 1, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleYZ(T scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleYZ(T scale) {
+			return {{
 				1, 0, 0, 0,
 				0, scale, 0, 0,
 				0, 0, scale, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleYZ(T scaleY, T scaleZ) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleYZ(T scaleY, T scaleZ) {
+			return {{
 				1, 0, 0, 0,
 				0, scaleY, 0, 0,
 				0, 0, scaleZ, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleYZ(const GenoVector<2, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleYZ(const GenoVector<2, T> & scale) {
+			return {{
 				1, 0, 0, 0,
 				0, scale.v[0], 0, 0,
 				0, 0, scale.v[1], 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleZX(const GenoVector<2, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleZX(const GenoVector<2, T> & scale) {
+			return {{
 				scale.v[1], 0, 0, 0,
 				0, 1, 0, 0,
 				0, 0, scale.v[0], 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleZY(const GenoVector<2, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleZY(const GenoVector<2, T> & scale) {
+			return {{
 				1, 0, 0, 0,
 				0, scale.v[1], 0, 0,
 				0, 0, scale.v[0], 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleXYZ(T scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleXYZ(T scale) {
+			return {{
 				scale, 0, 0, 0,
 				0, scale, 0, 0,
 				0, 0, scale, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleXYZ(T scaleX, T scaleY, T scaleZ) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleXYZ(T scaleX, T scaleY, T scaleZ) {
+			return {{
 				scaleX, 0, 0, 0,
 				0, scaleY, 0, 0,
 				0, 0, scaleZ, 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleXYZ(const GenoVector<3, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleXYZ(const GenoVector<3, T> & scale) {
+			return {{
 				scale.v[0], 0, 0, 0,
 				0, scale.v[1], 0, 0,
 				0, 0, scale.v[2], 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleXZY(const GenoVector<3, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleXZY(const GenoVector<3, T> & scale) {
+			return {{
 				scale.v[0], 0, 0, 0,
 				0, scale.v[2], 0, 0,
 				0, 0, scale.v[1], 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleYXZ(const GenoVector<3, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleYXZ(const GenoVector<3, T> & scale) {
+			return {{
 				scale.v[1], 0, 0, 0,
 				0, scale.v[0], 0, 0,
 				0, 0, scale.v[2], 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleYZX(const GenoVector<3, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleYZX(const GenoVector<3, T> & scale) {
+			return {{
 				scale.v[2], 0, 0, 0,
 				0, scale.v[0], 0, 0,
 				0, 0, scale.v[1], 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleZXY(const GenoVector<3, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleZXY(const GenoVector<3, T> & scale) {
+			return {{
 				scale.v[1], 0, 0, 0,
 				0, scale.v[2], 0, 0,
 				0, 0, scale.v[0], 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		static GenoMatrix<4, 4, T> makeScaleZYX(const GenoVector<3, T> & scale) {
-			return new T[4 * 4] {
+		static constexpr GenoMatrix<4, 4, T> makeScaleZYX(const GenoVector<3, T> & scale) {
+			return {{
 				scale.v[2], 0, 0, 0,
 				0, scale.v[1], 0, 0,
 				0, 0, scale.v[0], 0,
 				0, 0, 0, 1
-			};
+			}};
 		}
 
-		GenoMatrix() :
-			m(new T[4 * 4]()) {}
+		constexpr GenoMatrix() :
+			m() {}
 
-		GenoMatrix(T * m, bool owner = true) noexcept :
-			owner(owner),
-			m(m) {}
+		constexpr GenoMatrix(const T (& matrix)[4 * 4]) :
+			m {
+				matrix[0 ], matrix[1 ], matrix[2 ], matrix[3 ],
+				matrix[4 ], matrix[5 ], matrix[6 ], matrix[7 ],
+				matrix[8 ], matrix[9 ], matrix[10], matrix[11],
+				matrix[12], matrix[13], matrix[14], matrix[15]
+			} {}
 		
-		GenoMatrix(T a, T b, T c, T d,
+		constexpr GenoMatrix(T a, T b, T c, T d,
 				   T e, T f, T g, T h,
 				   T i, T j, T k, T l,
 				   T m, T n, T o, T p) :
-			m(new T[4 * 4] {
+			m {
 				a, e, i, m,
 				b, f, j, n,
 				c, g, k, o,
 				d, h, l, p
-			}) {}
+			} {}
 
 		template <typename T2>
-		GenoMatrix(const GenoMatrix<4, 4, T2> & matrix) :
-			m(new T[4 * 4]) {
-			m[0 ] = (T) matrix.m[0 ];
-			m[1 ] = (T) matrix.m[1 ];
-			m[2 ] = (T) matrix.m[2 ];
-			m[3 ] = (T) matrix.m[3 ];
-			m[4 ] = (T) matrix.m[4 ];
-			m[5 ] = (T) matrix.m[5 ];
-			m[6 ] = (T) matrix.m[6 ];
-			m[7 ] = (T) matrix.m[7 ];
-			m[8 ] = (T) matrix.m[8 ];
-			m[9 ] = (T) matrix.m[9 ];
-			m[10] = (T) matrix.m[10];
-			m[11] = (T) matrix.m[11];
-			m[12] = (T) matrix.m[12];
-			m[13] = (T) matrix.m[13];
-			m[14] = (T) matrix.m[14];
-			m[15] = (T) matrix.m[15];
-		}
-
-		GenoMatrix(const GenoMatrix<4, 4, T> & matrix) :
-			m(new T[4 * 4]) {
-			m[0 ] = matrix.m[0 ];
-			m[1 ] = matrix.m[1 ];
-			m[2 ] = matrix.m[2 ];
-			m[3 ] = matrix.m[3 ];
-			m[4 ] = matrix.m[4 ];
-			m[5 ] = matrix.m[5 ];
-			m[6 ] = matrix.m[6 ];
-			m[7 ] = matrix.m[7 ];
-			m[8 ] = matrix.m[8 ];
-			m[9 ] = matrix.m[9 ];
-			m[10] = matrix.m[10];
-			m[11] = matrix.m[11];
-			m[12] = matrix.m[12];
-			m[13] = matrix.m[13];
-			m[14] = matrix.m[14];
-			m[15] = matrix.m[15];
-		}
-
-		GenoMatrix(GenoMatrix<4, 4, T> && matrix) noexcept :
-			owner(matrix.owner),
-			m(matrix.m) {
-			matrix.owner = false;
-		}
-
-		GenoMatrix<4, 4, T> & operator=(const GenoMatrix<4, 4, T> & matrix) {
+		constexpr GenoMatrix(const GenoMatrix<4, 4, T2> & matrix) :
+			m {
+				(T) matrix.m[0 ], (T) matrix.m[1 ], (T) matrix.m[2 ], (T) matrix.m[3 ],
+				(T) matrix.m[4 ], (T) matrix.m[5 ], (T) matrix.m[6 ], (T) matrix.m[7 ],
+				(T) matrix.m[8 ], (T) matrix.m[9 ], (T) matrix.m[10], (T) matrix.m[11],
+				(T) matrix.m[12], (T) matrix.m[13], (T) matrix.m[14], (T) matrix.m[15]
+			} {}
+
+		constexpr GenoMatrix(const GenoMatrix<4, 4, T> & matrix) :
+			m {
+				matrix.m[0 ], matrix.m[1 ], matrix.m[2 ], matrix.m[3 ],
+				matrix.m[4 ], matrix.m[5 ], matrix.m[6 ], matrix.m[7 ],
+				matrix.m[8 ], matrix.m[9 ], matrix.m[10], matrix.m[11],
+				matrix.m[12], matrix.m[13], matrix.m[14], matrix.m[15]
+			} {}
+
+		constexpr GenoMatrix<4, 4, T> & operator=(const GenoMatrix<4, 4, T> & matrix) {
 			m[0 ] = matrix.m[0 ];
 			m[1 ] = matrix.m[1 ];
 			m[2 ] = matrix.m[2 ];
@@ -1026,15 +994,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & operator=(GenoMatrix<4, 4, T> && matrix) noexcept {
-			clean();
-			owner = matrix.owner;
-			m = matrix.m;
-			matrix.owner = false;
-			return *this;
-		}
-
-		GenoMatrix<4, 4, T> & operator+=(const GenoMatrix<4, 4, T> & matrix) {
+		constexpr GenoMatrix<4, 4, T> & operator+=(const GenoMatrix<4, 4, T> & matrix) {
 			m[0 ] += matrix.m[0 ];
 			m[1 ] += matrix.m[1 ];
 			m[2 ] += matrix.m[2 ];
@@ -1054,7 +1014,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & operator-=(const GenoMatrix<4, 4, T> & matrix) {
+		constexpr GenoMatrix<4, 4, T> & operator-=(const GenoMatrix<4, 4, T> & matrix) {
 			m[0 ] -= matrix.m[0 ];
 			m[1 ] -= matrix.m[1 ];
 			m[2 ] -= matrix.m[2 ];
@@ -1074,15 +1034,29 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & operator*=(const GenoMatrix<4, 4, T> & matrix) {
+		constexpr GenoMatrix<4, 4, T> & operator*=(const GenoMatrix<4, 4, T> & matrix) {
 			return *this = *this * matrix;
 		}
 
-		GenoVector<4, T> operator[](uint32 index) const noexcept {
-			return GenoVector<4, T>(index * 4, false);
+		constexpr GenoVectorView<4, T> operator[](uint32 index) noexcept {
+			return m + index * 4;
 		}
 
-		GenoMatrix<4, 4, T> & setIdentity() {
+		constexpr GenoVectorView<4, const T> operator[](uint32 index) const noexcept {
+			return m + index * 4;
+		}
+
+		constexpr GenoMatrix<4, 4, T> & transpose() {
+			auto swap = m[1 ]; m[1 ] = m[4 ]; m[4 ] = swap;
+			     swap = m[2 ]; m[2 ] = m[8 ]; m[8 ] = swap;
+			     swap = m[3 ]; m[3 ] = m[12]; m[12] = swap;
+			     swap = m[6 ]; m[6 ] = m[9 ]; m[9 ] = swap;
+			     swap = m[7 ]; m[7 ] = m[13]; m[13] = swap;
+			     swap = m[11]; m[11] = m[14]; m[14] = swap;
+			return *this;
+		}
+
+		constexpr GenoMatrix<4, 4, T> & setIdentity() {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1102,7 +1076,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setOrthographic(T left, T right, T bottom, T top, T near, T far) {
+		constexpr GenoMatrix<4, 4, T> & setOrthographic(T left, T right, T bottom, T top, T near, T far) {
 			m[0 ] = 2 / (right - left);
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1123,7 +1097,7 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setPerspective(T fovY, T aspectRatio, T near, T far) {
-			auto vertical = 1 / tan(fovY / 2);
+			T vertical = 1 / tan(fovY / 2);
 			m[0 ] = vertical / aspectRatio;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1144,9 +1118,9 @@ class GenoMatrix<4, 4, T> {
 		}
 		
 		GenoMatrix<4, 4, T> & setShear2D(T axisAngle, T shearAngle) {
-			auto sinAxis = sin(axisAngle);
-			auto cosAxis = cos(axisAngle);
-			auto tanShear = tan(shearAngle);
+			T sinAxis = sin(axisAngle);
+			T cosAxis = cos(axisAngle);
+			T tanShear = tan(shearAngle);
 			m[0 ] =  sinAxis * tanShear * cosAxis;
 			m[1 ] = -cosAxis * tanShear * cosAxis;
 			m[2 ] = 0;
@@ -1168,7 +1142,7 @@ class GenoMatrix<4, 4, T> {
 		
 		GenoMatrix<4, 4, T> & setShear2D(const GenoVector<2, T> & axis, T shearAngle) {
 			auto unitAxis = normalize(axis); 
-			auto tanShear = tan(shearAngle);
+			T tanShear = tan(shearAngle);
 			m[0 ] =  unitAxis.v[1] * tanShear * unitAxis.v[0];
 			m[1 ] = -unitAxis.v[0] * tanShear * unitAxis.v[0];
 			m[2 ] = 0;
@@ -1189,8 +1163,8 @@ class GenoMatrix<4, 4, T> {
 		}
 		
 		GenoMatrix<4, 4, T> & setShear2D(T axisAngle, const GenoVector<2, T> & shear) {
-			auto sinAxis = sin(axisAngle);
-			auto cosAxis = cos(axisAngle);
+			T sinAxis = sin(axisAngle);
+			T cosAxis = cos(axisAngle);
 			auto tanShear = shear.v[1] / shear.v[0];
 			m[0 ] =  sinAxis * tanShear * cosAxis;
 			m[1 ] = -cosAxis * tanShear * cosAxis;
@@ -1253,7 +1227,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 		
-		GenoMatrix<4, 4, T> & setShear2DX(const GenoVector<2, T> & shear) {
+		constexpr GenoMatrix<4, 4, T> & setShear2DX(const GenoVector<2, T> & shear) {
 			m[0 ] = 1;
 			m[1 ] = -shear.v[1] / shear.v[0];
 			m[2 ] = 0;
@@ -1293,7 +1267,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 		
-		GenoMatrix<4, 4, T> & setShear2DY(const GenoVector<2, T> & shear) {
+		constexpr GenoMatrix<4, 4, T> & setShear2DY(const GenoVector<2, T> & shear) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1313,7 +1287,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslate2D(T translateX, T translateY) {
+		constexpr GenoMatrix<4, 4, T> & setTranslate2D(T translateX, T translateY) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1333,7 +1307,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslate2D(const GenoVector<2, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & setTranslate2D(const GenoVector<2, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1353,7 +1327,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslate(T translateX, T translateY, T translateZ) {
+		constexpr GenoMatrix<4, 4, T> & setTranslate(T translateX, T translateY, T translateZ) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1373,7 +1347,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslate(const GenoVector<3, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & setTranslate(const GenoVector<3, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1394,8 +1368,8 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotate2D(T rotation) {
-			auto sinZ = sin(rotation);
-			auto cosZ = cos(rotation);
+			T sinZ = sin(rotation);
+			T cosZ = cos(rotation);
 			m[0 ] = cosZ;
 			m[1 ] = sinZ;
 			m[2 ] = 0;
@@ -1415,7 +1389,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScale2D(T scale) {
+		constexpr GenoMatrix<4, 4, T> & setScale2D(T scale) {
 			m[0 ] = scale;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1435,7 +1409,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScale2D(T scaleX, T scaleY) {
+		constexpr GenoMatrix<4, 4, T> & setScale2D(T scaleX, T scaleY) {
 			m[0 ] = scaleX;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1455,7 +1429,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScale2D(const GenoVector<2, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & setScale2D(const GenoVector<2, T> & scale) {
 			m[0 ] = scale.v[0];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1475,7 +1449,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScale(T scale) {
+		constexpr GenoMatrix<4, 4, T> & setScale(T scale) {
 			m[0 ] = scale;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1495,7 +1469,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScale(T scaleX, T scaleY, T scaleZ) {
+		constexpr GenoMatrix<4, 4, T> & setScale(T scaleX, T scaleY, T scaleZ) {
 			m[0 ] = scaleX;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1515,7 +1489,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScale(const GenoVector<3, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & setScale(const GenoVector<3, T> & scale) {
 			m[0 ] = scale.v[0];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1535,7 +1509,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateX(T translateX) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateX(T translateX) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1555,7 +1529,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateY(T translateY) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateY(T translateY) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1575,7 +1549,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateZ(T translateZ) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateZ(T translateZ) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1595,7 +1569,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateXY(T translateX, T translateY) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateXY(T translateX, T translateY) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1615,7 +1589,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateXY(const GenoVector<2, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateXY(const GenoVector<2, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1635,7 +1609,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateXZ(T translateX, T translateZ) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateXZ(T translateX, T translateZ) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1655,7 +1629,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateXZ(const GenoVector<2, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateXZ(const GenoVector<2, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1675,7 +1649,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateYX(const GenoVector<2, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateYX(const GenoVector<2, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1695,7 +1669,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateYZ(T translateY, T translateZ) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateYZ(T translateY, T translateZ) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1715,7 +1689,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateYZ(const GenoVector<2, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateYZ(const GenoVector<2, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1735,7 +1709,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateZX(const GenoVector<2, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateZX(const GenoVector<2, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1755,7 +1729,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateZY(const GenoVector<2, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateZY(const GenoVector<2, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1775,7 +1749,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateXYZ(T translateX, T translateY, T translateZ) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateXYZ(T translateX, T translateY, T translateZ) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1795,7 +1769,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateXYZ(const GenoVector<3, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateXYZ(const GenoVector<3, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1815,7 +1789,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateXZY(const GenoVector<3, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateXZY(const GenoVector<3, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1835,7 +1809,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateYXZ(const GenoVector<3, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateYXZ(const GenoVector<3, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1855,7 +1829,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateYZX(const GenoVector<3, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateYZX(const GenoVector<3, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1875,7 +1849,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateZXY(const GenoVector<3, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateZXY(const GenoVector<3, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1895,7 +1869,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setTranslateZYX(const GenoVector<3, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & setTranslateZYX(const GenoVector<3, T> & translate) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1916,8 +1890,8 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateX(T rotateX) {
-			auto sinX = sin(rotateX);
-			auto cosX = cos(rotateX);
+			T sinX = sin(rotateX);
+			T cosX = cos(rotateX);
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -1938,8 +1912,8 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateY(T rotateY) {
-			auto sinY = sin(rotateY);
-			auto cosY = cos(rotateY);
+			T sinY = sin(rotateY);
+			T cosY = cos(rotateY);
 			m[0 ] = cosY;
 			m[1 ] = 0;
 			m[2 ] = -sinY;
@@ -1960,8 +1934,8 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateZ(T rotateZ) {
-			auto sinZ = sin(rotateZ);
-			auto cosZ = cos(rotateZ);
+			T sinZ = sin(rotateZ);
+			T cosZ = cos(rotateZ);
 			m[0 ] = cosZ;
 			m[1 ] = sinZ;
 			m[2 ] = 0;
@@ -1982,10 +1956,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateXY(T rotateX, T rotateY) {
-			auto sinX = sin(rotateX);
-			auto cosX = cos(rotateX);
-			auto sinY = sin(rotateY);
-			auto cosY = cos(rotateY);
+			T sinX = sin(rotateX);
+			T cosX = cos(rotateX);
+			T sinY = sin(rotateY);
+			T cosY = cos(rotateY);
 			m[0 ] = cosY;
 			m[1 ] = 0;
 			m[2 ] = -sinY;
@@ -2006,10 +1980,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateXY(const GenoVector<2, T> & rotate) {
-			auto sinX = sin(rotate.v[0]);
-			auto cosX = cos(rotate.v[0]);
-			auto sinY = sin(rotate.v[1]);
-			auto cosY = cos(rotate.v[1]);
+			T sinX = sin(rotate.v[0]);
+			T cosX = cos(rotate.v[0]);
+			T sinY = sin(rotate.v[1]);
+			T cosY = cos(rotate.v[1]);
 			m[0 ] = cosY;
 			m[1 ] = 0;
 			m[2 ] = -sinY;
@@ -2030,10 +2004,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateXZ(T rotateX, T rotateZ) {
-			auto sinX = sin(rotateX);
-			auto cosX = cos(rotateX);
-			auto sinZ = sin(rotateZ);
-			auto cosZ = cos(rotateZ);
+			T sinX = sin(rotateX);
+			T cosX = cos(rotateX);
+			T sinZ = sin(rotateZ);
+			T cosZ = cos(rotateZ);
 			m[0 ] = cosZ;
 			m[1 ] = sinZ;
 			m[2 ] = 0;
@@ -2054,10 +2028,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateXZ(const GenoVector<2, T> & rotate) {
-			auto sinX = sin(rotate.v[0]);
-			auto cosX = cos(rotate.v[0]);
-			auto sinZ = sin(rotate.v[1]);
-			auto cosZ = cos(rotate.v[1]);
+			T sinX = sin(rotate.v[0]);
+			T cosX = cos(rotate.v[0]);
+			T sinZ = sin(rotate.v[1]);
+			T cosZ = cos(rotate.v[1]);
 			m[0 ] = cosZ;
 			m[1 ] = sinZ;
 			m[2 ] = 0;
@@ -2078,10 +2052,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateYX(const GenoVector<2, T> & rotate) {
-			auto sinX = sin(rotate.v[1]);
-			auto cosX = cos(rotate.v[1]);
-			auto sinY = sin(rotate.v[0]);
-			auto cosY = cos(rotate.v[0]);
+			T sinX = sin(rotate.v[1]);
+			T cosX = cos(rotate.v[1]);
+			T sinY = sin(rotate.v[0]);
+			T cosY = cos(rotate.v[0]);
 			m[0 ] = cosY;
 			m[1 ] = sinX * sinY;
 			m[2 ] = -cosX * sinY;
@@ -2102,10 +2076,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateYZ(T rotateY, T rotateZ) {
-			auto sinY = sin(rotateY);
-			auto cosY = cos(rotateY);
-			auto sinZ = sin(rotateZ);
-			auto cosZ = cos(rotateZ);
+			T sinY = sin(rotateY);
+			T cosY = cos(rotateY);
+			T sinZ = sin(rotateZ);
+			T cosZ = cos(rotateZ);
 			m[0 ] = cosZ * cosY;
 			m[1 ] = sinZ * cosY;
 			m[2 ] = -sinY;
@@ -2126,10 +2100,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateYZ(const GenoVector<2, T> & rotate) {
-			auto sinY = sin(rotate.v[0]);
-			auto cosY = cos(rotate.v[0]);
-			auto sinZ = sin(rotate.v[1]);
-			auto cosZ = cos(rotate.v[1]);
+			T sinY = sin(rotate.v[0]);
+			T cosY = cos(rotate.v[0]);
+			T sinZ = sin(rotate.v[1]);
+			T cosZ = cos(rotate.v[1]);
 			m[0 ] = cosZ * cosY;
 			m[1 ] = sinZ * cosY;
 			m[2 ] = -sinY;
@@ -2150,10 +2124,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateZX(const GenoVector<2, T> & rotate) {
-			auto sinX = sin(rotate.v[1]);
-			auto cosX = cos(rotate.v[1]);
-			auto sinZ = sin(rotate.v[0]);
-			auto cosZ = cos(rotate.v[0]);
+			T sinX = sin(rotate.v[1]);
+			T cosX = cos(rotate.v[1]);
+			T sinZ = sin(rotate.v[0]);
+			T cosZ = cos(rotate.v[0]);
 			m[0 ] = cosZ;
 			m[1 ] = cosX * sinZ;
 			m[2 ] = sinX * sinZ;
@@ -2174,10 +2148,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateZY(const GenoVector<2, T> & rotate) {
-			auto sinY = sin(rotate.v[1]);
-			auto cosY = cos(rotate.v[1]);
-			auto sinZ = sin(rotate.v[0]);
-			auto cosZ = cos(rotate.v[0]);
+			T sinY = sin(rotate.v[1]);
+			T cosY = cos(rotate.v[1]);
+			T sinZ = sin(rotate.v[0]);
+			T cosZ = cos(rotate.v[0]);
 			m[0 ] = cosY * cosZ;
 			m[1 ] = sinZ;
 			m[2 ] = -sinY * cosZ;
@@ -2198,12 +2172,12 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateXYZ(T rotateX, T rotateY, T rotateZ) {
-			auto sinX = sin(rotateX);
-			auto cosX = cos(rotateX);
-			auto sinY = sin(rotateY);
-			auto cosY = cos(rotateY);
-			auto sinZ = sin(rotateZ);
-			auto cosZ = cos(rotateZ);
+			T sinX = sin(rotateX);
+			T cosX = cos(rotateX);
+			T sinY = sin(rotateY);
+			T cosY = cos(rotateY);
+			T sinZ = sin(rotateZ);
+			T cosZ = cos(rotateZ);
 			m[0 ] = cosZ * cosY;
 			m[1 ] = sinZ * cosY;
 			m[2 ] = -sinY;
@@ -2224,12 +2198,12 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateXYZ(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[0]);
-			auto cosX = cos(rotate.v[0]);
-			auto sinY = sin(rotate.v[1]);
-			auto cosY = cos(rotate.v[1]);
-			auto sinZ = sin(rotate.v[2]);
-			auto cosZ = cos(rotate.v[2]);
+			T sinX = sin(rotate.v[0]);
+			T cosX = cos(rotate.v[0]);
+			T sinY = sin(rotate.v[1]);
+			T cosY = cos(rotate.v[1]);
+			T sinZ = sin(rotate.v[2]);
+			T cosZ = cos(rotate.v[2]);
 			m[0 ] = cosZ * cosY;
 			m[1 ] = sinZ * cosY;
 			m[2 ] = -sinY;
@@ -2250,12 +2224,12 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateXZY(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[0]);
-			auto cosX = cos(rotate.v[0]);
-			auto sinY = sin(rotate.v[2]);
-			auto cosY = cos(rotate.v[2]);
-			auto sinZ = sin(rotate.v[1]);
-			auto cosZ = cos(rotate.v[1]);
+			T sinX = sin(rotate.v[0]);
+			T cosX = cos(rotate.v[0]);
+			T sinY = sin(rotate.v[2]);
+			T cosY = cos(rotate.v[2]);
+			T sinZ = sin(rotate.v[1]);
+			T cosZ = cos(rotate.v[1]);
 			m[0 ] = cosY * cosZ;
 			m[1 ] = sinZ;
 			m[2 ] = -sinY * cosZ;
@@ -2276,12 +2250,12 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateYXZ(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[1]);
-			auto cosX = cos(rotate.v[1]);
-			auto sinY = sin(rotate.v[0]);
-			auto cosY = cos(rotate.v[0]);
-			auto sinZ = sin(rotate.v[2]);
-			auto cosZ = cos(rotate.v[2]);
+			T sinX = sin(rotate.v[1]);
+			T cosX = cos(rotate.v[1]);
+			T sinY = sin(rotate.v[0]);
+			T cosY = cos(rotate.v[0]);
+			T sinZ = sin(rotate.v[2]);
+			T cosZ = cos(rotate.v[2]);
 			m[0 ] = cosZ * cosY - sinZ * sinX * sinY;
 			m[1 ] = sinZ * cosY + cosZ * sinX * sinY;
 			m[2 ] = -cosX * sinY;
@@ -2302,12 +2276,12 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateYZX(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[2]);
-			auto cosX = cos(rotate.v[2]);
-			auto sinY = sin(rotate.v[0]);
-			auto cosY = cos(rotate.v[0]);
-			auto sinZ = sin(rotate.v[1]);
-			auto cosZ = cos(rotate.v[1]);
+			T sinX = sin(rotate.v[2]);
+			T cosX = cos(rotate.v[2]);
+			T sinY = sin(rotate.v[0]);
+			T cosY = cos(rotate.v[0]);
+			T sinZ = sin(rotate.v[1]);
+			T cosZ = cos(rotate.v[1]);
 			m[0 ] = cosZ * cosY;
 			m[1 ] = cosX * sinZ * cosY + sinX * sinY;
 			m[2 ] = sinX * sinZ * cosY - cosX * sinY;
@@ -2328,12 +2302,12 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateZXY(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[1]);
-			auto cosX = cos(rotate.v[1]);
-			auto sinY = sin(rotate.v[2]);
-			auto cosY = cos(rotate.v[2]);
-			auto sinZ = sin(rotate.v[0]);
-			auto cosZ = cos(rotate.v[0]);
+			T sinX = sin(rotate.v[1]);
+			T cosX = cos(rotate.v[1]);
+			T sinY = sin(rotate.v[2]);
+			T cosY = cos(rotate.v[2]);
+			T sinZ = sin(rotate.v[0]);
+			T cosZ = cos(rotate.v[0]);
 			m[0 ] = cosY * cosZ + sinY * sinX * sinZ;
 			m[1 ] = cosX * sinZ;
 			m[2 ] = -sinY * cosZ + cosY * sinX * sinZ;
@@ -2354,12 +2328,12 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & setRotateZYX(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[2]);
-			auto cosX = cos(rotate.v[2]);
-			auto sinY = sin(rotate.v[1]);
-			auto cosY = cos(rotate.v[1]);
-			auto sinZ = sin(rotate.v[0]);
-			auto cosZ = cos(rotate.v[0]);
+			T sinX = sin(rotate.v[2]);
+			T cosX = cos(rotate.v[2]);
+			T sinY = sin(rotate.v[1]);
+			T cosY = cos(rotate.v[1]);
+			T sinZ = sin(rotate.v[0]);
+			T cosZ = cos(rotate.v[0]);
 			m[0 ] = cosY * cosZ;
 			m[1 ] = sinX * sinY * cosZ + cosX * sinZ;
 			m[2 ] = -cosX * sinY * cosZ + sinX * sinZ;
@@ -2379,7 +2353,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleX(T scaleX) {
+		constexpr GenoMatrix<4, 4, T> & setScaleX(T scaleX) {
 			m[0 ] = scaleX;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2399,7 +2373,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleY(T scaleY) {
+		constexpr GenoMatrix<4, 4, T> & setScaleY(T scaleY) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2419,7 +2393,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleZ(T scaleZ) {
+		constexpr GenoMatrix<4, 4, T> & setScaleZ(T scaleZ) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2439,7 +2413,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleXY(T scale) {
+		constexpr GenoMatrix<4, 4, T> & setScaleXY(T scale) {
 			m[0 ] = scale;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2459,7 +2433,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleXY(T scaleX, T scaleY) {
+		constexpr GenoMatrix<4, 4, T> & setScaleXY(T scaleX, T scaleY) {
 			m[0 ] = scaleX;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2479,7 +2453,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleXY(const GenoVector<2, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & setScaleXY(const GenoVector<2, T> & scale) {
 			m[0 ] = scale.v[0];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2499,7 +2473,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleXZ(T scale) {
+		constexpr GenoMatrix<4, 4, T> & setScaleXZ(T scale) {
 			m[0 ] = scale;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2519,7 +2493,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleXZ(T scaleX, T scaleZ) {
+		constexpr GenoMatrix<4, 4, T> & setScaleXZ(T scaleX, T scaleZ) {
 			m[0 ] = scaleX;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2539,7 +2513,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleXZ(const GenoVector<2, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & setScaleXZ(const GenoVector<2, T> & scale) {
 			m[0 ] = scale.v[0];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2559,7 +2533,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleYX(const GenoVector<2, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & setScaleYX(const GenoVector<2, T> & scale) {
 			m[0 ] = scale.v[1];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2579,7 +2553,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleYZ(T scale) {
+		constexpr GenoMatrix<4, 4, T> & setScaleYZ(T scale) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2599,7 +2573,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleYZ(T scaleY, T scaleZ) {
+		constexpr GenoMatrix<4, 4, T> & setScaleYZ(T scaleY, T scaleZ) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2619,7 +2593,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleYZ(const GenoVector<2, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & setScaleYZ(const GenoVector<2, T> & scale) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2639,7 +2613,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleZX(const GenoVector<2, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & setScaleZX(const GenoVector<2, T> & scale) {
 			m[0 ] = scale.v[1];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2659,7 +2633,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleZY(const GenoVector<2, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & setScaleZY(const GenoVector<2, T> & scale) {
 			m[0 ] = 1;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2679,7 +2653,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleXYZ(T scale) {
+		constexpr GenoMatrix<4, 4, T> & setScaleXYZ(T scale) {
 			m[0 ] = scale;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2699,7 +2673,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleXYZ(T scaleX, T scaleY, T scaleZ) {
+		constexpr GenoMatrix<4, 4, T> & setScaleXYZ(T scaleX, T scaleY, T scaleZ) {
 			m[0 ] = scaleX;
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2719,7 +2693,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleXYZ(const GenoVector<3, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & setScaleXYZ(const GenoVector<3, T> & scale) {
 			m[0 ] = scale.v[0];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2739,7 +2713,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleXZY(const GenoVector<3, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & setScaleXZY(const GenoVector<3, T> & scale) {
 			m[0 ] = scale.v[0];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2759,7 +2733,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleYXZ(const GenoVector<3, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & setScaleYXZ(const GenoVector<3, T> & scale) {
 			m[0 ] = scale.v[1];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2779,7 +2753,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleYZX(const GenoVector<3, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & setScaleYZX(const GenoVector<3, T> & scale) {
 			m[0 ] = scale.v[2];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2799,7 +2773,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleZXY(const GenoVector<3, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & setScaleZXY(const GenoVector<3, T> & scale) {
 			m[0 ] = scale.v[1];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2819,7 +2793,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & setScaleZYX(const GenoVector<3, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & setScaleZYX(const GenoVector<3, T> & scale) {
 			m[0 ] = scale.v[2];
 			m[1 ] = 0;
 			m[2 ] = 0;
@@ -2839,7 +2813,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & projectOrthographic(T left, T right, T bottom, T top, T near, T far) {
+		constexpr GenoMatrix<4, 4, T> & projectOrthographic(T left, T right, T bottom, T top, T near, T far) {
 			auto m0  = 2 / (right -   left);
 			auto m5  = 2 / (top   - bottom);
 			auto m10 = 2 / (far   -   near);
@@ -2872,7 +2846,7 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & projectPerspective(T fovY, T aspectRatio, T near, T far) {
-			auto vertical = 1 / tan(fovY / 2);
+			T vertical = 1 / tan(fovY / 2);
 			auto m0  = vertical / aspectRatio;
 			auto m10 = (near + far) / (near - far);
 			auto m14 = (2 * far * near) / (near - far);
@@ -2902,9 +2876,9 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & shear2D(T axisAngle, T shearAngle) {
-			auto sinAxis = sin(axisAngle);
-			auto cosAxis = cos(axisAngle);
-			auto tanShear = tan(shearAngle);
+			T sinAxis = sin(axisAngle);
+			T cosAxis = cos(axisAngle);
+			T tanShear = tan(shearAngle);
 			auto m0  = sinAxis * tanShear * cosAxis;
 			auto m1  = -cosAxis * tanShear * cosAxis;
 			auto m4  = sinAxis * tanShear * sinAxis;
@@ -2928,7 +2902,7 @@ class GenoMatrix<4, 4, T> {
 
 		GenoMatrix<4, 4, T> & shear2D(const GenoVector<2, T> & axis, T shearAngle) {
 			auto unitAxis = normalize(axis);
-			auto tanShear = tan(shearAngle);
+			T tanShear = tan(shearAngle);
 			auto m0  = unitAxis.v[1] * tanShear * unitAxis.v[0];
 			auto m1  = -unitAxis.v[0] * tanShear * unitAxis.v[0];
 			auto m4  = unitAxis.v[1] * tanShear * unitAxis.v[1];
@@ -2951,8 +2925,8 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & shear2D(T axisAngle,const GenoVector<2, T> & shear) {
-			auto sinAxis = sin(axisAngle);
-			auto cosAxis = cos(axisAngle);
+			T sinAxis = sin(axisAngle);
+			T cosAxis = cos(axisAngle);
 			auto tanShear = shear.v[1] / shear.v[0];
 			auto m0  = sinAxis * tanShear * cosAxis;
 			auto m1  = -cosAxis * tanShear * cosAxis;
@@ -3000,7 +2974,7 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & shear2DX(T angle) {
-			auto m1  = -tan(angle);
+			T m1  = -tan(angle);
 			T newM[] = {
 				m[0] + m[4] * m1,
 				m[1] + m[5] * m1,
@@ -3014,7 +2988,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & shear2DX(const GenoVector<2, T> & shear) {
+		constexpr GenoMatrix<4, 4, T> & shear2DX(const GenoVector<2, T> & shear) {
 			auto m1  = -shear.v[1] / shear.v[0];
 			T newM[] = {
 				m[0] + m[4] * m1,
@@ -3030,7 +3004,7 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & shear2DY(T angle) {
-			auto m4  = tan(angle);
+			T m4  = tan(angle);
 			T newM[] = {
 				m[0] * m4 + m[4],
 				m[1] * m4 + m[5],
@@ -3044,7 +3018,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & shear2DY(const GenoVector<2, T> & shear) {
+		constexpr GenoMatrix<4, 4, T> & shear2DY(const GenoVector<2, T> & shear) {
 			auto m4  = shear.v[1] / shear.v[0];
 			T newM[] = {
 				m[0] * m4 + m[4],
@@ -3059,7 +3033,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translate2D(T translateX, T translateY) {
+		constexpr GenoMatrix<4, 4, T> & translate2D(T translateX, T translateY) {
 			T newM[] = {
 				m[0] * translateX + m[4] * translateY + m[12],
 				m[1] * translateX + m[5] * translateY + m[13],
@@ -3073,7 +3047,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translate2D(const GenoVector<2, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & translate2D(const GenoVector<2, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[0] + m[4] * translate.v[1] + m[12],
 				m[1] * translate.v[0] + m[5] * translate.v[1] + m[13],
@@ -3087,7 +3061,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translate(T translateX, T translateY, T translateZ) {
+		constexpr GenoMatrix<4, 4, T> & translate(T translateX, T translateY, T translateZ) {
 			T newM[] = {
 				m[0] * translateX + m[4] * translateY + m[8] * translateZ + m[12],
 				m[1] * translateX + m[5] * translateY + m[9] * translateZ + m[13],
@@ -3101,7 +3075,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translate(const GenoVector<3, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & translate(const GenoVector<3, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[0] + m[4] * translate.v[1] + m[8] * translate.v[2] + m[12],
 				m[1] * translate.v[0] + m[5] * translate.v[1] + m[9] * translate.v[2] + m[13],
@@ -3116,8 +3090,8 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotate2D(T rotation) {
-			auto sinZ = sin(rotation);
-			auto cosZ = cos(rotation);
+			T sinZ = sin(rotation);
+			T cosZ = cos(rotation);
 			T newM[] = {
 				m[0] * cosZ + m[4] * sinZ,
 				m[1] * cosZ + m[5] * sinZ,
@@ -3135,7 +3109,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scale2D(T scale) {
+		constexpr GenoMatrix<4, 4, T> & scale2D(T scale) {
 			T newM[] = {
 				m[0] * scale,
 				m[1] * scale,
@@ -3153,7 +3127,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scale2D(T scaleX, T scaleY) {
+		constexpr GenoMatrix<4, 4, T> & scale2D(T scaleX, T scaleY) {
 			T newM[] = {
 				m[0] * scaleX,
 				m[1] * scaleX,
@@ -3171,7 +3145,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scale2D(const GenoVector<2, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & scale2D(const GenoVector<2, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[0],
 				m[1] * scale.v[0],
@@ -3189,7 +3163,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scale(T scale) {
+		constexpr GenoMatrix<4, 4, T> & scale(T scale) {
 			T newM[] = {
 				m[0] * scale,
 				m[1] * scale,
@@ -3211,7 +3185,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scale(T scaleX, T scaleY, T scaleZ) {
+		constexpr GenoMatrix<4, 4, T> & scale(T scaleX, T scaleY, T scaleZ) {
 			T newM[] = {
 				m[0] * scaleX,
 				m[1] * scaleX,
@@ -3233,7 +3207,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scale(const GenoVector<3, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & scale(const GenoVector<3, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[0],
 				m[1] * scale.v[0],
@@ -3255,7 +3229,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateX(T translateX) {
+		constexpr GenoMatrix<4, 4, T> & translateX(T translateX) {
 			T newM[] = {
 				m[0] * translateX + m[12],
 				m[1] * translateX + m[13],
@@ -3269,7 +3243,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateY(T translateY) {
+		constexpr GenoMatrix<4, 4, T> & translateY(T translateY) {
 			T newM[] = {
 				m[4] * translateY + m[12],
 				m[5] * translateY + m[13],
@@ -3283,7 +3257,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateZ(T translateZ) {
+		constexpr GenoMatrix<4, 4, T> & translateZ(T translateZ) {
 			T newM[] = {
 				m[8] * translateZ + m[12],
 				m[9] * translateZ + m[13],
@@ -3297,7 +3271,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateXY(T translateX, T translateY) {
+		constexpr GenoMatrix<4, 4, T> & translateXY(T translateX, T translateY) {
 			T newM[] = {
 				m[0] * translateX + m[4] * translateY + m[12],
 				m[1] * translateX + m[5] * translateY + m[13],
@@ -3311,7 +3285,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateXY(const GenoVector<2, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & translateXY(const GenoVector<2, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[0] + m[4] * translate.v[1] + m[12],
 				m[1] * translate.v[0] + m[5] * translate.v[1] + m[13],
@@ -3325,7 +3299,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateXZ(T translateX, T translateZ) {
+		constexpr GenoMatrix<4, 4, T> & translateXZ(T translateX, T translateZ) {
 			T newM[] = {
 				m[0] * translateX + m[8] * translateZ + m[12],
 				m[1] * translateX + m[9] * translateZ + m[13],
@@ -3339,7 +3313,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateXZ(const GenoVector<2, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & translateXZ(const GenoVector<2, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[0] + m[8] * translate.v[1] + m[12],
 				m[1] * translate.v[0] + m[9] * translate.v[1] + m[13],
@@ -3353,7 +3327,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateYX(const GenoVector<2, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & translateYX(const GenoVector<2, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[1] + m[4] * translate.v[0] + m[12],
 				m[1] * translate.v[1] + m[5] * translate.v[0] + m[13],
@@ -3367,7 +3341,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateYZ(T translateY, T translateZ) {
+		constexpr GenoMatrix<4, 4, T> & translateYZ(T translateY, T translateZ) {
 			T newM[] = {
 				m[4] * translateY + m[8] * translateZ + m[12],
 				m[5] * translateY + m[9] * translateZ + m[13],
@@ -3381,7 +3355,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateYZ(const GenoVector<2, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & translateYZ(const GenoVector<2, T> & translate) {
 			T newM[] = {
 				m[4] * translate.v[0] + m[8] * translate.v[1] + m[12],
 				m[5] * translate.v[0] + m[9] * translate.v[1] + m[13],
@@ -3395,7 +3369,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateZX(const GenoVector<2, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & translateZX(const GenoVector<2, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[1] + m[8] * translate.v[0] + m[12],
 				m[1] * translate.v[1] + m[9] * translate.v[0] + m[13],
@@ -3409,7 +3383,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateZY(const GenoVector<2, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & translateZY(const GenoVector<2, T> & translate) {
 			T newM[] = {
 				m[4] * translate.v[1] + m[8] * translate.v[0] + m[12],
 				m[5] * translate.v[1] + m[9] * translate.v[0] + m[13],
@@ -3423,7 +3397,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateXYZ(T translateX, T translateY, T translateZ) {
+		constexpr GenoMatrix<4, 4, T> & translateXYZ(T translateX, T translateY, T translateZ) {
 			T newM[] = {
 				m[0] * translateX + m[4] * translateY + m[8] * translateZ + m[12],
 				m[1] * translateX + m[5] * translateY + m[9] * translateZ + m[13],
@@ -3437,7 +3411,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateXYZ(const GenoVector<3, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & translateXYZ(const GenoVector<3, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[0] + m[4] * translate.v[1] + m[8] * translate.v[2] + m[12],
 				m[1] * translate.v[0] + m[5] * translate.v[1] + m[9] * translate.v[2] + m[13],
@@ -3451,7 +3425,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateXZY(const GenoVector<3, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & translateXZY(const GenoVector<3, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[0] + m[4] * translate.v[2] + m[8] * translate.v[1] + m[12],
 				m[1] * translate.v[0] + m[5] * translate.v[2] + m[9] * translate.v[1] + m[13],
@@ -3465,7 +3439,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateYXZ(const GenoVector<3, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & translateYXZ(const GenoVector<3, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[1] + m[4] * translate.v[0] + m[8] * translate.v[2] + m[12],
 				m[1] * translate.v[1] + m[5] * translate.v[0] + m[9] * translate.v[2] + m[13],
@@ -3479,7 +3453,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateYZX(const GenoVector<3, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & translateYZX(const GenoVector<3, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[2] + m[4] * translate.v[0] + m[8] * translate.v[1] + m[12],
 				m[1] * translate.v[2] + m[5] * translate.v[0] + m[9] * translate.v[1] + m[13],
@@ -3493,7 +3467,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateZXY(const GenoVector<3, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & translateZXY(const GenoVector<3, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[1] + m[4] * translate.v[2] + m[8] * translate.v[0] + m[12],
 				m[1] * translate.v[1] + m[5] * translate.v[2] + m[9] * translate.v[0] + m[13],
@@ -3507,7 +3481,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & translateZYX(const GenoVector<3, T> & translate) {
+		constexpr GenoMatrix<4, 4, T> & translateZYX(const GenoVector<3, T> & translate) {
 			T newM[] = {
 				m[0] * translate.v[2] + m[4] * translate.v[1] + m[8] * translate.v[0] + m[12],
 				m[1] * translate.v[2] + m[5] * translate.v[1] + m[9] * translate.v[0] + m[13],
@@ -3522,8 +3496,8 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateX(T rotateX) {
-			auto sinX = sin(rotateX);
-			auto cosX = cos(rotateX);
+			T sinX = sin(rotateX);
+			T cosX = cos(rotateX);
 			T newM[] = {
 				m[4] * cosX + m[8] * sinX,
 				m[5] * cosX + m[9] * sinX,
@@ -3542,8 +3516,8 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateY(T rotateY) {
-			auto sinY = sin(rotateY);
-			auto cosY = cos(rotateY);
+			T sinY = sin(rotateY);
+			T cosY = cos(rotateY);
 			T newM[] = {
 				m[0] * cosY + m[8] * -sinY,
 				m[1] * cosY + m[9] * -sinY,
@@ -3562,8 +3536,8 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateZ(T rotateZ) {
-			auto sinZ = sin(rotateZ);
-			auto cosZ = cos(rotateZ);
+			T sinZ = sin(rotateZ);
+			T cosZ = cos(rotateZ);
 			T newM[] = {
 				m[0] * cosZ + m[4] * sinZ,
 				m[1] * cosZ + m[5] * sinZ,
@@ -3582,10 +3556,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateXY(T rotateX, T rotateY) {
-			auto sinX = sin(rotateX);
-			auto cosX = cos(rotateX);
-			auto sinY = sin(rotateY);
-			auto cosY = cos(rotateY);
+			T sinX = sin(rotateX);
+			T cosX = cos(rotateX);
+			T sinY = sin(rotateY);
+			T cosY = cos(rotateY);
 			auto m4  = sinY * sinX;
 			auto m6  = cosY * sinX;
 			auto m8  = sinY * cosX;
@@ -3612,10 +3586,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateXY(const GenoVector<2, T> & rotate) {
-			auto sinX = sin(rotate.v[0]);
-			auto cosX = cos(rotate.v[0]);
-			auto sinY = sin(rotate.v[1]);
-			auto cosY = cos(rotate.v[1]);
+			T sinX = sin(rotate.v[0]);
+			T cosX = cos(rotate.v[0]);
+			T sinY = sin(rotate.v[1]);
+			T cosY = cos(rotate.v[1]);
 			auto m4  = sinY * sinX;
 			auto m6  = cosY * sinX;
 			auto m8  = sinY * cosX;
@@ -3642,10 +3616,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateXZ(T rotateX, T rotateZ) {
-			auto sinX = sin(rotateX);
-			auto cosX = cos(rotateX);
-			auto sinZ = sin(rotateZ);
-			auto cosZ = cos(rotateZ);
+			T sinX = sin(rotateX);
+			T cosX = cos(rotateX);
+			T sinZ = sin(rotateZ);
+			T cosZ = cos(rotateZ);
 			auto m4  = -sinZ * cosX;
 			auto m5  = cosZ * cosX;
 			auto m8  = sinZ * sinX;
@@ -3672,10 +3646,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateXZ(const GenoVector<2, T> & rotate) {
-			auto sinX = sin(rotate.v[0]);
-			auto cosX = cos(rotate.v[0]);
-			auto sinZ = sin(rotate.v[1]);
-			auto cosZ = cos(rotate.v[1]);
+			T sinX = sin(rotate.v[0]);
+			T cosX = cos(rotate.v[0]);
+			T sinZ = sin(rotate.v[1]);
+			T cosZ = cos(rotate.v[1]);
 			auto m4  = -sinZ * cosX;
 			auto m5  = cosZ * cosX;
 			auto m8  = sinZ * sinX;
@@ -3702,10 +3676,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateYX(const GenoVector<2, T> & rotate) {
-			auto sinX = sin(rotate.v[1]);
-			auto cosX = cos(rotate.v[1]);
-			auto sinY = sin(rotate.v[0]);
-			auto cosY = cos(rotate.v[0]);
+			T sinX = sin(rotate.v[1]);
+			T cosX = cos(rotate.v[1]);
+			T sinY = sin(rotate.v[0]);
+			T cosY = cos(rotate.v[0]);
 			auto m1  = sinX * sinY;
 			auto m2  = -cosX * sinY;
 			auto m9  = -sinX * cosY;
@@ -3732,10 +3706,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateYZ(T rotateY, T rotateZ) {
-			auto sinY = sin(rotateY);
-			auto cosY = cos(rotateY);
-			auto sinZ = sin(rotateZ);
-			auto cosZ = cos(rotateZ);
+			T sinY = sin(rotateY);
+			T cosY = cos(rotateY);
+			T sinZ = sin(rotateZ);
+			T cosZ = cos(rotateZ);
 			auto m0  = cosZ * cosY;
 			auto m1  = sinZ * cosY;
 			auto m8  = cosZ * sinY;
@@ -3762,10 +3736,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateYZ(const GenoVector<2, T> & rotate) {
-			auto sinY = sin(rotate.v[0]);
-			auto cosY = cos(rotate.v[0]);
-			auto sinZ = sin(rotate.v[1]);
-			auto cosZ = cos(rotate.v[1]);
+			T sinY = sin(rotate.v[0]);
+			T cosY = cos(rotate.v[0]);
+			T sinZ = sin(rotate.v[1]);
+			T cosZ = cos(rotate.v[1]);
 			auto m0  = cosZ * cosY;
 			auto m1  = sinZ * cosY;
 			auto m8  = cosZ * sinY;
@@ -3792,10 +3766,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateZX(const GenoVector<2, T> & rotate) {
-			auto sinX = sin(rotate.v[1]);
-			auto cosX = cos(rotate.v[1]);
-			auto sinZ = sin(rotate.v[0]);
-			auto cosZ = cos(rotate.v[0]);
+			T sinX = sin(rotate.v[1]);
+			T cosX = cos(rotate.v[1]);
+			T sinZ = sin(rotate.v[0]);
+			T cosZ = cos(rotate.v[0]);
 			auto m1  = cosX * sinZ;
 			auto m2  = sinX * sinZ;
 			auto m5  = cosX * cosZ;
@@ -3822,10 +3796,10 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateZY(const GenoVector<2, T> & rotate) {
-			auto sinY = sin(rotate.v[1]);
-			auto cosY = cos(rotate.v[1]);
-			auto sinZ = sin(rotate.v[0]);
-			auto cosZ = cos(rotate.v[0]);
+			T sinY = sin(rotate.v[1]);
+			T cosY = cos(rotate.v[1]);
+			T sinZ = sin(rotate.v[0]);
+			T cosZ = cos(rotate.v[0]);
 			auto m0  = cosY * cosZ;
 			auto m2  = -sinY * cosZ;
 			auto m4  = -cosY * sinZ;
@@ -3852,12 +3826,12 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateXYZ(T rotateX, T rotateY, T rotateZ) {
-			auto sinX = sin(rotateX);
-			auto cosX = cos(rotateX);
-			auto sinY = sin(rotateY);
-			auto cosY = cos(rotateY);
-			auto sinZ = sin(rotateZ);
-			auto cosZ = cos(rotateZ);
+			T sinX = sin(rotateX);
+			T cosX = cos(rotateX);
+			T sinY = sin(rotateY);
+			T cosY = cos(rotateY);
+			T sinZ = sin(rotateZ);
+			T cosZ = cos(rotateZ);
 			auto m0  = cosZ * cosY;
 			auto m1  = sinZ * cosY;
 			auto m4  = -sinZ * cosX + cosZ * sinY * sinX;
@@ -3888,12 +3862,12 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateXYZ(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[0]);
-			auto cosX = cos(rotate.v[0]);
-			auto sinY = sin(rotate.v[1]);
-			auto cosY = cos(rotate.v[1]);
-			auto sinZ = sin(rotate.v[2]);
-			auto cosZ = cos(rotate.v[2]);
+			T sinX = sin(rotate.v[0]);
+			T cosX = cos(rotate.v[0]);
+			T sinY = sin(rotate.v[1]);
+			T cosY = cos(rotate.v[1]);
+			T sinZ = sin(rotate.v[2]);
+			T cosZ = cos(rotate.v[2]);
 			auto m0  = cosZ * cosY;
 			auto m1  = sinZ * cosY;
 			auto m4  = -sinZ * cosX + cosZ * sinY * sinX;
@@ -3924,12 +3898,12 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateXZY(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[0]);
-			auto cosX = cos(rotate.v[0]);
-			auto sinY = sin(rotate.v[2]);
-			auto cosY = cos(rotate.v[2]);
-			auto sinZ = sin(rotate.v[1]);
-			auto cosZ = cos(rotate.v[1]);
+			T sinX = sin(rotate.v[0]);
+			T cosX = cos(rotate.v[0]);
+			T sinY = sin(rotate.v[2]);
+			T cosY = cos(rotate.v[2]);
+			T sinZ = sin(rotate.v[1]);
+			T cosZ = cos(rotate.v[1]);
 			auto m0  = cosY * cosZ;
 			auto m2  = -sinY * cosZ;
 			auto m4  = -cosY * sinZ * cosX + sinY * sinX;
@@ -3960,12 +3934,12 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateYXZ(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[1]);
-			auto cosX = cos(rotate.v[1]);
-			auto sinY = sin(rotate.v[0]);
-			auto cosY = cos(rotate.v[0]);
-			auto sinZ = sin(rotate.v[2]);
-			auto cosZ = cos(rotate.v[2]);
+			T sinX = sin(rotate.v[1]);
+			T cosX = cos(rotate.v[1]);
+			T sinY = sin(rotate.v[0]);
+			T cosY = cos(rotate.v[0]);
+			T sinZ = sin(rotate.v[2]);
+			T cosZ = cos(rotate.v[2]);
 			auto m0  = cosZ * cosY - sinZ * sinX * sinY;
 			auto m1  = sinZ * cosY + cosZ * sinX * sinY;
 			auto m2  = -cosX * sinY;
@@ -3996,12 +3970,12 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateYZX(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[2]);
-			auto cosX = cos(rotate.v[2]);
-			auto sinY = sin(rotate.v[0]);
-			auto cosY = cos(rotate.v[0]);
-			auto sinZ = sin(rotate.v[1]);
-			auto cosZ = cos(rotate.v[1]);
+			T sinX = sin(rotate.v[2]);
+			T cosX = cos(rotate.v[2]);
+			T sinY = sin(rotate.v[0]);
+			T cosY = cos(rotate.v[0]);
+			T sinZ = sin(rotate.v[1]);
+			T cosZ = cos(rotate.v[1]);
 			auto m0  = cosZ * cosY;
 			auto m1  = cosX * sinZ * cosY + sinX * sinY;
 			auto m2  = sinX * sinZ * cosY - cosX * sinY;
@@ -4032,12 +4006,12 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateZXY(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[1]);
-			auto cosX = cos(rotate.v[1]);
-			auto sinY = sin(rotate.v[2]);
-			auto cosY = cos(rotate.v[2]);
-			auto sinZ = sin(rotate.v[0]);
-			auto cosZ = cos(rotate.v[0]);
+			T sinX = sin(rotate.v[1]);
+			T cosX = cos(rotate.v[1]);
+			T sinY = sin(rotate.v[2]);
+			T cosY = cos(rotate.v[2]);
+			T sinZ = sin(rotate.v[0]);
+			T cosZ = cos(rotate.v[0]);
 			auto m0  = cosY * cosZ + sinY * sinX * sinZ;
 			auto m1  = cosX * sinZ;
 			auto m2  = -sinY * cosZ + cosY * sinX * sinZ;
@@ -4068,12 +4042,12 @@ class GenoMatrix<4, 4, T> {
 		}
 
 		GenoMatrix<4, 4, T> & rotateZYX(const GenoVector<3, T> & rotate) {
-			auto sinX = sin(rotate.v[2]);
-			auto cosX = cos(rotate.v[2]);
-			auto sinY = sin(rotate.v[1]);
-			auto cosY = cos(rotate.v[1]);
-			auto sinZ = sin(rotate.v[0]);
-			auto cosZ = cos(rotate.v[0]);
+			T sinX = sin(rotate.v[2]);
+			T cosX = cos(rotate.v[2]);
+			T sinY = sin(rotate.v[1]);
+			T cosY = cos(rotate.v[1]);
+			T sinZ = sin(rotate.v[0]);
+			T cosZ = cos(rotate.v[0]);
 			auto m0  = cosY * cosZ;
 			auto m1  = sinX * sinY * cosZ + cosX * sinZ;
 			auto m2  = -cosX * sinY * cosZ + sinX * sinZ;
@@ -4103,7 +4077,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleX(T scaleX) {
+		constexpr GenoMatrix<4, 4, T> & scaleX(T scaleX) {
 			T newM[] = {
 				m[0] * scaleX,
 				m[1] * scaleX,
@@ -4117,7 +4091,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleY(T scaleY) {
+		constexpr GenoMatrix<4, 4, T> & scaleY(T scaleY) {
 			T newM[] = {
 				m[4] * scaleY,
 				m[5] * scaleY,
@@ -4131,7 +4105,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleZ(T scaleZ) {
+		constexpr GenoMatrix<4, 4, T> & scaleZ(T scaleZ) {
 			T newM[] = {
 				m[8] * scaleZ,
 				m[9] * scaleZ,
@@ -4145,7 +4119,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleXY(T scale) {
+		constexpr GenoMatrix<4, 4, T> & scaleXY(T scale) {
 			T newM[] = {
 				m[0] * scale,
 				m[1] * scale,
@@ -4163,7 +4137,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleXY(T scaleX, T scaleY) {
+		constexpr GenoMatrix<4, 4, T> & scaleXY(T scaleX, T scaleY) {
 			T newM[] = {
 				m[0] * scaleX,
 				m[1] * scaleX,
@@ -4181,7 +4155,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleXY(const GenoVector<2, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & scaleXY(const GenoVector<2, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[0],
 				m[1] * scale.v[0],
@@ -4199,7 +4173,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleXZ(T scale) {
+		constexpr GenoMatrix<4, 4, T> & scaleXZ(T scale) {
 			T newM[] = {
 				m[0] * scale,
 				m[1] * scale,
@@ -4217,7 +4191,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleXZ(T scaleX, T scaleZ) {
+		constexpr GenoMatrix<4, 4, T> & scaleXZ(T scaleX, T scaleZ) {
 			T newM[] = {
 				m[0] * scaleX,
 				m[1] * scaleX,
@@ -4235,7 +4209,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleXZ(const GenoVector<2, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & scaleXZ(const GenoVector<2, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[0],
 				m[1] * scale.v[0],
@@ -4253,7 +4227,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleYX(const GenoVector<2, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & scaleYX(const GenoVector<2, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[1],
 				m[1] * scale.v[1],
@@ -4271,7 +4245,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleYZ(T scale) {
+		constexpr GenoMatrix<4, 4, T> & scaleYZ(T scale) {
 			T newM[] = {
 				m[4] * scale,
 				m[5] * scale,
@@ -4289,7 +4263,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleYZ(T scaleY, T scaleZ) {
+		constexpr GenoMatrix<4, 4, T> & scaleYZ(T scaleY, T scaleZ) {
 			T newM[] = {
 				m[4] * scaleY,
 				m[5] * scaleY,
@@ -4307,7 +4281,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleYZ(const GenoVector<2, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & scaleYZ(const GenoVector<2, T> & scale) {
 			T newM[] = {
 				m[4] * scale.v[0],
 				m[5] * scale.v[0],
@@ -4325,7 +4299,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleZX(const GenoVector<2, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & scaleZX(const GenoVector<2, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[1],
 				m[1] * scale.v[1],
@@ -4343,7 +4317,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleZY(const GenoVector<2, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & scaleZY(const GenoVector<2, T> & scale) {
 			T newM[] = {
 				m[4] * scale.v[1],
 				m[5] * scale.v[1],
@@ -4361,7 +4335,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleXYZ(T scale) {
+		constexpr GenoMatrix<4, 4, T> & scaleXYZ(T scale) {
 			T newM[] = {
 				m[0] * scale,
 				m[1] * scale,
@@ -4383,7 +4357,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleXYZ(T scaleX, T scaleY, T scaleZ) {
+		constexpr GenoMatrix<4, 4, T> & scaleXYZ(T scaleX, T scaleY, T scaleZ) {
 			T newM[] = {
 				m[0] * scaleX,
 				m[1] * scaleX,
@@ -4405,7 +4379,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleXYZ(const GenoVector<3, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & scaleXYZ(const GenoVector<3, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[0],
 				m[1] * scale.v[0],
@@ -4427,7 +4401,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleXZY(const GenoVector<3, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & scaleXZY(const GenoVector<3, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[0],
 				m[1] * scale.v[0],
@@ -4449,7 +4423,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleYXZ(const GenoVector<3, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & scaleYXZ(const GenoVector<3, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[1],
 				m[1] * scale.v[1],
@@ -4471,7 +4445,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleYZX(const GenoVector<3, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & scaleYZX(const GenoVector<3, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[2],
 				m[1] * scale.v[2],
@@ -4493,7 +4467,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleZXY(const GenoVector<3, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & scaleZXY(const GenoVector<3, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[1],
 				m[1] * scale.v[1],
@@ -4515,7 +4489,7 @@ class GenoMatrix<4, 4, T> {
 			return *this;
 		}
 
-		GenoMatrix<4, 4, T> & scaleZYX(const GenoVector<3, T> & scale) {
+		constexpr GenoMatrix<4, 4, T> & scaleZYX(const GenoVector<3, T> & scale) {
 			T newM[] = {
 				m[0] * scale.v[2],
 				m[1] * scale.v[2],
@@ -4536,35 +4510,31 @@ class GenoMatrix<4, 4, T> {
 			/**** m[12] ****/ /**** m[13] ****/ /**** m[14] ****/ /**** m[15] ****/
 			return *this;
 		}
-
-		~GenoMatrix() {
-			clean();
-		}
 };
 
 template <typename T>
-GenoMatrix<4, 4, T> operator+(const GenoMatrix<4, 4, T> & left, const GenoMatrix<4, 4, T> & right) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> operator+(const GenoMatrix<4, 4, T> & left, const GenoMatrix<4, 4, T> & right) {
+	return {{
 		left.m[0 ] + right.m[0 ], left.m[1 ] + right.m[1 ], left.m[2 ] + right.m[2 ], left.m[3 ] + right.m[3 ],
 		left.m[4 ] + right.m[4 ], left.m[5 ] + right.m[5 ], left.m[6 ] + right.m[6 ], left.m[7 ] + right.m[7 ],
 		left.m[8 ] + right.m[8 ], left.m[9 ] + right.m[9 ], left.m[10] + right.m[10], left.m[11] + right.m[11],
 		left.m[12] + right.m[12], left.m[13] + right.m[13], left.m[14] + right.m[14], left.m[15] + right.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> operator-(const GenoMatrix<4, 4, T> & left, const GenoMatrix<4, 4, T> & right) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> operator-(const GenoMatrix<4, 4, T> & left, const GenoMatrix<4, 4, T> & right) {
+	return {{
 		left.m[0 ] - right.m[0 ], left.m[1 ] - right.m[1 ], left.m[2 ] - right.m[2 ], left.m[3 ] - right.m[3 ],
 		left.m[4 ] - right.m[4 ], left.m[5 ] - right.m[5 ], left.m[6 ] - right.m[6 ], left.m[7 ] - right.m[7 ],
 		left.m[8 ] - right.m[8 ], left.m[9 ] - right.m[9 ], left.m[10] - right.m[10], left.m[11] - right.m[11],
 		left.m[12] - right.m[12], left.m[13] - right.m[13], left.m[14] - right.m[14], left.m[15] - right.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> operator*(const GenoMatrix<4, 4, T> & left, const GenoMatrix<4, 4, T> & right) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> operator*(const GenoMatrix<4, 4, T> & left, const GenoMatrix<4, 4, T> & right) {
+	return {{
 		left.m[0] * right.m[0 ] + left.m[4] * right.m[1 ] + left.m[8 ] * right.m[2 ] + left.m[12] * right.m[3 ],
 		left.m[1] * right.m[0 ] + left.m[5] * right.m[1 ] + left.m[9 ] * right.m[2 ] + left.m[13] * right.m[3 ],
 		left.m[2] * right.m[0 ] + left.m[6] * right.m[1 ] + left.m[10] * right.m[2 ] + left.m[14] * right.m[3 ],
@@ -4581,18 +4551,39 @@ GenoMatrix<4, 4, T> operator*(const GenoMatrix<4, 4, T> & left, const GenoMatrix
 		left.m[1] * right.m[12] + left.m[5] * right.m[13] + left.m[9 ] * right.m[14] + left.m[13] * right.m[15],
 		left.m[2] * right.m[12] + left.m[6] * right.m[13] + left.m[10] * right.m[14] + left.m[14] * right.m[15],
 		left.m[3] * right.m[12] + left.m[7] * right.m[13] + left.m[11] * right.m[14] + left.m[15] * right.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> projectOrthographic(const GenoMatrix<4, 4, T> & matrix, T left, T right, T bottom, T top, T near, T far) {
+constexpr GenoMatrix<4, 4, T> transpose(const GenoMatrix<4, 4, T> & matrix) {
+	return {{
+		matrix.m[0], matrix.m[4], matrix.m[8 ], matrix.m[12],
+		matrix.m[1], matrix.m[5], matrix.m[9 ], matrix.m[13],
+		matrix.m[2], matrix.m[6], matrix.m[10], matrix.m[14],
+		matrix.m[3], matrix.m[7], matrix.m[11], matrix.m[15]
+	}};
+}
+
+template <typename T>
+constexpr GenoMatrix<4, 4, T> & transpose(const GenoMatrix<4, 4, T> & matrix, GenoMatrix<4, 4, T> & target) {
+	if (&matrix == &target)
+		return target.transpose();
+	target.m[0 ] = matrix.m[0 ]; target.m[1 ] = matrix.m[4 ]; target.m[2 ] = matrix.m[8 ]; target.m[3 ] = matrix.m[12];
+	target.m[4 ] = matrix.m[1 ]; target.m[5 ] = matrix.m[5 ]; target.m[6 ] = matrix.m[9 ]; target.m[7 ] = matrix.m[13];
+	target.m[8 ] = matrix.m[2 ]; target.m[9 ] = matrix.m[6 ]; target.m[10] = matrix.m[10]; target.m[11] = matrix.m[14];
+	target.m[12] = matrix.m[3 ]; target.m[13] = matrix.m[7 ]; target.m[14] = matrix.m[11]; target.m[15] = matrix.m[15];
+	return target;
+}
+
+template <typename T>
+constexpr GenoMatrix<4, 4, T> projectOrthographic(const GenoMatrix<4, 4, T> & matrix, T left, T right, T bottom, T top, T near, T far) {
 	auto m0  = 2 / (right -   left);
 	auto m5  = 2 / (top   - bottom);
 	auto m10 = 2 / (far   -   near);
 	auto m12 = (left   + right) / (left   - right);
 	auto m13 = (bottom +   top) / (bottom -   top);
 	auto m14 = (near   +   far) / (near   -   far);
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0 ] * m0,
 		matrix.m[1 ] * m0,
 		matrix.m[2 ] * m0,
@@ -4609,11 +4600,11 @@ GenoMatrix<4, 4, T> projectOrthographic(const GenoMatrix<4, 4, T> & matrix, T le
 		matrix.m[1 ] * m12 + matrix.m[5] * m13 + matrix.m[9 ] * m14 + matrix.m[13],
 		matrix.m[2 ] * m12 + matrix.m[6] * m13 + matrix.m[10] * m14 + matrix.m[14],
 		matrix.m[3 ] * m12 + matrix.m[7] * m13 + matrix.m[11] * m14 + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & projectOrthographic(const GenoMatrix<4, 4, T> & matrix, T left, T right, T bottom, T top, T near, T far, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & projectOrthographic(const GenoMatrix<4, 4, T> & matrix, T left, T right, T bottom, T top, T near, T far, GenoMatrix<4, 4, T> & target) {
 	auto m0  = 2 / (right -   left);
 	auto m5  = 2 / (top   - bottom);
 	auto m10 = 2 / (far   -   near);
@@ -4641,11 +4632,11 @@ GenoMatrix<4, 4, T> & projectOrthographic(const GenoMatrix<4, 4, T> & matrix, T
 
 template <typename T>
 GenoMatrix<4, 4, T> projectPerspective(const GenoMatrix<4, 4, T> & matrix, T fovY, T aspectRatio, T near, T far) {
-	auto vertical = 1 / tan(fovY / 2);
+	T vertical = 1 / tan(fovY / 2);
 	auto m0  = vertical / aspectRatio;
 	auto m10 = (near + far) / (near - far);
 	auto m14 = (2 * far * near) / (near - far);
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0 ] * m0,
 		matrix.m[1 ] * m0,
 		matrix.m[2 ] * m0,
@@ -4662,12 +4653,12 @@ GenoMatrix<4, 4, T> projectPerspective(const GenoMatrix<4, 4, T> & matrix, T fov
 		matrix.m[9 ] * m14,
 		matrix.m[10] * m14,
 		matrix.m[11] * m14
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> & projectPerspective(const GenoMatrix<4, 4, T> & matrix, T fovY, T aspectRatio, T near, T far, GenoMatrix<4, 4, T> & target) {
-	auto vertical = 1 / tan(fovY / 2);
+	T vertical = 1 / tan(fovY / 2);
 	auto m0  = vertical / aspectRatio;
 	auto m10 = (near + far) / (near - far);
 	auto m14 = (2 * far * near) / (near - far);
@@ -4692,14 +4683,14 @@ GenoMatrix<4, 4, T> & projectPerspective(const GenoMatrix<4, 4, T> & matrix, T f
 
 template <typename T>
 GenoMatrix<4, 4, T> shear2D(const GenoMatrix<4, 4, T> & matrix, T axisAngle, T shearAngle) {
-	auto sinAxis = sin(axisAngle);
-	auto cosAxis = cos(axisAngle);
-	auto tanShear = tan(shearAngle);
+	T sinAxis = sin(axisAngle);
+	T cosAxis = cos(axisAngle);
+	T tanShear = tan(shearAngle);
 	auto m0  = sinAxis * tanShear * cosAxis;
 	auto m1  = -cosAxis * tanShear * cosAxis;
 	auto m4  = sinAxis * tanShear * sinAxis;
 	auto m5  = -cosAxis * tanShear * sinAxis;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * m0 + matrix.m[4] * m1,
 		matrix.m[1] * m0 + matrix.m[5] * m1,
 		matrix.m[2] * m0 + matrix.m[6] * m1,
@@ -4716,18 +4707,18 @@ GenoMatrix<4, 4, T> shear2D(const GenoMatrix<4, 4, T> & matrix, T axisAngle, T s
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> shear2D(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & axis, T shearAngle) {
 	auto unitAxis = normalize(axis);
-	auto tanShear = tan(shearAngle);
+	T tanShear = tan(shearAngle);
 	auto m0  = unitAxis.v[1] * tanShear * unitAxis.v[0];
 	auto m1  = -unitAxis.v[0] * tanShear * unitAxis.v[0];
 	auto m4  = unitAxis.v[1] * tanShear * unitAxis.v[1];
 	auto m5  = -unitAxis.v[0] * tanShear * unitAxis.v[1];
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * m0 + matrix.m[4] * m1,
 		matrix.m[1] * m0 + matrix.m[5] * m1,
 		matrix.m[2] * m0 + matrix.m[6] * m1,
@@ -4744,19 +4735,19 @@ GenoMatrix<4, 4, T> shear2D(const GenoMatrix<4, 4, T> & matrix, const GenoVector
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> shear2D(const GenoMatrix<4, 4, T> & matrix, T axisAngle,const GenoVector<2, T> & shear) {
-	auto sinAxis = sin(axisAngle);
-	auto cosAxis = cos(axisAngle);
+	T sinAxis = sin(axisAngle);
+	T cosAxis = cos(axisAngle);
 	auto tanShear = shear.v[1] / shear.v[0];
 	auto m0  = sinAxis * tanShear * cosAxis;
 	auto m1  = -cosAxis * tanShear * cosAxis;
 	auto m4  = sinAxis * tanShear * sinAxis;
 	auto m5  = -cosAxis * tanShear * sinAxis;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * m0 + matrix.m[4] * m1,
 		matrix.m[1] * m0 + matrix.m[5] * m1,
 		matrix.m[2] * m0 + matrix.m[6] * m1,
@@ -4773,7 +4764,7 @@ GenoMatrix<4, 4, T> shear2D(const GenoMatrix<4, 4, T> & matrix, T axisAngle,cons
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
@@ -4784,7 +4775,7 @@ GenoMatrix<4, 4, T> shear2D(const GenoMatrix<4, 4, T> & matrix, const GenoVector
 	auto m1  = -unitAxis.v[0] * tanShear * unitAxis.v[0];
 	auto m4  = unitAxis.v[1] * tanShear * unitAxis.v[1];
 	auto m5  = -unitAxis.v[0] * tanShear * unitAxis.v[1];
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * m0 + matrix.m[4] * m1,
 		matrix.m[1] * m0 + matrix.m[5] * m1,
 		matrix.m[2] * m0 + matrix.m[6] * m1,
@@ -4801,13 +4792,13 @@ GenoMatrix<4, 4, T> shear2D(const GenoMatrix<4, 4, T> & matrix, const GenoVector
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> shear2DX(const GenoMatrix<4, 4, T> & matrix, T angle) {
-	auto m1  = -tan(angle);
-	return new T[4 * 4] {
+	T m1  = -tan(angle);
+	return {{
 		matrix.m[0] + matrix.m[4] * m1,
 		matrix.m[1] + matrix.m[5] * m1,
 		matrix.m[2] + matrix.m[6] * m1,
@@ -4824,13 +4815,13 @@ GenoMatrix<4, 4, T> shear2DX(const GenoMatrix<4, 4, T> & matrix, T angle) {
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> shear2DX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & shear) {
+constexpr GenoMatrix<4, 4, T> shear2DX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & shear) {
 	auto m1  = -shear.v[1] / shear.v[0];
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] + matrix.m[4] * m1,
 		matrix.m[1] + matrix.m[5] * m1,
 		matrix.m[2] + matrix.m[6] * m1,
@@ -4847,13 +4838,13 @@ GenoMatrix<4, 4, T> shear2DX(const GenoMatrix<4, 4, T> & matrix, const GenoVecto
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> shear2DY(const GenoMatrix<4, 4, T> & matrix, T angle) {
-	auto m4  = tan(angle);
-	return new T[4 * 4] {
+	T m4  = tan(angle);
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -4870,13 +4861,13 @@ GenoMatrix<4, 4, T> shear2DY(const GenoMatrix<4, 4, T> & matrix, T angle) {
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> shear2DY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & shear) {
+constexpr GenoMatrix<4, 4, T> shear2DY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & shear) {
 	auto m4  = shear.v[1] / shear.v[0];
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -4893,14 +4884,14 @@ GenoMatrix<4, 4, T> shear2DY(const GenoMatrix<4, 4, T> & matrix, const GenoVecto
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> & shear2D(const GenoMatrix<4, 4, T> & matrix, T axisAngle, T shearAngle, GenoMatrix<4, 4, T> & target) {
-	auto sinAxis = sin(axisAngle);
-	auto cosAxis = cos(axisAngle);
-	auto tanShear = tan(shearAngle);
+	T sinAxis = sin(axisAngle);
+	T cosAxis = cos(axisAngle);
+	T tanShear = tan(shearAngle);
 	auto m0  = sinAxis * tanShear * cosAxis;
 	auto m1  = -cosAxis * tanShear * cosAxis;
 	auto m4  = sinAxis * tanShear * sinAxis;
@@ -4927,7 +4918,7 @@ GenoMatrix<4, 4, T> & shear2D(const GenoMatrix<4, 4, T> & matrix, T axisAngle, T
 template <typename T>
 GenoMatrix<4, 4, T> & shear2D(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & axis, T shearAngle, GenoMatrix<4, 4, T> & target) {
 	auto unitAxis = normalize(axis);
-	auto tanShear = tan(shearAngle);
+	T tanShear = tan(shearAngle);
 	auto m0  = unitAxis.v[1] * tanShear * unitAxis.v[0];
 	auto m1  = -unitAxis.v[0] * tanShear * unitAxis.v[0];
 	auto m4  = unitAxis.v[1] * tanShear * unitAxis.v[1];
@@ -4953,8 +4944,8 @@ GenoMatrix<4, 4, T> & shear2D(const GenoMatrix<4, 4, T> & matrix, const GenoVect
 
 template <typename T>
 GenoMatrix<4, 4, T> & shear2D(const GenoMatrix<4, 4, T> & matrix, T axisAngle,const GenoVector<2, T> & shear, GenoMatrix<4, 4, T> & target) {
-	auto sinAxis = sin(axisAngle);
-	auto cosAxis = cos(axisAngle);
+	T sinAxis = sin(axisAngle);
+	T cosAxis = cos(axisAngle);
 	auto tanShear = shear.v[1] / shear.v[0];
 	auto m0  = sinAxis * tanShear * cosAxis;
 	auto m1  = -cosAxis * tanShear * cosAxis;
@@ -5008,7 +4999,7 @@ GenoMatrix<4, 4, T> & shear2D(const GenoMatrix<4, 4, T> & matrix, const GenoVect
 
 template <typename T>
 GenoMatrix<4, 4, T> & shear2DX(const GenoMatrix<4, 4, T> & matrix, T angle, GenoMatrix<4, 4, T> & target) {
-	auto m1  = -tan(angle);
+	T m1  = -tan(angle);
 	target.m[0] = matrix.m[0] + matrix.m[4] * m1;
 	target.m[1] = matrix.m[1] + matrix.m[5] * m1;
 	target.m[2] = matrix.m[2] + matrix.m[6] * m1;
@@ -5029,7 +5020,7 @@ GenoMatrix<4, 4, T> & shear2DX(const GenoMatrix<4, 4, T> & matrix, T angle, Geno
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & shear2DX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & shear, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & shear2DX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & shear, GenoMatrix<4, 4, T> & target) {
 	auto m1  = -shear.v[1] / shear.v[0];
 	target.m[0] = matrix.m[0] + matrix.m[4] * m1;
 	target.m[1] = matrix.m[1] + matrix.m[5] * m1;
@@ -5052,7 +5043,7 @@ GenoMatrix<4, 4, T> & shear2DX(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 
 template <typename T>
 GenoMatrix<4, 4, T> & shear2DY(const GenoMatrix<4, 4, T> & matrix, T angle, GenoMatrix<4, 4, T> & target) {
-	auto m4  = tan(angle);
+	T m4  = tan(angle);
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -5073,7 +5064,7 @@ GenoMatrix<4, 4, T> & shear2DY(const GenoMatrix<4, 4, T> & matrix, T angle, Geno
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & shear2DY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & shear, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & shear2DY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & shear, GenoMatrix<4, 4, T> & target) {
 	auto m4  = shear.v[1] / shear.v[0];
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
@@ -5095,8 +5086,8 @@ GenoMatrix<4, 4, T> & shear2DY(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translate2D(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateY) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translate2D(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateY) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5113,12 +5104,12 @@ GenoMatrix<4, 4, T> translate2D(const GenoMatrix<4, 4, T> & matrix, T translateX
 		matrix.m[1] * translateX + matrix.m[5] * translateY + matrix.m[13],
 		matrix.m[2] * translateX + matrix.m[6] * translateY + matrix.m[14],
 		matrix.m[3] * translateX + matrix.m[7] * translateY + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translate2D(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translate2D(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5135,11 +5126,11 @@ GenoMatrix<4, 4, T> translate2D(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 		matrix.m[1] * translate.v[0] + matrix.m[5] * translate.v[1] + matrix.m[13],
 		matrix.m[2] * translate.v[0] + matrix.m[6] * translate.v[1] + matrix.m[14],
 		matrix.m[3] * translate.v[0] + matrix.m[7] * translate.v[1] + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translate2D(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateY, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translate2D(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateY, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -5160,7 +5151,7 @@ GenoMatrix<4, 4, T> & translate2D(const GenoMatrix<4, 4, T> & matrix, T translat
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translate2D(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translate2D(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -5181,8 +5172,8 @@ GenoMatrix<4, 4, T> & translate2D(const GenoMatrix<4, 4, T> & matrix, const Geno
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translate(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateY, T translateZ) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translate(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateY, T translateZ) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5199,12 +5190,12 @@ GenoMatrix<4, 4, T> translate(const GenoMatrix<4, 4, T> & matrix, T translateX,
 		matrix.m[1] * translateX + matrix.m[5] * translateY + matrix.m[9] * translateZ + matrix.m[13],
 		matrix.m[2] * translateX + matrix.m[6] * translateY + matrix.m[10] * translateZ + matrix.m[14],
 		matrix.m[3] * translateX + matrix.m[7] * translateY + matrix.m[11] * translateZ + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translate(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translate(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5221,11 +5212,11 @@ GenoMatrix<4, 4, T> translate(const GenoMatrix<4, 4, T> & matrix, const GenoVect
 		matrix.m[1] * translate.v[0] + matrix.m[5] * translate.v[1] + matrix.m[9] * translate.v[2] + matrix.m[13],
 		matrix.m[2] * translate.v[0] + matrix.m[6] * translate.v[1] + matrix.m[10] * translate.v[2] + matrix.m[14],
 		matrix.m[3] * translate.v[0] + matrix.m[7] * translate.v[1] + matrix.m[11] * translate.v[2] + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translate(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateY, T translateZ, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translate(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateY, T translateZ, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -5246,7 +5237,7 @@ GenoMatrix<4, 4, T> & translate(const GenoMatrix<4, 4, T> & matrix, T translateX
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translate(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translate(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -5268,9 +5259,9 @@ GenoMatrix<4, 4, T> & translate(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 
 template <typename T>
 GenoMatrix<4, 4, T> rotate2D(const GenoMatrix<4, 4, T> & matrix, T rotateZ) {
-	auto sinZ = sin(rotateZ);
-	auto cosZ = cos(rotateZ);
-	return new T[4 * 4] {
+	T sinZ = sin(rotateZ);
+	T cosZ = cos(rotateZ);
+	return {{
 		matrix.m[0] * cosZ + matrix.m[4] * sinZ,
 		matrix.m[1] * cosZ + matrix.m[5] * sinZ,
 		matrix.m[2] * cosZ + matrix.m[6] * sinZ,
@@ -5287,13 +5278,13 @@ GenoMatrix<4, 4, T> rotate2D(const GenoMatrix<4, 4, T> & matrix, T rotateZ) {
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotate2D(const GenoMatrix<4, 4, T> & matrix, T rotateZ, GenoMatrix<4, 4, T> & target) {
-	auto sinZ = sin(rotateZ);
-	auto cosZ = cos(rotateZ);
+	T sinZ = sin(rotateZ);
+	T cosZ = cos(rotateZ);
 	target.m[0] = matrix.m[0] * cosZ + matrix.m[4] * sinZ;
 	target.m[1] = matrix.m[1] * cosZ + matrix.m[5] * sinZ;
 	target.m[2] = matrix.m[2] * cosZ + matrix.m[6] * sinZ;
@@ -5314,8 +5305,8 @@ GenoMatrix<4, 4, T> & rotate2D(const GenoMatrix<4, 4, T> & matrix, T rotateZ, Ge
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scale2D(const GenoMatrix<4, 4, T> & matrix, T scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scale2D(const GenoMatrix<4, 4, T> & matrix, T scale) {
+	return {{
 		matrix.m[0] * scale,
 		matrix.m[1] * scale,
 		matrix.m[2] * scale,
@@ -5332,12 +5323,12 @@ GenoMatrix<4, 4, T> scale2D(const GenoMatrix<4, 4, T> & matrix, T scale) {
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scale2D(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scale2D(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY) {
+	return {{
 		matrix.m[0] * scaleX,
 		matrix.m[1] * scaleX,
 		matrix.m[2] * scaleX,
@@ -5354,12 +5345,12 @@ GenoMatrix<4, 4, T> scale2D(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scal
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scale2D(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scale2D(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale) {
+	return {{
 		matrix.m[0] * scale.v[0],
 		matrix.m[1] * scale.v[0],
 		matrix.m[2] * scale.v[0],
@@ -5376,11 +5367,11 @@ GenoMatrix<4, 4, T> scale2D(const GenoMatrix<4, 4, T> & matrix, const GenoVector
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scale2D(const GenoMatrix<4, 4, T> & matrix, T scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scale2D(const GenoMatrix<4, 4, T> & matrix, T scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale;
 	target.m[1] = matrix.m[1] * scale;
 	target.m[2] = matrix.m[2] * scale;
@@ -5401,7 +5392,7 @@ GenoMatrix<4, 4, T> & scale2D(const GenoMatrix<4, 4, T> & matrix, T scale, GenoM
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scale2D(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scale2D(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scaleX;
 	target.m[1] = matrix.m[1] * scaleX;
 	target.m[2] = matrix.m[2] * scaleX;
@@ -5422,7 +5413,7 @@ GenoMatrix<4, 4, T> & scale2D(const GenoMatrix<4, 4, T> & matrix, T scaleX, T sc
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scale2D(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scale2D(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[0];
 	target.m[1] = matrix.m[1] * scale.v[0];
 	target.m[2] = matrix.m[2] * scale.v[0];
@@ -5443,8 +5434,8 @@ GenoMatrix<4, 4, T> & scale2D(const GenoMatrix<4, 4, T> & matrix, const GenoVect
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scale(const GenoMatrix<4, 4, T> & matrix, T scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scale(const GenoMatrix<4, 4, T> & matrix, T scale) {
+	return {{
 		matrix.m[0] * scale,
 		matrix.m[1] * scale,
 		matrix.m[2] * scale,
@@ -5461,12 +5452,12 @@ GenoMatrix<4, 4, T> scale(const GenoMatrix<4, 4, T> & matrix, T scale) {
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scale(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY, T scaleZ) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scale(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY, T scaleZ) {
+	return {{
 		matrix.m[0] * scaleX,
 		matrix.m[1] * scaleX,
 		matrix.m[2] * scaleX,
@@ -5483,12 +5474,12 @@ GenoMatrix<4, 4, T> scale(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scale(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scale(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale) {
+	return {{
 		matrix.m[0] * scale.v[0],
 		matrix.m[1] * scale.v[0],
 		matrix.m[2] * scale.v[0],
@@ -5505,11 +5496,11 @@ GenoMatrix<4, 4, T> scale(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scale(const GenoMatrix<4, 4, T> & matrix, T scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scale(const GenoMatrix<4, 4, T> & matrix, T scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale;
 	target.m[1] = matrix.m[1] * scale;
 	target.m[2] = matrix.m[2] * scale;
@@ -5530,7 +5521,7 @@ GenoMatrix<4, 4, T> & scale(const GenoMatrix<4, 4, T> & matrix, T scale, GenoMat
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scale(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY, T scaleZ, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scale(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY, T scaleZ, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scaleX;
 	target.m[1] = matrix.m[1] * scaleX;
 	target.m[2] = matrix.m[2] * scaleX;
@@ -5551,7 +5542,7 @@ GenoMatrix<4, 4, T> & scale(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scal
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scale(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scale(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[0];
 	target.m[1] = matrix.m[1] * scale.v[0];
 	target.m[2] = matrix.m[2] * scale.v[0];
@@ -5572,8 +5563,8 @@ GenoMatrix<4, 4, T> & scale(const GenoMatrix<4, 4, T> & matrix, const GenoVector
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateX(const GenoMatrix<4, 4, T> & matrix, T translateX) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateX(const GenoMatrix<4, 4, T> & matrix, T translateX) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5590,12 +5581,12 @@ GenoMatrix<4, 4, T> translateX(const GenoMatrix<4, 4, T> & matrix, T translateX)
 		matrix.m[1] * translateX + matrix.m[13],
 		matrix.m[2] * translateX + matrix.m[14],
 		matrix.m[3] * translateX + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateY(const GenoMatrix<4, 4, T> & matrix, T translateY) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateY(const GenoMatrix<4, 4, T> & matrix, T translateY) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5612,12 +5603,12 @@ GenoMatrix<4, 4, T> translateY(const GenoMatrix<4, 4, T> & matrix, T translateY)
 		matrix.m[5] * translateY + matrix.m[13],
 		matrix.m[6] * translateY + matrix.m[14],
 		matrix.m[7] * translateY + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateZ(const GenoMatrix<4, 4, T> & matrix, T translateZ) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateZ(const GenoMatrix<4, 4, T> & matrix, T translateZ) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5634,12 +5625,12 @@ GenoMatrix<4, 4, T> translateZ(const GenoMatrix<4, 4, T> & matrix, T translateZ)
 		matrix.m[9] * translateZ + matrix.m[13],
 		matrix.m[10] * translateZ + matrix.m[14],
 		matrix.m[11] * translateZ + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateXY(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateY) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateXY(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateY) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5656,12 +5647,12 @@ GenoMatrix<4, 4, T> translateXY(const GenoMatrix<4, 4, T> & matrix, T translateX
 		matrix.m[1] * translateX + matrix.m[5] * translateY + matrix.m[13],
 		matrix.m[2] * translateX + matrix.m[6] * translateY + matrix.m[14],
 		matrix.m[3] * translateX + matrix.m[7] * translateY + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5678,12 +5669,12 @@ GenoMatrix<4, 4, T> translateXY(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 		matrix.m[1] * translate.v[0] + matrix.m[5] * translate.v[1] + matrix.m[13],
 		matrix.m[2] * translate.v[0] + matrix.m[6] * translate.v[1] + matrix.m[14],
 		matrix.m[3] * translate.v[0] + matrix.m[7] * translate.v[1] + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateXZ(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateZ) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateXZ(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateZ) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5700,12 +5691,12 @@ GenoMatrix<4, 4, T> translateXZ(const GenoMatrix<4, 4, T> & matrix, T translateX
 		matrix.m[1] * translateX + matrix.m[9] * translateZ + matrix.m[13],
 		matrix.m[2] * translateX + matrix.m[10] * translateZ + matrix.m[14],
 		matrix.m[3] * translateX + matrix.m[11] * translateZ + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5722,12 +5713,12 @@ GenoMatrix<4, 4, T> translateXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 		matrix.m[1] * translate.v[0] + matrix.m[9] * translate.v[1] + matrix.m[13],
 		matrix.m[2] * translate.v[0] + matrix.m[10] * translate.v[1] + matrix.m[14],
 		matrix.m[3] * translate.v[0] + matrix.m[11] * translate.v[1] + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5744,12 +5735,12 @@ GenoMatrix<4, 4, T> translateYX(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 		matrix.m[1] * translate.v[1] + matrix.m[5] * translate.v[0] + matrix.m[13],
 		matrix.m[2] * translate.v[1] + matrix.m[6] * translate.v[0] + matrix.m[14],
 		matrix.m[3] * translate.v[1] + matrix.m[7] * translate.v[0] + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateYZ(const GenoMatrix<4, 4, T> & matrix, T translateY, T translateZ) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateYZ(const GenoMatrix<4, 4, T> & matrix, T translateY, T translateZ) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5766,12 +5757,12 @@ GenoMatrix<4, 4, T> translateYZ(const GenoMatrix<4, 4, T> & matrix, T translateY
 		matrix.m[5] * translateY + matrix.m[9] * translateZ + matrix.m[13],
 		matrix.m[6] * translateY + matrix.m[10] * translateZ + matrix.m[14],
 		matrix.m[7] * translateY + matrix.m[11] * translateZ + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5788,12 +5779,12 @@ GenoMatrix<4, 4, T> translateYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 		matrix.m[5] * translate.v[0] + matrix.m[9] * translate.v[1] + matrix.m[13],
 		matrix.m[6] * translate.v[0] + matrix.m[10] * translate.v[1] + matrix.m[14],
 		matrix.m[7] * translate.v[0] + matrix.m[11] * translate.v[1] + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5810,12 +5801,12 @@ GenoMatrix<4, 4, T> translateZX(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 		matrix.m[1] * translate.v[1] + matrix.m[9] * translate.v[0] + matrix.m[13],
 		matrix.m[2] * translate.v[1] + matrix.m[10] * translate.v[0] + matrix.m[14],
 		matrix.m[3] * translate.v[1] + matrix.m[11] * translate.v[0] + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5832,12 +5823,12 @@ GenoMatrix<4, 4, T> translateZY(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 		matrix.m[5] * translate.v[1] + matrix.m[9] * translate.v[0] + matrix.m[13],
 		matrix.m[6] * translate.v[1] + matrix.m[10] * translate.v[0] + matrix.m[14],
 		matrix.m[7] * translate.v[1] + matrix.m[11] * translate.v[0] + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateXYZ(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateY, T translateZ) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateXYZ(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateY, T translateZ) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5854,12 +5845,12 @@ GenoMatrix<4, 4, T> translateXYZ(const GenoMatrix<4, 4, T> & matrix, T translate
 		matrix.m[1] * translateX + matrix.m[5] * translateY + matrix.m[9] * translateZ + matrix.m[13],
 		matrix.m[2] * translateX + matrix.m[6] * translateY + matrix.m[10] * translateZ + matrix.m[14],
 		matrix.m[3] * translateX + matrix.m[7] * translateY + matrix.m[11] * translateZ + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateXYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateXYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5876,12 +5867,12 @@ GenoMatrix<4, 4, T> translateXYZ(const GenoMatrix<4, 4, T> & matrix, const GenoV
 		matrix.m[1] * translate.v[0] + matrix.m[5] * translate.v[1] + matrix.m[9] * translate.v[2] + matrix.m[13],
 		matrix.m[2] * translate.v[0] + matrix.m[6] * translate.v[1] + matrix.m[10] * translate.v[2] + matrix.m[14],
 		matrix.m[3] * translate.v[0] + matrix.m[7] * translate.v[1] + matrix.m[11] * translate.v[2] + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateXZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateXZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5898,12 +5889,12 @@ GenoMatrix<4, 4, T> translateXZY(const GenoMatrix<4, 4, T> & matrix, const GenoV
 		matrix.m[1] * translate.v[0] + matrix.m[5] * translate.v[2] + matrix.m[9] * translate.v[1] + matrix.m[13],
 		matrix.m[2] * translate.v[0] + matrix.m[6] * translate.v[2] + matrix.m[10] * translate.v[1] + matrix.m[14],
 		matrix.m[3] * translate.v[0] + matrix.m[7] * translate.v[2] + matrix.m[11] * translate.v[1] + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateYXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateYXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5920,12 +5911,12 @@ GenoMatrix<4, 4, T> translateYXZ(const GenoMatrix<4, 4, T> & matrix, const GenoV
 		matrix.m[1] * translate.v[1] + matrix.m[5] * translate.v[0] + matrix.m[9] * translate.v[2] + matrix.m[13],
 		matrix.m[2] * translate.v[1] + matrix.m[6] * translate.v[0] + matrix.m[10] * translate.v[2] + matrix.m[14],
 		matrix.m[3] * translate.v[1] + matrix.m[7] * translate.v[0] + matrix.m[11] * translate.v[2] + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateYZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateYZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5942,12 +5933,12 @@ GenoMatrix<4, 4, T> translateYZX(const GenoMatrix<4, 4, T> & matrix, const GenoV
 		matrix.m[1] * translate.v[2] + matrix.m[5] * translate.v[0] + matrix.m[9] * translate.v[1] + matrix.m[13],
 		matrix.m[2] * translate.v[2] + matrix.m[6] * translate.v[0] + matrix.m[10] * translate.v[1] + matrix.m[14],
 		matrix.m[3] * translate.v[2] + matrix.m[7] * translate.v[0] + matrix.m[11] * translate.v[1] + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateZXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateZXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5964,12 +5955,12 @@ GenoMatrix<4, 4, T> translateZXY(const GenoMatrix<4, 4, T> & matrix, const GenoV
 		matrix.m[1] * translate.v[1] + matrix.m[5] * translate.v[2] + matrix.m[9] * translate.v[0] + matrix.m[13],
 		matrix.m[2] * translate.v[1] + matrix.m[6] * translate.v[2] + matrix.m[10] * translate.v[0] + matrix.m[14],
 		matrix.m[3] * translate.v[1] + matrix.m[7] * translate.v[2] + matrix.m[11] * translate.v[0] + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> translateZYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> translateZYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -5986,11 +5977,11 @@ GenoMatrix<4, 4, T> translateZYX(const GenoMatrix<4, 4, T> & matrix, const GenoV
 		matrix.m[1] * translate.v[2] + matrix.m[5] * translate.v[1] + matrix.m[9] * translate.v[0] + matrix.m[13],
 		matrix.m[2] * translate.v[2] + matrix.m[6] * translate.v[1] + matrix.m[10] * translate.v[0] + matrix.m[14],
 		matrix.m[3] * translate.v[2] + matrix.m[7] * translate.v[1] + matrix.m[11] * translate.v[0] + matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateX(const GenoMatrix<4, 4, T> & matrix, T translateX, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateX(const GenoMatrix<4, 4, T> & matrix, T translateX, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6011,7 +6002,7 @@ GenoMatrix<4, 4, T> & translateX(const GenoMatrix<4, 4, T> & matrix, T translate
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateY(const GenoMatrix<4, 4, T> & matrix, T translateY, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateY(const GenoMatrix<4, 4, T> & matrix, T translateY, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6032,7 +6023,7 @@ GenoMatrix<4, 4, T> & translateY(const GenoMatrix<4, 4, T> & matrix, T translate
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateZ(const GenoMatrix<4, 4, T> & matrix, T translateZ, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateZ(const GenoMatrix<4, 4, T> & matrix, T translateZ, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6053,7 +6044,7 @@ GenoMatrix<4, 4, T> & translateZ(const GenoMatrix<4, 4, T> & matrix, T translate
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateXY(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateY, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateXY(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateY, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6074,7 +6065,7 @@ GenoMatrix<4, 4, T> & translateXY(const GenoMatrix<4, 4, T> & matrix, T translat
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6095,7 +6086,7 @@ GenoMatrix<4, 4, T> & translateXY(const GenoMatrix<4, 4, T> & matrix, const Geno
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateXZ(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateZ, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateXZ(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateZ, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6116,7 +6107,7 @@ GenoMatrix<4, 4, T> & translateXZ(const GenoMatrix<4, 4, T> & matrix, T translat
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6137,7 +6128,7 @@ GenoMatrix<4, 4, T> & translateXZ(const GenoMatrix<4, 4, T> & matrix, const Geno
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6158,7 +6149,7 @@ GenoMatrix<4, 4, T> & translateYX(const GenoMatrix<4, 4, T> & matrix, const Geno
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateYZ(const GenoMatrix<4, 4, T> & matrix, T translateY, T translateZ, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateYZ(const GenoMatrix<4, 4, T> & matrix, T translateY, T translateZ, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6179,7 +6170,7 @@ GenoMatrix<4, 4, T> & translateYZ(const GenoMatrix<4, 4, T> & matrix, T translat
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6200,7 +6191,7 @@ GenoMatrix<4, 4, T> & translateYZ(const GenoMatrix<4, 4, T> & matrix, const Geno
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6221,7 +6212,7 @@ GenoMatrix<4, 4, T> & translateZX(const GenoMatrix<4, 4, T> & matrix, const Geno
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & translate, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6242,7 +6233,7 @@ GenoMatrix<4, 4, T> & translateZY(const GenoMatrix<4, 4, T> & matrix, const Geno
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateXYZ(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateY, T translateZ, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateXYZ(const GenoMatrix<4, 4, T> & matrix, T translateX, T translateY, T translateZ, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6263,7 +6254,7 @@ GenoMatrix<4, 4, T> & translateXYZ(const GenoMatrix<4, 4, T> & matrix, T transla
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateXYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateXYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6284,7 +6275,7 @@ GenoMatrix<4, 4, T> & translateXYZ(const GenoMatrix<4, 4, T> & matrix, const Gen
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateXZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateXZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6305,7 +6296,7 @@ GenoMatrix<4, 4, T> & translateXZY(const GenoMatrix<4, 4, T> & matrix, const Gen
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateYXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateYXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6326,7 +6317,7 @@ GenoMatrix<4, 4, T> & translateYXZ(const GenoMatrix<4, 4, T> & matrix, const Gen
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateYZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateYZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6347,7 +6338,7 @@ GenoMatrix<4, 4, T> & translateYZX(const GenoMatrix<4, 4, T> & matrix, const Gen
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateZXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateZXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6368,7 +6359,7 @@ GenoMatrix<4, 4, T> & translateZXY(const GenoMatrix<4, 4, T> & matrix, const Gen
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & translateZYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & translateZYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & translate, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -6390,9 +6381,9 @@ GenoMatrix<4, 4, T> & translateZYX(const GenoMatrix<4, 4, T> & matrix, const Gen
 
 template <typename T>
 GenoMatrix<4, 4, T> rotateX(const GenoMatrix<4, 4, T> & matrix, T rotateX) {
-	auto sinX = sin(rotateX);
-	auto cosX = cos(rotateX);
-	return new T[4 * 4] {
+	T sinX = sin(rotateX);
+	T cosX = cos(rotateX);
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -6409,14 +6400,14 @@ GenoMatrix<4, 4, T> rotateX(const GenoMatrix<4, 4, T> & matrix, T rotateX) {
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> rotateY(const GenoMatrix<4, 4, T> & matrix, T rotateY) {
-	auto sinY = sin(rotateY);
-	auto cosY = cos(rotateY);
-	return new T[4 * 4] {
+	T sinY = sin(rotateY);
+	T cosY = cos(rotateY);
+	return {{
 		matrix.m[0] * cosY + matrix.m[8] * -sinY,
 		matrix.m[1] * cosY + matrix.m[9] * -sinY,
 		matrix.m[2] * cosY + matrix.m[10] * -sinY,
@@ -6433,14 +6424,14 @@ GenoMatrix<4, 4, T> rotateY(const GenoMatrix<4, 4, T> & matrix, T rotateY) {
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> rotateZ(const GenoMatrix<4, 4, T> & matrix, T rotateZ) {
-	auto sinZ = sin(rotateZ);
-	auto cosZ = cos(rotateZ);
-	return new T[4 * 4] {
+	T sinZ = sin(rotateZ);
+	T cosZ = cos(rotateZ);
+	return {{
 		matrix.m[0] * cosZ + matrix.m[4] * sinZ,
 		matrix.m[1] * cosZ + matrix.m[5] * sinZ,
 		matrix.m[2] * cosZ + matrix.m[6] * sinZ,
@@ -6457,20 +6448,20 @@ GenoMatrix<4, 4, T> rotateZ(const GenoMatrix<4, 4, T> & matrix, T rotateZ) {
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> rotateXY(const GenoMatrix<4, 4, T> & matrix, T rotateX, T rotateY) {
-	auto sinX = sin(rotateX);
-	auto cosX = cos(rotateX);
-	auto sinY = sin(rotateY);
-	auto cosY = cos(rotateY);
+	T sinX = sin(rotateX);
+	T cosX = cos(rotateX);
+	T sinY = sin(rotateY);
+	T cosY = cos(rotateY);
 	auto m4  = sinY * sinX;
 	auto m6  = cosY * sinX;
 	auto m8  = sinY * cosX;
 	auto m10 = cosY * cosX;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * cosY + matrix.m[8] * -sinY,
 		matrix.m[1] * cosY + matrix.m[9] * -sinY,
 		matrix.m[2] * cosY + matrix.m[10] * -sinY,
@@ -6487,20 +6478,20 @@ GenoMatrix<4, 4, T> rotateXY(const GenoMatrix<4, 4, T> & matrix, T rotateX, T ro
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & rotate) {
-	auto sinX = sin(rotate.v[0]);
-	auto cosX = cos(rotate.v[0]);
-	auto sinY = sin(rotate.v[1]);
-	auto cosY = cos(rotate.v[1]);
+	T sinX = sin(rotate.v[0]);
+	T cosX = cos(rotate.v[0]);
+	T sinY = sin(rotate.v[1]);
+	T cosY = cos(rotate.v[1]);
 	auto m4  = sinY * sinX;
 	auto m6  = cosY * sinX;
 	auto m8  = sinY * cosX;
 	auto m10 = cosY * cosX;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * cosY + matrix.m[8] * -sinY,
 		matrix.m[1] * cosY + matrix.m[9] * -sinY,
 		matrix.m[2] * cosY + matrix.m[10] * -sinY,
@@ -6517,20 +6508,20 @@ GenoMatrix<4, 4, T> & rotateXY(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> rotateXZ(const GenoMatrix<4, 4, T> & matrix, T rotateX, T rotateZ) {
-	auto sinX = sin(rotateX);
-	auto cosX = cos(rotateX);
-	auto sinZ = sin(rotateZ);
-	auto cosZ = cos(rotateZ);
+	T sinX = sin(rotateX);
+	T cosX = cos(rotateX);
+	T sinZ = sin(rotateZ);
+	T cosZ = cos(rotateZ);
 	auto m4  = -sinZ * cosX;
 	auto m5  = cosZ * cosX;
 	auto m8  = sinZ * sinX;
 	auto m9  = -cosZ * sinX;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * cosZ + matrix.m[4] * sinZ,
 		matrix.m[1] * cosZ + matrix.m[5] * sinZ,
 		matrix.m[2] * cosZ + matrix.m[6] * sinZ,
@@ -6547,20 +6538,20 @@ GenoMatrix<4, 4, T> rotateXZ(const GenoMatrix<4, 4, T> & matrix, T rotateX, T ro
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & rotate) {
-	auto sinX = sin(rotate.v[0]);
-	auto cosX = cos(rotate.v[0]);
-	auto sinZ = sin(rotate.v[1]);
-	auto cosZ = cos(rotate.v[1]);
+	T sinX = sin(rotate.v[0]);
+	T cosX = cos(rotate.v[0]);
+	T sinZ = sin(rotate.v[1]);
+	T cosZ = cos(rotate.v[1]);
 	auto m4  = -sinZ * cosX;
 	auto m5  = cosZ * cosX;
 	auto m8  = sinZ * sinX;
 	auto m9  = -cosZ * sinX;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * cosZ + matrix.m[4] * sinZ,
 		matrix.m[1] * cosZ + matrix.m[5] * sinZ,
 		matrix.m[2] * cosZ + matrix.m[6] * sinZ,
@@ -6577,20 +6568,20 @@ GenoMatrix<4, 4, T> & rotateXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & rotate) {
-	auto sinX = sin(rotate.v[1]);
-	auto cosX = cos(rotate.v[1]);
-	auto sinY = sin(rotate.v[0]);
-	auto cosY = cos(rotate.v[0]);
+	T sinX = sin(rotate.v[1]);
+	T cosX = cos(rotate.v[1]);
+	T sinY = sin(rotate.v[0]);
+	T cosY = cos(rotate.v[0]);
 	auto m1  = sinX * sinY;
 	auto m2  = -cosX * sinY;
 	auto m9  = -sinX * cosY;
 	auto m10 = cosX * cosY;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * cosY + matrix.m[4] * m1 + matrix.m[8] * m2,
 		matrix.m[1] * cosY + matrix.m[5] * m1 + matrix.m[9] * m2,
 		matrix.m[2] * cosY + matrix.m[6] * m1 + matrix.m[10] * m2,
@@ -6607,20 +6598,20 @@ GenoMatrix<4, 4, T> & rotateYX(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> rotateYZ(const GenoMatrix<4, 4, T> & matrix, T rotateY, T rotateZ) {
-	auto sinY = sin(rotateY);
-	auto cosY = cos(rotateY);
-	auto sinZ = sin(rotateZ);
-	auto cosZ = cos(rotateZ);
+	T sinY = sin(rotateY);
+	T cosY = cos(rotateY);
+	T sinZ = sin(rotateZ);
+	T cosZ = cos(rotateZ);
 	auto m0  = cosZ * cosY;
 	auto m1  = sinZ * cosY;
 	auto m8  = cosZ * sinY;
 	auto m9  = sinZ * sinY;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * m0 + matrix.m[4] * m1 + matrix.m[8] * -sinY,
 		matrix.m[1] * m0 + matrix.m[5] * m1 + matrix.m[9] * -sinY,
 		matrix.m[2] * m0 + matrix.m[6] * m1 + matrix.m[10] * -sinY,
@@ -6637,20 +6628,20 @@ GenoMatrix<4, 4, T> rotateYZ(const GenoMatrix<4, 4, T> & matrix, T rotateY, T ro
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & rotate) {
-	auto sinY = sin(rotate.v[0]);
-	auto cosY = cos(rotate.v[0]);
-	auto sinZ = sin(rotate.v[1]);
-	auto cosZ = cos(rotate.v[1]);
+	T sinY = sin(rotate.v[0]);
+	T cosY = cos(rotate.v[0]);
+	T sinZ = sin(rotate.v[1]);
+	T cosZ = cos(rotate.v[1]);
 	auto m0  = cosZ * cosY;
 	auto m1  = sinZ * cosY;
 	auto m8  = cosZ * sinY;
 	auto m9  = sinZ * sinY;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * m0 + matrix.m[4] * m1 + matrix.m[8] * -sinY,
 		matrix.m[1] * m0 + matrix.m[5] * m1 + matrix.m[9] * -sinY,
 		matrix.m[2] * m0 + matrix.m[6] * m1 + matrix.m[10] * -sinY,
@@ -6667,20 +6658,20 @@ GenoMatrix<4, 4, T> & rotateYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & rotate) {
-	auto sinX = sin(rotate.v[1]);
-	auto cosX = cos(rotate.v[1]);
-	auto sinZ = sin(rotate.v[0]);
-	auto cosZ = cos(rotate.v[0]);
+	T sinX = sin(rotate.v[1]);
+	T cosX = cos(rotate.v[1]);
+	T sinZ = sin(rotate.v[0]);
+	T cosZ = cos(rotate.v[0]);
 	auto m1  = cosX * sinZ;
 	auto m2  = sinX * sinZ;
 	auto m5  = cosX * cosZ;
 	auto m6  = sinX * cosZ;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * cosZ + matrix.m[4] * m1 + matrix.m[8] * m2,
 		matrix.m[1] * cosZ + matrix.m[5] * m1 + matrix.m[9] * m2,
 		matrix.m[2] * cosZ + matrix.m[6] * m1 + matrix.m[10] * m2,
@@ -6697,20 +6688,20 @@ GenoMatrix<4, 4, T> & rotateZX(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & rotate) {
-	auto sinY = sin(rotate.v[1]);
-	auto cosY = cos(rotate.v[1]);
-	auto sinZ = sin(rotate.v[0]);
-	auto cosZ = cos(rotate.v[0]);
+	T sinY = sin(rotate.v[1]);
+	T cosY = cos(rotate.v[1]);
+	T sinZ = sin(rotate.v[0]);
+	T cosZ = cos(rotate.v[0]);
 	auto m0  = cosY * cosZ;
 	auto m2  = -sinY * cosZ;
 	auto m4  = -cosY * sinZ;
 	auto m6  = sinY * sinZ;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * m0 + matrix.m[4] * sinZ + matrix.m[8] * m2,
 		matrix.m[1] * m0 + matrix.m[5] * sinZ + matrix.m[9] * m2,
 		matrix.m[2] * m0 + matrix.m[6] * sinZ + matrix.m[10] * m2,
@@ -6727,17 +6718,17 @@ GenoMatrix<4, 4, T> & rotateZY(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> rotateXYZ(const GenoMatrix<4, 4, T> & matrix, T rotateX, T rotateY, T rotateZ) {
-	auto sinX = sin(rotateX);
-	auto cosX = cos(rotateX);
-	auto sinY = sin(rotateY);
-	auto cosY = cos(rotateY);
-	auto sinZ = sin(rotateZ);
-	auto cosZ = cos(rotateZ);
+	T sinX = sin(rotateX);
+	T cosX = cos(rotateX);
+	T sinY = sin(rotateY);
+	T cosY = cos(rotateY);
+	T sinZ = sin(rotateZ);
+	T cosZ = cos(rotateZ);
 	auto m0  = cosZ * cosY;
 	auto m1  = sinZ * cosY;
 	auto m4  = -sinZ * cosX + cosZ * sinY * sinX;
@@ -6746,7 +6737,7 @@ GenoMatrix<4, 4, T> rotateXYZ(const GenoMatrix<4, 4, T> & matrix, T rotateX, T r
 	auto m8  = sinZ * sinX + cosZ * sinY * cosX;
 	auto m9  = -cosZ * sinX + sinZ * sinY * cosX;
 	auto m10 = cosY * cosX;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * m0 + matrix.m[4] * m1 + matrix.m[8] * -sinY,
 		matrix.m[1] * m0 + matrix.m[5] * m1 + matrix.m[9] * -sinY,
 		matrix.m[2] * m0 + matrix.m[6] * m1 + matrix.m[10] * -sinY,
@@ -6763,17 +6754,17 @@ GenoMatrix<4, 4, T> rotateXYZ(const GenoMatrix<4, 4, T> & matrix, T rotateX, T r
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateXYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & rotate) {
-	auto sinX = sin(rotate.v[0]);
-	auto cosX = cos(rotate.v[0]);
-	auto sinY = sin(rotate.v[1]);
-	auto cosY = cos(rotate.v[1]);
-	auto sinZ = sin(rotate.v[2]);
-	auto cosZ = cos(rotate.v[2]);
+	T sinX = sin(rotate.v[0]);
+	T cosX = cos(rotate.v[0]);
+	T sinY = sin(rotate.v[1]);
+	T cosY = cos(rotate.v[1]);
+	T sinZ = sin(rotate.v[2]);
+	T cosZ = cos(rotate.v[2]);
 	auto m0  = cosZ * cosY;
 	auto m1  = sinZ * cosY;
 	auto m4  = -sinZ * cosX + cosZ * sinY * sinX;
@@ -6782,7 +6773,7 @@ GenoMatrix<4, 4, T> & rotateXYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 	auto m8  = sinZ * sinX + cosZ * sinY * cosX;
 	auto m9  = -cosZ * sinX + sinZ * sinY * cosX;
 	auto m10 = cosY * cosX;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * m0 + matrix.m[4] * m1 + matrix.m[8] * -sinY,
 		matrix.m[1] * m0 + matrix.m[5] * m1 + matrix.m[9] * -sinY,
 		matrix.m[2] * m0 + matrix.m[6] * m1 + matrix.m[10] * -sinY,
@@ -6799,17 +6790,17 @@ GenoMatrix<4, 4, T> & rotateXYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateXZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & rotate) {
-	auto sinX = sin(rotate.v[0]);
-	auto cosX = cos(rotate.v[0]);
-	auto sinY = sin(rotate.v[2]);
-	auto cosY = cos(rotate.v[2]);
-	auto sinZ = sin(rotate.v[1]);
-	auto cosZ = cos(rotate.v[1]);
+	T sinX = sin(rotate.v[0]);
+	T cosX = cos(rotate.v[0]);
+	T sinY = sin(rotate.v[2]);
+	T cosY = cos(rotate.v[2]);
+	T sinZ = sin(rotate.v[1]);
+	T cosZ = cos(rotate.v[1]);
 	auto m0  = cosY * cosZ;
 	auto m2  = -sinY * cosZ;
 	auto m4  = -cosY * sinZ * cosX + sinY * sinX;
@@ -6818,7 +6809,7 @@ GenoMatrix<4, 4, T> & rotateXZY(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 	auto m8  = cosY * sinZ * sinX + sinY * cosX;
 	auto m9  = -cosZ * sinX;
 	auto m10 = -sinY * sinZ * sinX + cosY * cosX;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * m0 + matrix.m[4] * sinZ + matrix.m[8] * m2,
 		matrix.m[1] * m0 + matrix.m[5] * sinZ + matrix.m[9] * m2,
 		matrix.m[2] * m0 + matrix.m[6] * sinZ + matrix.m[10] * m2,
@@ -6835,17 +6826,17 @@ GenoMatrix<4, 4, T> & rotateXZY(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateYXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & rotate) {
-	auto sinX = sin(rotate.v[1]);
-	auto cosX = cos(rotate.v[1]);
-	auto sinY = sin(rotate.v[0]);
-	auto cosY = cos(rotate.v[0]);
-	auto sinZ = sin(rotate.v[2]);
-	auto cosZ = cos(rotate.v[2]);
+	T sinX = sin(rotate.v[1]);
+	T cosX = cos(rotate.v[1]);
+	T sinY = sin(rotate.v[0]);
+	T cosY = cos(rotate.v[0]);
+	T sinZ = sin(rotate.v[2]);
+	T cosZ = cos(rotate.v[2]);
 	auto m0  = cosZ * cosY - sinZ * sinX * sinY;
 	auto m1  = sinZ * cosY + cosZ * sinX * sinY;
 	auto m2  = -cosX * sinY;
@@ -6854,7 +6845,7 @@ GenoMatrix<4, 4, T> & rotateYXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 	auto m8  = cosZ * sinY + sinZ * sinX * cosY;
 	auto m9  = sinZ * sinY - cosZ * sinX * cosY;
 	auto m10 = cosX * cosY;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * m0 + matrix.m[4] * m1 + matrix.m[8] * m2,
 		matrix.m[1] * m0 + matrix.m[5] * m1 + matrix.m[9] * m2,
 		matrix.m[2] * m0 + matrix.m[6] * m1 + matrix.m[10] * m2,
@@ -6871,17 +6862,17 @@ GenoMatrix<4, 4, T> & rotateYXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateYZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & rotate) {
-	auto sinX = sin(rotate.v[2]);
-	auto cosX = cos(rotate.v[2]);
-	auto sinY = sin(rotate.v[0]);
-	auto cosY = cos(rotate.v[0]);
-	auto sinZ = sin(rotate.v[1]);
-	auto cosZ = cos(rotate.v[1]);
+	T sinX = sin(rotate.v[2]);
+	T cosX = cos(rotate.v[2]);
+	T sinY = sin(rotate.v[0]);
+	T cosY = cos(rotate.v[0]);
+	T sinZ = sin(rotate.v[1]);
+	T cosZ = cos(rotate.v[1]);
 	auto m0  = cosZ * cosY;
 	auto m1  = cosX * sinZ * cosY + sinX * sinY;
 	auto m2  = sinX * sinZ * cosY - cosX * sinY;
@@ -6890,7 +6881,7 @@ GenoMatrix<4, 4, T> & rotateYZX(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 	auto m8  = cosZ * sinY;
 	auto m9  = cosX * sinZ * sinY - sinX * cosY;
 	auto m10 = sinX * sinZ * sinY + cosX * cosY;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * m0 + matrix.m[4] * m1 + matrix.m[8] * m2,
 		matrix.m[1] * m0 + matrix.m[5] * m1 + matrix.m[9] * m2,
 		matrix.m[2] * m0 + matrix.m[6] * m1 + matrix.m[10] * m2,
@@ -6907,17 +6898,17 @@ GenoMatrix<4, 4, T> & rotateYZX(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateZXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & rotate) {
-	auto sinX = sin(rotate.v[1]);
-	auto cosX = cos(rotate.v[1]);
-	auto sinY = sin(rotate.v[2]);
-	auto cosY = cos(rotate.v[2]);
-	auto sinZ = sin(rotate.v[0]);
-	auto cosZ = cos(rotate.v[0]);
+	T sinX = sin(rotate.v[1]);
+	T cosX = cos(rotate.v[1]);
+	T sinY = sin(rotate.v[2]);
+	T cosY = cos(rotate.v[2]);
+	T sinZ = sin(rotate.v[0]);
+	T cosZ = cos(rotate.v[0]);
 	auto m0  = cosY * cosZ + sinY * sinX * sinZ;
 	auto m1  = cosX * sinZ;
 	auto m2  = -sinY * cosZ + cosY * sinX * sinZ;
@@ -6926,7 +6917,7 @@ GenoMatrix<4, 4, T> & rotateZXY(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 	auto m6  = sinY * sinZ + cosY * sinX * cosZ;
 	auto m8  = sinY * cosX;
 	auto m10 = cosY * cosX;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * m0 + matrix.m[4] * m1 + matrix.m[8] * m2,
 		matrix.m[1] * m0 + matrix.m[5] * m1 + matrix.m[9] * m2,
 		matrix.m[2] * m0 + matrix.m[6] * m1 + matrix.m[10] * m2,
@@ -6943,17 +6934,17 @@ GenoMatrix<4, 4, T> & rotateZXY(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateZYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & rotate) {
-	auto sinX = sin(rotate.v[2]);
-	auto cosX = cos(rotate.v[2]);
-	auto sinY = sin(rotate.v[1]);
-	auto cosY = cos(rotate.v[1]);
-	auto sinZ = sin(rotate.v[0]);
-	auto cosZ = cos(rotate.v[0]);
+	T sinX = sin(rotate.v[2]);
+	T cosX = cos(rotate.v[2]);
+	T sinY = sin(rotate.v[1]);
+	T cosY = cos(rotate.v[1]);
+	T sinZ = sin(rotate.v[0]);
+	T cosZ = cos(rotate.v[0]);
 	auto m0  = cosY * cosZ;
 	auto m1  = sinX * sinY * cosZ + cosX * sinZ;
 	auto m2  = -cosX * sinY * cosZ + sinX * sinZ;
@@ -6962,7 +6953,7 @@ GenoMatrix<4, 4, T> & rotateZYX(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 	auto m6  = cosX * sinY * sinZ + sinX * cosZ;
 	auto m9  = -sinX * cosY;
 	auto m10 = cosX * cosY;
-	return new T[4 * 4] {
+	return {{
 		matrix.m[0] * m0 + matrix.m[4] * m1 + matrix.m[8] * m2,
 		matrix.m[1] * m0 + matrix.m[5] * m1 + matrix.m[9] * m2,
 		matrix.m[2] * m0 + matrix.m[6] * m1 + matrix.m[10] * m2,
@@ -6979,13 +6970,13 @@ GenoMatrix<4, 4, T> & rotateZYX(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateX(const GenoMatrix<4, 4, T> & matrix, T rotateX, GenoMatrix<4, 4, T> & target) {
-	auto sinX = sin(rotateX);
-	auto cosX = cos(rotateX);
+	T sinX = sin(rotateX);
+	T cosX = cos(rotateX);
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -7007,8 +6998,8 @@ GenoMatrix<4, 4, T> & rotateX(const GenoMatrix<4, 4, T> & matrix, T rotateX, Gen
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateY(const GenoMatrix<4, 4, T> & matrix, T rotateY, GenoMatrix<4, 4, T> & target) {
-	auto sinY = sin(rotateY);
-	auto cosY = cos(rotateY);
+	T sinY = sin(rotateY);
+	T cosY = cos(rotateY);
 	target.m[0] = matrix.m[0] * cosY + matrix.m[8] * -sinY;
 	target.m[1] = matrix.m[1] * cosY + matrix.m[9] * -sinY;
 	target.m[2] = matrix.m[2] * cosY + matrix.m[10] * -sinY;
@@ -7030,8 +7021,8 @@ GenoMatrix<4, 4, T> & rotateY(const GenoMatrix<4, 4, T> & matrix, T rotateY, Gen
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateZ(const GenoMatrix<4, 4, T> & matrix, T rotateZ, GenoMatrix<4, 4, T> & target) {
-	auto sinZ = sin(rotateZ);
-	auto cosZ = cos(rotateZ);
+	T sinZ = sin(rotateZ);
+	T cosZ = cos(rotateZ);
 	target.m[0] = matrix.m[0] * cosZ + matrix.m[4] * sinZ;
 	target.m[1] = matrix.m[1] * cosZ + matrix.m[5] * sinZ;
 	target.m[2] = matrix.m[2] * cosZ + matrix.m[6] * sinZ;
@@ -7053,10 +7044,10 @@ GenoMatrix<4, 4, T> & rotateZ(const GenoMatrix<4, 4, T> & matrix, T rotateZ, Gen
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateXY(const GenoMatrix<4, 4, T> & matrix, T rotateX, T rotateY, GenoMatrix<4, 4, T> & target) {
-	auto sinX = sin(rotateX);
-	auto cosX = cos(rotateX);
-	auto sinY = sin(rotateY);
-	auto cosY = cos(rotateY);
+	T sinX = sin(rotateX);
+	T cosX = cos(rotateX);
+	T sinY = sin(rotateY);
+	T cosY = cos(rotateY);
 	auto m4  = sinY * sinX;
 	auto m6  = cosY * sinX;
 	auto m8  = sinY * cosX;
@@ -7082,10 +7073,10 @@ GenoMatrix<4, 4, T> & rotateXY(const GenoMatrix<4, 4, T> & matrix, T rotateX, T
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & rotate, GenoMatrix<4, 4, T> & target) {
-	auto sinX = sin(rotate.v[0]);
-	auto cosX = cos(rotate.v[0]);
-	auto sinY = sin(rotate.v[1]);
-	auto cosY = cos(rotate.v[1]);
+	T sinX = sin(rotate.v[0]);
+	T cosX = cos(rotate.v[0]);
+	T sinY = sin(rotate.v[1]);
+	T cosY = cos(rotate.v[1]);
 	auto m4  = sinY * sinX;
 	auto m6  = cosY * sinX;
 	auto m8  = sinY * cosX;
@@ -7111,10 +7102,10 @@ GenoMatrix<4, 4, T> & rotateXY(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateXZ(const GenoMatrix<4, 4, T> & matrix, T rotateX, T rotateZ, GenoMatrix<4, 4, T> & target) {
-	auto sinX = sin(rotateX);
-	auto cosX = cos(rotateX);
-	auto sinZ = sin(rotateZ);
-	auto cosZ = cos(rotateZ);
+	T sinX = sin(rotateX);
+	T cosX = cos(rotateX);
+	T sinZ = sin(rotateZ);
+	T cosZ = cos(rotateZ);
 	auto m4  = -sinZ * cosX;
 	auto m5  = cosZ * cosX;
 	auto m8  = sinZ * sinX;
@@ -7140,10 +7131,10 @@ GenoMatrix<4, 4, T> & rotateXZ(const GenoMatrix<4, 4, T> & matrix, T rotateX, T
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & rotate, GenoMatrix<4, 4, T> & target) {
-	auto sinX = sin(rotate.v[0]);
-	auto cosX = cos(rotate.v[0]);
-	auto sinZ = sin(rotate.v[1]);
-	auto cosZ = cos(rotate.v[1]);
+	T sinX = sin(rotate.v[0]);
+	T cosX = cos(rotate.v[0]);
+	T sinZ = sin(rotate.v[1]);
+	T cosZ = cos(rotate.v[1]);
 	auto m4  = -sinZ * cosX;
 	auto m5  = cosZ * cosX;
 	auto m8  = sinZ * sinX;
@@ -7169,10 +7160,10 @@ GenoMatrix<4, 4, T> & rotateXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & rotate, GenoMatrix<4, 4, T> & target) {
-	auto sinX = sin(rotate.v[1]);
-	auto cosX = cos(rotate.v[1]);
-	auto sinY = sin(rotate.v[0]);
-	auto cosY = cos(rotate.v[0]);
+	T sinX = sin(rotate.v[1]);
+	T cosX = cos(rotate.v[1]);
+	T sinY = sin(rotate.v[0]);
+	T cosY = cos(rotate.v[0]);
 	auto m1  = sinX * sinY;
 	auto m2  = -cosX * sinY;
 	auto m9  = -sinX * cosY;
@@ -7198,10 +7189,10 @@ GenoMatrix<4, 4, T> & rotateYX(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateYZ(const GenoMatrix<4, 4, T> & matrix, T rotateY, T rotateZ, GenoMatrix<4, 4, T> & target) {
-	auto sinY = sin(rotateY);
-	auto cosY = cos(rotateY);
-	auto sinZ = sin(rotateZ);
-	auto cosZ = cos(rotateZ);
+	T sinY = sin(rotateY);
+	T cosY = cos(rotateY);
+	T sinZ = sin(rotateZ);
+	T cosZ = cos(rotateZ);
 	auto m0  = cosZ * cosY;
 	auto m1  = sinZ * cosY;
 	auto m8  = cosZ * sinY;
@@ -7227,10 +7218,10 @@ GenoMatrix<4, 4, T> & rotateYZ(const GenoMatrix<4, 4, T> & matrix, T rotateY, T
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & rotate, GenoMatrix<4, 4, T> & target) {
-	auto sinY = sin(rotate.v[0]);
-	auto cosY = cos(rotate.v[0]);
-	auto sinZ = sin(rotate.v[1]);
-	auto cosZ = cos(rotate.v[1]);
+	T sinY = sin(rotate.v[0]);
+	T cosY = cos(rotate.v[0]);
+	T sinZ = sin(rotate.v[1]);
+	T cosZ = cos(rotate.v[1]);
 	auto m0  = cosZ * cosY;
 	auto m1  = sinZ * cosY;
 	auto m8  = cosZ * sinY;
@@ -7256,10 +7247,10 @@ GenoMatrix<4, 4, T> & rotateYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & rotate, GenoMatrix<4, 4, T> & target) {
-	auto sinX = sin(rotate.v[1]);
-	auto cosX = cos(rotate.v[1]);
-	auto sinZ = sin(rotate.v[0]);
-	auto cosZ = cos(rotate.v[0]);
+	T sinX = sin(rotate.v[1]);
+	T cosX = cos(rotate.v[1]);
+	T sinZ = sin(rotate.v[0]);
+	T cosZ = cos(rotate.v[0]);
 	auto m1  = cosX * sinZ;
 	auto m2  = sinX * sinZ;
 	auto m5  = cosX * cosZ;
@@ -7285,10 +7276,10 @@ GenoMatrix<4, 4, T> & rotateZX(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & rotate, GenoMatrix<4, 4, T> & target) {
-	auto sinY = sin(rotate.v[1]);
-	auto cosY = cos(rotate.v[1]);
-	auto sinZ = sin(rotate.v[0]);
-	auto cosZ = cos(rotate.v[0]);
+	T sinY = sin(rotate.v[1]);
+	T cosY = cos(rotate.v[1]);
+	T sinZ = sin(rotate.v[0]);
+	T cosZ = cos(rotate.v[0]);
 	auto m0  = cosY * cosZ;
 	auto m2  = -sinY * cosZ;
 	auto m4  = -cosY * sinZ;
@@ -7314,12 +7305,12 @@ GenoMatrix<4, 4, T> & rotateZY(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateXYZ(const GenoMatrix<4, 4, T> & matrix, T rotateX, T rotateY, T rotateZ, GenoMatrix<4, 4, T> & target) {
-	auto sinX = sin(rotateX);
-	auto cosX = cos(rotateX);
-	auto sinY = sin(rotateY);
-	auto cosY = cos(rotateY);
-	auto sinZ = sin(rotateZ);
-	auto cosZ = cos(rotateZ);
+	T sinX = sin(rotateX);
+	T cosX = cos(rotateX);
+	T sinY = sin(rotateY);
+	T cosY = cos(rotateY);
+	T sinZ = sin(rotateZ);
+	T cosZ = cos(rotateZ);
 	auto m0  = cosZ * cosY;
 	auto m1  = sinZ * cosY;
 	auto m4  = -sinZ * cosX + cosZ * sinY * sinX;
@@ -7349,12 +7340,12 @@ GenoMatrix<4, 4, T> & rotateXYZ(const GenoMatrix<4, 4, T> & matrix, T rotateX, T
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateXYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & rotate, GenoMatrix<4, 4, T> & target) {
-	auto sinX = sin(rotate.v[0]);
-	auto cosX = cos(rotate.v[0]);
-	auto sinY = sin(rotate.v[1]);
-	auto cosY = cos(rotate.v[1]);
-	auto sinZ = sin(rotate.v[2]);
-	auto cosZ = cos(rotate.v[2]);
+	T sinX = sin(rotate.v[0]);
+	T cosX = cos(rotate.v[0]);
+	T sinY = sin(rotate.v[1]);
+	T cosY = cos(rotate.v[1]);
+	T sinZ = sin(rotate.v[2]);
+	T cosZ = cos(rotate.v[2]);
 	auto m0  = cosZ * cosY;
 	auto m1  = sinZ * cosY;
 	auto m4  = -sinZ * cosX + cosZ * sinY * sinX;
@@ -7384,12 +7375,12 @@ GenoMatrix<4, 4, T> & rotateXYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateXZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & rotate, GenoMatrix<4, 4, T> & target) {
-	auto sinX = sin(rotate.v[0]);
-	auto cosX = cos(rotate.v[0]);
-	auto sinY = sin(rotate.v[2]);
-	auto cosY = cos(rotate.v[2]);
-	auto sinZ = sin(rotate.v[1]);
-	auto cosZ = cos(rotate.v[1]);
+	T sinX = sin(rotate.v[0]);
+	T cosX = cos(rotate.v[0]);
+	T sinY = sin(rotate.v[2]);
+	T cosY = cos(rotate.v[2]);
+	T sinZ = sin(rotate.v[1]);
+	T cosZ = cos(rotate.v[1]);
 	auto m0  = cosY * cosZ;
 	auto m2  = -sinY * cosZ;
 	auto m4  = -cosY * sinZ * cosX + sinY * sinX;
@@ -7419,12 +7410,12 @@ GenoMatrix<4, 4, T> & rotateXZY(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateYXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & rotate, GenoMatrix<4, 4, T> & target) {
-	auto sinX = sin(rotate.v[1]);
-	auto cosX = cos(rotate.v[1]);
-	auto sinY = sin(rotate.v[0]);
-	auto cosY = cos(rotate.v[0]);
-	auto sinZ = sin(rotate.v[2]);
-	auto cosZ = cos(rotate.v[2]);
+	T sinX = sin(rotate.v[1]);
+	T cosX = cos(rotate.v[1]);
+	T sinY = sin(rotate.v[0]);
+	T cosY = cos(rotate.v[0]);
+	T sinZ = sin(rotate.v[2]);
+	T cosZ = cos(rotate.v[2]);
 	auto m0  = cosZ * cosY - sinZ * sinX * sinY;
 	auto m1  = sinZ * cosY + cosZ * sinX * sinY;
 	auto m2  = -cosX * sinY;
@@ -7454,12 +7445,12 @@ GenoMatrix<4, 4, T> & rotateYXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateYZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & rotate, GenoMatrix<4, 4, T> & target) {
-	auto sinX = sin(rotate.v[2]);
-	auto cosX = cos(rotate.v[2]);
-	auto sinY = sin(rotate.v[0]);
-	auto cosY = cos(rotate.v[0]);
-	auto sinZ = sin(rotate.v[1]);
-	auto cosZ = cos(rotate.v[1]);
+	T sinX = sin(rotate.v[2]);
+	T cosX = cos(rotate.v[2]);
+	T sinY = sin(rotate.v[0]);
+	T cosY = cos(rotate.v[0]);
+	T sinZ = sin(rotate.v[1]);
+	T cosZ = cos(rotate.v[1]);
 	auto m0  = cosZ * cosY;
 	auto m1  = cosX * sinZ * cosY + sinX * sinY;
 	auto m2  = sinX * sinZ * cosY - cosX * sinY;
@@ -7489,12 +7480,12 @@ GenoMatrix<4, 4, T> & rotateYZX(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateZXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & rotate, GenoMatrix<4, 4, T> & target) {
-	auto sinX = sin(rotate.v[1]);
-	auto cosX = cos(rotate.v[1]);
-	auto sinY = sin(rotate.v[2]);
-	auto cosY = cos(rotate.v[2]);
-	auto sinZ = sin(rotate.v[0]);
-	auto cosZ = cos(rotate.v[0]);
+	T sinX = sin(rotate.v[1]);
+	T cosX = cos(rotate.v[1]);
+	T sinY = sin(rotate.v[2]);
+	T cosY = cos(rotate.v[2]);
+	T sinZ = sin(rotate.v[0]);
+	T cosZ = cos(rotate.v[0]);
 	auto m0  = cosY * cosZ + sinY * sinX * sinZ;
 	auto m1  = cosX * sinZ;
 	auto m2  = -sinY * cosZ + cosY * sinX * sinZ;
@@ -7524,12 +7515,12 @@ GenoMatrix<4, 4, T> & rotateZXY(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 
 template <typename T>
 GenoMatrix<4, 4, T> & rotateZYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & rotate, GenoMatrix<4, 4, T> & target) {
-	auto sinX = sin(rotate.v[2]);
-	auto cosX = cos(rotate.v[2]);
-	auto sinY = sin(rotate.v[1]);
-	auto cosY = cos(rotate.v[1]);
-	auto sinZ = sin(rotate.v[0]);
-	auto cosZ = cos(rotate.v[0]);
+	T sinX = sin(rotate.v[2]);
+	T cosX = cos(rotate.v[2]);
+	T sinY = sin(rotate.v[1]);
+	T cosY = cos(rotate.v[1]);
+	T sinZ = sin(rotate.v[0]);
+	T cosZ = cos(rotate.v[0]);
 	auto m0  = cosY * cosZ;
 	auto m1  = sinX * sinY * cosZ + cosX * sinZ;
 	auto m2  = -cosX * sinY * cosZ + sinX * sinZ;
@@ -7558,8 +7549,8 @@ GenoMatrix<4, 4, T> & rotateZYX(const GenoMatrix<4, 4, T> & matrix, const GenoVe
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleX(const GenoMatrix<4, 4, T> & matrix, T scaleX) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleX(const GenoMatrix<4, 4, T> & matrix, T scaleX) {
+	return {{
 		matrix.m[0] * scaleX,
 		matrix.m[1] * scaleX,
 		matrix.m[2] * scaleX,
@@ -7576,12 +7567,12 @@ GenoMatrix<4, 4, T> scaleX(const GenoMatrix<4, 4, T> & matrix, T scaleX) {
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleY(const GenoMatrix<4, 4, T> & matrix, T scaleY) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleY(const GenoMatrix<4, 4, T> & matrix, T scaleY) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -7598,12 +7589,12 @@ GenoMatrix<4, 4, T> scaleY(const GenoMatrix<4, 4, T> & matrix, T scaleY) {
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleZ(const GenoMatrix<4, 4, T> & matrix, T scaleZ) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleZ(const GenoMatrix<4, 4, T> & matrix, T scaleZ) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -7620,12 +7611,12 @@ GenoMatrix<4, 4, T> scaleZ(const GenoMatrix<4, 4, T> & matrix, T scaleZ) {
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleXY(const GenoMatrix<4, 4, T> & matrix, T scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleXY(const GenoMatrix<4, 4, T> & matrix, T scale) {
+	return {{
 		matrix.m[0] * scale,
 		matrix.m[1] * scale,
 		matrix.m[2] * scale,
@@ -7642,12 +7633,12 @@ GenoMatrix<4, 4, T> scaleXY(const GenoMatrix<4, 4, T> & matrix, T scale) {
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleXY(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleXY(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY) {
+	return {{
 		matrix.m[0] * scaleX,
 		matrix.m[1] * scaleX,
 		matrix.m[2] * scaleX,
@@ -7664,12 +7655,12 @@ GenoMatrix<4, 4, T> scaleXY(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scal
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale) {
+	return {{
 		matrix.m[0] * scale.v[0],
 		matrix.m[1] * scale.v[0],
 		matrix.m[2] * scale.v[0],
@@ -7686,12 +7677,12 @@ GenoMatrix<4, 4, T> scaleXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleXZ(const GenoMatrix<4, 4, T> & matrix, T scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleXZ(const GenoMatrix<4, 4, T> & matrix, T scale) {
+	return {{
 		matrix.m[0] * scale,
 		matrix.m[1] * scale,
 		matrix.m[2] * scale,
@@ -7708,12 +7699,12 @@ GenoMatrix<4, 4, T> scaleXZ(const GenoMatrix<4, 4, T> & matrix, T scale) {
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleXZ(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleZ) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleXZ(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleZ) {
+	return {{
 		matrix.m[0] * scaleX,
 		matrix.m[1] * scaleX,
 		matrix.m[2] * scaleX,
@@ -7730,12 +7721,12 @@ GenoMatrix<4, 4, T> scaleXZ(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scal
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale) {
+	return {{
 		matrix.m[0] * scale.v[0],
 		matrix.m[1] * scale.v[0],
 		matrix.m[2] * scale.v[0],
@@ -7752,12 +7743,12 @@ GenoMatrix<4, 4, T> scaleXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale) {
+	return {{
 		matrix.m[0] * scale.v[1],
 		matrix.m[1] * scale.v[1],
 		matrix.m[2] * scale.v[1],
@@ -7774,12 +7765,12 @@ GenoMatrix<4, 4, T> scaleYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleYZ(const GenoMatrix<4, 4, T> & matrix, T scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleYZ(const GenoMatrix<4, 4, T> & matrix, T scale) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -7796,12 +7787,12 @@ GenoMatrix<4, 4, T> scaleYZ(const GenoMatrix<4, 4, T> & matrix, T scale) {
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleYZ(const GenoMatrix<4, 4, T> & matrix, T scaleY, T scaleZ) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleYZ(const GenoMatrix<4, 4, T> & matrix, T scaleY, T scaleZ) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -7818,12 +7809,12 @@ GenoMatrix<4, 4, T> scaleYZ(const GenoMatrix<4, 4, T> & matrix, T scaleY, T scal
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -7840,12 +7831,12 @@ GenoMatrix<4, 4, T> scaleYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale) {
+	return {{
 		matrix.m[0] * scale.v[1],
 		matrix.m[1] * scale.v[1],
 		matrix.m[2] * scale.v[1],
@@ -7862,12 +7853,12 @@ GenoMatrix<4, 4, T> scaleZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale) {
+	return {{
 		matrix.m[0],
 		matrix.m[1],
 		matrix.m[2],
@@ -7884,12 +7875,12 @@ GenoMatrix<4, 4, T> scaleZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleXYZ(const GenoMatrix<4, 4, T> & matrix, T scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleXYZ(const GenoMatrix<4, 4, T> & matrix, T scale) {
+	return {{
 		matrix.m[0] * scale,
 		matrix.m[1] * scale,
 		matrix.m[2] * scale,
@@ -7906,12 +7897,12 @@ GenoMatrix<4, 4, T> scaleXYZ(const GenoMatrix<4, 4, T> & matrix, T scale) {
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleXYZ(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY, T scaleZ) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleXYZ(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY, T scaleZ) {
+	return {{
 		matrix.m[0] * scaleX,
 		matrix.m[1] * scaleX,
 		matrix.m[2] * scaleX,
@@ -7928,12 +7919,12 @@ GenoMatrix<4, 4, T> scaleXYZ(const GenoMatrix<4, 4, T> & matrix, T scaleX, T sca
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleXYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleXYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale) {
+	return {{
 		matrix.m[0] * scale.v[0],
 		matrix.m[1] * scale.v[0],
 		matrix.m[2] * scale.v[0],
@@ -7950,12 +7941,12 @@ GenoMatrix<4, 4, T> scaleXYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVecto
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleXZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleXZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale) {
+	return {{
 		matrix.m[0] * scale.v[0],
 		matrix.m[1] * scale.v[0],
 		matrix.m[2] * scale.v[0],
@@ -7972,12 +7963,12 @@ GenoMatrix<4, 4, T> scaleXZY(const GenoMatrix<4, 4, T> & matrix, const GenoVecto
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleYXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleYXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale) {
+	return {{
 		matrix.m[0] * scale.v[1],
 		matrix.m[1] * scale.v[1],
 		matrix.m[2] * scale.v[1],
@@ -7994,12 +7985,12 @@ GenoMatrix<4, 4, T> scaleYXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVecto
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleYZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleYZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale) {
+	return {{
 		matrix.m[0] * scale.v[2],
 		matrix.m[1] * scale.v[2],
 		matrix.m[2] * scale.v[2],
@@ -8016,12 +8007,12 @@ GenoMatrix<4, 4, T> scaleYZX(const GenoMatrix<4, 4, T> & matrix, const GenoVecto
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleZXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleZXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale) {
+	return {{
 		matrix.m[0] * scale.v[1],
 		matrix.m[1] * scale.v[1],
 		matrix.m[2] * scale.v[1],
@@ -8038,12 +8029,12 @@ GenoMatrix<4, 4, T> scaleZXY(const GenoMatrix<4, 4, T> & matrix, const GenoVecto
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> scaleZYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale) {
-	return new T[4 * 4] {
+constexpr GenoMatrix<4, 4, T> scaleZYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale) {
+	return {{
 		matrix.m[0] * scale.v[2],
 		matrix.m[1] * scale.v[2],
 		matrix.m[2] * scale.v[2],
@@ -8060,11 +8051,11 @@ GenoMatrix<4, 4, T> scaleZYX(const GenoMatrix<4, 4, T> & matrix, const GenoVecto
 		matrix.m[13],
 		matrix.m[14],
 		matrix.m[15]
-	};
+	}};
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleX(const GenoMatrix<4, 4, T> & matrix, T scaleX, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleX(const GenoMatrix<4, 4, T> & matrix, T scaleX, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scaleX;
 	target.m[1] = matrix.m[1] * scaleX;
 	target.m[2] = matrix.m[2] * scaleX;
@@ -8085,7 +8076,7 @@ GenoMatrix<4, 4, T> & scaleX(const GenoMatrix<4, 4, T> & matrix, T scaleX, GenoM
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleY(const GenoMatrix<4, 4, T> & matrix, T scaleY, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleY(const GenoMatrix<4, 4, T> & matrix, T scaleY, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -8106,7 +8097,7 @@ GenoMatrix<4, 4, T> & scaleY(const GenoMatrix<4, 4, T> & matrix, T scaleY, GenoM
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleZ(const GenoMatrix<4, 4, T> & matrix, T scaleZ, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleZ(const GenoMatrix<4, 4, T> & matrix, T scaleZ, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -8127,7 +8118,7 @@ GenoMatrix<4, 4, T> & scaleZ(const GenoMatrix<4, 4, T> & matrix, T scaleZ, GenoM
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleXY(const GenoMatrix<4, 4, T> & matrix, T scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleXY(const GenoMatrix<4, 4, T> & matrix, T scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale;
 	target.m[1] = matrix.m[1] * scale;
 	target.m[2] = matrix.m[2] * scale;
@@ -8148,7 +8139,7 @@ GenoMatrix<4, 4, T> & scaleXY(const GenoMatrix<4, 4, T> & matrix, T scale, GenoM
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleXY(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleXY(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scaleX;
 	target.m[1] = matrix.m[1] * scaleX;
 	target.m[2] = matrix.m[2] * scaleX;
@@ -8169,7 +8160,7 @@ GenoMatrix<4, 4, T> & scaleXY(const GenoMatrix<4, 4, T> & matrix, T scaleX, T sc
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[0];
 	target.m[1] = matrix.m[1] * scale.v[0];
 	target.m[2] = matrix.m[2] * scale.v[0];
@@ -8190,7 +8181,7 @@ GenoMatrix<4, 4, T> & scaleXY(const GenoMatrix<4, 4, T> & matrix, const GenoVect
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleXZ(const GenoMatrix<4, 4, T> & matrix, T scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleXZ(const GenoMatrix<4, 4, T> & matrix, T scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale;
 	target.m[1] = matrix.m[1] * scale;
 	target.m[2] = matrix.m[2] * scale;
@@ -8211,7 +8202,7 @@ GenoMatrix<4, 4, T> & scaleXZ(const GenoMatrix<4, 4, T> & matrix, T scale, GenoM
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleXZ(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleZ, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleXZ(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleZ, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scaleX;
 	target.m[1] = matrix.m[1] * scaleX;
 	target.m[2] = matrix.m[2] * scaleX;
@@ -8232,7 +8223,7 @@ GenoMatrix<4, 4, T> & scaleXZ(const GenoMatrix<4, 4, T> & matrix, T scaleX, T sc
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[0];
 	target.m[1] = matrix.m[1] * scale.v[0];
 	target.m[2] = matrix.m[2] * scale.v[0];
@@ -8253,7 +8244,7 @@ GenoMatrix<4, 4, T> & scaleXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVect
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[1];
 	target.m[1] = matrix.m[1] * scale.v[1];
 	target.m[2] = matrix.m[2] * scale.v[1];
@@ -8274,7 +8265,7 @@ GenoMatrix<4, 4, T> & scaleYX(const GenoMatrix<4, 4, T> & matrix, const GenoVect
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleYZ(const GenoMatrix<4, 4, T> & matrix, T scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleYZ(const GenoMatrix<4, 4, T> & matrix, T scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -8295,7 +8286,7 @@ GenoMatrix<4, 4, T> & scaleYZ(const GenoMatrix<4, 4, T> & matrix, T scale, GenoM
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleYZ(const GenoMatrix<4, 4, T> & matrix, T scaleY, T scaleZ, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleYZ(const GenoMatrix<4, 4, T> & matrix, T scaleY, T scaleZ, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -8316,7 +8307,7 @@ GenoMatrix<4, 4, T> & scaleYZ(const GenoMatrix<4, 4, T> & matrix, T scaleY, T sc
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -8337,7 +8328,7 @@ GenoMatrix<4, 4, T> & scaleYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVect
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[1];
 	target.m[1] = matrix.m[1] * scale.v[1];
 	target.m[2] = matrix.m[2] * scale.v[1];
@@ -8358,7 +8349,7 @@ GenoMatrix<4, 4, T> & scaleZX(const GenoMatrix<4, 4, T> & matrix, const GenoVect
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<2, T> & scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0];
 	target.m[1] = matrix.m[1];
 	target.m[2] = matrix.m[2];
@@ -8379,7 +8370,7 @@ GenoMatrix<4, 4, T> & scaleZY(const GenoMatrix<4, 4, T> & matrix, const GenoVect
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleXYZ(const GenoMatrix<4, 4, T> & matrix, T scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleXYZ(const GenoMatrix<4, 4, T> & matrix, T scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale;
 	target.m[1] = matrix.m[1] * scale;
 	target.m[2] = matrix.m[2] * scale;
@@ -8400,7 +8391,7 @@ GenoMatrix<4, 4, T> & scaleXYZ(const GenoMatrix<4, 4, T> & matrix, T scale, Geno
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleXYZ(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY, T scaleZ, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleXYZ(const GenoMatrix<4, 4, T> & matrix, T scaleX, T scaleY, T scaleZ, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scaleX;
 	target.m[1] = matrix.m[1] * scaleX;
 	target.m[2] = matrix.m[2] * scaleX;
@@ -8421,7 +8412,7 @@ GenoMatrix<4, 4, T> & scaleXYZ(const GenoMatrix<4, 4, T> & matrix, T scaleX, T s
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleXYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleXYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[0];
 	target.m[1] = matrix.m[1] * scale.v[0];
 	target.m[2] = matrix.m[2] * scale.v[0];
@@ -8442,7 +8433,7 @@ GenoMatrix<4, 4, T> & scaleXYZ(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleXZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleXZY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[0];
 	target.m[1] = matrix.m[1] * scale.v[0];
 	target.m[2] = matrix.m[2] * scale.v[0];
@@ -8463,7 +8454,7 @@ GenoMatrix<4, 4, T> & scaleXZY(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleYXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleYXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[1];
 	target.m[1] = matrix.m[1] * scale.v[1];
 	target.m[2] = matrix.m[2] * scale.v[1];
@@ -8484,7 +8475,7 @@ GenoMatrix<4, 4, T> & scaleYXZ(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleYZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleYZX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[2];
 	target.m[1] = matrix.m[1] * scale.v[2];
 	target.m[2] = matrix.m[2] * scale.v[2];
@@ -8505,7 +8496,7 @@ GenoMatrix<4, 4, T> & scaleYZX(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleZXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleZXY(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[1];
 	target.m[1] = matrix.m[1] * scale.v[1];
 	target.m[2] = matrix.m[2] * scale.v[1];
@@ -8526,7 +8517,7 @@ GenoMatrix<4, 4, T> & scaleZXY(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 }
 
 template <typename T>
-GenoMatrix<4, 4, T> & scaleZYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale, GenoMatrix<4, 4, T> & target) {
+constexpr GenoMatrix<4, 4, T> & scaleZYX(const GenoMatrix<4, 4, T> & matrix, const GenoVector<3, T> & scale, GenoMatrix<4, 4, T> & target) {
 	target.m[0] = matrix.m[0] * scale.v[2];
 	target.m[1] = matrix.m[1] * scale.v[2];
 	target.m[2] = matrix.m[2] * scale.v[2];
@@ -8547,8 +8538,8 @@ GenoMatrix<4, 4, T> & scaleZYX(const GenoMatrix<4, 4, T> & matrix, const GenoVec
 }
 
 template <typename T>
-GenoVector<4, T> operator*(const GenoMatrix<4, 4, T> & left, const GenoVector<4, T> & right) {
-	return new T[4] {
+constexpr GenoVector<4, T> operator*(const GenoMatrix<4, 4, T> & left, const GenoVector<4, T> & right) {
+	return {
 		left.m[0] * right.v[0] + left.m[4] * right.v[1] + left.m[8 ] * right.v[2] + left.m[12] * right.v[3],
 		left.m[1] * right.v[0] + left.m[5] * right.v[1] + left.m[9 ] * right.v[2] + left.m[13] * right.v[3],
 		left.m[2] * right.v[0] + left.m[6] * right.v[1] + left.m[10] * right.v[2] + left.m[14] * right.v[3],
@@ -8575,5 +8566,14 @@ using GenoMatrix4ul = GenoMatrix<4, 4, uint64>;
 using GenoMatrix4f  = GenoMatrix<4, 4, float >;
 using GenoMatrix4d  = GenoMatrix<4, 4, double>;
 
+#include "GenoMatrix4Simd.h"
+
+/** Instantiated once in GenoMathInstantiations.cpp, which defines GENO_MATH_INSTANTIATIONS to skip these **/
+#ifndef GENO_MATH_INSTANTIATIONS
+	extern template class GenoMatrix<4, 4, float >;
+	extern template class GenoMatrix<4, 4, double>;
+	extern template class GenoMatrix<4, 4,  int32>;
+#endif // GENO_MATH_INSTANTIATIONS
+
 #define GNARLY_GENOME_MATRIX4_FORWARD
 #endif // GNARLY_GENOME_MATRIX4
\ No newline at end of file
@@ -0,0 +1,269 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_GENOME_MATRIX4_SIMD
+#define GNARLY_GENOME_MATRIX4_SIMD
+
+#include "../GenoSimd.h"
+#include "GenoMatrix4.h"
+
+/**
+ * SSE / AVX versions of the hot GenoMatrix<4, 4, float> operations
+ *
+ * These are explicit specializations of the generic templates in GenoMatrix4.h so callers pick them up without
+ * any change. GenoMatrix<4, 4, T>::m is 16 byte aligned, so every column can be loaded with a single aligned load.
+**/
+
+#ifdef GENO_SSE
+
+namespace GenoMatrix4Simd {
+
+	inline void multiply(const float * left, const float * right, float * product) {
+		__m128 column0 = _mm_load_ps(left + 0 );
+		__m128 column1 = _mm_load_ps(left + 4 );
+		__m128 column2 = _mm_load_ps(left + 8 );
+		__m128 column3 = _mm_load_ps(left + 12);
+#ifdef GENO_AVX
+		__m256 columns0 = _mm256_set_m128(column0, column0);
+		__m256 columns1 = _mm256_set_m128(column1, column1);
+		__m256 columns2 = _mm256_set_m128(column2, column2);
+		__m256 columns3 = _mm256_set_m128(column3, column3);
+		// Two output columns per iteration, the shuffles broadcast one element of each right hand column per lane
+		for (uint32 i = 0; i < 16; i += 8) {
+			__m256 r = _mm256_loadu_ps(right + i);
+			__m256 p = _mm256_mul_ps(columns0, _mm256_shuffle_ps(r, r, 0x00));
+			p = _mm256_add_ps(p, _mm256_mul_ps(columns1, _mm256_shuffle_ps(r, r, 0x55)));
+			p = _mm256_add_ps(p, _mm256_mul_ps(columns2, _mm256_shuffle_ps(r, r, 0xAA)));
+			p = _mm256_add_ps(p, _mm256_mul_ps(columns3, _mm256_shuffle_ps(r, r, 0xFF)));
+			_mm256_storeu_ps(product + i, p);
+		}
+#else
+		for (uint32 i = 0; i < 16; i += 4) {
+			__m128 p = _mm_mul_ps(column0, _mm_set1_ps(right[i]));
+			p = _mm_add_ps(p, _mm_mul_ps(column1, _mm_set1_ps(right[i + 1])));
+			p = _mm_add_ps(p, _mm_mul_ps(column2, _mm_set1_ps(right[i + 2])));
+			p = _mm_add_ps(p, _mm_mul_ps(column3, _mm_set1_ps(right[i + 3])));
+			_mm_store_ps(product + i, p);
+		}
+#endif
+	}
+
+	inline void translate2D(const float * matrix, float translateX, float translateY, float * target) {
+		__m128 column0 = _mm_load_ps(matrix + 0);
+		__m128 column1 = _mm_load_ps(matrix + 4);
+		__m128 column3 = _mm_add_ps(_mm_load_ps(matrix + 12), _mm_add_ps(
+			_mm_mul_ps(column0, _mm_set1_ps(translateX)),
+			_mm_mul_ps(column1, _mm_set1_ps(translateY))
+		));
+		if (matrix != target) {
+			_mm_store_ps(target + 0, column0);
+			_mm_store_ps(target + 4, column1);
+			_mm_store_ps(target + 8, _mm_load_ps(matrix + 8));
+		}
+		_mm_store_ps(target + 12, column3);
+	}
+
+	inline void scale2D(const float * matrix, float scaleX, float scaleY, float * target) {
+		_mm_store_ps(target + 0, _mm_mul_ps(_mm_load_ps(matrix + 0), _mm_set1_ps(scaleX)));
+		_mm_store_ps(target + 4, _mm_mul_ps(_mm_load_ps(matrix + 4), _mm_set1_ps(scaleY)));
+		if (matrix != target) {
+			_mm_store_ps(target + 8,  _mm_load_ps(matrix + 8 ));
+			_mm_store_ps(target + 12, _mm_load_ps(matrix + 12));
+		}
+	}
+
+	inline void transpose(const float * matrix, float * target) {
+		__m128 column0 = _mm_load_ps(matrix + 0 );
+		__m128 column1 = _mm_load_ps(matrix + 4 );
+		__m128 column2 = _mm_load_ps(matrix + 8 );
+		__m128 column3 = _mm_load_ps(matrix + 12);
+		_MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+		_mm_store_ps(target + 0 , column0);
+		_mm_store_ps(target + 4 , column1);
+		_mm_store_ps(target + 8 , column2);
+		_mm_store_ps(target + 12, column3);
+	}
+
+	inline void orthographic(float left, float right, float bottom, float top, float near, float far, float * target) {
+		// The fourth lane is padded with 0 and 1 so that it stays finite
+		__m128 low  = _mm_set_ps(0, near, bottom, left );
+		__m128 high = _mm_set_ps(1, far,  top,    right);
+		alignas(16) float scale[4];
+		_mm_store_ps(scale, _mm_div_ps(_mm_set1_ps(2), _mm_sub_ps(high, low)));
+		__m128 zero = _mm_setzero_ps();
+		_mm_store_ps(target + 0,  _mm_move_ss(zero, _mm_set_ss(scale[0])));
+		_mm_store_ps(target + 4,  _mm_set_ps(0, 0, scale[1], 0));
+		_mm_store_ps(target + 8,  _mm_set_ps(0, scale[2], 0, 0));
+		_mm_store_ps(target + 12, _mm_div_ps(_mm_add_ps(low, high), _mm_sub_ps(low, high)));
+		target[15] = 1;
+	}
+
+	inline void transform(const float * matrix, const float * vector, float * product) {
+		__m128 p = _mm_mul_ps(_mm_load_ps(matrix + 0), _mm_set1_ps(vector[0]));
+		p = _mm_add_ps(p, _mm_mul_ps(_mm_load_ps(matrix + 4 ), _mm_set1_ps(vector[1])));
+		p = _mm_add_ps(p, _mm_mul_ps(_mm_load_ps(matrix + 8 ), _mm_set1_ps(vector[2])));
+		p = _mm_add_ps(p, _mm_mul_ps(_mm_load_ps(matrix + 12), _mm_set1_ps(vector[3])));
+		_mm_storeu_ps(product, p);
+	}
+}
+
+template <>
+inline GenoMatrix<4, 4, float> & GenoMatrix<4, 4, float>::setOrthographic(float left, float right, float bottom, float top, float near, float far) {
+	GenoMatrix4Simd::orthographic(left, right, bottom, top, near, far, m);
+	return *this;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> & GenoMatrix<4, 4, float>::transpose() {
+	GenoMatrix4Simd::transpose(m, m);
+	return *this;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> & GenoMatrix<4, 4, float>::translate2D(float translateX, float translateY) {
+	GenoMatrix4Simd::translate2D(m, translateX, translateY, m);
+	return *this;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> & GenoMatrix<4, 4, float>::translate2D(const GenoVector<2, float> & translate) {
+	GenoMatrix4Simd::translate2D(m, translate.v[0], translate.v[1], m);
+	return *this;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> & GenoMatrix<4, 4, float>::scale2D(float scale) {
+	GenoMatrix4Simd::scale2D(m, scale, scale, m);
+	return *this;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> & GenoMatrix<4, 4, float>::scale2D(float scaleX, float scaleY) {
+	GenoMatrix4Simd::scale2D(m, scaleX, scaleY, m);
+	return *this;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> & GenoMatrix<4, 4, float>::scale2D(const GenoVector<2, float> & scale) {
+	GenoMatrix4Simd::scale2D(m, scale.v[0], scale.v[1], m);
+	return *this;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> operator*(const GenoMatrix<4, 4, float> & left, const GenoMatrix<4, 4, float> & right) {
+	GenoMatrix<4, 4, float> product;
+	GenoMatrix4Simd::multiply(left.m, right.m, product.m);
+	return product;
+}
+
+template <>
+inline GenoVector<4, float> operator*(const GenoMatrix<4, 4, float> & left, const GenoVector<4, float> & right) {
+	GenoVector<4, float> product;
+	GenoMatrix4Simd::transform(left.m, right.v, product.v);
+	return product;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> transpose(const GenoMatrix<4, 4, float> & matrix) {
+	GenoMatrix<4, 4, float> ret;
+	GenoMatrix4Simd::transpose(matrix.m, ret.m);
+	return ret;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> & transpose(const GenoMatrix<4, 4, float> & matrix, GenoMatrix<4, 4, float> & target) {
+	GenoMatrix4Simd::transpose(matrix.m, target.m);
+	return target;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> translate2D(const GenoMatrix<4, 4, float> & matrix, float translateX, float translateY) {
+	GenoMatrix<4, 4, float> ret;
+	GenoMatrix4Simd::translate2D(matrix.m, translateX, translateY, ret.m);
+	return ret;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> translate2D(const GenoMatrix<4, 4, float> & matrix, const GenoVector<2, float> & translate) {
+	GenoMatrix<4, 4, float> ret;
+	GenoMatrix4Simd::translate2D(matrix.m, translate.v[0], translate.v[1], ret.m);
+	return ret;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> & translate2D(const GenoMatrix<4, 4, float> & matrix, float translateX, float translateY, GenoMatrix<4, 4, float> & target) {
+	GenoMatrix4Simd::translate2D(matrix.m, translateX, translateY, target.m);
+	return target;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> & translate2D(const GenoMatrix<4, 4, float> & matrix, const GenoVector<2, float> & translate, GenoMatrix<4, 4, float> & target) {
+	GenoMatrix4Simd::translate2D(matrix.m, translate.v[0], translate.v[1], target.m);
+	return target;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> scale2D(const GenoMatrix<4, 4, float> & matrix, float scale) {
+	GenoMatrix<4, 4, float> ret;
+	GenoMatrix4Simd::scale2D(matrix.m, scale, scale, ret.m);
+	return ret;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> scale2D(const GenoMatrix<4, 4, float> & matrix, float scaleX, float scaleY) {
+	GenoMatrix<4, 4, float> ret;
+	GenoMatrix4Simd::scale2D(matrix.m, scaleX, scaleY, ret.m);
+	return ret;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> scale2D(const GenoMatrix<4, 4, float> & matrix, const GenoVector<2, float> & scale) {
+	GenoMatrix<4, 4, float> ret;
+	GenoMatrix4Simd::scale2D(matrix.m, scale.v[0], scale.v[1], ret.m);
+	return ret;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> & scale2D(const GenoMatrix<4, 4, float> & matrix, float scale, GenoMatrix<4, 4, float> & target) {
+	GenoMatrix4Simd::scale2D(matrix.m, scale, scale, target.m);
+	return target;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> & scale2D(const GenoMatrix<4, 4, float> & matrix, float scaleX, float scaleY, GenoMatrix<4, 4, float> & target) {
+	GenoMatrix4Simd::scale2D(matrix.m, scaleX, scaleY, target.m);
+	return target;
+}
+
+template <>
+inline GenoMatrix<4, 4, float> & scale2D(const GenoMatrix<4, 4, float> & matrix, const GenoVector<2, float> & scale, GenoMatrix<4, 4, float> & target) {
+	GenoMatrix4Simd::scale2D(matrix.m, scale.v[0], scale.v[1], target.m);
+	return target;
+}
+
+#endif // GENO_SSE
+
+#endif // GNARLY_GENOME_MATRIX4_SIMD
@@ -0,0 +1,243 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "../GenoSimd.h"
+#include "../../thread/GenoParallel.h"
+#include "GenoMatrix4fTransform.h"
+
+static_assert(sizeof(GenoVector2f) == 2 * sizeof(float), "GenoVector2f arrays must be tightly packed floats");
+static_assert(sizeof(GenoVector4f) == 4 * sizeof(float), "GenoVector4f arrays must be tightly packed floats");
+
+namespace {
+#if defined(GENO_AVX)
+	constexpr uint32 LANES = 8;
+	using Lanes = __m256;
+
+	inline Lanes load(const float * source)         { return _mm256_loadu_ps(source);    }
+	inline void  store(float * target, Lanes value) { _mm256_storeu_ps(target, value);   }
+	inline Lanes broadcast(float value)             { return _mm256_set1_ps(value);      }
+	inline Lanes add(Lanes left, Lanes right)       { return _mm256_add_ps(left, right); }
+	inline Lanes multiply(Lanes left, Lanes right)  { return _mm256_mul_ps(left, right); }
+#elif defined(GENO_SSE)
+	constexpr uint32 LANES = 4;
+	using Lanes = __m128;
+
+	inline Lanes load(const float * source)         { return _mm_loadu_ps(source);    }
+	inline void  store(float * target, Lanes value) { _mm_storeu_ps(target, value);   }
+	inline Lanes broadcast(float value)             { return _mm_set1_ps(value);      }
+	inline Lanes add(Lanes left, Lanes right)       { return _mm_add_ps(left, right); }
+	inline Lanes multiply(Lanes left, Lanes right)  { return _mm_mul_ps(left, right); }
+#else
+	constexpr uint32 LANES = 1;
+#endif
+
+	/**
+	 * Arrays shorter than this are never split, below it the pool's overhead outweighs the work
+	**/
+	constexpr uint32 MIN_JOB_SIZE = 16384;
+
+	/**
+	 * Tightly packed (x, y, z, w) vectors
+	**/
+	void transformPacked4(const float * m, const float * source, float * target, uint32 count) {
+		uint32 i = 0;
+#if defined(GENO_SSE)
+		__m128 column0 = _mm_load_ps(m + 0 );
+		__m128 column1 = _mm_load_ps(m + 4 );
+		__m128 column2 = _mm_load_ps(m + 8 );
+		__m128 column3 = _mm_load_ps(m + 12);
+#if defined(GENO_AVX)
+		// Two vectors per iteration, permute broadcasts one component of each vector across its half
+		__m256 columns0 = _mm256_set_m128(column0, column0);
+		__m256 columns1 = _mm256_set_m128(column1, column1);
+		__m256 columns2 = _mm256_set_m128(column2, column2);
+		__m256 columns3 = _mm256_set_m128(column3, column3);
+		for (; i + 2 <= count; i += 2) {
+			__m256 v = _mm256_loadu_ps(source + i * 4);
+			__m256 p = _mm256_mul_ps(columns0, _mm256_permute_ps(v, 0x00));
+			p = _mm256_add_ps(p, _mm256_mul_ps(columns1, _mm256_permute_ps(v, 0x55)));
+			p = _mm256_add_ps(p, _mm256_mul_ps(columns2, _mm256_permute_ps(v, 0xAA)));
+			p = _mm256_add_ps(p, _mm256_mul_ps(columns3, _mm256_permute_ps(v, 0xFF)));
+			_mm256_storeu_ps(target + i * 4, p);
+		}
+#endif
+		for (; i < count; ++i) {
+			__m128 v = _mm_loadu_ps(source + i * 4);
+			__m128 p = _mm_mul_ps(column0, _mm_shuffle_ps(v, v, 0x00));
+			p = _mm_add_ps(p, _mm_mul_ps(column1, _mm_shuffle_ps(v, v, 0x55)));
+			p = _mm_add_ps(p, _mm_mul_ps(column2, _mm_shuffle_ps(v, v, 0xAA)));
+			p = _mm_add_ps(p, _mm_mul_ps(column3, _mm_shuffle_ps(v, v, 0xFF)));
+			_mm_storeu_ps(target + i * 4, p);
+		}
+#else
+		for (; i < count; ++i) {
+			const float * v = source + i * 4;
+			float x = v[0], y = v[1], z = v[2], w = v[3];
+			float * t = target + i * 4;
+			t[0] = m[0] * x + m[4] * y + m[ 8] * z + m[12] * w;
+			t[1] = m[1] * x + m[5] * y + m[ 9] * z + m[13] * w;
+			t[2] = m[2] * x + m[6] * y + m[10] * z + m[14] * w;
+			t[3] = m[3] * x + m[7] * y + m[11] * z + m[15] * w;
+		}
+#endif
+	}
+
+	/**
+	 * Tightly packed (x, y) points with z = 0 and w = 1
+	**/
+	void transformPacked2(const float * m, const float * source, float * target, uint32 count) {
+		uint32 i = 0;
+#if defined(GENO_SSE)
+		// Two points per __m128, columns hold (m0, m1, m0, m1) and (m4, m5, m4, m5)
+		__m128 column0   = _mm_setr_ps(m[0 ], m[1 ], m[0 ], m[1 ]);
+		__m128 column1   = _mm_setr_ps(m[4 ], m[5 ], m[4 ], m[5 ]);
+		__m128 translate = _mm_setr_ps(m[12], m[13], m[12], m[13]);
+#if defined(GENO_AVX)
+		__m256 columns0   = _mm256_set_m128(column0,   column0  );
+		__m256 columns1   = _mm256_set_m128(column1,   column1  );
+		__m256 translates = _mm256_set_m128(translate, translate);
+		for (; i + 4 <= count; i += 4) {
+			__m256 v = _mm256_loadu_ps(source + i * 2);
+			__m256 p = _mm256_add_ps(translates, _mm256_mul_ps(columns0, _mm256_permute_ps(v, 0xA0)));
+			p = _mm256_add_ps(p, _mm256_mul_ps(columns1, _mm256_permute_ps(v, 0xF5)));
+			_mm256_storeu_ps(target + i * 2, p);
+		}
+#endif
+		for (; i + 2 <= count; i += 2) {
+			__m128 v = _mm_loadu_ps(source + i * 2);
+			__m128 p = _mm_add_ps(translate, _mm_mul_ps(column0, _mm_shuffle_ps(v, v, 0xA0)));
+			p = _mm_add_ps(p, _mm_mul_ps(column1, _mm_shuffle_ps(v, v, 0xF5)));
+			_mm_storeu_ps(target + i * 2, p);
+		}
+#endif
+		for (; i < count; ++i) {
+			float x = source[i * 2];
+			float y = source[i * 2 + 1];
+			target[i * 2    ] = m[0] * x + m[4] * y + m[12];
+			target[i * 2 + 1] = m[1] * x + m[5] * y + m[13];
+		}
+	}
+
+	/**
+	 * Any component count and stride, one element per iteration
+	**/
+	void transformStrided(const float * m, const float * source, float * target, uint32 count, uint32 components, uint32 stride) {
+#if defined(GENO_SSE)
+		__m128 column0 = _mm_load_ps(m + 0 );
+		__m128 column1 = _mm_load_ps(m + 4 );
+		__m128 column2 = _mm_load_ps(m + 8 );
+		__m128 column3 = _mm_load_ps(m + 12);
+		for (uint32 i = 0; i < count; ++i) {
+			const float * v = source + i * stride;
+			float * t = target + i * stride;
+			float z = components > 2 ? v[2] : 0;
+			float w = components > 3 ? v[3] : 1;
+			__m128 p = _mm_mul_ps(column0, _mm_set1_ps(v[0]));
+			p = _mm_add_ps(p, _mm_mul_ps(column1, _mm_set1_ps(v[1])));
+			p = _mm_add_ps(p, _mm_mul_ps(column2, _mm_set1_ps(z)));
+			p = _mm_add_ps(p, _mm_mul_ps(column3, _mm_set1_ps(w)));
+			if (components == 4)
+				_mm_storeu_ps(t, p);
+			else {
+				_mm_storel_pi((__m64 *) t, p);
+				if (components == 3)
+					_mm_store_ss(t + 2, _mm_movehl_ps(p, p));
+			}
+		}
+#else
+		for (uint32 i = 0; i < count; ++i) {
+			const float * v = source + i * stride;
+			float * t = target + i * stride;
+			float x = v[0];
+			float y = v[1];
+			float z = components > 2 ? v[2] : 0;
+			float w = components > 3 ? v[3] : 1;
+			for (uint32 j = 0; j < components; ++j)
+				t[j] = m[j] * x + m[4 + j] * y + m[8 + j] * z + m[12 + j] * w;
+		}
+#endif
+	}
+
+	void transformRange(const float * m, const float * source, float * target, uint32 count, uint32 components, uint32 stride) {
+		if (components == 4 && stride == 4)
+			transformPacked4(m, source, target, count);
+		else if (components == 2 && stride == 2)
+			transformPacked2(m, source, target, count);
+		else
+			transformStrided(m, source, target, count, components, stride);
+	}
+
+	/**
+	 * Splits the array into one chunk of at least MIN_JOB_SIZE elements per thread, the calling thread takes part
+	**/
+	void dispatch(const GenoMatrix4f & matrix, const float * source, float * target, uint32 count, uint32 components, uint32 stride, GenoThreadPool * pool) {
+		uint32 grain = MIN_JOB_SIZE;
+		if (pool != 0 && count / (pool->getNumThreads() + 1) > grain)
+			grain = count / (pool->getNumThreads() + 1) + 1;
+		parallelForRange(pool, 0, count, grain, [&](uint32 begin, uint32 end) {
+			transformRange(matrix.m, source + begin * stride, target + begin * stride, end - begin, components, stride);
+		});
+	}
+}
+
+void transform(const GenoMatrix4f & matrix, const GenoVector4f * vectors, GenoVector4f * target, uint32 count, GenoThreadPool * pool) {
+	dispatch(matrix, (const float *) vectors, (float *) target, count, 4, 4, pool);
+}
+
+void transformPoints2D(const GenoMatrix4f & matrix, const GenoVector2f * points, GenoVector2f * target, uint32 count, GenoThreadPool * pool) {
+	dispatch(matrix, (const float *) points, (float *) target, count, 2, 2, pool);
+}
+
+void transformInterleaved(const GenoMatrix4f & matrix, const float * source, float * target, uint32 count, uint32 components, uint32 stride, GenoThreadPool * pool) {
+	dispatch(matrix, source, target, count, components, stride, pool);
+}
+
+void transformPoints2D(const GenoMatrix4f & matrix, const GenoVector2fBatch & points, GenoVector2fBatch & target) {
+	const float * m = matrix.m;
+	uint32 size = points.getSize();
+	target.resize(size);
+	uint32 i = 0;
+#if defined(GENO_SSE)
+	Lanes m0  = broadcast(m[0 ]);
+	Lanes m1  = broadcast(m[1 ]);
+	Lanes m4  = broadcast(m[4 ]);
+	Lanes m5  = broadcast(m[5 ]);
+	Lanes m12 = broadcast(m[12]);
+	Lanes m13 = broadcast(m[13]);
+	for (uint32 end = size - size % LANES; i < end; i += LANES) {
+		Lanes x = load(points.x + i);
+		Lanes y = load(points.y + i);
+		store(target.x + i, add(m12, add(multiply(m0, x), multiply(m4, y))));
+		store(target.y + i, add(m13, add(multiply(m1, x), multiply(m5, y))));
+	}
+#endif
+	for (; i < size; ++i) {
+		float x = points.x[i];
+		float y = points.y[i];
+		target.x[i] = m[0] * x + m[4] * y + m[12];
+		target.y[i] = m[1] * x + m[5] * y + m[13];
+	}
+}
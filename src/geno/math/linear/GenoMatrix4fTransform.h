@@ -0,0 +1,79 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_GENOME_THREAD_POOL_FORWARD
+#define GNARLY_GENOME_THREAD_POOL_FORWARD
+
+class GenoThreadPool;
+
+#endif // GNARLY_GENOME_THREAD_POOL_FORWARD
+
+#ifndef GNARLY_GENOME_MATRIX4F_TRANSFORM
+#define GNARLY_GENOME_MATRIX4F_TRANSFORM
+
+#include "../../GenoInts.h"
+#include "GenoVector2.h"
+#include "GenoVector4.h"
+#include "GenoMatrix4.h"
+#include "GenoVector2fBatch.h"
+
+/**
+ * Array versions of matrix * vector for GenoMatrix4f
+ *
+ * Every function transforms count vectors in one SIMD pass. If pool is not null and the array is large enough
+ * the work is split across the pool and the calling thread with parallelForRange, and the call returns once every
+ * chunk is done.
+ *
+ * target may be the same array as the source but must not partially overlap it.
+**/
+
+/**
+ * target[i] = matrix * vectors[i]
+**/
+void transform(const GenoMatrix4f & matrix, const GenoVector4f * vectors, GenoVector4f * target, uint32 count, GenoThreadPool * pool = 0);
+
+/**
+ * Transforms 2D points, treating each point as (x, y, 0, 1) and keeping the resulting x and y
+**/
+void transformPoints2D(const GenoMatrix4f & matrix, const GenoVector2f * points, GenoVector2f * target, uint32 count, GenoThreadPool * pool = 0);
+
+/**
+ * Transforms points stored in an interleaved float buffer such as a vertex array
+ *
+ * Each element starts components floats in (2, 3 or 4), missing components are taken as z = 0 and w = 1.
+ * Only the first components floats of each target element are written so other vertex attributes are left alone.
+ *
+ * @param stride - The distance in floats between the starts of consecutive elements, in both source and target
+**/
+void transformInterleaved(const GenoMatrix4f & matrix, const float * source, float * target, uint32 count, uint32 components, uint32 stride, GenoThreadPool * pool = 0);
+
+/**
+ * Transforms every point of a batch as (x, y, 0, 1), resizing target to fit
+**/
+void transformPoints2D(const GenoMatrix4f & matrix, const GenoVector2fBatch & points, GenoVector2fBatch & target);
+
+#define GNARLY_GENOME_MATRIX4F_TRANSFORM_FORWARD
+#endif // GNARLY_GENOME_MATRIX4F_TRANSFORM
@@ -30,7 +30,7 @@
 #define GNARLY_GENOME_VECTOR_FORWARD
 
 template <uint32 N, typename T>
-class GenoVector<N, T>;
+class GenoVector;
 
 #endif // GNARLY_GENOME_VECTOR_FORWARD
 
@@ -46,9 +46,35 @@ class GenoMatrix;
 #define GNARLY_GENOME_MATRIXN
 
 #include <ostream>
+#include <type_traits>
 
 #include "GenoVector.h"
+#include "GenoVectorView.h"
 #include "GenoMatrix.h"
+#include "GenoMatrixNSimd.h"
+
+/**
+ * LU decomposition with partial pivoting of an N x N matrix, PA = LU
+ *
+ * Factor once with decomposeLU and reuse it for det, solve and invert
+**/
+template <uint32 N, typename T>
+struct GenoMatrixLU {
+	/**
+	 * Column major like GenoMatrix, L below the diagonal (its unit diagonal is implied) and U on and above it
+	**/
+	T lu[N * N];
+
+	/**
+	 * Row i of LU corresponds to row pivots[i] of the decomposed matrix
+	**/
+	uint32 pivots[N];
+
+	/**
+	 * The sign of the row permutation, 0 if the matrix is singular
+	**/
+	T sign;
+};
 
 template <uint32 N, typename T>
 class GenoMatrix<N, N, T> {
@@ -140,8 +166,36 @@ class GenoMatrix<N, N, T> {
 			return *this = *this * matrix;
 		}
 
-		GenoVector<N, T> operator[](uint32 index) const noexcept {
-			return GenoVector<N, T>(index * N, false);
+		GenoVectorView<N, T> operator[](uint32 index) const noexcept {
+			return m + index * N;
+		}
+
+		GenoMatrix<N, N, T> & transpose() {
+#ifdef GENO_SSE
+			if constexpr (GenoMatrixNSimd::accelerated<N, T>()) {
+				GenoMatrixNSimd::transpose<N>(m, m);
+				return *this;
+			}
+#endif
+			for (uint32 i = 0; i < N; ++i) {
+				for (uint32 j = i + 1; j < N; ++j) {
+					T swap = m[j * N + i];
+					m[j * N + i] = m[i * N + j];
+					m[i * N + j] = swap;
+				}
+			}
+			return *this;
+		}
+
+		/**
+		 * Inverts the matrix through its LU decomposition, the result is not finite if the matrix is singular
+		**/
+		GenoMatrix<N, N, T> & invert() {
+			GenoMatrixLU<N, T> lu;
+			decomposeLU(*this, lu);
+			auto identity = makeIdentity();
+			solve(lu, identity.m, m, N);
+			return *this;
 		}
 
 		GenoMatrix<N, N, T> & setIdentity() {
@@ -160,21 +214,220 @@ class GenoMatrix<N, N, T> {
 };
 
 template <uint32 N, typename T>
-T det(const GenoMatrix<N, N, T> & matrix) {
-	auto ret    = T{ 0 };
-	auto sign   = T{ 1 };
-	GenoMatrix<N - 1, N - 1, T> storage;
+GenoMatrix<N, N, T> operator*(const GenoMatrix<N, N, T> & left, const GenoMatrix<N, N, T> & right) {
+#ifdef GENO_SSE
+	if constexpr (GenoMatrixNSimd::accelerated<N, T>()) {
+		GenoMatrix<N, N, T> product;
+		GenoMatrixNSimd::multiply<N>(left.m, right.m, product.m);
+		return product;
+	}
+#endif
+	auto product = new T[N * N];
+	for (uint32 i = 0; i < N; ++i) {
+		for (uint32 j = 0; j < N; ++j) {
+			product[j * N + i] = 0;
+			for (uint32 k = 0; k < N; ++k)
+				product[j * N + i] += left.m[k * N + i] * right.m[j * N + k];
+		}
+	}
+	return product;
+}
+
+template <uint32 N, typename T>
+GenoVector<N, T> operator*(const GenoMatrix<N, N, T> & left, const GenoVector<N, T> & right) {
+#ifdef GENO_SSE
+	if constexpr (GenoMatrixNSimd::accelerated<N, T>()) {
+		GenoVector<N, T> product;
+		GenoMatrixNSimd::transform<N>(left.m, right.v, product.v);
+		return product;
+	}
+#endif
+	GenoVector<N, T> product;
 	for (uint32 i = 0; i < N; ++i) {
-		auto offset = uint32( -1 );
-		for (uint32 j = 0; j < N * N; ++j)
-			if (j % N != 0 && j / N != i)
-				storage.m[++offset] = matrix.m[j];
-		ret  += sign * matrix.m[i * N] * det(storage);
-		sign *= -1;
+		product.v[i] = 0;
+		for (uint32 j = 0; j < N; ++j)
+			product.v[i] += left.m[j * N + i] * right.v[j];
+	}
+	return product;
+}
+
+template <uint32 N, typename T>
+GenoMatrix<N, N, T> & transpose(const GenoMatrix<N, N, T> & matrix, GenoMatrix<N, N, T> & target) {
+	if (&matrix == &target)
+		return target.transpose();
+#ifdef GENO_SSE
+	if constexpr (GenoMatrixNSimd::accelerated<N, T>()) {
+		GenoMatrixNSimd::transpose<N>(matrix.m, target.m);
+		return target;
+	}
+#endif
+	for (uint32 i = 0; i < N; ++i)
+		for (uint32 j = 0; j < N; ++j)
+			target.m[j * N + i] = matrix.m[i * N + j];
+	return target;
+}
+
+template <uint32 N, typename T>
+GenoMatrix<N, N, T> transpose(const GenoMatrix<N, N, T> & matrix) {
+	GenoMatrix<N, N, T> ret;
+	transpose(matrix, ret);
+	return ret;
+}
+
+/**
+ * Decomposes matrix into target
+ *
+ * @return - False if the matrix is singular, target is then only partially decomposed
+**/
+template <uint32 N, typename T>
+bool decomposeLU(const GenoMatrix<N, N, T> & matrix, GenoMatrixLU<N, T> & target) {
+#ifdef GENO_SSE
+	if constexpr (GenoMatrixNSimd::accelerated<N, T>()) {
+		target.sign = GenoMatrixNSimd::decompose<N>(matrix.m, target.lu, target.pivots);
+		return target.sign != 0;
+	}
+#endif
+	T * a = target.lu;
+	for (uint32 i = 0; i < N * N; ++i)
+		a[i] = matrix.m[i];
+	for (uint32 i = 0; i < N; ++i)
+		target.pivots[i] = i;
+	target.sign = 1;
+	for (uint32 k = 0; k < N; ++k) {
+		T * column = a + k * N;
+		uint32 pivot = k;
+		for (uint32 i = k + 1; i < N; ++i)
+			if ((column[i] < 0 ? -column[i] : column[i]) > (column[pivot] < 0 ? -column[pivot] : column[pivot]))
+				pivot = i;
+		if (column[pivot] == 0) {
+			target.sign = 0;
+			return false;
+		}
+		if (pivot != k) {
+			for (uint32 j = 0; j < N; ++j) {
+				T swap = a[j * N + k];
+				a[j * N + k]     = a[j * N + pivot];
+				a[j * N + pivot] = swap;
+			}
+			uint32 swap = target.pivots[k];
+			target.pivots[k]     = target.pivots[pivot];
+			target.pivots[pivot] = swap;
+			target.sign = -target.sign;
+		}
+		for (uint32 i = k + 1; i < N; ++i)
+			column[i] /= column[k];
+		for (uint32 j = k + 1; j < N; ++j)
+			for (uint32 i = k + 1; i < N; ++i)
+				a[j * N + i] -= column[i] * a[j * N + k];
+	}
+	return true;
+}
+
+template <uint32 N, typename T>
+T det(const GenoMatrixLU<N, T> & lu) {
+	auto ret = lu.sign;
+	for (uint32 i = 0; i < N; ++i)
+		ret *= lu.lu[i * N + i];
+	return ret;
+}
+
+/**
+ * Solves A x = b for count right hand sides at once
+ *
+ * @param columns - count column vectors b of N components each, stored one after another
+ * @param target - Receives the count solutions x in the same layout, may be columns
+**/
+template <uint32 N, typename T>
+void solve(const GenoMatrixLU<N, T> & lu, const T * columns, T * target, uint32 count) {
+#ifdef GENO_SSE
+	if constexpr (GenoMatrixNSimd::accelerated<N, T>()) {
+		GenoMatrixNSimd::substitute<N>(lu.lu, lu.pivots, columns, target, count);
+		return;
 	}
+#endif
+	T x[N];
+	for (uint32 j = 0; j < count; ++j) {
+		for (uint32 i = 0; i < N; ++i)
+			x[i] = columns[j * N + lu.pivots[i]];
+		for (uint32 k = 0; k < N; ++k)
+			for (uint32 i = k + 1; i < N; ++i)
+				x[i] -= lu.lu[k * N + i] * x[k];
+		for (uint32 k = N; k-- > 0;) {
+			x[k] /= lu.lu[k * N + k];
+			for (uint32 i = 0; i < k; ++i)
+				x[i] -= lu.lu[k * N + i] * x[k];
+		}
+		for (uint32 i = 0; i < N; ++i)
+			target[j * N + i] = x[i];
+	}
+}
+
+template <uint32 N, typename T>
+GenoVector<N, T> solve(const GenoMatrixLU<N, T> & lu, const GenoVector<N, T> & vector) {
+	GenoVector<N, T> ret;
+	solve(lu, vector.v, ret.v, 1);
+	return ret;
+}
+
+/**
+ * Solves matrix * x = vector for x, the result is not finite if the matrix is singular
+**/
+template <uint32 N, typename T>
+GenoVector<N, T> solve(const GenoMatrix<N, N, T> & matrix, const GenoVector<N, T> & vector) {
+	GenoMatrixLU<N, T> lu;
+	decomposeLU(matrix, lu);
+	return solve(lu, vector);
+}
+
+template <uint32 N, typename T>
+GenoMatrix<N, N, T> invert(const GenoMatrixLU<N, T> & lu) {
+	auto ret = GenoMatrix<N, N, T>::makeIdentity();
+	solve(lu, ret.m, ret.m, N);
 	return ret;
 }
 
+template <uint32 N, typename T>
+GenoMatrix<N, N, T> invert(const GenoMatrix<N, N, T> & matrix) {
+	GenoMatrixLU<N, T> lu;
+	decomposeLU(matrix, lu);
+	return invert(lu);
+}
+
+template <uint32 N, typename T>
+GenoMatrix<N, N, T> & invert(const GenoMatrix<N, N, T> & matrix, GenoMatrix<N, N, T> & target) {
+	GenoMatrixLU<N, T> lu;
+	decomposeLU(matrix, lu);
+	target.setIdentity();
+	solve(lu, target.m, target.m, N);
+	return target;
+}
+
+/**
+ * Cofactor expansion for integer types and small matrices, LU decomposition for larger floating point ones
+**/
+template <uint32 N, typename T>
+T det(const GenoMatrix<N, N, T> & matrix) {
+	if constexpr (std::is_floating_point<T>::value && N > 3) {
+		GenoMatrixLU<N, T> lu;
+		decomposeLU(matrix, lu);
+		return det(lu);
+	}
+	else {
+		auto ret    = T{ 0 };
+		auto sign   = T{ 1 };
+		GenoMatrix<N - 1, N - 1, T> storage;
+		for (uint32 i = 0; i < N; ++i) {
+			auto offset = uint32( -1 );
+			for (uint32 j = 0; j < N * N; ++j)
+				if (j % N != 0 && j / N != i)
+					storage.m[++offset] = matrix.m[j];
+			ret  += sign * matrix.m[i * N] * det(storage);
+			sign *= -1;
+		}
+		return ret;
+	}
+}
+
 template <typename T>
 T det(const GenoMatrix<2, 2, T> & matrix) {
 	return matrix.m[0] * matrix.m[3] - matrix.m[2] * matrix.m[1];
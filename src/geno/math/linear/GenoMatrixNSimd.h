@@ -0,0 +1,318 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_GENOME_MATRIXN_SIMD
+#define GNARLY_GENOME_MATRIXN_SIMD
+
+#include <cmath>
+#include <type_traits>
+
+#include "../../GenoInts.h"
+#include "../GenoSimd.h"
+
+/**
+ * SSE / AVX kernels behind the float GenoMatrixN operations for N from 2 to 8
+ *
+ * Every kernel copies its input into columns padded with zeros to 4 or 8 floats, so that each column is one or two
+ * registers regardless of N, and copies the result back out. GenoMatrixN.h picks these up from its generic functions
+ * wherever accelerated() says so.
+**/
+
+#ifdef GENO_SSE
+
+namespace GenoMatrixNSimd {
+
+	/**
+	 * Whether GenoMatrixN routes an N x N matrix of T through these kernels
+	 *
+	 * The kernels handle 2 and 3 but the scalar loops are faster there since the whole matrix stays in registers,
+	 * and 4 x 4 matrices go through GenoMatrix4 instead
+	**/
+	template <uint32 N, typename T>
+	constexpr bool accelerated() {
+		return std::is_same<T, float>::value && N >= 5 && N <= 8;
+	}
+
+	/**
+	 * Number of floats each padded column takes
+	**/
+	template <uint32 N>
+	constexpr uint32 stride() {
+		return N <= 4 ? 4 : 8;
+	}
+
+	template <uint32 N>
+	inline void pad(const float * matrix, float * padded, uint32 columns) {
+		constexpr uint32 P = stride<N>();
+		for (uint32 j = 0; j < columns; ++j) {
+			for (uint32 i = 0; i < N; ++i)
+				padded[j * P + i] = matrix[j * N + i];
+			for (uint32 i = N; i < P; ++i)
+				padded[j * P + i] = 0;
+		}
+	}
+
+	template <uint32 N>
+	inline void unpad(const float * padded, float * matrix, uint32 columns) {
+		constexpr uint32 P = stride<N>();
+		for (uint32 j = 0; j < columns; ++j)
+			for (uint32 i = 0; i < N; ++i)
+				matrix[j * N + i] = padded[j * P + i];
+	}
+
+	/**
+	 * target += column * scalar over one padded column
+	**/
+	template <uint32 P>
+	inline void multiplyAdd(float * target, const float * column, float scalar) {
+#ifdef GENO_AVX
+		if (P == 8) {
+			_mm256_store_ps(target, _mm256_add_ps(_mm256_load_ps(target), _mm256_mul_ps(_mm256_load_ps(column), _mm256_set1_ps(scalar))));
+			return;
+		}
+#endif
+		__m128 scale = _mm_set1_ps(scalar);
+		for (uint32 i = 0; i < P; i += 4)
+			_mm_store_ps(target + i, _mm_add_ps(_mm_load_ps(target + i), _mm_mul_ps(_mm_load_ps(column + i), scale)));
+	}
+
+	/**
+	 * product = padded left * count columns of N floats
+	**/
+	template <uint32 N>
+	inline void multiplyColumns(const float * left, const float * right, float * product, uint32 count) {
+		constexpr uint32 P = stride<N>();
+		for (uint32 j = 0; j < count; ++j) {
+			const float * column = right + j * N;
+#ifdef GENO_AVX
+			if (P == 8) {
+				__m256 p = _mm256_mul_ps(_mm256_load_ps(left), _mm256_set1_ps(column[0]));
+				for (uint32 k = 1; k < N; ++k)
+					p = _mm256_add_ps(p, _mm256_mul_ps(_mm256_load_ps(left + k * P), _mm256_set1_ps(column[k])));
+				_mm256_store_ps(product + j * P, p);
+				continue;
+			}
+#endif
+			for (uint32 i = 0; i < P; i += 4) {
+				__m128 p = _mm_mul_ps(_mm_load_ps(left + i), _mm_set1_ps(column[0]));
+				for (uint32 k = 1; k < N; ++k)
+					p = _mm_add_ps(p, _mm_mul_ps(_mm_load_ps(left + k * P + i), _mm_set1_ps(column[k])));
+				_mm_store_ps(product + j * P + i, p);
+			}
+		}
+	}
+
+	template <uint32 N>
+	inline void multiply(const float * left, const float * right, float * product) {
+		constexpr uint32 P = stride<N>();
+		alignas(32) float paddedLeft[N * P];
+		alignas(32) float paddedProduct[N * P];
+		pad<N>(left, paddedLeft, N);
+		multiplyColumns<N>(paddedLeft, right, paddedProduct, N);
+		unpad<N>(paddedProduct, product, N);
+	}
+
+	template <uint32 N>
+	inline void transform(const float * matrix, const float * vector, float * product) {
+		constexpr uint32 P = stride<N>();
+		alignas(32) float paddedMatrix[N * P];
+		alignas(32) float paddedProduct[P];
+		pad<N>(matrix, paddedMatrix, N);
+		multiplyColumns<N>(paddedMatrix, vector, paddedProduct, 1);
+		unpad<N>(paddedProduct, product, 1);
+	}
+
+	/**
+	 * Transposes the padded P x P matrix one 4 x 4 block at a time
+	**/
+	template <uint32 N>
+	inline void transpose(const float * matrix, float * target) {
+		constexpr uint32 P = stride<N>();
+		alignas(16) float padded[P * P];
+		alignas(16) float transposed[P * P];
+		pad<N>(matrix, padded, N);
+		for (uint32 i = N * P; i < P * P; ++i)
+			padded[i] = 0;
+		for (uint32 blockColumn = 0; blockColumn < P; blockColumn += 4) {
+			for (uint32 blockRow = 0; blockRow < P; blockRow += 4) {
+				__m128 column0 = _mm_load_ps(padded + (blockColumn + 0) * P + blockRow);
+				__m128 column1 = _mm_load_ps(padded + (blockColumn + 1) * P + blockRow);
+				__m128 column2 = _mm_load_ps(padded + (blockColumn + 2) * P + blockRow);
+				__m128 column3 = _mm_load_ps(padded + (blockColumn + 3) * P + blockRow);
+				_MM_TRANSPOSE4_PS(column0, column1, column2, column3);
+				_mm_store_ps(transposed + (blockRow + 0) * P + blockColumn, column0);
+				_mm_store_ps(transposed + (blockRow + 1) * P + blockColumn, column1);
+				_mm_store_ps(transposed + (blockRow + 2) * P + blockColumn, column2);
+				_mm_store_ps(transposed + (blockRow + 3) * P + blockColumn, column3);
+			}
+		}
+		unpad<N>(transposed, target, N);
+	}
+
+	/**
+	 * Zeroes every element of a padded row at or before column k, built in registers so no scalar store gets reloaded
+	**/
+	template <uint32 P>
+	inline void maskAfter(const float * row, float * target, uint32 k) {
+		__m128 index = _mm_setr_ps(0, 1, 2, 3);
+		__m128 limit = _mm_set1_ps((float) k);
+		for (uint32 i = 0; i < P; i += 4) {
+			__m128 mask = _mm_cmpgt_ps(_mm_add_ps(index, _mm_set1_ps((float) i)), limit);
+			_mm_store_ps(target + i, _mm_and_ps(_mm_load_ps(row + i), mask));
+		}
+	}
+
+	template <uint32 P>
+	inline void swap(float * left, float * right) {
+		for (uint32 i = 0; i < P; i += 4) {
+			__m128 swap = _mm_load_ps(left + i);
+			_mm_store_ps(left + i, _mm_load_ps(right + i));
+			_mm_store_ps(right + i, swap);
+		}
+	}
+
+	template <uint32 P>
+	inline void scale(float * target, float scalar) {
+		__m128 scale = _mm_set1_ps(scalar);
+		for (uint32 i = 0; i < P; i += 4)
+			_mm_store_ps(target + i, _mm_mul_ps(_mm_load_ps(target + i), scale));
+	}
+
+	/**
+	 * LU decomposition with partial pivoting, see GenoMatrixLU
+	 *
+	 * Works on the transposed matrix so that row swaps and row eliminations are whole padded rows. The multipliers
+	 * of L go to a separate array and are only ever read back as scalars.
+	 *
+	 * @return - The sign of the row permutation, 0 if the matrix is singular
+	**/
+	template <uint32 N>
+	inline float decompose(const float * matrix, float * lu, uint32 * pivots) {
+		constexpr uint32 P = stride<N>();
+		alignas(32) float rows[N * P];
+		alignas(32) float pivotRow[P];
+		float lower[N * N];
+		for (uint32 i = 0; i < N; ++i) {
+			for (uint32 j = 0; j < N; ++j)
+				rows[i * P + j] = matrix[j * N + i];
+			for (uint32 j = N; j < P; ++j)
+				rows[i * P + j] = 0;
+		}
+		for (uint32 i = 0; i < N; ++i)
+			pivots[i] = i;
+		float sign = 1;
+		for (uint32 k = 0; k < N; ++k) {
+			uint32 pivot = k;
+			for (uint32 i = k + 1; i < N; ++i)
+				if (fabsf(rows[i * P + k]) > fabsf(rows[pivot * P + k]))
+					pivot = i;
+			if (rows[pivot * P + k] == 0) {
+				sign = 0;
+				break;
+			}
+			if (pivot != k) {
+				swap<P>(rows + k * P, rows + pivot * P);
+				for (uint32 j = 0; j < k; ++j) {
+					float swap = lower[k * N + j];
+					lower[k * N + j]     = lower[pivot * N + j];
+					lower[pivot * N + j] = swap;
+				}
+				uint32 swap   = pivots[k];
+				pivots[k]     = pivots[pivot];
+				pivots[pivot] = swap;
+				sign = -sign;
+			}
+			float inverse = 1 / rows[k * P + k];
+			maskAfter<P>(rows + k * P, pivotRow, k);
+			for (uint32 i = k + 1; i < N; ++i) {
+				float multiplier = rows[i * P + k] * inverse;
+				lower[i * N + k] = multiplier;
+				multiplyAdd<P>(rows + i * P, pivotRow, -multiplier);
+			}
+		}
+		for (uint32 k = 0; k < N; ++k)
+			for (uint32 i = 0; i < N; ++i)
+				lu[k * N + i] = i > k ? lower[i * N + k] : rows[i * P + k];
+		return sign;
+	}
+
+	/**
+	 * Solves count right hand side columns of N floats against a decomposition from decompose()
+	 *
+	 * Up to WIDTH right hand sides are solved together, stored as padded rows so that every substitution step is one
+	 * multiplyAdd of a whole row. A single right hand side has nothing to share a row with and runs scalar.
+	**/
+	template <uint32 N>
+	inline void substitute(const float * lu, const uint32 * pivots, const float * columns, float * target, uint32 count) {
+#ifdef GENO_AVX
+		constexpr uint32 WIDTH = 8;
+#else
+		constexpr uint32 WIDTH = 4;
+#endif
+		alignas(32) float rows[N * WIDTH];
+		uint32 j = 0;
+		for (; j + 1 < count; j += WIDTH) {
+			uint32 group = count - j < WIDTH ? count - j : WIDTH;
+			for (uint32 i = 0; i < N; ++i) {
+				for (uint32 c = 0; c < group; ++c)
+					rows[i * WIDTH + c] = columns[(j + c) * N + pivots[i]];
+				for (uint32 c = group; c < WIDTH; ++c)
+					rows[i * WIDTH + c] = 0;
+			}
+			for (uint32 k = 0; k < N; ++k)
+				for (uint32 i = k + 1; i < N; ++i)
+					multiplyAdd<WIDTH>(rows + i * WIDTH, rows + k * WIDTH, -lu[k * N + i]);
+			for (uint32 k = N; k-- > 0;) {
+				scale<WIDTH>(rows + k * WIDTH, 1 / lu[k * N + k]);
+				for (uint32 i = 0; i < k; ++i)
+					multiplyAdd<WIDTH>(rows + i * WIDTH, rows + k * WIDTH, -lu[k * N + i]);
+			}
+			for (uint32 c = 0; c < group; ++c)
+				for (uint32 i = 0; i < N; ++i)
+					target[(j + c) * N + i] = rows[i * WIDTH + c];
+		}
+		for (; j < count; ++j) {
+			float x[N];
+			for (uint32 i = 0; i < N; ++i)
+				x[i] = columns[j * N + pivots[i]];
+			for (uint32 k = 0; k < N; ++k)
+				for (uint32 i = k + 1; i < N; ++i)
+					x[i] -= lu[k * N + i] * x[k];
+			for (uint32 k = N; k-- > 0;) {
+				x[k] /= lu[k * N + k];
+				for (uint32 i = 0; i < k; ++i)
+					x[i] -= lu[k * N + i] * x[k];
+			}
+			for (uint32 i = 0; i < N; ++i)
+				target[j * N + i] = x[i];
+		}
+	}
+}
+
+#endif // GENO_SSE
+
+#define GNARLY_GENOME_MATRIXN_SIMD_FORWARD
+#endif // GNARLY_GENOME_MATRIXN_SIMD
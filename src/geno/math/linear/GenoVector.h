@@ -32,6 +32,7 @@
 #include <initializer_list>
 
 #include "../../GenoInts.h"
+#include "../GenoFastMath.h"
 
 template <uint32 N, typename T>
 class GenoVector {
@@ -79,7 +80,6 @@ class GenoVector {
 		
 		GenoVector(const GenoVector<N, T> & vector) :
 			v(new T[N]) {
-			std::cout << "aoeu" << std::endl;
 			for (uint32 i = 0; i < N; ++i)
 				v[i] = vector.v[i];
 		}
@@ -87,19 +87,16 @@ class GenoVector {
 		GenoVector(GenoVector<N, T> && vector) noexcept :
 			owner(vector.owner),
 			v(vector.v) {
-			std::cout << "aoeu" << std::endl;
 			vector.owner = false;
 		}
 
 		GenoVector<N, T> & operator=(const GenoVector<N, T> & vector) {
-			std::cout << "aoeu" << std::endl;
 			for (uint32 i = 0; i < N; ++i)
 				v[i] = vector.v[i];
 			return *this;
 		}
 		
 		GenoVector<N, T> & operator=(GenoVector<N, T> && vector) noexcept {
-			std::cout << "aoeu" << std::endl;
 			if (owner) {
 				clean();
 				owner = vector.owner;
@@ -156,14 +153,14 @@ class GenoVector {
 		}
 		
 		T getLength() const {
-			auto lengthSquared = 0;
+			T lengthSquared = 0;
 			for (uint32 i = 0; i < N; ++i)
 				lengthSquared += v[i] * v[i];
 			return sqrt(lengthSquared);
 		}
 
 		T getLengthSquared() const {
-			auto lengthSquared = 0;
+			T lengthSquared = 0;
 			for (uint32 i = 0; i < N; ++i)
 				lengthSquared += v[i] * v[i];
 			return lengthSquared;
@@ -183,6 +180,24 @@ class GenoVector {
 			return *this;
 		}
 
+		T fastGetLength() const {
+			return fastSqrt(getLengthSquared());
+		}
+
+		GenoVector<N, T> & fastSetLength(T length) {
+			auto scalar = length * fastInverseSqrt(getLengthSquared());
+			for (uint32 i = 0; i < N; ++i)
+				v[i] *= scalar;
+			return *this;
+		}
+
+		GenoVector<N, T> & fastNormalize() {
+			auto scalar = fastInverseSqrt(getLengthSquared());
+			for (uint32 i = 0; i < N; ++i)
+				v[i] *= scalar;
+			return *this;
+		}
+
 		GenoVector<N, T> & negate() {
 			for (uint32 i = 0; i < N; ++i)
 				v[i] = -v[i];
@@ -369,6 +384,40 @@ GenoVector<N, T> & normalize(const GenoVector<N, T> & vector, const GenoVector<N
 	return target;
 }
 
+template <uint32 N, typename T>
+GenoVector<N, T> fastSetLength(const GenoVector<N, T> & vector, T length) {
+	auto scalar = length * fastInverseSqrt(vector.getLengthSquared());
+	auto newV = new T[N];
+	for (uint32 i = 0; i < N; ++i)
+		newV[i] = vector.v[i] * scalar;
+	return newV;
+}
+
+template <uint32 N, typename T>
+GenoVector<N, T> & fastSetLength(const GenoVector<N, T> & vector, T length, const GenoVector<N, T> & target) {
+	auto scalar = length * fastInverseSqrt(vector.getLengthSquared());
+	for (uint32 i = 0; i < N; ++i)
+		target.v[i] = vector.v[i] * scalar;
+	return target;
+}
+
+template <uint32 N, typename T>
+GenoVector<N, T> fastNormalize(const GenoVector<N, T> & vector) {
+	auto scalar = fastInverseSqrt(vector.getLengthSquared());
+	auto newV = new T[N];
+	for (uint32 i = 0; i < N; ++i)
+		newV[i] = vector.v[i] * scalar;
+	return newV;
+}
+
+template <uint32 N, typename T>
+GenoVector<N, T> & fastNormalize(const GenoVector<N, T> & vector, const GenoVector<N, T> & target) {
+	auto scalar = fastInverseSqrt(vector.getLengthSquared());
+	for (uint32 i = 0; i < N; ++i)
+		target.v[i] = vector.v[i] * scalar;
+	return target;
+}
+
 template <uint32 N, typename T>
 GenoVector<N, T> negate(const GenoVector<N, T> & vector) {
 	auto newV = new T[N];
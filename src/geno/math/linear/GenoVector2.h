@@ -56,10 +56,12 @@ class GenoVector<4, T>;
 #include <ostream>
 #include <cmath>
 
+#include "../GenoFastMath.h"
 #include "GenoVector.h"
 #include "GenoVector3.h"
 #include "GenoVector4.h"
 #include "GenoVectorDimensions.h"
+#include "GenoVectorExpression.h"
 
 namespace GenoVectorDimensions {
 	extern GenoVectorDimension<0> x;
@@ -68,115 +70,111 @@ namespace GenoVectorDimensions {
 
 template <typename T>
 class GenoVector<2, T> {
-	private:
-		bool owner = true;
-
-		void clean() {
-			if (owner)
-				delete [] v;
-		}
-
 	public:
-		T * v;
-		
-		GenoVector() :
-			v(new T[2]()) {}
+		T v[2];
 
-		GenoVector(T * v, bool owner = true) noexcept :
-			owner(owner),
-			v(v) {}
+		constexpr GenoVector() :
+			v() {}
 
-		explicit GenoVector(T value) :
-			v(new T[2] { value, value }) {}
+		explicit constexpr GenoVector(T value) :
+			v { value, value } {}
 
-		GenoVector(T x, T y) :
-			v(new T[2] { x, y }) {}
+		constexpr GenoVector(T x, T y) :
+			v { x, y } {}
 
 		template <typename T2>
-		GenoVector(const GenoVector<2, T2> & vector) :
-			v(new T[2] {
+		constexpr GenoVector(const GenoVector<2, T2> & vector) :
+			v {
 				(T) vector.v[0],
 				(T) vector.v[1]
-			}) {}
+			} {}
+
+		template <typename E>
+		constexpr GenoVector(const GenoVectorExpression<2, T, E> & expression) :
+			v {
+				expression.get(0),
+				expression.get(1)
+			} {}
 
-		GenoVector(const GenoVector<2, T> & vector) :
-			v(new T[2] {
+		constexpr GenoVector(const GenoVector<2, T> & vector) :
+			v {
 				vector.v[0],
 				vector.v[1]
-			}) {}
+			} {}
 
-		GenoVector(GenoVector<2, T> && vector) noexcept :
-			owner(vector.owner),
-			v(vector.v) {
-			vector.owner = false;
-		}
-
-		GenoVector<2, T> & operator=(const GenoVector<2, T> & vector) {
+		constexpr GenoVector<2, T> & operator=(const GenoVector<2, T> & vector) {
 			v[0] = vector.v[0];
 			v[1] = vector.v[1];
 			return *this;
 		}
 
-		GenoVector<2, T> & operator=(GenoVector<2, T> && vector) noexcept {
-			if (owner) {
-				clean();
-				owner = vector.owner;
-				v = vector.v;
-				vector.owner = false;
-			}
-			else {
-				v[0] = vector.v[0];
-				v[1] = vector.v[1];
-			}
+		template <typename E>
+		constexpr GenoVector<2, T> & operator=(const GenoVectorExpression<2, T, E> & expression) {
+			v[0] = expression.get(0);
+			v[1] = expression.get(1);
 			return *this;
 		}
 
-		GenoVector<2, T> & operator+=(const GenoVector<2, T> & vector) {
+		template <typename E>
+		constexpr GenoVector<2, T> & operator+=(const GenoVectorExpression<2, T, E> & expression) {
+			v[0] += expression.get(0);
+			v[1] += expression.get(1);
+			return *this;
+		}
+
+		template <typename E>
+		constexpr GenoVector<2, T> & operator-=(const GenoVectorExpression<2, T, E> & expression) {
+			v[0] -= expression.get(0);
+			v[1] -= expression.get(1);
+			return *this;
+		}
+
+		constexpr GenoVector<2, T> & operator+=(const GenoVector<2, T> & vector) {
 			v[0] += vector.v[0];
 			v[1] += vector.v[1];
 			return *this;
 		}
 
-		GenoVector<2, T> & operator-=(const GenoVector<2, T> & vector) {
+		constexpr GenoVector<2, T> & operator-=(const GenoVector<2, T> & vector) {
 			v[0] -= vector.v[0];
 			v[1] -= vector.v[1];
 			return *this;
 		}
 
-		GenoVector<2, T> & operator*=(T scalar) {
+		constexpr GenoVector<2, T> & operator*=(T scalar) {
 			v[0] *= scalar;
 			v[1] *= scalar;
 			return *this;
 		}
 
-		GenoVector<2, T> & operator*=(const GenoVector<2, T> & vector) {
+		constexpr GenoVector<2, T> & operator*=(const GenoVector<2, T> & vector) {
 			v[0] *= vector.v[0];
 			v[1] *= vector.v[1];
 			return *this;
 		}
 
-		GenoVector<2, T> & operator/=(T scalar) {
+		constexpr GenoVector<2, T> & operator/=(T scalar) {
 			v[0] /= scalar;
 			v[1] /= scalar;
 			return *this;
 		}
 
-		GenoVector<2, T> & operator/=(const GenoVector<2, T> & vector) {
+		constexpr GenoVector<2, T> & operator/=(const GenoVector<2, T> & vector) {
 			v[0] /= vector.v[0];
 			v[1] /= vector.v[1];
 			return *this;
 		}
 		
-		T & operator[](uint32 index) noexcept {
+		constexpr T & operator[](uint32 index) noexcept {
 			return v[index];
 		}
 
-		const T & operator[](uint32 index) const noexcept {
+		constexpr const T & operator[](uint32 index) const noexcept {
 			return v[index];
 		}
 
 		template <uint32 N>
-		T & operator[](const GenoVectorDimensions::GenoVectorDimension<N> & dimension) noexcept {
+		constexpr T & operator[](const GenoVectorDimensions::GenoVectorDimension<N> & dimension) noexcept {
 			static_assert(GenoVectorDimensions::GenoVectorDimension<N>::dimension != 2, "GenoVector<2, T> has no dimension z!");
 			static_assert(GenoVectorDimensions::GenoVectorDimension<N>::dimension != 3, "GenoVector<2, T> has no dimension w!");
 			static_assert(GenoVectorDimensions::GenoVectorDimension<N>::dimension  < 4, "GenoVector<2, T> has no dimension beyond y!");
@@ -184,26 +182,26 @@ class GenoVector<2, T> {
 		}
 
 		template <uint32 N>
-		const T & operator[](const GenoVectorDimensions::GenoVectorDimension<N> & dimension) const noexcept {
+		constexpr const T & operator[](const GenoVectorDimensions::GenoVectorDimension<N> & dimension) const noexcept {
 			static_assert(GenoVectorDimensions::GenoVectorDimension<N>::dimension != 2, "GenoVector<2, T> has no dimension z!");
 			static_assert(GenoVectorDimensions::GenoVectorDimension<N>::dimension != 3, "GenoVector<2, T> has no dimension w!");
 			static_assert(GenoVectorDimensions::GenoVectorDimension<N>::dimension  < 4, "GenoVector<2, T> has no dimension beyond y!");
 			return v[GenoVectorDimensions::GenoVectorDimension<N>::dimension];
 		}
 
-		T & x() noexcept {
+		constexpr T & x() noexcept {
 			return v[0];
 		}
 
-		const T & x() const noexcept {
+		constexpr const T & x() const noexcept {
 			return v[0];
 		}
 
-		T & y() noexcept {
+		constexpr T & y() noexcept {
 			return v[1];
 		}
 
-		const T & y() const noexcept {
+		constexpr const T & y() const noexcept {
 			return v[1];
 		}
 
@@ -214,7 +212,7 @@ class GenoVector<2, T> {
 			);
 		}
 
-		T getLengthSquared() const {
+		constexpr T getLengthSquared() const {
 			return (
 				v[0] * v[0] +
 				v[1] * v[1]
@@ -235,6 +233,24 @@ class GenoVector<2, T> {
 			return *this;
 		}
 
+		T fastGetLength() const {
+			return fastSqrt(getLengthSquared());
+		}
+
+		GenoVector<2, T> & fastSetLength(T length) {
+			auto scalar = length * fastInverseSqrt(getLengthSquared());
+			v[0] *= scalar;
+			v[1] *= scalar;
+			return *this;
+		}
+
+		GenoVector<2, T> & fastNormalize() {
+			auto scalar = fastInverseSqrt(getLengthSquared());
+			v[0] *= scalar;
+			v[1] *= scalar;
+			return *this;
+		}
+
 		T getAngle() const {
 			return atan2(v[1], v[0]);
 		}
@@ -255,13 +271,13 @@ class GenoVector<2, T> {
 			return *this;
 		}
 
-		GenoVector<2, T> & negate() {
+		constexpr GenoVector<2, T> & negate() {
 			v[0] = -v[0];
 			v[1] = -v[1];
 			return *this;
 		}
 
-		GenoVector<2, T> & project(const GenoVector<2, T> & projection) {
+		constexpr GenoVector<2, T> & project(const GenoVector<2, T> & projection) {
 			auto scalar = dot(*this, projection) / projection.getLengthSquared();
 			v[0] /= scalar;
 			v[1] /= scalar;
@@ -272,13 +288,13 @@ class GenoVector<2, T> {
 			return *this = getLength() * vector + *this * vector.getLength();
 		}
 
-		GenoVector<2, T> & lerp(const GenoVector<2, T> & end, double interpAmount) {
+		constexpr GenoVector<2, T> & lerp(const GenoVector<2, T> & end, double interpAmount) {
 			v[0] = (T) (v[0] + (end.v[0] - v[0]) * interpAmount);
 			v[1] = (T) (v[1] + (end.v[1] - v[1]) * interpAmount);
 			return *this;
 		}
 		
-		bool isZeroVector() {
+		constexpr bool isZeroVector() {
 			return v[0] == 0 &&
 			       v[1] == 0;
 		}
@@ -294,7 +310,7 @@ class GenoVector<2, T> {
 		}
 
 		GenoVector<2, T> & shear(const GenoVector<2, T> & axis, T shearAngle) {
-			auto unitAxis = normalize(axis); 
+			auto unitAxis = GenoVector<2, T>(axis).normalize();
 			auto scalar  = v[0] * unitAxis.v[1] - v[1] * unitAxis.v[0];
 			     scalar *= tan(shearAngle);
 			v[0] += scalar * unitAxis.v[0];
@@ -313,7 +329,7 @@ class GenoVector<2, T> {
 		}
 
 		GenoVector<2, T> & shear(const GenoVector<2, T> & axis, const GenoVector<2, T> & shear) {
-			auto unitAxis = normalize(axis); 
+			auto unitAxis = GenoVector<2, T>(axis).normalize();
 			auto scalar  = v[0] * unitAxis.v[1] - v[1] * unitAxis.v[0];
 			     scalar *= shear.v[1] / shear.v[0];
 			v[0] += scalar * unitAxis.v[0];
@@ -326,7 +342,7 @@ class GenoVector<2, T> {
 			return *this;
 		}
 
-		GenoVector<2, T> & shearX(const GenoVector<2, T> & shear) {
+		constexpr GenoVector<2, T> & shearX(const GenoVector<2, T> & shear) {
 			v[0] -= v[1] * shear.v[1] / shear.v[0];
 			return *this;
 		}
@@ -336,305 +352,288 @@ class GenoVector<2, T> {
 			return *this;
 		}
 
-		GenoVector<2, T> & shearY(const GenoVector<2, T> & shear) {
+		constexpr GenoVector<2, T> & shearY(const GenoVector<2, T> & shear) {
 			v[1] += v[0] * shear.v[1] / shear.v[0];
 			return *this;
 		}
 
-		GenoVector<2, T> & set(const GenoVector<2, T> & set) {
+		constexpr GenoVector<2, T> & set(const GenoVector<2, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<2, T> & translate(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<2, T> & translate(const GenoVector<2, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			return *this;
 		}
 
-		GenoVector<2, T> & scale(T scale) {
+		constexpr GenoVector<2, T> & scale(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 			return *this;
 		}
 
-		GenoVector<2, T> & scale(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<2, T> & scale(const GenoVector<2, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 			return *this;
 		}
 
-		GenoVector<2, T> & setX(T x) {
+		constexpr GenoVector<2, T> & setX(T x) {
 			v[0] = x;
 			return *this;
 		}
 
-		GenoVector<2, T> & setY(T y) {
+		constexpr GenoVector<2, T> & setY(T y) {
 			v[1] = y;
 			return *this;
 		}
 
-		GenoVector<2, T> & setXY(T x, T y) {
+		constexpr GenoVector<2, T> & setXY(T x, T y) {
 			v[0] = x;
 			v[1] = y;
 			return *this;
 		}
 
-		GenoVector<2, T> & setXY(const GenoVector<2, T> & set) {
+		constexpr GenoVector<2, T> & setXY(const GenoVector<2, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<2, T> & setYX(const GenoVector<2, T> & set) {
+		constexpr GenoVector<2, T> & setYX(const GenoVector<2, T> & set) {
 			v[1] = set.v[0];
 			v[0] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<2, T> & translateX(T translateX) {
+		constexpr GenoVector<2, T> & translateX(T translateX) {
 			v[0] += translateX;
+			return *this;
 		}
 
-		GenoVector<2, T> & translateY(T translateY) {
+		constexpr GenoVector<2, T> & translateY(T translateY) {
 			v[1] += translateY;
+			return *this;
 		}
 
-		GenoVector<2, T> & translateXY(T translateX, T translateY) {
+		constexpr GenoVector<2, T> & translateXY(T translateX, T translateY) {
 			v[0] += translateX;
 			v[1] += translateY;
+			return *this;
 		}
 
-		GenoVector<2, T> & translateXY(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<2, T> & translateXY(const GenoVector<2, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<2, T> & translateYX(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<2, T> & translateYX(const GenoVector<2, T> & translate) {
 			v[1] += translate.v[0];
 			v[0] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<2, T> & scaleX(T scaleX) {
+		constexpr GenoVector<2, T> & scaleX(T scaleX) {
 			v[0] *= scaleX;
+			return *this;
 		}
 
-		GenoVector<2, T> & scaleY(T scaleY) {
+		constexpr GenoVector<2, T> & scaleY(T scaleY) {
 			v[1] *= scaleY;
+			return *this;
 		}
 
-		GenoVector<2, T> & scaleXY(T scale) {
+		constexpr GenoVector<2, T> & scaleXY(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
+			return *this;
 		}
 
-		GenoVector<2, T> & scaleXY(T scaleX, T scaleY) {
+		constexpr GenoVector<2, T> & scaleXY(T scaleX, T scaleY) {
 			v[0] *= scaleX;
 			v[1] *= scaleY;
+			return *this;
 		}
 
-		GenoVector<2, T> & scaleXY(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<2, T> & scaleXY(const GenoVector<2, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<2, T> & scaleYX(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<2, T> & scaleYX(const GenoVector<2, T> & scale) {
 			v[1] *= scale.v[0];
 			v[0] *= scale.v[1];
+			return *this;
 		}
 
-		T getX() const {
+		constexpr T getX() const {
 			return v[0];
 		}
 
-		T getY() const {
+		constexpr T getY() const {
 			return v[1];
 		}
 
-		GenoVector<2, T> getXX() const {
+		constexpr GenoVector<2, T> getXX() const {
 			return { v[0], v[0] };
 		}
 
-		GenoVector<2, T> getXY() const {
+		constexpr GenoVector<2, T> getXY() const {
 			return { v[0], v[1] };
 		}
 
-		GenoVector<2, T> getYX() const {
+		constexpr GenoVector<2, T> getYX() const {
 			return { v[1], v[0] };
 		}
 
-		GenoVector<2, T> getYY() const {
+		constexpr GenoVector<2, T> getYY() const {
 			return { v[1], v[1] };
 		}
 
-		GenoVector<3, T> getXXX() const {
+		constexpr GenoVector<3, T> getXXX() const {
 			return { v[0], v[0], v[0] };
 		}
 
-		GenoVector<3, T> getXXY() const {
+		constexpr GenoVector<3, T> getXXY() const {
 			return { v[0], v[0], v[1] };
 		}
 
-		GenoVector<3, T> getXYX() const {
+		constexpr GenoVector<3, T> getXYX() const {
 			return { v[0], v[1], v[0] };
 		}
 
-		GenoVector<3, T> getXYY() const {
+		constexpr GenoVector<3, T> getXYY() const {
 			return { v[0], v[1], v[1] };
 		}
 
-		GenoVector<3, T> getYXX() const {
+		constexpr GenoVector<3, T> getYXX() const {
 			return { v[1], v[0], v[0] };
 		}
 
-		GenoVector<3, T> getYXY() const {
+		constexpr GenoVector<3, T> getYXY() const {
 			return { v[1], v[0], v[1] };
 		}
 
-		GenoVector<3, T> getYYX() const {
+		constexpr GenoVector<3, T> getYYX() const {
 			return { v[1], v[1], v[0] };
 		}
 
-		GenoVector<3, T> getYYY() const {
+		constexpr GenoVector<3, T> getYYY() const {
 			return { v[1], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getXXXX() const {
+		constexpr GenoVector<4, T> getXXXX() const {
 			return { v[0], v[0], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getXXXY() const {
+		constexpr GenoVector<4, T> getXXXY() const {
 			return { v[0], v[0], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getXXYX() const {
+		constexpr GenoVector<4, T> getXXYX() const {
 			return { v[0], v[0], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getXXYY() const {
+		constexpr GenoVector<4, T> getXXYY() const {
 			return { v[0], v[0], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getXYXX() const {
+		constexpr GenoVector<4, T> getXYXX() const {
 			return { v[0], v[1], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getXYXY() const {
+		constexpr GenoVector<4, T> getXYXY() const {
 			return { v[0], v[1], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getXYYX() const {
+		constexpr GenoVector<4, T> getXYYX() const {
 			return { v[0], v[1], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getXYYY() const {
+		constexpr GenoVector<4, T> getXYYY() const {
 			return { v[0], v[1], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getYXXX() const {
+		constexpr GenoVector<4, T> getYXXX() const {
 			return { v[1], v[0], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getYXXY() const {
+		constexpr GenoVector<4, T> getYXXY() const {
 			return { v[1], v[0], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getYXYX() const {
+		constexpr GenoVector<4, T> getYXYX() const {
 			return { v[1], v[0], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getYXYY() const {
+		constexpr GenoVector<4, T> getYXYY() const {
 			return { v[1], v[0], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getYYXX() const {
+		constexpr GenoVector<4, T> getYYXX() const {
 			return { v[1], v[1], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getYYXY() const {
+		constexpr GenoVector<4, T> getYYXY() const {
 			return { v[1], v[1], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getYYYX() const {
+		constexpr GenoVector<4, T> getYYYX() const {
 			return { v[1], v[1], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getYYYY() const {
+		constexpr GenoVector<4, T> getYYYY() const {
 			return { v[1], v[1], v[1], v[1] };
 		}
-
-		virtual ~GenoVector() noexcept {
-			clean();
-		}
 };
 
 template <typename T>
-GenoVector<2, T> operator-(const GenoVector<2, T> & vector) {
-	return {
-		-vector.v[0],
-		-vector.v[1]
-	};
+constexpr GenoVectorNegate<2, T, GenoVector<2, T>> operator-(const GenoVector<2, T> & vector) {
+	return { vector };
 }
 
 template <typename T>
-GenoVector<2, T> operator+(const GenoVector<2, T> & left, const GenoVector<2, T> & right) {
-	return {
-		left.v[0] + right.v[0],
-		left.v[1] + right.v[1]
-	};
+constexpr GenoVectorPair<2, T, GenoVectorExpressions::Add> operator+(const GenoVector<2, T> & left, const GenoVector<2, T> & right) {
+	return { left, right };
 }
 
 template <typename T>
-GenoVector<2, T> operator-(const GenoVector<2, T> & left, const GenoVector<2, T> & right) {
-   	return {
-		left.v[0] - right.v[0],
-		left.v[1] - right.v[1]
-	};
+constexpr GenoVectorPair<2, T, GenoVectorExpressions::Subtract> operator-(const GenoVector<2, T> & left, const GenoVector<2, T> & right) {
+	return { left, right };
 }
 
 template <typename T>
-GenoVector<2, T> operator*(T left, const GenoVector<2, T> & right) {
-	return {
-		left * right.v[0],
-		left * right.v[1]
-	};
+constexpr GenoVectorPreScaled<2, T> operator*(T left, const GenoVector<2, T> & right) {
+	return { { left }, right };
 }
 
 template <typename T>
-GenoVector<2, T> operator*(const GenoVector<2, T> & left, T right) {
-	return {
-		left.v[0] * right,
-		left.v[1] * right
-	};
+constexpr GenoVectorScaled<2, T, GenoVectorExpressions::Multiply> operator*(const GenoVector<2, T> & left, T right) {
+	return { left, { right } };
 }
 
 template <typename T>
-GenoVector<2, T> operator*(const GenoVector<2, T> & left, const GenoVector<2, T> & right) {
-	return {
-		left.v[0] * right.v[0],
-		left.v[1] * right.v[1]
-	};
+constexpr GenoVectorPair<2, T, GenoVectorExpressions::Multiply> operator*(const GenoVector<2, T> & left, const GenoVector<2, T> & right) {
+	return { left, right };
 }
 
 template <typename T>
-GenoVector<2, T> operator/(const GenoVector<2, T> & left, T right) {
-	return {
-		left.v[0] / right,
-		left.v[1] / right
-	};
+constexpr GenoVectorScaled<2, T, GenoVectorExpressions::Divide> operator/(const GenoVector<2, T> & left, T right) {
+	return { left, { right } };
 }
 
 template <typename T>
-GenoVector<2, T> operator/(const GenoVector<2, T> & left, const GenoVector<2, T> & right) {
-	return {
-		left.v[0] / right.v[0],
-		left.v[1] / right.v[1]
-	};
+constexpr GenoVectorPair<2, T, GenoVectorExpressions::Divide> operator/(const GenoVector<2, T> & left, const GenoVector<2, T> & right) {
+	return { left, right };
 }
 
 template <typename T>
-GenoVector<3, T> operator|(T left, const GenoVector<2, T> & right) {
+constexpr GenoVector<3, T> operator|(T left, const GenoVector<2, T> & right) {
 	return {
 		left,
 		right.v[0],
@@ -643,7 +642,7 @@ GenoVector<3, T> operator|(T left, const GenoVector<2, T> & right) {
 }
 
 template <typename T>
-GenoVector<3, T> operator|(const GenoVector<2, T> & left, T right) {
+constexpr GenoVector<3, T> operator|(const GenoVector<2, T> & left, T right) {
 	return {
 		left.v[0],
 		left.v[1],
@@ -652,7 +651,7 @@ GenoVector<3, T> operator|(const GenoVector<2, T> & left, T right) {
 }
 
 template <typename T>
-GenoVector<4, T> operator|(const GenoVector<2, T> & left, const GenoVector<2, T> & right) {
+constexpr GenoVector<4, T> operator|(const GenoVector<2, T> & left, const GenoVector<2, T> & right) {
 	return {
 		left.v[0],
 		left.v[1],
@@ -695,6 +694,40 @@ GenoVector<2, T> & normalize(const GenoVector<2, T> & vector, GenoVector<2, T> &
 	return target;
 }
 
+template <typename T>
+GenoVector<2, T> fastSetLength(const GenoVector<2, T> & vector, T length) {
+	auto scalar = length * fastInverseSqrt(vector.getLengthSquared());
+	return {
+		vector.v[0] * scalar,
+		vector.v[1] * scalar
+	};
+}
+
+template <typename T>
+GenoVector<2, T> & fastSetLength(const GenoVector<2, T> & vector, T length, GenoVector<2, T> & target) {
+	auto scalar = length * fastInverseSqrt(vector.getLengthSquared());
+	target.v[0] = vector.v[0] * scalar;
+	target.v[1] = vector.v[1] * scalar;
+	return target;
+}
+
+template <typename T>
+GenoVector<2, T> fastNormalize(const GenoVector<2, T> & vector) {
+	auto scalar = fastInverseSqrt(vector.getLengthSquared());
+	return {
+		vector.v[0] * scalar,
+		vector.v[1] * scalar
+	};
+}
+
+template <typename T>
+GenoVector<2, T> & fastNormalize(const GenoVector<2, T> & vector, GenoVector<2, T> & target) {
+	auto scalar = fastInverseSqrt(vector.getLengthSquared());
+	target.v[0] = vector.v[0] * scalar;
+	target.v[1] = vector.v[1] * scalar;
+	return target;
+}
+
 template <typename T>
 GenoVector<2, T> setAngle(const GenoVector<2, T> & vector, T angle) {
 	auto length = vector.getLength();
@@ -732,7 +765,7 @@ GenoVector<2, T> & rotate(const GenoVector<2, T> & vector, T angle, GenoVector<2
 }
 
 template <typename T>
-GenoVector<2, T> negate(const GenoVector<2, T> & vector) {
+constexpr GenoVector<2, T> negate(const GenoVector<2, T> & vector) {
 	return {
 		-vector.v[0],
 		-vector.v[1]
@@ -740,14 +773,14 @@ GenoVector<2, T> negate(const GenoVector<2, T> & vector) {
 }
 
 template <typename T>
-GenoVector<2, T> & negate(const GenoVector<2, T> & vector, GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> & negate(const GenoVector<2, T> & vector, GenoVector<2, T> & target) {
 	target.v[0] = -vector.v[0];
 	target.v[1] = -vector.v[1];
 	return target;
 }
 
 template <typename T>
-T dot(const GenoVector<2, T> & left, const GenoVector<2, T> & right) {
+constexpr T dot(const GenoVector<2, T> & left, const GenoVector<2, T> & right) {
 	return (
 		left.v[0] * right.v[0] +
 		left.v[1] * right.v[1]
@@ -755,7 +788,7 @@ T dot(const GenoVector<2, T> & left, const GenoVector<2, T> & right) {
 }
 
 template <typename T>
-GenoVector<2, T> project(const GenoVector<2, T> & vector, const GenoVector<2, T> & projection) {
+constexpr GenoVector<2, T> project(const GenoVector<2, T> & vector, const GenoVector<2, T> & projection) {
 	auto scalar = dot(vector, projection) / projection.getLengthSquared();
 	return {
 		scalar * projection.v[0],
@@ -764,7 +797,7 @@ GenoVector<2, T> project(const GenoVector<2, T> & vector, const GenoVector<2, T>
 }
 
 template <typename T>
-GenoVector<2, T> & project(const GenoVector<2, T> & vector, const GenoVector<2, T> & projection, GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> & project(const GenoVector<2, T> & vector, const GenoVector<2, T> & projection, GenoVector<2, T> & target) {
 	auto scalar = dot(vector, projection) / projection.getLengthSquared();
 	target.v[0] = scalar * projection.v[0];
 	target.v[1] = scalar * projection.v[1];
@@ -772,7 +805,7 @@ GenoVector<2, T> & project(const GenoVector<2, T> & vector, const GenoVector<2,
 }
 
 template <typename T>
-GenoVector<2, T> lerp(const GenoVector<2, T> & start, const GenoVector<2, T> & end, double interpAmount) {
+constexpr GenoVector<2, T> lerp(const GenoVector<2, T> & start, const GenoVector<2, T> & end, double interpAmount) {
 	return {
 		(T) (start.v[0] + (end.v[0] - start.v[0]) * interpAmount),
 		(T) (start.v[1] + (end.v[1] - start.v[1]) * interpAmount)
@@ -780,7 +813,7 @@ GenoVector<2, T> lerp(const GenoVector<2, T> & start, const GenoVector<2, T> & e
 }
 
 template <typename T>
-GenoVector<2, T> & lerp(const GenoVector<2, T> & start, const GenoVector<2, T> & end, double interpAmount, GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> & lerp(const GenoVector<2, T> & start, const GenoVector<2, T> & end, double interpAmount, GenoVector<2, T> & target) {
 	target.v[0] = (T) (start.v[0] + (end.v[0] - start.v[0]) * interpAmount);
 	target.v[1] = (T) (start.v[1] + (end.v[1] - start.v[1]) * interpAmount);
 	return target;
@@ -840,7 +873,7 @@ GenoVector<2, T> & shearY(const GenoVector<2, T> & vector, T angle, GenoVector<2
 }
 
 template <typename T>
-GenoVector<2, T> translate(const GenoVector<2, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<2, T> translate(const GenoVector<2, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0]	+ translate.v[0],
 		vector.v[1] + translate.v[1]
@@ -848,14 +881,14 @@ GenoVector<2, T> translate(const GenoVector<2, T> & vector, const GenoVector<2,
 }
 
 template <typename T>
-GenoVector<2, T> & translate(const GenoVector<2, T> & vector, const GenoVector<2, T> & translate, GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> & translate(const GenoVector<2, T> & vector, const GenoVector<2, T> & translate, GenoVector<2, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	return target;
 }
 
 template <typename T>
-GenoVector<2, T> scale(const GenoVector<2, T> & vector, T scale) {
+constexpr GenoVector<2, T> scale(const GenoVector<2, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale
@@ -863,14 +896,14 @@ GenoVector<2, T> scale(const GenoVector<2, T> & vector, T scale) {
 }
 
 template <typename T>
-GenoVector<2, T> & scale(const GenoVector<2, T> & vector, T scale, GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> & scale(const GenoVector<2, T> & vector, T scale, GenoVector<2, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	return target;
 }
 
 template <typename T>
-GenoVector<2, T> scale(const GenoVector<2, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<2, T> scale(const GenoVector<2, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1]
@@ -878,14 +911,14 @@ GenoVector<2, T> scale(const GenoVector<2, T> & vector, const GenoVector<2, T> &
 }
 
 template <typename T>
-GenoVector<2, T> & scale(const GenoVector<2, T> & vector, const GenoVector<2, T> & scale, GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> & scale(const GenoVector<2, T> & vector, const GenoVector<2, T> & scale, GenoVector<2, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	return target;
 }
 
 template<typename T>
-GenoVector<2, T> setX(const GenoVector<2, T> & vector, T x) {
+constexpr GenoVector<2, T> setX(const GenoVector<2, T> & vector, T x) {
 	return {
 		x,
 		vector.v[1]
@@ -893,7 +926,7 @@ GenoVector<2, T> setX(const GenoVector<2, T> & vector, T x) {
 }
 
 template<typename T>
-GenoVector<2, T> setY(const GenoVector<2, T> & vector, T y) {
+constexpr GenoVector<2, T> setY(const GenoVector<2, T> & vector, T y) {
 	return {
 		vector.v[0],
 		y
@@ -901,21 +934,21 @@ GenoVector<2, T> setY(const GenoVector<2, T> & vector, T y) {
 }
 
 template<typename T>
-GenoVector<2, T> setX(const GenoVector<2, T> & vector, T x, GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> setX(const GenoVector<2, T> & vector, T x, GenoVector<2, T> & target) {
 	target.v[0] = x;
 	target.v[1] = vector.v[1];
 	return target;
 }
 
 template<typename T>
-GenoVector<2, T> setY(const GenoVector<2, T> & vector, T y, GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> setY(const GenoVector<2, T> & vector, T y, GenoVector<2, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = y;
 	return target;
 }
 
 template<typename T>
-GenoVector<2, T> translateX(const GenoVector<2, T> & vector, T translateX) {
+constexpr GenoVector<2, T> translateX(const GenoVector<2, T> & vector, T translateX) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1]
@@ -923,7 +956,7 @@ GenoVector<2, T> translateX(const GenoVector<2, T> & vector, T translateX) {
 }
 
 template<typename T>
-GenoVector<2, T> translateY(const GenoVector<2, T> & vector, T translateY) {
+constexpr GenoVector<2, T> translateY(const GenoVector<2, T> & vector, T translateY) {
 	return {
 		vector.v[0],
 		vector.v[1] + translateY
@@ -931,7 +964,7 @@ GenoVector<2, T> translateY(const GenoVector<2, T> & vector, T translateY) {
 }
 
 template<typename T>
-GenoVector<2, T> translateXY(const GenoVector<2, T> & vector, T translateX, T translateY) {
+constexpr GenoVector<2, T> translateXY(const GenoVector<2, T> & vector, T translateX, T translateY) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1] + translateY
@@ -939,7 +972,7 @@ GenoVector<2, T> translateXY(const GenoVector<2, T> & vector, T translateX, T tr
 }
 
 template<typename T>
-GenoVector<2, T> translateXY(const GenoVector<2, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<2, T> translateXY(const GenoVector<2, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[1]
@@ -947,7 +980,7 @@ GenoVector<2, T> translateXY(const GenoVector<2, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<2, T> translateYX(const GenoVector<2, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<2, T> translateYX(const GenoVector<2, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[0]
@@ -955,42 +988,42 @@ GenoVector<2, T> translateYX(const GenoVector<2, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<2, T> translateX(const GenoVector<2, T> & vector, T translateX, GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> translateX(const GenoVector<2, T> & vector, T translateX, GenoVector<2, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1];
 	return target;
 }
 
 template<typename T>
-GenoVector<2, T> translateY(const GenoVector<2, T> & vector, T translateY, GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> translateY(const GenoVector<2, T> & vector, T translateY, GenoVector<2, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translateY;
 	return target;
 }
 
 template<typename T>
-GenoVector<2, T> translateXY(const GenoVector<2, T> & vector, T translateX, T translateY, GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> translateXY(const GenoVector<2, T> & vector, T translateX, T translateY, GenoVector<2, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1] + translateY;
 	return target;
 }
 
 template<typename T>
-GenoVector<2, T> translateXY(const GenoVector<2, T> & vector, const GenoVector<2, T> & translate, GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> translateXY(const GenoVector<2, T> & vector, const GenoVector<2, T> & translate, GenoVector<2, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	return target;
 }
 
 template<typename T>
-GenoVector<2, T> translateYX(const GenoVector<2, T> & vector, const GenoVector<2, T> & translate, GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> translateYX(const GenoVector<2, T> & vector, const GenoVector<2, T> & translate, GenoVector<2, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[0];
 	return target;
 }
 
 template<typename T>
-GenoVector<2, T> scaleX(const GenoVector<2, T> & vector, T scaleX) {
+constexpr GenoVector<2, T> scaleX(const GenoVector<2, T> & vector, T scaleX) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1]
@@ -998,7 +1031,7 @@ GenoVector<2, T> scaleX(const GenoVector<2, T> & vector, T scaleX) {
 }
 
 template<typename T>
-GenoVector<2, T> scaleY(const GenoVector<2, T> & vector, T scaleY) {
+constexpr GenoVector<2, T> scaleY(const GenoVector<2, T> & vector, T scaleY) {
 	return {
 		vector.v[0],
 		vector.v[1] * scaleY
@@ -1006,7 +1039,7 @@ GenoVector<2, T> scaleY(const GenoVector<2, T> & vector, T scaleY) {
 }
 
 template<typename T>
-GenoVector<2, T> scaleXY(const GenoVector<2, T> & vector, T scale) {
+constexpr GenoVector<2, T> scaleXY(const GenoVector<2, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale
@@ -1014,7 +1047,7 @@ GenoVector<2, T> scaleXY(const GenoVector<2, T> & vector, T scale) {
 }
 
 template<typename T>
-GenoVector<2, T> scaleXY(const GenoVector<2, T> & vector, T scaleX, T scaleY) {
+constexpr GenoVector<2, T> scaleXY(const GenoVector<2, T> & vector, T scaleX, T scaleY) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1] * scaleY
@@ -1022,7 +1055,7 @@ GenoVector<2, T> scaleXY(const GenoVector<2, T> & vector, T scaleX, T scaleY) {
 }
 
 template<typename T>
-GenoVector<2, T> scaleXY(const GenoVector<2, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<2, T> scaleXY(const GenoVector<2, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1]
@@ -1030,7 +1063,7 @@ GenoVector<2, T> scaleXY(const GenoVector<2, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<2, T> scaleYX(const GenoVector<2, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<2, T> scaleYX(const GenoVector<2, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[0]
@@ -1038,42 +1071,42 @@ GenoVector<2, T> scaleYX(const GenoVector<2, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<2, T> scaleX(const GenoVector<2, T> & vector, T scaleX, const GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> scaleX(const GenoVector<2, T> & vector, T scaleX, const GenoVector<2, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1];
 	return target;
 }
 
 template<typename T>
-GenoVector<2, T> scaleY(const GenoVector<2, T> & vector, T scaleY, const GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> scaleY(const GenoVector<2, T> & vector, T scaleY, const GenoVector<2, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scaleY;
 	return target;
 }
 
 template<typename T>
-GenoVector<2, T> scaleXY(const GenoVector<2, T> & vector, T scale, GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> scaleXY(const GenoVector<2, T> & vector, T scale, GenoVector<2, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	return target;
 }
 
 template<typename T>
-GenoVector<2, T> scaleXY(const GenoVector<2, T> & vector, T scaleX, T scaleY, const GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> scaleXY(const GenoVector<2, T> & vector, T scaleX, T scaleY, const GenoVector<2, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1] * scaleY;
 	return target;
 }
 
 template<typename T>
-GenoVector<2, T> scaleXY(const GenoVector<2, T> & vector, const GenoVector<2, T> & scale, GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> scaleXY(const GenoVector<2, T> & vector, const GenoVector<2, T> & scale, GenoVector<2, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	return target;
 }
 
 template<typename T>
-GenoVector<2, T> scaleYX(const GenoVector<2, T> & vector, const GenoVector<2, T> & scale, GenoVector<2, T> & target) {
+constexpr GenoVector<2, T> scaleYX(const GenoVector<2, T> & vector, const GenoVector<2, T> & scale, GenoVector<2, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[0];
 	return target;
@@ -1097,5 +1130,12 @@ using GenoVector2ul = GenoVector2<uint64>;
 using GenoVector2f  = GenoVector2<float >;
 using GenoVector2d  = GenoVector2<double>;
 
+/** Instantiated once in GenoMathInstantiations.cpp, which defines GENO_MATH_INSTANTIATIONS to skip these **/
+#ifndef GENO_MATH_INSTANTIATIONS
+	extern template class GenoVector<2, float >;
+	extern template class GenoVector<2, double>;
+	extern template class GenoVector<2,  int32>;
+#endif // GENO_MATH_INSTANTIATIONS
+
 #define GNARLY_GENOME_VECTOR2_FORWARD
 #endif // GNARLY_GENOME_VECTOR2
\ No newline at end of file
@@ -0,0 +1,417 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+
+#include "../GenoSimd.h"
+#include "GenoVector2fBatch.h"
+
+namespace {
+#if defined(GENO_AVX)
+	constexpr uint32 LANES = 8;
+	using Lanes = __m256;
+
+	inline Lanes load(const float * source)           { return _mm256_loadu_ps(source);         }
+	inline void  store(float * target, Lanes value)   { _mm256_storeu_ps(target, value);        }
+	inline Lanes broadcast(float value)               { return _mm256_set1_ps(value);           }
+	inline Lanes add(Lanes left, Lanes right)         { return _mm256_add_ps(left, right);      }
+	inline Lanes multiply(Lanes left, Lanes right)    { return _mm256_mul_ps(left, right);      }
+	inline Lanes divide(Lanes left, Lanes right)      { return _mm256_div_ps(left, right);      }
+	inline Lanes sqrt(Lanes value)                    { return _mm256_sqrt_ps(value);           }
+	inline Lanes min(Lanes left, Lanes right)         { return _mm256_min_ps(left, right);      }
+	inline Lanes max(Lanes left, Lanes right)         { return _mm256_max_ps(left, right);      }
+	inline Lanes bitAnd(Lanes left, Lanes right)      { return _mm256_and_ps(left, right);      }
+	inline Lanes lessThan(Lanes left, Lanes right)    { return _mm256_cmp_ps(left, right, _CMP_LT_OQ); }
+	inline Lanes greaterThan(Lanes left, Lanes right) { return _mm256_cmp_ps(left, right, _CMP_GT_OQ); }
+	inline int32 mask(Lanes value)                    { return _mm256_movemask_ps(value);       }
+#elif defined(GENO_SSE)
+	constexpr uint32 LANES = 4;
+	using Lanes = __m128;
+
+	inline Lanes load(const float * source)           { return _mm_loadu_ps(source);    }
+	inline void  store(float * target, Lanes value)   { _mm_storeu_ps(target, value);   }
+	inline Lanes broadcast(float value)               { return _mm_set1_ps(value);      }
+	inline Lanes add(Lanes left, Lanes right)         { return _mm_add_ps(left, right); }
+	inline Lanes multiply(Lanes left, Lanes right)    { return _mm_mul_ps(left, right); }
+	inline Lanes divide(Lanes left, Lanes right)      { return _mm_div_ps(left, right); }
+	inline Lanes sqrt(Lanes value)                    { return _mm_sqrt_ps(value);      }
+	inline Lanes min(Lanes left, Lanes right)         { return _mm_min_ps(left, right); }
+	inline Lanes max(Lanes left, Lanes right)         { return _mm_max_ps(left, right); }
+	inline Lanes bitAnd(Lanes left, Lanes right)      { return _mm_and_ps(left, right); }
+	inline Lanes lessThan(Lanes left, Lanes right)    { return _mm_cmplt_ps(left, right); }
+	inline Lanes greaterThan(Lanes left, Lanes right) { return _mm_cmpgt_ps(left, right); }
+	inline int32 mask(Lanes value)                    { return _mm_movemask_ps(value);  }
+#else
+	constexpr uint32 LANES = 1;
+#endif
+
+#if defined(GENO_SSE)
+	/**
+	 * Bitmask of the lanes starting at index whose box overlaps the query box
+	**/
+	inline int32 overlapMask(const GenoVector2fBatch & positions, const GenoVector2fBatch & dimensions, uint32 index,
+	                         Lanes positionX, Lanes positionY, Lanes farX, Lanes farY) {
+		Lanes boxX = load(positions.x + index);
+		Lanes boxY = load(positions.y + index);
+		Lanes overlap = bitAnd(
+			bitAnd(lessThan(positionX, add(boxX, load(dimensions.x + index))), greaterThan(farX, boxX)),
+			bitAnd(lessThan(positionY, add(boxY, load(dimensions.y + index))), greaterThan(farY, boxY))
+		);
+		return mask(overlap);
+	}
+#endif
+
+	inline bool overlap(const GenoVector2fBatch & positions, const GenoVector2fBatch & dimensions, uint32 index,
+	                    const GenoVector2f & position, const GenoVector2f & dimension) {
+		return position.v[0] < positions.x[index] + dimensions.x[index] && position.v[0] + dimension.v[0] > positions.x[index]
+		    && position.v[1] < positions.y[index] + dimensions.y[index] && position.v[1] + dimension.v[1] > positions.y[index];
+	}
+
+	/**
+	 * Number of leading elements the vector loops handle, the rest go through the scalar tail
+	**/
+	inline uint32 vectorEnd(uint32 size) {
+		return size - size % LANES;
+	}
+}
+
+GenoVector2fBatch::GenoVector2fBatch() :
+	size(0),
+	capacity(0),
+	x(0),
+	y(0) {}
+
+GenoVector2fBatch::GenoVector2fBatch(uint32 size) :
+	size(size),
+	capacity(size),
+	x(new float[size]()),
+	y(new float[size]()) {}
+
+GenoVector2fBatch::GenoVector2fBatch(const GenoVector2f * vectors, uint32 size) :
+	size(size),
+	capacity(size),
+	x(new float[size]),
+	y(new float[size]) {
+	for (uint32 i = 0; i < size; ++i) {
+		x[i] = vectors[i].v[0];
+		y[i] = vectors[i].v[1];
+	}
+}
+
+GenoVector2fBatch::GenoVector2fBatch(const GenoVector2fBatch & batch) :
+	size(batch.size),
+	capacity(batch.size),
+	x(new float[batch.size]),
+	y(new float[batch.size]) {
+	memcpy(x, batch.x, size * sizeof(float));
+	memcpy(y, batch.y, size * sizeof(float));
+}
+
+GenoVector2fBatch::GenoVector2fBatch(GenoVector2fBatch && batch) noexcept :
+	size(batch.size),
+	capacity(batch.capacity),
+	x(batch.x),
+	y(batch.y) {
+	batch.size     = 0;
+	batch.capacity = 0;
+	batch.x        = 0;
+	batch.y        = 0;
+}
+
+GenoVector2fBatch & GenoVector2fBatch::operator=(const GenoVector2fBatch & batch) {
+	if (this != &batch) {
+		resize(batch.size);
+		memcpy(x, batch.x, size * sizeof(float));
+		memcpy(y, batch.y, size * sizeof(float));
+	}
+	return *this;
+}
+
+GenoVector2fBatch & GenoVector2fBatch::operator=(GenoVector2fBatch && batch) noexcept {
+	if (this != &batch) {
+		delete [] x;
+		delete [] y;
+		size     = batch.size;
+		capacity = batch.capacity;
+		x        = batch.x;
+		y        = batch.y;
+		batch.size     = 0;
+		batch.capacity = 0;
+		batch.x        = 0;
+		batch.y        = 0;
+	}
+	return *this;
+}
+
+GenoVector2fBatch & GenoVector2fBatch::operator+=(const GenoVector2fBatch & batch) {
+	add(*this, batch, *this);
+	return *this;
+}
+
+GenoVector2fBatch & GenoVector2fBatch::operator+=(const GenoVector2f & vector) {
+	uint32 i = 0;
+#if defined(GENO_SSE)
+	Lanes addX = broadcast(vector.v[0]);
+	Lanes addY = broadcast(vector.v[1]);
+	for (uint32 end = vectorEnd(size); i < end; i += LANES) {
+		store(x + i, add(load(x + i), addX));
+		store(y + i, add(load(y + i), addY));
+	}
+#endif
+	for (; i < size; ++i) {
+		x[i] += vector.v[0];
+		y[i] += vector.v[1];
+	}
+	return *this;
+}
+
+GenoVector2fBatch & GenoVector2fBatch::operator*=(float scalar) {
+	uint32 i = 0;
+#if defined(GENO_SSE)
+	Lanes scale = broadcast(scalar);
+	for (uint32 end = vectorEnd(size); i < end; i += LANES) {
+		store(x + i, multiply(load(x + i), scale));
+		store(y + i, multiply(load(y + i), scale));
+	}
+#endif
+	for (; i < size; ++i) {
+		x[i] *= scalar;
+		y[i] *= scalar;
+	}
+	return *this;
+}
+
+uint32 GenoVector2fBatch::getSize() const noexcept {
+	return size;
+}
+
+void GenoVector2fBatch::reserve(uint32 capacity) {
+	if (capacity > this->capacity) {
+		float * newX = new float[capacity];
+		float * newY = new float[capacity];
+		memcpy(newX, x, size * sizeof(float));
+		memcpy(newY, y, size * sizeof(float));
+		delete [] x;
+		delete [] y;
+		x = newX;
+		y = newY;
+		this->capacity = capacity;
+	}
+}
+
+void GenoVector2fBatch::resize(uint32 size) {
+	reserve(size);
+	for (uint32 i = this->size; i < size; ++i) {
+		x[i] = 0;
+		y[i] = 0;
+	}
+	this->size = size;
+}
+
+void GenoVector2fBatch::clear() noexcept {
+	size = 0;
+}
+
+void GenoVector2fBatch::push(const GenoVector2f & vector) {
+	if (size == capacity)
+		reserve(capacity == 0 ? LANES * 2 : capacity * 2);
+	x[size] = vector.v[0];
+	y[size] = vector.v[1];
+	++size;
+}
+
+void GenoVector2fBatch::erase(uint32 index) {
+	--size;
+	memmove(x + index, x + index + 1, (size - index) * sizeof(float));
+	memmove(y + index, y + index + 1, (size - index) * sizeof(float));
+}
+
+GenoVector2f GenoVector2fBatch::get(uint32 index) const noexcept {
+	return { x[index], y[index] };
+}
+
+void GenoVector2fBatch::set(uint32 index, const GenoVector2f & vector) noexcept {
+	x[index] = vector.v[0];
+	y[index] = vector.v[1];
+}
+
+void GenoVector2fBatch::get(GenoVector2f * target) const noexcept {
+	for (uint32 i = 0; i < size; ++i) {
+		target[i].v[0] = x[i];
+		target[i].v[1] = y[i];
+	}
+}
+
+GenoVector2fBatch::~GenoVector2fBatch() {
+	delete [] x;
+	delete [] y;
+}
+
+void add(const GenoVector2fBatch & left, const GenoVector2fBatch & right, GenoVector2fBatch & target) {
+	uint32 size = left.getSize();
+	target.resize(size);
+	uint32 i = 0;
+#if defined(GENO_SSE)
+	for (uint32 end = vectorEnd(size); i < end; i += LANES) {
+		store(target.x + i, add(load(left.x + i), load(right.x + i)));
+		store(target.y + i, add(load(left.y + i), load(right.y + i)));
+	}
+#endif
+	for (; i < size; ++i) {
+		target.x[i] = left.x[i] + right.x[i];
+		target.y[i] = left.y[i] + right.y[i];
+	}
+}
+
+void multiplyAdd(const GenoVector2fBatch & scaled, float scalar, const GenoVector2fBatch & offset, GenoVector2fBatch & target) {
+	uint32 size = scaled.getSize();
+	target.resize(size);
+	uint32 i = 0;
+#if defined(GENO_SSE)
+	Lanes scale = broadcast(scalar);
+	for (uint32 end = vectorEnd(size); i < end; i += LANES) {
+		store(target.x + i, add(load(offset.x + i), multiply(load(scaled.x + i), scale)));
+		store(target.y + i, add(load(offset.y + i), multiply(load(scaled.y + i), scale)));
+	}
+#endif
+	for (; i < size; ++i) {
+		target.x[i] = offset.x[i] + scaled.x[i] * scalar;
+		target.y[i] = offset.y[i] + scaled.y[i] * scalar;
+	}
+}
+
+void length(const GenoVector2fBatch & batch, float * target) {
+	uint32 size = batch.getSize();
+	uint32 i = 0;
+#if defined(GENO_SSE)
+	for (uint32 end = vectorEnd(size); i < end; i += LANES) {
+		Lanes x = load(batch.x + i);
+		Lanes y = load(batch.y + i);
+		store(target + i, sqrt(add(multiply(x, x), multiply(y, y))));
+	}
+#endif
+	for (; i < size; ++i)
+		target[i] = std::sqrt(batch.x[i] * batch.x[i] + batch.y[i] * batch.y[i]);
+}
+
+void normalize(const GenoVector2fBatch & batch, GenoVector2fBatch & target) {
+	uint32 size = batch.getSize();
+	target.resize(size);
+	uint32 i = 0;
+#if defined(GENO_SSE)
+	Lanes zero = broadcast(0);
+	for (uint32 end = vectorEnd(size); i < end; i += LANES) {
+		Lanes x = load(batch.x + i);
+		Lanes y = load(batch.y + i);
+		Lanes lengthSquared = add(multiply(x, x), multiply(y, y));
+		Lanes nonZero = greaterThan(lengthSquared, zero);
+		Lanes length  = sqrt(lengthSquared);
+		store(target.x + i, bitAnd(divide(x, length), nonZero));
+		store(target.y + i, bitAnd(divide(y, length), nonZero));
+	}
+#endif
+	for (; i < size; ++i) {
+		float lengthSquared = batch.x[i] * batch.x[i] + batch.y[i] * batch.y[i];
+		if (lengthSquared > 0) {
+			float length = std::sqrt(lengthSquared);
+			target.x[i] = batch.x[i] / length;
+			target.y[i] = batch.y[i] / length;
+		}
+		else {
+			target.x[i] = 0;
+			target.y[i] = 0;
+		}
+	}
+}
+
+void clamp(const GenoVector2fBatch & batch, const GenoVector2f & minimum, const GenoVector2f & maximum, GenoVector2fBatch & target) {
+	uint32 size = batch.getSize();
+	target.resize(size);
+	uint32 i = 0;
+#if defined(GENO_SSE)
+	Lanes minX = broadcast(minimum.v[0]);
+	Lanes minY = broadcast(minimum.v[1]);
+	Lanes maxX = broadcast(maximum.v[0]);
+	Lanes maxY = broadcast(maximum.v[1]);
+	for (uint32 end = vectorEnd(size); i < end; i += LANES) {
+		store(target.x + i, min(max(load(batch.x + i), minX), maxX));
+		store(target.y + i, min(max(load(batch.y + i), minY), maxY));
+	}
+#endif
+	for (; i < size; ++i) {
+		target.x[i] = fminf(fmaxf(batch.x[i], minimum.v[0]), maximum.v[0]);
+		target.y[i] = fminf(fmaxf(batch.y[i], minimum.v[1]), maximum.v[1]);
+	}
+}
+
+uint32 overlaps(const GenoVector2fBatch & positions, const GenoVector2fBatch & dimensions, const GenoVector2f & position, const GenoVector2f & dimension, bool * target) {
+	uint32 size = positions.getSize();
+	uint32 count = 0;
+	uint32 i = 0;
+#if defined(GENO_SSE)
+	Lanes positionX = broadcast(position.v[0]);
+	Lanes positionY = broadcast(position.v[1]);
+	Lanes farX      = broadcast(position.v[0] + dimension.v[0]);
+	Lanes farY      = broadcast(position.v[1] + dimension.v[1]);
+	for (uint32 end = vectorEnd(size); i < end; i += LANES) {
+		int32 hits = overlapMask(positions, dimensions, i, positionX, positionY, farX, farY);
+		for (uint32 j = 0; j < LANES; ++j) {
+			target[i + j] = (hits >> j) & 1;
+			count += target[i + j];
+		}
+	}
+#endif
+	for (; i < size; ++i) {
+		target[i] = overlap(positions, dimensions, i, position, dimension);
+		count += target[i];
+	}
+	return count;
+}
+
+uint32 findOverlap(const GenoVector2fBatch & positions, const GenoVector2fBatch & dimensions, uint32 begin, const GenoVector2f & position, const GenoVector2f & dimension) {
+	uint32 size = positions.getSize();
+	uint32 i = begin;
+#if defined(GENO_SSE)
+	Lanes positionX = broadcast(position.v[0]);
+	Lanes positionY = broadcast(position.v[1]);
+	Lanes farX      = broadcast(position.v[0] + dimension.v[0]);
+	Lanes farY      = broadcast(position.v[1] + dimension.v[1]);
+	for (; i + LANES <= size; i += LANES) {
+		int32 hits = overlapMask(positions, dimensions, i, positionX, positionY, farX, farY);
+		if (hits != 0) {
+			uint32 lane = 0;
+			while (((hits >> lane) & 1) == 0)
+				++lane;
+			return i + lane;
+		}
+	}
+#endif
+	for (; i < size; ++i)
+		if (overlap(positions, dimensions, i, position, dimension))
+			return i;
+	return size;
+}
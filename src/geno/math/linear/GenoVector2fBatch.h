@@ -0,0 +1,122 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_GENOME_VECTOR2F_BATCH
+#define GNARLY_GENOME_VECTOR2F_BATCH
+
+#include "../../GenoInts.h"
+#include "GenoVector2.h"
+
+/**
+ * Structure-of-arrays storage for many 2D float vectors. The x and y components live in
+ * two separate arrays so the kernels below can process 4 (SSE) or 8 (AVX) vectors per instruction.
+ *
+ * Kernels resize their target to the size of their input and may write in place.
+**/
+class GenoVector2fBatch {
+	private:
+		uint32 size;
+		uint32 capacity;
+
+	public:
+		float * x;
+		float * y;
+
+		GenoVector2fBatch();
+		explicit GenoVector2fBatch(uint32 size);
+		GenoVector2fBatch(const GenoVector2f * vectors, uint32 size);
+		GenoVector2fBatch(const GenoVector2fBatch & batch);
+		GenoVector2fBatch(GenoVector2fBatch && batch) noexcept;
+
+		GenoVector2fBatch & operator=(const GenoVector2fBatch & batch);
+		GenoVector2fBatch & operator=(GenoVector2fBatch && batch) noexcept;
+
+		GenoVector2fBatch & operator+=(const GenoVector2fBatch & batch);
+		GenoVector2fBatch & operator+=(const GenoVector2f & vector);
+		GenoVector2fBatch & operator*=(float scalar);
+
+		uint32 getSize() const noexcept;
+		void reserve(uint32 capacity);
+		void resize(uint32 size);
+		void clear() noexcept;
+
+		void push(const GenoVector2f & vector);
+		void erase(uint32 index);
+
+		GenoVector2f get(uint32 index) const noexcept;
+		void set(uint32 index, const GenoVector2f & vector) noexcept;
+		void get(GenoVector2f * target) const noexcept;
+
+		~GenoVector2fBatch();
+};
+
+/**
+ * target[i] = left[i] + right[i]
+**/
+void add(const GenoVector2fBatch & left, const GenoVector2fBatch & right, GenoVector2fBatch & target);
+
+/**
+ * target[i] = offset[i] + scaled[i] * scalar
+ *
+ * Euler integration is multiplyAdd(velocities, delta, positions, positions)
+**/
+void multiplyAdd(const GenoVector2fBatch & scaled, float scalar, const GenoVector2fBatch & offset, GenoVector2fBatch & target);
+
+/**
+ * target[i] = |batch[i]|
+ *
+ * target must hold batch.getSize() floats
+**/
+void length(const GenoVector2fBatch & batch, float * target);
+
+/**
+ * target[i] = batch[i] / |batch[i]|
+ *
+ * Zero vectors stay zero instead of becoming NaN
+**/
+void normalize(const GenoVector2fBatch & batch, GenoVector2fBatch & target);
+
+/**
+ * target[i] = component-wise min(max(batch[i], minimum), maximum)
+**/
+void clamp(const GenoVector2fBatch & batch, const GenoVector2f & minimum, const GenoVector2f & maximum, GenoVector2fBatch & target);
+
+/**
+ * Strict AABB overlap of every box (positions[i], dimensions[i]) against the box (position, dimension)
+ *
+ * Writes one flag per box to target and returns the number of overlapping boxes.
+ * A point test is a box with zero dimensions.
+**/
+uint32 overlaps(const GenoVector2fBatch & positions, const GenoVector2fBatch & dimensions, const GenoVector2f & position, const GenoVector2f & dimension, bool * target);
+
+/**
+ * Returns the index of the first box at or after begin that overlaps (position, dimension),
+ * or positions.getSize() if none does
+**/
+uint32 findOverlap(const GenoVector2fBatch & positions, const GenoVector2fBatch & dimensions, uint32 begin, const GenoVector2f & position, const GenoVector2f & dimension);
+
+#define GNARLY_GENOME_VECTOR2F_BATCH_FORWARD
+#endif // GNARLY_GENOME_VECTOR2F_BATCH
@@ -56,10 +56,12 @@ class GenoVector<4, T>;
 #include <ostream>
 #include <cmath>
 
+#include "../GenoFastMath.h"
 #include "GenoVector.h"
 #include "GenoVector2.h"
 #include "GenoVector4.h"
 #include "GenoVectorDimensions.h"
+#include "GenoVectorExpression.h"
 
 namespace GenoVectorDimensions {
 	extern GenoVectorDimension<2> z;
@@ -67,158 +69,157 @@ namespace GenoVectorDimensions {
 
 template <typename T>
 class GenoVector<3, T> {
-	private:
-		bool owner = true;
-
-		void clean() {
-			if (owner)
-				delete [] v;
-		}
-
 	public:
-		T * v;
+		T v[3];
 
-		GenoVector() :
-			v(new T[3]()) {}
-		
-		GenoVector(T * v, bool owner = true) noexcept :
-			owner(owner),
-			v(v) {}
-		
-		explicit GenoVector(T value) :
-			v(new T[3] { value, value, value }) {}
+		constexpr GenoVector() :
+			v() {}
+
+		explicit constexpr GenoVector(T value) :
+			v { value, value, value } {}
 
-		GenoVector(T x, T y, T z) :
-			v(new T[3] { x, y, z }) {}
+		constexpr GenoVector(T x, T y, T z) :
+			v { x, y, z } {}
 
 		template <typename T2>
-		GenoVector(const GenoVector<3, T2> & vector) :
-			v(new T[3] {
+		constexpr GenoVector(const GenoVector<3, T2> & vector) :
+			v {
 				(T) vector.v[0],
 				(T) vector.v[1],
 				(T) vector.v[2]
-			}) {}
-
-		GenoVector(const GenoVector<3, T> & vector) :
-			v(new T[3] {
+			} {}
+
+		template <typename E>
+		constexpr GenoVector(const GenoVectorExpression<3, T, E> & expression) :
+			v {
+				expression.get(0),
+				expression.get(1),
+				expression.get(2)
+			} {}
+
+		constexpr GenoVector(const GenoVector<3, T> & vector) :
+			v {
 				vector.v[0],
 				vector.v[1],
 				vector.v[2]
-			}) {}
-
-		GenoVector(GenoVector<3, T> && vector) :
-			owner(vector.owner),
-			v(vector.v) {
-			vector.owner = false;
-		}
+			} {}
 
-		GenoVector<3, T> & operator=(const GenoVector<3, T> & vector) {
+		constexpr GenoVector<3, T> & operator=(const GenoVector<3, T> & vector) {
 			v[0] = vector.v[0];
 			v[1] = vector.v[1];
 			v[2] = vector.v[2];
 			return *this;
 		}
 
-		GenoVector<3, T> & operator=(GenoVector<3, T> && vector) {
-			if (owner) {
-				clean();
-				owner = vector.owner;
-				v = vector.v;
-				vector.owner = false;
-			}
-			else {
-				v[0] = vector.v[0];
-				v[1] = vector.v[1];
-				v[2] = vector.v[2];
-			}
+		template <typename E>
+		constexpr GenoVector<3, T> & operator=(const GenoVectorExpression<3, T, E> & expression) {
+			v[0] = expression.get(0);
+			v[1] = expression.get(1);
+			v[2] = expression.get(2);
+			return *this;
+		}
+
+		template <typename E>
+		constexpr GenoVector<3, T> & operator+=(const GenoVectorExpression<3, T, E> & expression) {
+			v[0] += expression.get(0);
+			v[1] += expression.get(1);
+			v[2] += expression.get(2);
 			return *this;
 		}
 
-		GenoVector<3, T> & operator+=(const GenoVector<3, T> & vector) {
+		template <typename E>
+		constexpr GenoVector<3, T> & operator-=(const GenoVectorExpression<3, T, E> & expression) {
+			v[0] -= expression.get(0);
+			v[1] -= expression.get(1);
+			v[2] -= expression.get(2);
+			return *this;
+		}
+
+		constexpr GenoVector<3, T> & operator+=(const GenoVector<3, T> & vector) {
 			v[0] += vector.v[0];
 			v[1] += vector.v[1];
 			v[2] += vector.v[2];
 			return *this;
 		}
 
-		GenoVector<3, T> & operator-=(const GenoVector<3, T> & vector) {
+		constexpr GenoVector<3, T> & operator-=(const GenoVector<3, T> & vector) {
 			v[0] -= vector.v[0];
 			v[1] -= vector.v[1];
 			v[2] -= vector.v[2];
 			return *this;
 		}
 
-		GenoVector<3, T> & operator*=(T scalar) {
+		constexpr GenoVector<3, T> & operator*=(T scalar) {
 			v[0] *= scalar;
 			v[1] *= scalar;
 			v[2] *= scalar;
 			return *this;
 		}
 
-		GenoVector<3, T> & operator*=(const GenoVector<3, T> & vector) {
+		constexpr GenoVector<3, T> & operator*=(const GenoVector<3, T> & vector) {
 			v[0] *= vector.v[0];
 			v[1] *= vector.v[1];
 			v[2] *= vector.v[2];
 			return *this;
 		}
 
-		GenoVector<3, T> & operator/=(T scalar) {
+		constexpr GenoVector<3, T> & operator/=(T scalar) {
 			v[0] /= scalar;
 			v[1] /= scalar;
 			v[2] /= scalar;
 			return *this;
 		}
 
-		GenoVector<3, T> & operator/=(const GenoVector<3, T> & vector) {
+		constexpr GenoVector<3, T> & operator/=(const GenoVector<3, T> & vector) {
 			v[0] /= vector.v[0];
 			v[1] /= vector.v[1];
 			v[2] /= vector.v[2];
 			return *this;
 		}
 
-		T & operator[](uint32 index) noexcept {
+		constexpr T & operator[](uint32 index) noexcept {
 			return v[index];
 		}
 
-		const T & operator[](uint32 index) const noexcept {
+		constexpr const T & operator[](uint32 index) const noexcept {
 			return v[index];
 		}
 
 		template <uint32 N>
-		T & operator[](const GenoVectorDimensions::GenoVectorDimension<N> & dimension) noexcept {
+		constexpr T & operator[](const GenoVectorDimensions::GenoVectorDimension<N> & dimension) noexcept {
 			static_assert(GenoVectorDimensions::GenoVectorDimension<N>::dimension != 3, "GenoVector<3, T> has no dimension w!");
 			static_assert(GenoVectorDimensions::GenoVectorDimension<N>::dimension  < 4, "GenoVector<3, T> has no dimension beyond z!");
 			return v[GenoVectorDimensions::GenoVectorDimension<N>::dimension];
 		}
 
 		template <uint32 N>
-		const T & operator[](const GenoVectorDimensions::GenoVectorDimension<N> & dimension) const noexcept {
+		constexpr const T & operator[](const GenoVectorDimensions::GenoVectorDimension<N> & dimension) const noexcept {
 			static_assert(GenoVectorDimensions::GenoVectorDimension<N>::dimension != 3, "GenoVector<3, T> has no dimension w!");
 			static_assert(GenoVectorDimensions::GenoVectorDimension<N>::dimension  < 4, "GenoVector<3, T> has no dimension beyond z!");
 			return v[GenoVectorDimensions::GenoVectorDimension<N>::dimension];
 		}
 
-		T & x() noexcept {
+		constexpr T & x() noexcept {
 			return v[0];
 		}
 
-		const T & x() const noexcept {
+		constexpr const T & x() const noexcept {
 			return v[0];
 		}
 
-		T & y() noexcept {
+		constexpr T & y() noexcept {
 			return v[1];
 		}
 
-		const T & y() const noexcept {
+		constexpr const T & y() const noexcept {
 			return v[1];
 		}
 
-		T & z() noexcept {
+		constexpr T & z() noexcept {
 			return v[2];
 		}
 
-		const T & z() const noexcept {
+		constexpr const T & z() const noexcept {
 			return v[2];
 		}
 
@@ -230,7 +231,7 @@ class GenoVector<3, T> {
 			);
 		}
 
-		T getLengthSquared() const {
+		constexpr T getLengthSquared() const {
 			return (
 				v[0] * v[0] +
 				v[1] * v[1] +
@@ -253,15 +254,35 @@ class GenoVector<3, T> {
 			v[2] *= scalar;
 			return *this;
 		}
+
+		T fastGetLength() const {
+			return fastSqrt(getLengthSquared());
+		}
+
+		GenoVector<3, T> & fastSetLength(T length) {
+			auto scalar = length * fastInverseSqrt(getLengthSquared());
+			v[0] *= scalar;
+			v[1] *= scalar;
+			v[2] *= scalar;
+			return *this;
+		}
+
+		GenoVector<3, T> & fastNormalize() {
+			auto scalar = fastInverseSqrt(getLengthSquared());
+			v[0] *= scalar;
+			v[1] *= scalar;
+			v[2] *= scalar;
+			return *this;
+		}
 		
-		GenoVector<3, T> & negate() {
+		constexpr GenoVector<3, T> & negate() {
 			v[0] = -v[0];
 			v[1] = -v[1];
 			v[2] = -v[2];
 			return *this;
 		}
 
-		GenoVector<3, T> & project(const GenoVector<3, T> & projection) {
+		constexpr GenoVector<3, T> & project(const GenoVector<3, T> & projection) {
 			auto scalar = dot(*this, projection) / projection.getLengthSquared();
 			v[0] /= scalar;
 			v[1] /= scalar;
@@ -273,20 +294,20 @@ class GenoVector<3, T> {
 			return *this = getLength() * vector + *this * vector.getLength();
 		}
 
-		GenoVector<3, T> & lerp(const GenoVector<3, T> & end, double interpAmount) {
+		constexpr GenoVector<3, T> & lerp(const GenoVector<3, T> & end, double interpAmount) {
 			v[0] = (T) (v[0] + (end.v[0] - v[0]) * interpAmount);
 			v[1] = (T) (v[1] + (end.v[1] - v[1]) * interpAmount);
 			v[2] = (T) (v[2] + (end.v[2] - v[2]) * interpAmount);
 			return *this;
 		}
 
-		bool isZeroVector() {
+		constexpr bool isZeroVector() {
 			return v[0] == 0 &&
 			       v[1] == 0 &&
 			       v[2] == 0;
 		}
 
-		GenoVector<3, T> & cross(const GenoVector<3, T> & cross) {
+		constexpr GenoVector<3, T> & cross(const GenoVector<3, T> & cross) {
 			T v0 = v[1] * cross.v[2] - v[2] * cross.v[1];
 			T v1 = v[2] * cross.v[0] - v[0] * cross.v[2];
 			v[2] = v[0] * cross.v[1] - v[1] * cross.v[0];
@@ -295,249 +316,268 @@ class GenoVector<3, T> {
 			return *this;
 		}
 
-		GenoVector<3, T> & set(const GenoVector<3, T> & set) {
+		constexpr GenoVector<3, T> & set(const GenoVector<3, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<3, T> & translate(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<3, T> & translate(const GenoVector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			v[2] += translate.v[2];
 			return *this;
 		}
 		
-		GenoVector<3, T> & scale(T scale) {
+		constexpr GenoVector<3, T> & scale(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 			v[2] *= scale;
 			return *this;
 		}
 		
-		GenoVector<3, T> & scale(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<3, T> & scale(const GenoVector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[2] *= scale.v[2];
 			return *this;
 		}
 
-		GenoVector<3, T> & setX(T x) {
+		constexpr GenoVector<3, T> & setX(T x) {
 			v[0] = x;
 			return *this;
 		}
 
-		GenoVector<3, T> & setY(T y) {
+		constexpr GenoVector<3, T> & setY(T y) {
 			v[1] = y;
 			return *this;
 		}
 
-		GenoVector<3, T> & setZ(T z) {
+		constexpr GenoVector<3, T> & setZ(T z) {
 			v[2] = z;
 			return *this;
 		}
 
-		GenoVector<3, T> & setXY(T x, T y) {
+		constexpr GenoVector<3, T> & setXY(T x, T y) {
 			v[0] = x;
 			v[1] = y;
 			return *this;
 		}
 
-		GenoVector<3, T> & setXY(const GenoVector<2, T> & set) {
+		constexpr GenoVector<3, T> & setXY(const GenoVector<2, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<3, T> & setXZ(T x, T z) {
+		constexpr GenoVector<3, T> & setXZ(T x, T z) {
 			v[0] = x;
 			v[2] = z;
 			return *this;
 		}
 
-		GenoVector<3, T> & setXZ(const GenoVector<2, T> & set) {
+		constexpr GenoVector<3, T> & setXZ(const GenoVector<2, T> & set) {
 			v[0] = set.v[0];
 			v[2] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<3, T> & setYX(const GenoVector<2, T> & set) {
+		constexpr GenoVector<3, T> & setYX(const GenoVector<2, T> & set) {
 			v[1] = set.v[0];
 			v[0] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<3, T> & setYZ(T y, T z) {
+		constexpr GenoVector<3, T> & setYZ(T y, T z) {
 			v[1] = y;
 			v[2] = z;
 			return *this;
 		}
 
-		GenoVector<3, T> & setYZ(const GenoVector<2, T> & set) {
+		constexpr GenoVector<3, T> & setYZ(const GenoVector<2, T> & set) {
 			v[1] = set.v[0];
 			v[2] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<3, T> & setZX(const GenoVector<2, T> & set) {
+		constexpr GenoVector<3, T> & setZX(const GenoVector<2, T> & set) {
 			v[2] = set.v[0];
 			v[0] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<3, T> & setZY(const GenoVector<2, T> & set) {
+		constexpr GenoVector<3, T> & setZY(const GenoVector<2, T> & set) {
 			v[2] = set.v[0];
 			v[1] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<3, T> & setXYZ(T x, T y, T z) {
+		constexpr GenoVector<3, T> & setXYZ(T x, T y, T z) {
 			v[0] = x;
 			v[1] = y;
 			v[2] = z;
 			return *this;
 		}
 
-		GenoVector<3, T> & setXYZ(const GenoVector<3, T> & set) {
+		constexpr GenoVector<3, T> & setXYZ(const GenoVector<3, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<3, T> & setXZY(const GenoVector<3, T> & set) {
+		constexpr GenoVector<3, T> & setXZY(const GenoVector<3, T> & set) {
 			v[0] = set.v[0];
 			v[2] = set.v[1];
 			v[1] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<3, T> & setYXZ(const GenoVector<3, T> & set) {
+		constexpr GenoVector<3, T> & setYXZ(const GenoVector<3, T> & set) {
 			v[1] = set.v[0];
 			v[0] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<3, T> & setYZX(const GenoVector<3, T> & set) {
+		constexpr GenoVector<3, T> & setYZX(const GenoVector<3, T> & set) {
 			v[1] = set.v[0];
 			v[2] = set.v[1];
 			v[0] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<3, T> & setZXY(const GenoVector<3, T> & set) {
+		constexpr GenoVector<3, T> & setZXY(const GenoVector<3, T> & set) {
 			v[2] = set.v[0];
 			v[0] = set.v[1];
 			v[1] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<3, T> & setZYX(const GenoVector<3, T> & set) {
+		constexpr GenoVector<3, T> & setZYX(const GenoVector<3, T> & set) {
 			v[2] = set.v[0];
 			v[1] = set.v[1];
 			v[0] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<3, T> & translateX(T translateX) {
+		constexpr GenoVector<3, T> & translateX(T translateX) {
 			v[0] += translateX;
+			return *this;
 		}
 
-		GenoVector<3, T> & translateY(T translateY) {
+		constexpr GenoVector<3, T> & translateY(T translateY) {
 			v[1] += translateY;
+			return *this;
 		}
 
-		GenoVector<3, T> & translateZ(T translateZ) {
+		constexpr GenoVector<3, T> & translateZ(T translateZ) {
 			v[2] += translateZ;
+			return *this;
 		}
 
-		GenoVector<3, T> & translateXY(T translateX, T translateY) {
+		constexpr GenoVector<3, T> & translateXY(T translateX, T translateY) {
 			v[0] += translateX;
 			v[1] += translateY;
+			return *this;
 		}
 
-		GenoVector<3, T> & translateXY(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<3, T> & translateXY(const GenoVector<2, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<3, T> & translateXZ(T translateX, T translateZ) {
+		constexpr GenoVector<3, T> & translateXZ(T translateX, T translateZ) {
 			v[0] += translateX;
 			v[2] += translateZ;
+			return *this;
 		}
 
-		GenoVector<3, T> & translateXZ(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<3, T> & translateXZ(const GenoVector<2, T> & translate) {
 			v[0] += translate.v[0];
 			v[2] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<3, T> & translateYX(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<3, T> & translateYX(const GenoVector<2, T> & translate) {
 			v[1] += translate.v[0];
 			v[0] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<3, T> & translateYZ(T translateY, T translateZ) {
+		constexpr GenoVector<3, T> & translateYZ(T translateY, T translateZ) {
 			v[1] += translateY;
 			v[2] += translateZ;
+			return *this;
 		}
 
-		GenoVector<3, T> & translateYZ(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<3, T> & translateYZ(const GenoVector<2, T> & translate) {
 			v[1] += translate.v[0];
 			v[2] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<3, T> & translateZX(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<3, T> & translateZX(const GenoVector<2, T> & translate) {
 			v[2] += translate.v[0];
 			v[0] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<3, T> & translateZY(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<3, T> & translateZY(const GenoVector<2, T> & translate) {
 			v[2] += translate.v[0];
 			v[1] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<3, T> & translateXYZ(T translateX, T translateY, T translateZ) {
+		constexpr GenoVector<3, T> & translateXYZ(T translateX, T translateY, T translateZ) {
 			v[0] += translateX;
 			v[1] += translateY;
 			v[2] += translateZ;
+			return *this;
 		}
 
-		GenoVector<3, T> & translateXYZ(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<3, T> & translateXYZ(const GenoVector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			v[2] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<3, T> & translateXZY(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<3, T> & translateXZY(const GenoVector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[2] += translate.v[1];
 			v[1] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<3, T> & translateYXZ(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<3, T> & translateYXZ(const GenoVector<3, T> & translate) {
 			v[1] += translate.v[0];
 			v[0] += translate.v[1];
 			v[2] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<3, T> & translateYZX(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<3, T> & translateYZX(const GenoVector<3, T> & translate) {
 			v[1] += translate.v[0];
 			v[2] += translate.v[1];
 			v[0] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<3, T> & translateZXY(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<3, T> & translateZXY(const GenoVector<3, T> & translate) {
 			v[2] += translate.v[0];
 			v[0] += translate.v[1];
 			v[1] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<3, T> & translateZYX(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<3, T> & translateZYX(const GenoVector<3, T> & translate) {
 			v[2] += translate.v[0];
 			v[1] += translate.v[1];
 			v[0] += translate.v[2];
+			return *this;
 		}
 
 		GenoVector<3, T> & rotateX(T rotateX) {
@@ -808,685 +848,672 @@ class GenoVector<3, T> {
 			return *this;
 		}
 
-		GenoVector<3, T> & scaleX(T scaleX) {
+		constexpr GenoVector<3, T> & scaleX(T scaleX) {
 			v[0] *= scaleX;
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleY(T scaleY) {
+		constexpr GenoVector<3, T> & scaleY(T scaleY) {
 			v[1] *= scaleY;
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleZ(T scaleZ) {
+		constexpr GenoVector<3, T> & scaleZ(T scaleZ) {
 			v[2] *= scaleZ;
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleXY(T scale) {
+		constexpr GenoVector<3, T> & scaleXY(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleXY(T scaleX, T scaleY) {
+		constexpr GenoVector<3, T> & scaleXY(T scaleX, T scaleY) {
 			v[0] *= scaleX;
 			v[1] *= scaleY;
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleXY(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<3, T> & scaleXY(const GenoVector<2, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleXZ(T scale) {
+		constexpr GenoVector<3, T> & scaleXZ(T scale) {
 			v[0] *= scale;
 			v[2] *= scale;
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleXZ(T scaleX, T scaleZ) {
+		constexpr GenoVector<3, T> & scaleXZ(T scaleX, T scaleZ) {
 			v[0] *= scaleX;
 			v[2] *= scaleZ;
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleXZ(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<3, T> & scaleXZ(const GenoVector<2, T> & scale) {
 			v[0] *= scale.v[0];
 			v[2] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleYX(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<3, T> & scaleYX(const GenoVector<2, T> & scale) {
 			v[1] *= scale.v[0];
 			v[0] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleYZ(T scale) {
+		constexpr GenoVector<3, T> & scaleYZ(T scale) {
 			v[1] *= scale;
 			v[2] *= scale;
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleYZ(T scaleY, T scaleZ) {
+		constexpr GenoVector<3, T> & scaleYZ(T scaleY, T scaleZ) {
 			v[1] *= scaleY;
 			v[2] *= scaleZ;
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleYZ(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<3, T> & scaleYZ(const GenoVector<2, T> & scale) {
 			v[1] *= scale.v[0];
 			v[2] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleZX(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<3, T> & scaleZX(const GenoVector<2, T> & scale) {
 			v[2] *= scale.v[0];
 			v[0] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleZY(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<3, T> & scaleZY(const GenoVector<2, T> & scale) {
 			v[2] *= scale.v[0];
 			v[1] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleXYZ(T scale) {
+		constexpr GenoVector<3, T> & scaleXYZ(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 			v[2] *= scale;
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleXYZ(T scaleX, T scaleY, T scaleZ) {
+		constexpr GenoVector<3, T> & scaleXYZ(T scaleX, T scaleY, T scaleZ) {
 			v[0] *= scaleX;
 			v[1] *= scaleY;
 			v[2] *= scaleZ;
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleXYZ(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<3, T> & scaleXYZ(const GenoVector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[2] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleXZY(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<3, T> & scaleXZY(const GenoVector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[1] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleYXZ(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<3, T> & scaleYXZ(const GenoVector<3, T> & scale) {
 			v[1] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[2] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleYZX(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<3, T> & scaleYZX(const GenoVector<3, T> & scale) {
 			v[1] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[0] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleZXY(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<3, T> & scaleZXY(const GenoVector<3, T> & scale) {
 			v[2] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[1] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<3, T> & scaleZYX(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<3, T> & scaleZYX(const GenoVector<3, T> & scale) {
 			v[2] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[0] *= scale.v[2];
+			return *this;
 		}
 
-		T getX() const {
+		constexpr T getX() const {
 			return v[0];
 		}
 
-		T getY() const {
+		constexpr T getY() const {
 			return v[1];
 		}
 
-		T getZ() const {
+		constexpr T getZ() const {
 			return v[2];
 		}
 
-		GenoVector<2, T> getXX() const {
+		constexpr GenoVector<2, T> getXX() const {
 			return { v[0], v[0] };
 		}
 
-		GenoVector<2, T> getXY() const {
+		constexpr GenoVector<2, T> getXY() const {
 			return { v[0], v[1] };
 		}
 
-		GenoVector<2, T> getXZ() const {
+		constexpr GenoVector<2, T> getXZ() const {
 			return { v[0], v[2] };
 		}
 
-		GenoVector<2, T> getYX() const {
+		constexpr GenoVector<2, T> getYX() const {
 			return { v[1], v[0] };
 		}
 
-		GenoVector<2, T> getYY() const {
+		constexpr GenoVector<2, T> getYY() const {
 			return { v[1], v[1] };
 		}
 
-		GenoVector<2, T> getYZ() const {
+		constexpr GenoVector<2, T> getYZ() const {
 			return { v[1], v[2] };
 		}
 
-		GenoVector<2, T> getZX() const {
+		constexpr GenoVector<2, T> getZX() const {
 			return { v[2], v[0] };
 		}
 
-		GenoVector<2, T> getZY() const {
+		constexpr GenoVector<2, T> getZY() const {
 			return { v[2], v[1] };
 		}
 
-		GenoVector<2, T> getZZ() const {
+		constexpr GenoVector<2, T> getZZ() const {
 			return { v[2], v[2] };
 		}
 
-		GenoVector<3, T> getXXX() const {
+		constexpr GenoVector<3, T> getXXX() const {
 			return { v[0], v[0], v[0] };
 		}
 
-		GenoVector<3, T> getXXY() const {
+		constexpr GenoVector<3, T> getXXY() const {
 			return { v[0], v[0], v[1] };
 		}
 
-		GenoVector<3, T> getXXZ() const {
+		constexpr GenoVector<3, T> getXXZ() const {
 			return { v[0], v[0], v[2] };
 		}
 
-		GenoVector<3, T> getXYX() const {
+		constexpr GenoVector<3, T> getXYX() const {
 			return { v[0], v[1], v[0] };
 		}
 
-		GenoVector<3, T> getXYY() const {
+		constexpr GenoVector<3, T> getXYY() const {
 			return { v[0], v[1], v[1] };
 		}
 
-		GenoVector<3, T> getXYZ() const {
+		constexpr GenoVector<3, T> getXYZ() const {
 			return { v[0], v[1], v[2] };
 		}
 
-		GenoVector<3, T> getXZX() const {
+		constexpr GenoVector<3, T> getXZX() const {
 			return { v[0], v[2], v[0] };
 		}
 
-		GenoVector<3, T> getXZY() const {
+		constexpr GenoVector<3, T> getXZY() const {
 			return { v[0], v[2], v[1] };
 		}
 
-		GenoVector<3, T> getXZZ() const {
+		constexpr GenoVector<3, T> getXZZ() const {
 			return { v[0], v[2], v[2] };
 		}
 
-		GenoVector<3, T> getYXX() const {
+		constexpr GenoVector<3, T> getYXX() const {
 			return { v[1], v[0], v[0] };
 		}
 
-		GenoVector<3, T> getYXY() const {
+		constexpr GenoVector<3, T> getYXY() const {
 			return { v[1], v[0], v[1] };
 		}
 
-		GenoVector<3, T> getYXZ() const {
+		constexpr GenoVector<3, T> getYXZ() const {
 			return { v[1], v[0], v[2] };
 		}
 
-		GenoVector<3, T> getYYX() const {
+		constexpr GenoVector<3, T> getYYX() const {
 			return { v[1], v[1], v[0] };
 		}
 
-		GenoVector<3, T> getYYY() const {
+		constexpr GenoVector<3, T> getYYY() const {
 			return { v[1], v[1], v[1] };
 		}
 
-		GenoVector<3, T> getYYZ() const {
+		constexpr GenoVector<3, T> getYYZ() const {
 			return { v[1], v[1], v[2] };
 		}
 
-		GenoVector<3, T> getYZX() const {
+		constexpr GenoVector<3, T> getYZX() const {
 			return { v[1], v[2], v[0] };
 		}
 
-		GenoVector<3, T> getYZY() const {
+		constexpr GenoVector<3, T> getYZY() const {
 			return { v[1], v[2], v[1] };
 		}
 
-		GenoVector<3, T> getYZZ() const {
+		constexpr GenoVector<3, T> getYZZ() const {
 			return { v[1], v[2], v[2] };
 		}
 
-		GenoVector<3, T> getZXX() const {
+		constexpr GenoVector<3, T> getZXX() const {
 			return { v[2], v[0], v[0] };
 		}
 
-		GenoVector<3, T> getZXY() const {
+		constexpr GenoVector<3, T> getZXY() const {
 			return { v[2], v[0], v[1] };
 		}
 
-		GenoVector<3, T> getZXZ() const {
+		constexpr GenoVector<3, T> getZXZ() const {
 			return { v[2], v[0], v[2] };
 		}
 
-		GenoVector<3, T> getZYX() const {
+		constexpr GenoVector<3, T> getZYX() const {
 			return { v[2], v[1], v[0] };
 		}
 
-		GenoVector<3, T> getZYY() const {
+		constexpr GenoVector<3, T> getZYY() const {
 			return { v[2], v[1], v[1] };
 		}
 
-		GenoVector<3, T> getZYZ() const {
+		constexpr GenoVector<3, T> getZYZ() const {
 			return { v[2], v[1], v[2] };
 		}
 
-		GenoVector<3, T> getZZX() const {
+		constexpr GenoVector<3, T> getZZX() const {
 			return { v[2], v[2], v[0] };
 		}
 
-		GenoVector<3, T> getZZY() const {
+		constexpr GenoVector<3, T> getZZY() const {
 			return { v[2], v[2], v[1] };
 		}
 
-		GenoVector<3, T> getZZZ() const {
+		constexpr GenoVector<3, T> getZZZ() const {
 			return { v[2], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getXXXX() const {
+		constexpr GenoVector<4, T> getXXXX() const {
 			return { v[0], v[0], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getXXXY() const {
+		constexpr GenoVector<4, T> getXXXY() const {
 			return { v[0], v[0], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getXXXZ() const {
+		constexpr GenoVector<4, T> getXXXZ() const {
 			return { v[0], v[0], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getXXYX() const {
+		constexpr GenoVector<4, T> getXXYX() const {
 			return { v[0], v[0], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getXXYY() const {
+		constexpr GenoVector<4, T> getXXYY() const {
 			return { v[0], v[0], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getXXYZ() const {
+		constexpr GenoVector<4, T> getXXYZ() const {
 			return { v[0], v[0], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getXXZX() const {
+		constexpr GenoVector<4, T> getXXZX() const {
 			return { v[0], v[0], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getXXZY() const {
+		constexpr GenoVector<4, T> getXXZY() const {
 			return { v[0], v[0], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getXXZZ() const {
+		constexpr GenoVector<4, T> getXXZZ() const {
 			return { v[0], v[0], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getXYXX() const {
+		constexpr GenoVector<4, T> getXYXX() const {
 			return { v[0], v[1], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getXYXY() const {
+		constexpr GenoVector<4, T> getXYXY() const {
 			return { v[0], v[1], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getXYXZ() const {
+		constexpr GenoVector<4, T> getXYXZ() const {
 			return { v[0], v[1], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getXYYX() const {
+		constexpr GenoVector<4, T> getXYYX() const {
 			return { v[0], v[1], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getXYYY() const {
+		constexpr GenoVector<4, T> getXYYY() const {
 			return { v[0], v[1], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getXYYZ() const {
+		constexpr GenoVector<4, T> getXYYZ() const {
 			return { v[0], v[1], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getXYZX() const {
+		constexpr GenoVector<4, T> getXYZX() const {
 			return { v[0], v[1], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getXYZY() const {
+		constexpr GenoVector<4, T> getXYZY() const {
 			return { v[0], v[1], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getXYZZ() const {
+		constexpr GenoVector<4, T> getXYZZ() const {
 			return { v[0], v[1], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getXZXX() const {
+		constexpr GenoVector<4, T> getXZXX() const {
 			return { v[0], v[2], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getXZXY() const {
+		constexpr GenoVector<4, T> getXZXY() const {
 			return { v[0], v[2], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getXZXZ() const {
+		constexpr GenoVector<4, T> getXZXZ() const {
 			return { v[0], v[2], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getXZYX() const {
+		constexpr GenoVector<4, T> getXZYX() const {
 			return { v[0], v[2], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getXZYY() const {
+		constexpr GenoVector<4, T> getXZYY() const {
 			return { v[0], v[2], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getXZYZ() const {
+		constexpr GenoVector<4, T> getXZYZ() const {
 			return { v[0], v[2], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getXZZX() const {
+		constexpr GenoVector<4, T> getXZZX() const {
 			return { v[0], v[2], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getXZZY() const {
+		constexpr GenoVector<4, T> getXZZY() const {
 			return { v[0], v[2], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getXZZZ() const {
+		constexpr GenoVector<4, T> getXZZZ() const {
 			return { v[0], v[2], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getYXXX() const {
+		constexpr GenoVector<4, T> getYXXX() const {
 			return { v[1], v[0], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getYXXY() const {
+		constexpr GenoVector<4, T> getYXXY() const {
 			return { v[1], v[0], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getYXXZ() const {
+		constexpr GenoVector<4, T> getYXXZ() const {
 			return { v[1], v[0], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getYXYX() const {
+		constexpr GenoVector<4, T> getYXYX() const {
 			return { v[1], v[0], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getYXYY() const {
+		constexpr GenoVector<4, T> getYXYY() const {
 			return { v[1], v[0], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getYXYZ() const {
+		constexpr GenoVector<4, T> getYXYZ() const {
 			return { v[1], v[0], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getYXZX() const {
+		constexpr GenoVector<4, T> getYXZX() const {
 			return { v[1], v[0], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getYXZY() const {
+		constexpr GenoVector<4, T> getYXZY() const {
 			return { v[1], v[0], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getYXZZ() const {
+		constexpr GenoVector<4, T> getYXZZ() const {
 			return { v[1], v[0], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getYYXX() const {
+		constexpr GenoVector<4, T> getYYXX() const {
 			return { v[1], v[1], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getYYXY() const {
+		constexpr GenoVector<4, T> getYYXY() const {
 			return { v[1], v[1], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getYYXZ() const {
+		constexpr GenoVector<4, T> getYYXZ() const {
 			return { v[1], v[1], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getYYYX() const {
+		constexpr GenoVector<4, T> getYYYX() const {
 			return { v[1], v[1], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getYYYY() const {
+		constexpr GenoVector<4, T> getYYYY() const {
 			return { v[1], v[1], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getYYYZ() const {
+		constexpr GenoVector<4, T> getYYYZ() const {
 			return { v[1], v[1], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getYYZX() const {
+		constexpr GenoVector<4, T> getYYZX() const {
 			return { v[1], v[1], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getYYZY() const {
+		constexpr GenoVector<4, T> getYYZY() const {
 			return { v[1], v[1], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getYYZZ() const {
+		constexpr GenoVector<4, T> getYYZZ() const {
 			return { v[1], v[1], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getYZXX() const {
+		constexpr GenoVector<4, T> getYZXX() const {
 			return { v[1], v[2], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getYZXY() const {
+		constexpr GenoVector<4, T> getYZXY() const {
 			return { v[1], v[2], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getYZXZ() const {
+		constexpr GenoVector<4, T> getYZXZ() const {
 			return { v[1], v[2], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getYZYX() const {
+		constexpr GenoVector<4, T> getYZYX() const {
 			return { v[1], v[2], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getYZYY() const {
+		constexpr GenoVector<4, T> getYZYY() const {
 			return { v[1], v[2], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getYZYZ() const {
+		constexpr GenoVector<4, T> getYZYZ() const {
 			return { v[1], v[2], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getYZZX() const {
+		constexpr GenoVector<4, T> getYZZX() const {
 			return { v[1], v[2], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getYZZY() const {
+		constexpr GenoVector<4, T> getYZZY() const {
 			return { v[1], v[2], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getYZZZ() const {
+		constexpr GenoVector<4, T> getYZZZ() const {
 			return { v[1], v[2], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getZXXX() const {
+		constexpr GenoVector<4, T> getZXXX() const {
 			return { v[2], v[0], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getZXXY() const {
+		constexpr GenoVector<4, T> getZXXY() const {
 			return { v[2], v[0], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getZXXZ() const {
+		constexpr GenoVector<4, T> getZXXZ() const {
 			return { v[2], v[0], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getZXYX() const {
+		constexpr GenoVector<4, T> getZXYX() const {
 			return { v[2], v[0], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getZXYY() const {
+		constexpr GenoVector<4, T> getZXYY() const {
 			return { v[2], v[0], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getZXYZ() const {
+		constexpr GenoVector<4, T> getZXYZ() const {
 			return { v[2], v[0], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getZXZX() const {
+		constexpr GenoVector<4, T> getZXZX() const {
 			return { v[2], v[0], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getZXZY() const {
+		constexpr GenoVector<4, T> getZXZY() const {
 			return { v[2], v[0], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getZXZZ() const {
+		constexpr GenoVector<4, T> getZXZZ() const {
 			return { v[2], v[0], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getZYXX() const {
+		constexpr GenoVector<4, T> getZYXX() const {
 			return { v[2], v[1], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getZYXY() const {
+		constexpr GenoVector<4, T> getZYXY() const {
 			return { v[2], v[1], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getZYXZ() const {
+		constexpr GenoVector<4, T> getZYXZ() const {
 			return { v[2], v[1], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getZYYX() const {
+		constexpr GenoVector<4, T> getZYYX() const {
 			return { v[2], v[1], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getZYYY() const {
+		constexpr GenoVector<4, T> getZYYY() const {
 			return { v[2], v[1], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getZYYZ() const {
+		constexpr GenoVector<4, T> getZYYZ() const {
 			return { v[2], v[1], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getZYZX() const {
+		constexpr GenoVector<4, T> getZYZX() const {
 			return { v[2], v[1], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getZYZY() const {
+		constexpr GenoVector<4, T> getZYZY() const {
 			return { v[2], v[1], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getZYZZ() const {
+		constexpr GenoVector<4, T> getZYZZ() const {
 			return { v[2], v[1], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getZZXX() const {
+		constexpr GenoVector<4, T> getZZXX() const {
 			return { v[2], v[2], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getZZXY() const {
+		constexpr GenoVector<4, T> getZZXY() const {
 			return { v[2], v[2], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getZZXZ() const {
+		constexpr GenoVector<4, T> getZZXZ() const {
 			return { v[2], v[2], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getZZYX() const {
+		constexpr GenoVector<4, T> getZZYX() const {
 			return { v[2], v[2], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getZZYY() const {
+		constexpr GenoVector<4, T> getZZYY() const {
 			return { v[2], v[2], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getZZYZ() const {
+		constexpr GenoVector<4, T> getZZYZ() const {
 			return { v[2], v[2], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getZZZX() const {
+		constexpr GenoVector<4, T> getZZZX() const {
 			return { v[2], v[2], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getZZZY() const {
+		constexpr GenoVector<4, T> getZZZY() const {
 			return { v[2], v[2], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getZZZZ() const {
+		constexpr GenoVector<4, T> getZZZZ() const {
 			return { v[2], v[2], v[2], v[2] };
 		}
-
-		virtual ~GenoVector() noexcept {
-			clean();
-		}
 };
 
 template <typename T>
-GenoVector<3, T> operator-(const GenoVector<3, T> & vector) {
-	return {
-		-vector.v[0],
-		-vector.v[1],
-		-vector.v[2]
-	};
+constexpr GenoVectorNegate<3, T, GenoVector<3, T>> operator-(const GenoVector<3, T> & vector) {
+	return { vector };
 }
 
 template <typename T>
-GenoVector<3, T> operator+(const GenoVector<3, T> & left, const GenoVector<3, T> & right) {
-	return {
-		left.v[0] + right.v[0],
-		left.v[1] + right.v[1],
-		left.v[2] + right.v[2]
-	};
+constexpr GenoVectorPair<3, T, GenoVectorExpressions::Add> operator+(const GenoVector<3, T> & left, const GenoVector<3, T> & right) {
+	return { left, right };
 }
 
 template <typename T>
-GenoVector<3, T> operator-(const GenoVector<3, T> & left, const GenoVector<3, T> & right) {
-	return {
-		left.v[0] - right.v[0],
-		left.v[1] - right.v[1],
-		left.v[2] - right.v[2]
-	};
+constexpr GenoVectorPair<3, T, GenoVectorExpressions::Subtract> operator-(const GenoVector<3, T> & left, const GenoVector<3, T> & right) {
+	return { left, right };
 }
 
 template <typename T>
-GenoVector<3, T> operator*(T left, const GenoVector<3, T> & right) {
-	return {
-		left * right.v[0],
-		left * right.v[1],
-		left * right.v[2]
-	};
+constexpr GenoVectorPreScaled<3, T> operator*(T left, const GenoVector<3, T> & right) {
+	return { { left }, right };
 }
 
 template <typename T>
-GenoVector<3, T> operator*(const GenoVector<3, T> & left, T right) {
-	return {
-		left.v[0] * right,
-		left.v[1] * right,
-		left.v[2] * right
-	};
+constexpr GenoVectorScaled<3, T, GenoVectorExpressions::Multiply> operator*(const GenoVector<3, T> & left, T right) {
+	return { left, { right } };
 }
 
 template <typename T>
-GenoVector<3, T> operator*(const GenoVector<3, T> & left, const GenoVector<3, T> & right) {
-	return {
-		left.v[0] * right.v[0],
-		left.v[1] * right.v[1],
-		left.v[2] * right.v[2]
-	};
+constexpr GenoVectorPair<3, T, GenoVectorExpressions::Multiply> operator*(const GenoVector<3, T> & left, const GenoVector<3, T> & right) {
+	return { left, right };
 }
 
 template <typename T>
-GenoVector<3, T> operator/(const GenoVector<3, T> & left, T right) {
-	return {
-		left.v[0] / right,
-		left.v[1] / right,
-		left.v[2] / right
-	};
+constexpr GenoVectorScaled<3, T, GenoVectorExpressions::Divide> operator/(const GenoVector<3, T> & left, T right) {
+	return { left, { right } };
 }
 
 template <typename T>
-GenoVector<3, T> operator/(const GenoVector<3, T> & left, const GenoVector<3, T> & right) {
-	return {
-		left.v[0] / right.v[0],
-		left.v[1] / right.v[1],
-		left.v[2] / right.v[2]
-	};
+constexpr GenoVectorPair<3, T, GenoVectorExpressions::Divide> operator/(const GenoVector<3, T> & left, const GenoVector<3, T> & right) {
+	return { left, right };
 }
 
 template <typename T>
-GenoVector<4, T> operator|(T left, const GenoVector<3, T> & right) {
+constexpr GenoVector<4, T> operator|(T left, const GenoVector<3, T> & right) {
 	return {
 		left,
 		right.v[0],
@@ -1496,7 +1523,7 @@ GenoVector<4, T> operator|(T left, const GenoVector<3, T> & right) {
 }
 
 template <typename T>
-GenoVector<4, T> operator|(const GenoVector<3, T> & left, T right) {
+constexpr GenoVector<4, T> operator|(const GenoVector<3, T> & left, T right) {
 	return {
 		left.v[0],
 		left.v[1],
@@ -1544,7 +1571,45 @@ GenoVector<3, T> & normalize(const GenoVector<3, T> & vector, GenoVector<3, T> &
 }
 
 template <typename T>
-GenoVector<3, T> negate(const GenoVector<3, T> & vector) {
+GenoVector<3, T> fastSetLength(const GenoVector<3, T> & vector, T length) {
+	auto scalar = length * fastInverseSqrt(vector.getLengthSquared());
+	return {
+		vector.v[0] * scalar,
+		vector.v[1] * scalar,
+		vector.v[2] * scalar
+	};
+}
+
+template <typename T>
+GenoVector<3, T> & fastSetLength(const GenoVector<3, T> & vector, T length, GenoVector<3, T> & target) {
+	auto scalar = length * fastInverseSqrt(vector.getLengthSquared());
+	target.v[0] = vector.v[0] * scalar;
+	target.v[1] = vector.v[1] * scalar;
+	target.v[2] = vector.v[2] * scalar;
+	return target;
+}
+
+template <typename T>
+GenoVector<3, T> fastNormalize(const GenoVector<3, T> & vector) {
+	auto scalar = fastInverseSqrt(vector.getLengthSquared());
+	return {
+		vector.v[0] * scalar,
+		vector.v[1] * scalar,
+		vector.v[2] * scalar
+	};
+}
+
+template <typename T>
+GenoVector<3, T> & fastNormalize(const GenoVector<3, T> & vector, GenoVector<3, T> & target) {
+	auto scalar = fastInverseSqrt(vector.getLengthSquared());
+	target.v[0] = vector.v[0] * scalar;
+	target.v[1] = vector.v[1] * scalar;
+	target.v[2] = vector.v[2] * scalar;
+	return target;
+}
+
+template <typename T>
+constexpr GenoVector<3, T> negate(const GenoVector<3, T> & vector) {
 	return {
 		-vector.v[0],
 		-vector.v[1],
@@ -1553,7 +1618,7 @@ GenoVector<3, T> negate(const GenoVector<3, T> & vector) {
 }
 
 template <typename T>
-GenoVector<3, T> & negate(const GenoVector<3, T> & vector, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> & negate(const GenoVector<3, T> & vector, GenoVector<3, T> & target) {
 	target.v[0] = -vector.v[0];
 	target.v[1] = -vector.v[1];
 	target.v[2] = -vector.v[2];
@@ -1561,7 +1626,7 @@ GenoVector<3, T> & negate(const GenoVector<3, T> & vector, GenoVector<3, T> & ta
 }
 
 template <typename T>
-T dot(const GenoVector<3, T> & left, const GenoVector<3, T> & right) {
+constexpr T dot(const GenoVector<3, T> & left, const GenoVector<3, T> & right) {
 	return (
 		left.v[0] * right.v[0] +
 		left.v[1] * right.v[1] +
@@ -1570,7 +1635,7 @@ T dot(const GenoVector<3, T> & left, const GenoVector<3, T> & right) {
 }
 
 template <typename T>
-GenoVector<3, T> project(const GenoVector<3, T> & vector, const GenoVector<3, T> & projection) {
+constexpr GenoVector<3, T> project(const GenoVector<3, T> & vector, const GenoVector<3, T> & projection) {
 	auto scalar = dot(vector, projection) / projection.getLengthSquared();
 	return {
 		scalar * projection.v[0],
@@ -1580,7 +1645,7 @@ GenoVector<3, T> project(const GenoVector<3, T> & vector, const GenoVector<3, T>
 }
 
 template <typename T>
-GenoVector<3, T> & project(const GenoVector<3, T> & vector, const GenoVector<3, T> & projection, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> & project(const GenoVector<3, T> & vector, const GenoVector<3, T> & projection, GenoVector<3, T> & target) {
 	auto scalar = dot(vector, projection) / projection.getLengthSquared();
 	target.v[0] = scalar * projection.v[0];
 	target.v[1] = scalar * projection.v[1];
@@ -1589,7 +1654,7 @@ GenoVector<3, T> & project(const GenoVector<3, T> & vector, const GenoVector<3,
 }
 
 template <typename T>
-GenoVector<3, T> lerp(const GenoVector<3, T> & start, const GenoVector<3, T> & end, double interpAmount) {
+constexpr GenoVector<3, T> lerp(const GenoVector<3, T> & start, const GenoVector<3, T> & end, double interpAmount) {
 	return {
 		(T) (start.v[0] + (end.v[0] - start.v[0]) * interpAmount),
 		(T) (start.v[1] + (end.v[1] - start.v[1]) * interpAmount),
@@ -1598,7 +1663,7 @@ GenoVector<3, T> lerp(const GenoVector<3, T> & start, const GenoVector<3, T> & e
 }
 
 template <typename T>
-GenoVector<3, T> & lerp(const GenoVector<3, T> & start, const GenoVector<3, T> & end, double interpAmount, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> & lerp(const GenoVector<3, T> & start, const GenoVector<3, T> & end, double interpAmount, GenoVector<3, T> & target) {
 	target.v[0] = (T) (start.v[0] + (end.v[0] - start.v[0]) * interpAmount);
 	target.v[1] = (T) (start.v[1] + (end.v[1] - start.v[1]) * interpAmount);
 	target.v[2] = (T) (start.v[2] + (end.v[2] - start.v[2]) * interpAmount);
@@ -1606,7 +1671,7 @@ GenoVector<3, T> & lerp(const GenoVector<3, T> & start, const GenoVector<3, T> &
 }
 
 template <typename T>
-GenoVector<3, T> cross(const GenoVector<3, T> & vector, const GenoVector<3, T> & cross) {
+constexpr GenoVector<3, T> cross(const GenoVector<3, T> & vector, const GenoVector<3, T> & cross) {
 	return {
 		vector.v[1] * cross.v[2] - vector.v[2] * cross.v[1],
 		vector.v[2] * cross.v[0] - vector.v[0] * cross.v[2],
@@ -1615,7 +1680,7 @@ GenoVector<3, T> cross(const GenoVector<3, T> & vector, const GenoVector<3, T> &
 }
 
 template <typename T>
-GenoVector<3, T> & cross(const GenoVector<3, T> & vector, const GenoVector<3, T> & cross, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> & cross(const GenoVector<3, T> & vector, const GenoVector<3, T> & cross, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[1] * cross.v[2] - vector.v[2] * cross.v[1];
 	target.v[1] = vector.v[2] * cross.v[0] - vector.v[0] * cross.v[2];
 	target.v[2] = vector.v[0] * cross.v[1] - vector.v[1] * cross.v[0];
@@ -1623,7 +1688,7 @@ GenoVector<3, T> & cross(const GenoVector<3, T> & vector, const GenoVector<3, T>
 }
 
 template <typename T>
-GenoVector<3, T> translate(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<3, T> translate(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0]	+ translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -1632,7 +1697,7 @@ GenoVector<3, T> translate(const GenoVector<3, T> & vector, const GenoVector<3,
 }
 
 template <typename T>
-GenoVector<3, T> & translate(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> & translate(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -1640,7 +1705,7 @@ GenoVector<3, T> & translate(const GenoVector<3, T> & vector, const GenoVector<3
 }
 
 template <typename T>
-GenoVector<3, T> scale(const GenoVector<3, T> & vector, T scale) {
+constexpr GenoVector<3, T> scale(const GenoVector<3, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale,
@@ -1649,7 +1714,7 @@ GenoVector<3, T> scale(const GenoVector<3, T> & vector, T scale) {
 }
 
 template <typename T>
-GenoVector<3, T> & scale(const GenoVector<3, T> & vector, T scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> & scale(const GenoVector<3, T> & vector, T scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2] * scale;
@@ -1657,7 +1722,7 @@ GenoVector<3, T> & scale(const GenoVector<3, T> & vector, T scale, GenoVector<3,
 }
 
 template <typename T>
-GenoVector<3, T> scale(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<3, T> scale(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -1666,7 +1731,7 @@ GenoVector<3, T> scale(const GenoVector<3, T> & vector, const GenoVector<3, T> &
 }
 
 template <typename T>
-GenoVector<3, T> & scale(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> & scale(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -1674,7 +1739,7 @@ GenoVector<3, T> & scale(const GenoVector<3, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<3, T> setX(const GenoVector<3, T> & vector, T x) {
+constexpr GenoVector<3, T> setX(const GenoVector<3, T> & vector, T x) {
 	return {
 		x,
 		vector.v[1],
@@ -1683,7 +1748,7 @@ GenoVector<3, T> setX(const GenoVector<3, T> & vector, T x) {
 }
 
 template<typename T>
-GenoVector<3, T> setY(const GenoVector<3, T> & vector, T y) {
+constexpr GenoVector<3, T> setY(const GenoVector<3, T> & vector, T y) {
 	return {
 		vector.v[0],
 		y,
@@ -1692,7 +1757,7 @@ GenoVector<3, T> setY(const GenoVector<3, T> & vector, T y) {
 }
 
 template<typename T>
-GenoVector<3, T> setZ(const GenoVector<3, T> & vector, T z) {
+constexpr GenoVector<3, T> setZ(const GenoVector<3, T> & vector, T z) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -1701,7 +1766,7 @@ GenoVector<3, T> setZ(const GenoVector<3, T> & vector, T z) {
 }
 
 template<typename T>
-GenoVector<3, T> setXY(const GenoVector<3, T> & vector, T x, T y) {
+constexpr GenoVector<3, T> setXY(const GenoVector<3, T> & vector, T x, T y) {
 	return {
 		x,
 		y,
@@ -1710,7 +1775,7 @@ GenoVector<3, T> setXY(const GenoVector<3, T> & vector, T x, T y) {
 }
 
 template<typename T>
-GenoVector<3, T> setXY(const GenoVector<3, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<3, T> setXY(const GenoVector<3, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		   set.v[0],
 		   set.v[1],
@@ -1719,7 +1784,7 @@ GenoVector<3, T> setXY(const GenoVector<3, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<3, T> setXZ(const GenoVector<3, T> & vector, T x, T z) {
+constexpr GenoVector<3, T> setXZ(const GenoVector<3, T> & vector, T x, T z) {
 	return {
 		x,
 		vector.v[1],
@@ -1728,7 +1793,7 @@ GenoVector<3, T> setXZ(const GenoVector<3, T> & vector, T x, T z) {
 }
 
 template<typename T>
-GenoVector<3, T> setXZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<3, T> setXZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		   set.v[0],
 		vector.v[1],
@@ -1737,7 +1802,7 @@ GenoVector<3, T> setXZ(const GenoVector<3, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<3, T> setYX(const GenoVector<3, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<3, T> setYX(const GenoVector<3, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		   set.v[1],
 		   set.v[0],
@@ -1746,7 +1811,7 @@ GenoVector<3, T> setYX(const GenoVector<3, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<3, T> setYZ(const GenoVector<3, T> & vector, T y, T z) {
+constexpr GenoVector<3, T> setYZ(const GenoVector<3, T> & vector, T y, T z) {
 	return {
 		vector.v[0],
 		y,
@@ -1755,7 +1820,7 @@ GenoVector<3, T> setYZ(const GenoVector<3, T> & vector, T y, T z) {
 }
 
 template<typename T>
-GenoVector<3, T> setYZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<3, T> setYZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[0],
@@ -1764,7 +1829,7 @@ GenoVector<3, T> setYZ(const GenoVector<3, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<3, T> setZX(const GenoVector<3, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<3, T> setZX(const GenoVector<3, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		   set.v[1],
 		vector.v[1],
@@ -1773,7 +1838,7 @@ GenoVector<3, T> setZX(const GenoVector<3, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<3, T> setZY(const GenoVector<3, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<3, T> setZY(const GenoVector<3, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[1],
@@ -1782,7 +1847,7 @@ GenoVector<3, T> setZY(const GenoVector<3, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<3, T> setX(const GenoVector<3, T> & vector, T x, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> setX(const GenoVector<3, T> & vector, T x, GenoVector<3, T> & target) {
 	target.v[0] = x;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -1790,7 +1855,7 @@ GenoVector<3, T> setX(const GenoVector<3, T> & vector, T x, GenoVector<3, T> & t
 }
 
 template<typename T>
-GenoVector<3, T> setY(const GenoVector<3, T> & vector, T y, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> setY(const GenoVector<3, T> & vector, T y, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = y;
 	target.v[2] = vector.v[2];
@@ -1798,7 +1863,7 @@ GenoVector<3, T> setY(const GenoVector<3, T> & vector, T y, GenoVector<3, T> & t
 }
 
 template<typename T>
-GenoVector<3, T> setZ(const GenoVector<3, T> & vector, T z, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> setZ(const GenoVector<3, T> & vector, T z, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = z;
@@ -1806,7 +1871,7 @@ GenoVector<3, T> setZ(const GenoVector<3, T> & vector, T z, GenoVector<3, T> & t
 }
 
 template<typename T>
-GenoVector<3, T> setXY(const GenoVector<3, T> & vector, T x, T y, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> setXY(const GenoVector<3, T> & vector, T x, T y, GenoVector<3, T> & target) {
 	target.v[0] = x;
 	target.v[1] = y;
 	target.v[2] = vector.v[2];
@@ -1814,7 +1879,7 @@ GenoVector<3, T> setXY(const GenoVector<3, T> & vector, T x, T y, GenoVector<3,
 }
 
 template<typename T>
-GenoVector<3, T> setXY(const GenoVector<3, T> & vector, const GenoVector<2, T> & set, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> setXY(const GenoVector<3, T> & vector, const GenoVector<2, T> & set, GenoVector<3, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] = vector.v[2];
@@ -1822,7 +1887,7 @@ GenoVector<3, T> setXY(const GenoVector<3, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<3, T> setXZ(const GenoVector<3, T> & vector, T x, T z, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> setXZ(const GenoVector<3, T> & vector, T x, T z, GenoVector<3, T> & target) {
 	target.v[0] = x;
 	target.v[1] = vector.v[1];
 	target.v[2] = z;
@@ -1830,7 +1895,7 @@ GenoVector<3, T> setXZ(const GenoVector<3, T> & vector, T x, T z, GenoVector<3,
 }
 
 template<typename T>
-GenoVector<3, T> setXZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & set, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> setXZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & set, GenoVector<3, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[1];
@@ -1838,7 +1903,7 @@ GenoVector<3, T> setXZ(const GenoVector<3, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<3, T> setYX(const GenoVector<3, T> & vector, const GenoVector<2, T> & set, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> setYX(const GenoVector<3, T> & vector, const GenoVector<2, T> & set, GenoVector<3, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] =    set.v[0];
 	target.v[2] = vector.v[2];
@@ -1846,7 +1911,7 @@ GenoVector<3, T> setYX(const GenoVector<3, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<3, T> setYZ(const GenoVector<3, T> & vector, T y, T z, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> setYZ(const GenoVector<3, T> & vector, T y, T z, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = y;
 	target.v[2] = z;
@@ -1854,7 +1919,7 @@ GenoVector<3, T> setYZ(const GenoVector<3, T> & vector, T y, T z, GenoVector<3,
 }
 
 template<typename T>
-GenoVector<3, T> setYZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & set, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> setYZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & set, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[0];
 	target.v[2] =    set.v[1];
@@ -1862,7 +1927,7 @@ GenoVector<3, T> setYZ(const GenoVector<3, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<3, T> setZX(const GenoVector<3, T> & vector, const GenoVector<2, T> & set, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> setZX(const GenoVector<3, T> & vector, const GenoVector<2, T> & set, GenoVector<3, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[0];
@@ -1870,7 +1935,7 @@ GenoVector<3, T> setZX(const GenoVector<3, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<3, T> setZY(const GenoVector<3, T> & vector, const GenoVector<2, T> & set, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> setZY(const GenoVector<3, T> & vector, const GenoVector<2, T> & set, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] =    set.v[0];
@@ -1878,7 +1943,7 @@ GenoVector<3, T> setZY(const GenoVector<3, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<3, T> translateX(const GenoVector<3, T> & vector, T translateX) {
+constexpr GenoVector<3, T> translateX(const GenoVector<3, T> & vector, T translateX) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1],
@@ -1887,7 +1952,7 @@ GenoVector<3, T> translateX(const GenoVector<3, T> & vector, T translateX) {
 }
 
 template<typename T>
-GenoVector<3, T> translateY(const GenoVector<3, T> & vector, T translateY) {
+constexpr GenoVector<3, T> translateY(const GenoVector<3, T> & vector, T translateY) {
 	return {
 		vector.v[0],
 		vector.v[1] + translateY,
@@ -1896,7 +1961,7 @@ GenoVector<3, T> translateY(const GenoVector<3, T> & vector, T translateY) {
 }
 
 template<typename T>
-GenoVector<3, T> translateZ(const GenoVector<3, T> & vector, T translateZ) {
+constexpr GenoVector<3, T> translateZ(const GenoVector<3, T> & vector, T translateZ) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -1905,7 +1970,7 @@ GenoVector<3, T> translateZ(const GenoVector<3, T> & vector, T translateZ) {
 }
 
 template<typename T>
-GenoVector<3, T> translateXY(const GenoVector<3, T> & vector, T translateX, T translateY) {
+constexpr GenoVector<3, T> translateXY(const GenoVector<3, T> & vector, T translateX, T translateY) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1] + translateY,
@@ -1914,7 +1979,7 @@ GenoVector<3, T> translateXY(const GenoVector<3, T> & vector, T translateX, T tr
 }
 
 template<typename T>
-GenoVector<3, T> translateXY(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<3, T> translateXY(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -1923,7 +1988,7 @@ GenoVector<3, T> translateXY(const GenoVector<3, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<3, T> translateXZ(const GenoVector<3, T> & vector, T translateX, T translateZ) {
+constexpr GenoVector<3, T> translateXZ(const GenoVector<3, T> & vector, T translateX, T translateZ) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1],
@@ -1932,7 +1997,7 @@ GenoVector<3, T> translateXZ(const GenoVector<3, T> & vector, T translateX, T tr
 }
 
 template<typename T>
-GenoVector<3, T> translateXZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<3, T> translateXZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1],
@@ -1941,7 +2006,7 @@ GenoVector<3, T> translateXZ(const GenoVector<3, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<3, T> translateYX(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<3, T> translateYX(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[0],
@@ -1950,7 +2015,7 @@ GenoVector<3, T> translateYX(const GenoVector<3, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<3, T> translateYZ(const GenoVector<3, T> & vector, T translateY, T translateZ) {
+constexpr GenoVector<3, T> translateYZ(const GenoVector<3, T> & vector, T translateY, T translateZ) {
 	return {
 		vector.v[0],
 		vector.v[1] + translateY,
@@ -1959,7 +2024,7 @@ GenoVector<3, T> translateYZ(const GenoVector<3, T> & vector, T translateY, T tr
 }
 
 template<typename T>
-GenoVector<3, T> translateYZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<3, T> translateYZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[0],
@@ -1968,7 +2033,7 @@ GenoVector<3, T> translateYZ(const GenoVector<3, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<3, T> translateZX(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<3, T> translateZX(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1],
@@ -1977,7 +2042,7 @@ GenoVector<3, T> translateZX(const GenoVector<3, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<3, T> translateZY(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<3, T> translateZY(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[1],
@@ -1986,7 +2051,7 @@ GenoVector<3, T> translateZY(const GenoVector<3, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<3, T> translateXYZ(const GenoVector<3, T> & vector, T translateX, T translateY, T translateZ) {
+constexpr GenoVector<3, T> translateXYZ(const GenoVector<3, T> & vector, T translateX, T translateY, T translateZ) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1] + translateY,
@@ -1995,7 +2060,7 @@ GenoVector<3, T> translateXYZ(const GenoVector<3, T> & vector, T translateX, T t
 }
 
 template<typename T>
-GenoVector<3, T> translateXYZ(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<3, T> translateXYZ(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -2004,7 +2069,7 @@ GenoVector<3, T> translateXYZ(const GenoVector<3, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<3, T> translateXZY(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<3, T> translateXZY(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[2],
@@ -2013,7 +2078,7 @@ GenoVector<3, T> translateXZY(const GenoVector<3, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<3, T> translateYXZ(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<3, T> translateYXZ(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[0],
@@ -2022,7 +2087,7 @@ GenoVector<3, T> translateYXZ(const GenoVector<3, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<3, T> translateYZX(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<3, T> translateYZX(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[0],
@@ -2031,7 +2096,7 @@ GenoVector<3, T> translateYZX(const GenoVector<3, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<3, T> translateZXY(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<3, T> translateZXY(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[2],
@@ -2040,7 +2105,7 @@ GenoVector<3, T> translateZXY(const GenoVector<3, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<3, T> translateZYX(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<3, T> translateZYX(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[1],
@@ -2049,7 +2114,7 @@ GenoVector<3, T> translateZYX(const GenoVector<3, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<3, T> translateX(const GenoVector<3, T> & vector, T translateX, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateX(const GenoVector<3, T> & vector, T translateX, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -2057,7 +2122,7 @@ GenoVector<3, T> translateX(const GenoVector<3, T> & vector, T translateX, GenoV
 }
 
 template<typename T>
-GenoVector<3, T> translateY(const GenoVector<3, T> & vector, T translateY, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateY(const GenoVector<3, T> & vector, T translateY, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2];
@@ -2065,7 +2130,7 @@ GenoVector<3, T> translateY(const GenoVector<3, T> & vector, T translateY, GenoV
 }
 
 template<typename T>
-GenoVector<3, T> translateZ(const GenoVector<3, T> & vector, T translateZ, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateZ(const GenoVector<3, T> & vector, T translateZ, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translateZ;
@@ -2073,7 +2138,7 @@ GenoVector<3, T> translateZ(const GenoVector<3, T> & vector, T translateZ, GenoV
 }
 
 template<typename T>
-GenoVector<3, T> translateXY(const GenoVector<3, T> & vector, T translateX, T translateY, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateXY(const GenoVector<3, T> & vector, T translateX, T translateY, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2];
@@ -2081,7 +2146,7 @@ GenoVector<3, T> translateXY(const GenoVector<3, T> & vector, T translateX, T tr
 }
 
 template<typename T>
-GenoVector<3, T> translateXY(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateXY(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2];
@@ -2089,7 +2154,7 @@ GenoVector<3, T> translateXY(const GenoVector<3, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<3, T> translateXZ(const GenoVector<3, T> & vector, T translateX, T translateZ, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateXZ(const GenoVector<3, T> & vector, T translateX, T translateZ, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translateZ;
@@ -2097,7 +2162,7 @@ GenoVector<3, T> translateXZ(const GenoVector<3, T> & vector, T translateX, T tr
 }
 
 template<typename T>
-GenoVector<3, T> translateXZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateXZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -2105,7 +2170,7 @@ GenoVector<3, T> translateXZ(const GenoVector<3, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<3, T> translateYX(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateYX(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2];
@@ -2113,7 +2178,7 @@ GenoVector<3, T> translateYX(const GenoVector<3, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<3, T> translateYZ(const GenoVector<3, T> & vector, T translateY, T translateZ, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateYZ(const GenoVector<3, T> & vector, T translateY, T translateZ, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2] + translateZ;
@@ -2121,7 +2186,7 @@ GenoVector<3, T> translateYZ(const GenoVector<3, T> & vector, T translateY, T tr
 }
 
 template<typename T>
-GenoVector<3, T> translateYZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateYZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -2129,7 +2194,7 @@ GenoVector<3, T> translateYZ(const GenoVector<3, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<3, T> translateZX(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateZX(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -2137,7 +2202,7 @@ GenoVector<3, T> translateZX(const GenoVector<3, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<3, T> translateZY(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateZY(const GenoVector<3, T> & vector, const GenoVector<2, T> & translate, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -2145,7 +2210,7 @@ GenoVector<3, T> translateZY(const GenoVector<3, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<3, T> translateXYZ(const GenoVector<3, T> & vector, T translateX, T translateY, T translateZ, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateXYZ(const GenoVector<3, T> & vector, T translateX, T translateY, T translateZ, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2] + translateZ;
@@ -2153,7 +2218,7 @@ GenoVector<3, T> translateXYZ(const GenoVector<3, T> & vector, T translateX, T t
 }
 
 template<typename T>
-GenoVector<3, T> translateXYZ(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateXYZ(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -2161,7 +2226,7 @@ GenoVector<3, T> translateXYZ(const GenoVector<3, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<3, T> translateXZY(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateXZY(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -2169,7 +2234,7 @@ GenoVector<3, T> translateXZY(const GenoVector<3, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<3, T> translateYXZ(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateYXZ(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -2177,7 +2242,7 @@ GenoVector<3, T> translateYXZ(const GenoVector<3, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<3, T> translateYZX(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateYZX(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -2185,7 +2250,7 @@ GenoVector<3, T> translateYZX(const GenoVector<3, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<3, T> translateZXY(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateZXY(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -2193,7 +2258,7 @@ GenoVector<3, T> translateZXY(const GenoVector<3, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<3, T> translateZYX(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> translateZYX(const GenoVector<3, T> & vector, const GenoVector<3, T> & translate, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -2692,7 +2757,7 @@ GenoVector<3, T> & rotateZYX(const GenoVector<3, T> & vector, const GenoVector<3
 }
 
 template<typename T>
-GenoVector<3, T> scaleX(const GenoVector<3, T> & vector, T scaleX) {
+constexpr GenoVector<3, T> scaleX(const GenoVector<3, T> & vector, T scaleX) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1],
@@ -2701,7 +2766,7 @@ GenoVector<3, T> scaleX(const GenoVector<3, T> & vector, T scaleX) {
 }
 
 template<typename T>
-GenoVector<3, T> scaleY(const GenoVector<3, T> & vector, T scaleY) {
+constexpr GenoVector<3, T> scaleY(const GenoVector<3, T> & vector, T scaleY) {
 	return {
 		vector.v[0],
 		vector.v[1] * scaleY,
@@ -2710,7 +2775,7 @@ GenoVector<3, T> scaleY(const GenoVector<3, T> & vector, T scaleY) {
 }
 
 template<typename T>
-GenoVector<3, T> scaleZ(const GenoVector<3, T> & vector, T scaleZ) {
+constexpr GenoVector<3, T> scaleZ(const GenoVector<3, T> & vector, T scaleZ) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -2719,7 +2784,7 @@ GenoVector<3, T> scaleZ(const GenoVector<3, T> & vector, T scaleZ) {
 }
 
 template<typename T>
-GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, T scale) {
+constexpr GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale,
@@ -2728,7 +2793,7 @@ GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, T scale) {
 }
 
 template<typename T>
-GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, T scaleX, T scaleY) {
+constexpr GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, T scaleX, T scaleY) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1] * scaleY,
@@ -2737,7 +2802,7 @@ GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, T scaleX, T scaleY) {
 }
 
 template<typename T>
-GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -2746,7 +2811,7 @@ GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, T scale) {
+constexpr GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1],
@@ -2755,7 +2820,7 @@ GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, T scale) {
 }
 
 template<typename T>
-GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, T scaleX, T scaleZ) {
+constexpr GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, T scaleX, T scaleZ) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1],
@@ -2764,7 +2829,7 @@ GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, T scaleX, T scaleZ) {
 }
 
 template<typename T>
-GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1],
@@ -2773,7 +2838,7 @@ GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<3, T> scaleYX(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<3, T> scaleYX(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[0],
@@ -2782,7 +2847,7 @@ GenoVector<3, T> scaleYX(const GenoVector<3, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, T scale) {
+constexpr GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, T scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale,
@@ -2791,7 +2856,7 @@ GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, T scale) {
 }
 
 template<typename T>
-GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, T scaleY, T scaleZ) {
+constexpr GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, T scaleY, T scaleZ) {
 	return {
 		vector.v[0],
 		vector.v[1] * scaleY,
@@ -2800,7 +2865,7 @@ GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, T scaleY, T scaleZ) {
 }
 
 template<typename T>
-GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[0],
@@ -2809,7 +2874,7 @@ GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<3, T> scaleZX(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<3, T> scaleZX(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1],
@@ -2818,7 +2883,7 @@ GenoVector<3, T> scaleZX(const GenoVector<3, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<3, T> scaleZY(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<3, T> scaleZY(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[1],
@@ -2827,7 +2892,7 @@ GenoVector<3, T> scaleZY(const GenoVector<3, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, T scale) {
+constexpr GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale,
@@ -2836,7 +2901,7 @@ GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, T scale) {
 }
 
 template<typename T>
-GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, T scaleX, T scaleY, T scaleZ) {
+constexpr GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, T scaleX, T scaleY, T scaleZ) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1] * scaleY,
@@ -2845,7 +2910,7 @@ GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, T scaleX, T scaleY, T
 }
 
 template<typename T>
-GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -2854,7 +2919,7 @@ GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<3, T> scaleXZY(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<3, T> scaleXZY(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[2],
@@ -2863,7 +2928,7 @@ GenoVector<3, T> scaleXZY(const GenoVector<3, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<3, T> scaleYXZ(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<3, T> scaleYXZ(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[0],
@@ -2872,7 +2937,7 @@ GenoVector<3, T> scaleYXZ(const GenoVector<3, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<3, T> scaleYZX(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<3, T> scaleYZX(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[0],
@@ -2881,7 +2946,7 @@ GenoVector<3, T> scaleYZX(const GenoVector<3, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<3, T> scaleZXY(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<3, T> scaleZXY(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[2],
@@ -2890,7 +2955,7 @@ GenoVector<3, T> scaleZXY(const GenoVector<3, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<3, T> scaleZYX(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<3, T> scaleZYX(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[1],
@@ -2899,7 +2964,7 @@ GenoVector<3, T> scaleZYX(const GenoVector<3, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<3, T> scaleX(const GenoVector<3, T> & vector, T scaleX, const GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleX(const GenoVector<3, T> & vector, T scaleX, const GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -2907,7 +2972,7 @@ GenoVector<3, T> scaleX(const GenoVector<3, T> & vector, T scaleX, const GenoVec
 }
 
 template<typename T>
-GenoVector<3, T> scaleY(const GenoVector<3, T> & vector, T scaleY, const GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleY(const GenoVector<3, T> & vector, T scaleY, const GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2];
@@ -2915,7 +2980,7 @@ GenoVector<3, T> scaleY(const GenoVector<3, T> & vector, T scaleY, const GenoVec
 }
 
 template<typename T>
-GenoVector<3, T> scaleZ(const GenoVector<3, T> & vector, T scaleZ, const GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleZ(const GenoVector<3, T> & vector, T scaleZ, const GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scaleZ;
@@ -2923,7 +2988,7 @@ GenoVector<3, T> scaleZ(const GenoVector<3, T> & vector, T scaleZ, const GenoVec
 }
 
 template<typename T>
-GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, T scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, T scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2];
@@ -2931,7 +2996,7 @@ GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, T scale, GenoVector<3,
 }
 
 template<typename T>
-GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, T scaleX, T scaleY, const GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, T scaleX, T scaleY, const GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2];
@@ -2939,7 +3004,7 @@ GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, T scaleX, T scaleY, co
 }
 
 template<typename T>
-GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2];
@@ -2947,7 +3012,7 @@ GenoVector<3, T> scaleXY(const GenoVector<3, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, T scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, T scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale;
@@ -2955,7 +3020,7 @@ GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, T scale, GenoVector<3,
 }
 
 template<typename T>
-GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, T scaleX, T scaleZ, const GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, T scaleX, T scaleZ, const GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scaleZ;
@@ -2963,7 +3028,7 @@ GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, T scaleX, T scaleZ, co
 }
 
 template<typename T>
-GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -2971,7 +3036,7 @@ GenoVector<3, T> scaleXZ(const GenoVector<3, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<3, T> scaleYX(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleYX(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2];
@@ -2979,7 +3044,7 @@ GenoVector<3, T> scaleYX(const GenoVector<3, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, T scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, T scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2] * scale;
@@ -2987,7 +3052,7 @@ GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, T scale, GenoVector<3,
 }
 
 template<typename T>
-GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, T scaleY, T scaleZ, const GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, T scaleY, T scaleZ, const GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2] * scaleZ;
@@ -2995,7 +3060,7 @@ GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, T scaleY, T scaleZ, co
 }
 
 template<typename T>
-GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -3003,7 +3068,7 @@ GenoVector<3, T> scaleYZ(const GenoVector<3, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<3, T> scaleZX(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleZX(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -3011,7 +3076,7 @@ GenoVector<3, T> scaleZX(const GenoVector<3, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<3, T> scaleZY(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleZY(const GenoVector<3, T> & vector, const GenoVector<2, T> & scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -3019,7 +3084,7 @@ GenoVector<3, T> scaleZY(const GenoVector<3, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, T scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, T scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2] * scale;
@@ -3027,7 +3092,7 @@ GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, T scale, GenoVector<3
 }
 
 template<typename T>
-GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, T scaleX, T scaleY, T scaleZ, const GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, T scaleX, T scaleY, T scaleZ, const GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2] * scaleZ;
@@ -3035,7 +3100,7 @@ GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, T scaleX, T scaleY, T
 }
 
 template<typename T>
-GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -3043,7 +3108,7 @@ GenoVector<3, T> scaleXYZ(const GenoVector<3, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<3, T> scaleXZY(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleXZY(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -3051,7 +3116,7 @@ GenoVector<3, T> scaleXZY(const GenoVector<3, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<3, T> scaleYXZ(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleYXZ(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -3059,7 +3124,7 @@ GenoVector<3, T> scaleYXZ(const GenoVector<3, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<3, T> scaleYZX(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleYZX(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -3067,7 +3132,7 @@ GenoVector<3, T> scaleYZX(const GenoVector<3, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<3, T> scaleZXY(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleZXY(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -3075,7 +3140,7 @@ GenoVector<3, T> scaleZXY(const GenoVector<3, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<3, T> scaleZYX(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale, GenoVector<3, T> & target) {
+constexpr GenoVector<3, T> scaleZYX(const GenoVector<3, T> & vector, const GenoVector<3, T> & scale, GenoVector<3, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -3101,5 +3166,12 @@ using GenoVector3ul = GenoVector3<uint64>;
 using GenoVector3f  = GenoVector3<float >;
 using GenoVector3d  = GenoVector3<double>;
 
+/** Instantiated once in GenoMathInstantiations.cpp, which defines GENO_MATH_INSTANTIATIONS to skip these **/
+#ifndef GENO_MATH_INSTANTIATIONS
+	extern template class GenoVector<3, float >;
+	extern template class GenoVector<3, double>;
+	extern template class GenoVector<3,  int32>;
+#endif // GENO_MATH_INSTANTIATIONS
+
 #define GNARLY_GENOME_VECTOR3_FORWARD
 #endif // GNARLY_GENOME_VECTOR3
\ No newline at end of file
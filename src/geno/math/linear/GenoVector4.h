@@ -56,10 +56,12 @@ class GenoVector<3, T>;
 #include <ostream>
 #include <cmath>
 
+#include "../GenoFastMath.h"
 #include "GenoVector.h"
 #include "GenoVector2.h"
 #include "GenoVector3.h"
 #include "GenoVectorDimensions.h"
+#include "GenoVectorExpression.h"
 
 namespace GenoVectorDimensions {
 	extern GenoVectorDimension<3> w;
@@ -67,54 +69,45 @@ namespace GenoVectorDimensions {
 
 template <typename T>
 class GenoVector<4, T> {
-	private:
-		bool owner = true;
-
-		void clean() {
-			if (owner)
-				delete [] v;
-		}
-
 	public:
-		T * v;
-
-		GenoVector() :
-			v(new T[4]()) {}
+		T v[4];
 
-		GenoVector(T * v, bool owner = true) noexcept :
-			owner(owner),
-			v(v) {}
+		constexpr GenoVector() :
+			v() {}
 
-		explicit GenoVector(T value) :
-			v(new T[4] { value, value, value, value }) {}
+		explicit constexpr GenoVector(T value) :
+			v { value, value, value, value } {}
 
-		GenoVector(T x, T y, T z, T w) :
-			v(new T[4] { x, y, z, w }) {}
+		constexpr GenoVector(T x, T y, T z, T w) :
+			v { x, y, z, w } {}
 
 		template <typename T2>
-		GenoVector(const GenoVector<4, T2> & vector) :
-			v(new T[4] {
+		constexpr GenoVector(const GenoVector<4, T2> & vector) :
+			v {
 				(T) vector.v[0],
 				(T) vector.v[1],
 				(T) vector.v[2],
 				(T) vector.v[3]
-			}) {}
-
-		GenoVector(const GenoVector<4, T> & vector) :
-			v(new T[4] {
+			} {}
+
+		template <typename E>
+		constexpr GenoVector(const GenoVectorExpression<4, T, E> & expression) :
+			v {
+				expression.get(0),
+				expression.get(1),
+				expression.get(2),
+				expression.get(3)
+			} {}
+
+		constexpr GenoVector(const GenoVector<4, T> & vector) :
+			v {
 				vector.v[0],
 				vector.v[1],
 				vector.v[2],
 				vector.v[3]
-			}) {}
-
-		GenoVector(GenoVector<4, T> && vector) :
-			owner(vector.owner),
-			v(vector.v) {
-			vector.owner = false;
-		}
+			} {}
 
-		GenoVector<4, T> & operator=(const GenoVector<4, T> & vector) {
+		constexpr GenoVector<4, T> & operator=(const GenoVector<4, T> & vector) {
 			v[0] = vector.v[0];
 			v[1] = vector.v[1];
 			v[2] = vector.v[2];
@@ -122,23 +115,34 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & operator=(GenoVector<4, T> && vector) {
-			if (owner) {
-				clean();
-				owner = vector.owner;
-				v = vector.v;
-				vector.owner = false;
-			}
-			else {
-				v[0] = vector.v[0];
-				v[1] = vector.v[1];
-				v[2] = vector.v[2];
-				v[3] = vector.v[3];
-			}
+		template <typename E>
+		constexpr GenoVector<4, T> & operator=(const GenoVectorExpression<4, T, E> & expression) {
+			v[0] = expression.get(0);
+			v[1] = expression.get(1);
+			v[2] = expression.get(2);
+			v[3] = expression.get(3);
+			return *this;
+		}
+
+		template <typename E>
+		constexpr GenoVector<4, T> & operator+=(const GenoVectorExpression<4, T, E> & expression) {
+			v[0] += expression.get(0);
+			v[1] += expression.get(1);
+			v[2] += expression.get(2);
+			v[3] += expression.get(3);
+			return *this;
+		}
+
+		template <typename E>
+		constexpr GenoVector<4, T> & operator-=(const GenoVectorExpression<4, T, E> & expression) {
+			v[0] -= expression.get(0);
+			v[1] -= expression.get(1);
+			v[2] -= expression.get(2);
+			v[3] -= expression.get(3);
 			return *this;
 		}
 
-		GenoVector<4, T> & operator+=(const GenoVector<4, T> & vector) {
+		constexpr GenoVector<4, T> & operator+=(const GenoVector<4, T> & vector) {
 			v[0] += vector.v[0];
 			v[1] += vector.v[1];
 			v[2] += vector.v[2];
@@ -146,7 +150,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & operator-=(const GenoVector<4, T> & vector) {
+		constexpr GenoVector<4, T> & operator-=(const GenoVector<4, T> & vector) {
 			v[0] -= vector.v[0];
 			v[1] -= vector.v[1];
 			v[2] -= vector.v[2];
@@ -154,7 +158,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & operator*=(T scalar) {
+		constexpr GenoVector<4, T> & operator*=(T scalar) {
 			v[0] *= scalar;
 			v[1] *= scalar;
 			v[2] *= scalar;
@@ -162,7 +166,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & operator*=(const GenoVector<4, T> & vector) {
+		constexpr GenoVector<4, T> & operator*=(const GenoVector<4, T> & vector) {
 			v[0] *= vector.v[0];
 			v[1] *= vector.v[1];
 			v[2] *= vector.v[2];
@@ -170,7 +174,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & operator/=(T scalar) {
+		constexpr GenoVector<4, T> & operator/=(T scalar) {
 			v[0] /= scalar;
 			v[1] /= scalar;
 			v[2] /= scalar;
@@ -178,7 +182,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & operator/=(const GenoVector<4, T> & vector) {
+		constexpr GenoVector<4, T> & operator/=(const GenoVector<4, T> & vector) {
 			v[0] /= vector.v[0];
 			v[1] /= vector.v[1];
 			v[2] /= vector.v[2];
@@ -186,55 +190,55 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		T & operator[](uint32 index) noexcept {
+		constexpr T & operator[](uint32 index) noexcept {
 			return v[index];
 		}
 
-		const T & operator[](uint32 index) const noexcept {
+		constexpr const T & operator[](uint32 index) const noexcept {
 			return v[index];
 		}
 		
 		template <uint32 N>
-		T & operator[](const GenoVectorDimensions::GenoVectorDimension<N> & dimension) noexcept {
+		constexpr T & operator[](const GenoVectorDimensions::GenoVectorDimension<N> & dimension) noexcept {
 			static_assert(GenoVectorDimensions::GenoVectorDimension<N>::dimension < 4, "GenoVector<4, T> has no dimension beyond w!");
 			return v[GenoVectorDimensions::GenoVectorDimension<N>::dimension];
 		}
 
 		template <uint32 N>
-		const T & operator[](const GenoVectorDimensions::GenoVectorDimension<N> & dimension) const noexcept {
+		constexpr const T & operator[](const GenoVectorDimensions::GenoVectorDimension<N> & dimension) const noexcept {
 			static_assert(GenoVectorDimensions::GenoVectorDimension<N>::dimension < 4, "GenoVector<4, T> has no dimension beyond w!");
 			return v[GenoVectorDimensions::GenoVectorDimension<N>::dimension];
 		}
 
-		T & x() noexcept {
+		constexpr T & x() noexcept {
 			return v[0];
 		}
 
-		const T & x() const noexcept {
+		constexpr const T & x() const noexcept {
 			return v[0];
 		}
 
-		T & y() noexcept {
+		constexpr T & y() noexcept {
 			return v[1];
 		}
 
-		const T & y() const noexcept {
+		constexpr const T & y() const noexcept {
 			return v[1];
 		}
 
-		T & z() noexcept {
+		constexpr T & z() noexcept {
 			return v[2];
 		}
 
-		const T & z() const noexcept {
+		constexpr const T & z() const noexcept {
 			return v[2];
 		}
 
-		T & w() noexcept {
+		constexpr T & w() noexcept {
 			return v[3];
 		}
 
-		const T & w() const noexcept {
+		constexpr const T & w() const noexcept {
 			return v[3];
 		}
 
@@ -247,7 +251,7 @@ class GenoVector<4, T> {
 			);
 		}
 
-		T getLengthSquared() const {
+		constexpr T getLengthSquared() const {
 			return (
 				v[0] * v[0] +
 				v[1] * v[1] +
@@ -273,8 +277,30 @@ class GenoVector<4, T> {
 			v[3] *= scalar;
 			return *this;
 		}
+
+		T fastGetLength() const {
+			return fastSqrt(getLengthSquared());
+		}
+
+		GenoVector<4, T> & fastSetLength(T length) {
+			auto scalar = length * fastInverseSqrt(getLengthSquared());
+			v[0] *= scalar;
+			v[1] *= scalar;
+			v[2] *= scalar;
+			v[3] *= scalar;
+			return *this;
+		}
+
+		GenoVector<4, T> & fastNormalize() {
+			auto scalar = fastInverseSqrt(getLengthSquared());
+			v[0] *= scalar;
+			v[1] *= scalar;
+			v[2] *= scalar;
+			v[3] *= scalar;
+			return *this;
+		}
 		
-		GenoVector<2, T> & negate() {
+		constexpr GenoVector<4, T> & negate() {
 			v[0] = -v[0];
 			v[1] = -v[1];
 			v[2] = -v[2];
@@ -282,7 +308,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & project(const GenoVector<4, T> & projection) {
+		constexpr GenoVector<4, T> & project(const GenoVector<4, T> & projection) {
 			auto scalar = dot(*this, projection) / projection.getLengthSquared();
 			v[0] /= scalar;
 			v[1] /= scalar;
@@ -295,7 +321,7 @@ class GenoVector<4, T> {
 			return *this = getLength() * vector + *this * vector.getLength();
 		}
 
-		GenoVector<4, T> & lerp(const GenoVector<4, T> & end, double interpAmount) {
+		constexpr GenoVector<4, T> & lerp(const GenoVector<4, T> & end, double interpAmount) {
 			v[0] = (T) (v[0] + (end.v[0] - v[0]) * interpAmount);
 			v[1] = (T) (v[1] + (end.v[1] - v[1]) * interpAmount);
 			v[2] = (T) (v[2] + (end.v[2] - v[2]) * interpAmount);
@@ -303,14 +329,14 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		bool isZeroVector() {
+		constexpr bool isZeroVector() {
 			return v[0] == 0 &&
 			       v[1] == 0 &&
 			       v[2] == 0 &&
 			       v[3] == 0;
 		}
 
-		GenoVector<4, T> & set(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & set(const GenoVector<4, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			v[2] = set.v[2];
@@ -318,7 +344,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & translate(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translate(const GenoVector<4, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			v[2] += translate.v[2];
@@ -326,7 +352,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 		
-		GenoVector<4, T> & scale(T scale) {
+		constexpr GenoVector<4, T> & scale(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 			v[2] *= scale;
@@ -334,7 +360,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 		
-		GenoVector<4, T> & scale(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scale(const GenoVector<4, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[2] *= scale.v[2];
@@ -342,331 +368,331 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setX(T x) {
+		constexpr GenoVector<4, T> & setX(T x) {
 			v[0] = x;
 			return *this;
 		}
 
-		GenoVector<4, T> & setY(T y) {
+		constexpr GenoVector<4, T> & setY(T y) {
 			v[1] = y;
 			return *this;
 		}
 
-		GenoVector<4, T> & setZ(T z) {
+		constexpr GenoVector<4, T> & setZ(T z) {
 			v[2] = z;
 			return *this;
 		}
 
-		GenoVector<4, T> & setW(T w) {
+		constexpr GenoVector<4, T> & setW(T w) {
 			v[3] = w;
 			return *this;
 		}
 
-		GenoVector<4, T> & setXY(T x, T y) {
+		constexpr GenoVector<4, T> & setXY(T x, T y) {
 			v[0] = x;
 			v[1] = y;
 			return *this;
 		}
 
-		GenoVector<4, T> & setXY(const GenoVector<2, T> & set) {
+		constexpr GenoVector<4, T> & setXY(const GenoVector<2, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<4, T> & setXZ(T x, T z) {
+		constexpr GenoVector<4, T> & setXZ(T x, T z) {
 			v[0] = x;
 			v[2] = z;
 			return *this;
 		}
 
-		GenoVector<4, T> & setXZ(const GenoVector<2, T> & set) {
+		constexpr GenoVector<4, T> & setXZ(const GenoVector<2, T> & set) {
 			v[0] = set.v[0];
 			v[2] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<4, T> & setXW(T x, T w) {
+		constexpr GenoVector<4, T> & setXW(T x, T w) {
 			v[0] = x;
 			v[3] = w;
 			return *this;
 		}
 
-		GenoVector<4, T> & setXW(const GenoVector<2, T> & set) {
+		constexpr GenoVector<4, T> & setXW(const GenoVector<2, T> & set) {
 			v[0] = set.v[0];
 			v[3] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<4, T> & setYX(const GenoVector<2, T> & set) {
+		constexpr GenoVector<4, T> & setYX(const GenoVector<2, T> & set) {
 			v[1] = set.v[0];
 			v[0] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<4, T> & setYZ(T y, T z) {
+		constexpr GenoVector<4, T> & setYZ(T y, T z) {
 			v[1] = y;
 			v[2] = z;
 			return *this;
 		}
 
-		GenoVector<4, T> & setYZ(const GenoVector<2, T> & set) {
+		constexpr GenoVector<4, T> & setYZ(const GenoVector<2, T> & set) {
 			v[1] = set.v[0];
 			v[2] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<4, T> & setYW(T y, T w) {
+		constexpr GenoVector<4, T> & setYW(T y, T w) {
 			v[1] = y;
 			v[3] = w;
 			return *this;
 		}
 
-		GenoVector<4, T> & setYW(const GenoVector<2, T> & set) {
+		constexpr GenoVector<4, T> & setYW(const GenoVector<2, T> & set) {
 			v[1] = set.v[0];
 			v[3] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<4, T> & setZX(const GenoVector<2, T> & set) {
+		constexpr GenoVector<4, T> & setZX(const GenoVector<2, T> & set) {
 			v[2] = set.v[0];
 			v[0] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<4, T> & setZY(const GenoVector<2, T> & set) {
+		constexpr GenoVector<4, T> & setZY(const GenoVector<2, T> & set) {
 			v[2] = set.v[0];
 			v[1] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<4, T> & setZW(T z, T w) {
+		constexpr GenoVector<4, T> & setZW(T z, T w) {
 			v[2] = z;
 			v[3] = w;
 			return *this;
 		}
 
-		GenoVector<4, T> & setZW(const GenoVector<2, T> & set) {
+		constexpr GenoVector<4, T> & setZW(const GenoVector<2, T> & set) {
 			v[2] = set.v[0];
 			v[3] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<4, T> & setWX(const GenoVector<2, T> & set) {
+		constexpr GenoVector<4, T> & setWX(const GenoVector<2, T> & set) {
 			v[3] = set.v[0];
 			v[0] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<4, T> & setWY(const GenoVector<2, T> & set) {
+		constexpr GenoVector<4, T> & setWY(const GenoVector<2, T> & set) {
 			v[3] = set.v[0];
 			v[1] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<4, T> & setWZ(const GenoVector<2, T> & set) {
+		constexpr GenoVector<4, T> & setWZ(const GenoVector<2, T> & set) {
 			v[3] = set.v[0];
 			v[2] = set.v[1];
 			return *this;
 		}
 
-		GenoVector<4, T> & setXYZ(T x, T y, T z) {
+		constexpr GenoVector<4, T> & setXYZ(T x, T y, T z) {
 			v[0] = x;
 			v[1] = y;
 			v[2] = z;
 			return *this;
 		}
 
-		GenoVector<4, T> & setXYZ(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setXYZ(const GenoVector<3, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setXYW(T x, T y, T w) {
+		constexpr GenoVector<4, T> & setXYW(T x, T y, T w) {
 			v[0] = x;
 			v[1] = y;
 			v[3] = w;
 			return *this;
 		}
 
-		GenoVector<4, T> & setXYW(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setXYW(const GenoVector<3, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			v[3] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setXZY(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setXZY(const GenoVector<3, T> & set) {
 			v[0] = set.v[0];
 			v[2] = set.v[1];
 			v[1] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setXZW(T x, T z, T w) {
+		constexpr GenoVector<4, T> & setXZW(T x, T z, T w) {
 			v[0] = x;
 			v[2] = z;
 			v[3] = w;
 			return *this;
 		}
 
-		GenoVector<4, T> & setXZW(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setXZW(const GenoVector<3, T> & set) {
 			v[0] = set.v[0];
 			v[2] = set.v[1];
 			v[3] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setXWY(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setXWY(const GenoVector<3, T> & set) {
 			v[0] = set.v[0];
 			v[3] = set.v[1];
 			v[1] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setXWZ(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setXWZ(const GenoVector<3, T> & set) {
 			v[0] = set.v[0];
 			v[3] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setYXZ(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setYXZ(const GenoVector<3, T> & set) {
 			v[1] = set.v[0];
 			v[0] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setYXW(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setYXW(const GenoVector<3, T> & set) {
 			v[1] = set.v[0];
 			v[0] = set.v[1];
 			v[3] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setYZX(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setYZX(const GenoVector<3, T> & set) {
 			v[1] = set.v[0];
 			v[2] = set.v[1];
 			v[0] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setYZW(T y, T z, T w) {
+		constexpr GenoVector<4, T> & setYZW(T y, T z, T w) {
 			v[1] = y;
 			v[2] = z;
 			v[3] = w;
 			return *this;
 		}
 
-		GenoVector<4, T> & setYZW(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setYZW(const GenoVector<3, T> & set) {
 			v[1] = set.v[0];
 			v[2] = set.v[1];
 			v[3] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setYWX(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setYWX(const GenoVector<3, T> & set) {
 			v[1] = set.v[0];
 			v[3] = set.v[1];
 			v[0] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setYWZ(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setYWZ(const GenoVector<3, T> & set) {
 			v[1] = set.v[0];
 			v[3] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setZXY(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setZXY(const GenoVector<3, T> & set) {
 			v[2] = set.v[0];
 			v[0] = set.v[1];
 			v[1] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setZXW(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setZXW(const GenoVector<3, T> & set) {
 			v[2] = set.v[0];
 			v[0] = set.v[1];
 			v[3] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setZYX(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setZYX(const GenoVector<3, T> & set) {
 			v[2] = set.v[0];
 			v[1] = set.v[1];
 			v[0] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setZYW(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setZYW(const GenoVector<3, T> & set) {
 			v[2] = set.v[0];
 			v[1] = set.v[1];
 			v[3] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setZWX(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setZWX(const GenoVector<3, T> & set) {
 			v[2] = set.v[0];
 			v[3] = set.v[1];
 			v[0] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setZWY(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setZWY(const GenoVector<3, T> & set) {
 			v[2] = set.v[0];
 			v[3] = set.v[1];
 			v[1] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setWXY(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setWXY(const GenoVector<3, T> & set) {
 			v[3] = set.v[0];
 			v[0] = set.v[1];
 			v[1] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setWXZ(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setWXZ(const GenoVector<3, T> & set) {
 			v[3] = set.v[0];
 			v[0] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setWYX(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setWYX(const GenoVector<3, T> & set) {
 			v[3] = set.v[0];
 			v[1] = set.v[1];
 			v[0] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setWYZ(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setWYZ(const GenoVector<3, T> & set) {
 			v[3] = set.v[0];
 			v[1] = set.v[1];
 			v[2] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setWZX(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setWZX(const GenoVector<3, T> & set) {
 			v[3] = set.v[0];
 			v[2] = set.v[1];
 			v[0] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setWZY(const GenoVector<3, T> & set) {
+		constexpr GenoVector<4, T> & setWZY(const GenoVector<3, T> & set) {
 			v[3] = set.v[0];
 			v[2] = set.v[1];
 			v[1] = set.v[2];
 			return *this;
 		}
 
-		GenoVector<4, T> & setXYZW(T x, T y, T z, T w) {
+		constexpr GenoVector<4, T> & setXYZW(T x, T y, T z, T w) {
 			v[0] = x;
 			v[1] = y;
 			v[2] = z;
@@ -674,7 +700,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setXYZW(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setXYZW(const GenoVector<4, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			v[2] = set.v[2];
@@ -682,7 +708,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setXYWZ(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setXYWZ(const GenoVector<4, T> & set) {
 			v[0] = set.v[0];
 			v[1] = set.v[1];
 			v[3] = set.v[2];
@@ -690,7 +716,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setXZYW(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setXZYW(const GenoVector<4, T> & set) {
 			v[0] = set.v[0];
 			v[2] = set.v[1];
 			v[1] = set.v[2];
@@ -698,7 +724,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setXZWY(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setXZWY(const GenoVector<4, T> & set) {
 			v[0] = set.v[0];
 			v[2] = set.v[1];
 			v[3] = set.v[2];
@@ -706,7 +732,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setXWYZ(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setXWYZ(const GenoVector<4, T> & set) {
 			v[0] = set.v[0];
 			v[3] = set.v[1];
 			v[1] = set.v[2];
@@ -714,7 +740,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setXWZY(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setXWZY(const GenoVector<4, T> & set) {
 			v[0] = set.v[0];
 			v[3] = set.v[1];
 			v[2] = set.v[2];
@@ -722,7 +748,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setYXZW(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setYXZW(const GenoVector<4, T> & set) {
 			v[1] = set.v[0];
 			v[0] = set.v[1];
 			v[2] = set.v[2];
@@ -730,7 +756,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setYXWZ(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setYXWZ(const GenoVector<4, T> & set) {
 			v[1] = set.v[0];
 			v[0] = set.v[1];
 			v[3] = set.v[2];
@@ -738,7 +764,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setYZXW(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setYZXW(const GenoVector<4, T> & set) {
 			v[1] = set.v[0];
 			v[2] = set.v[1];
 			v[0] = set.v[2];
@@ -746,7 +772,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setYZWX(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setYZWX(const GenoVector<4, T> & set) {
 			v[1] = set.v[0];
 			v[2] = set.v[1];
 			v[3] = set.v[2];
@@ -754,7 +780,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setYWXZ(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setYWXZ(const GenoVector<4, T> & set) {
 			v[1] = set.v[0];
 			v[3] = set.v[1];
 			v[0] = set.v[2];
@@ -762,7 +788,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setYWZX(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setYWZX(const GenoVector<4, T> & set) {
 			v[1] = set.v[0];
 			v[3] = set.v[1];
 			v[2] = set.v[2];
@@ -770,7 +796,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setZXYW(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setZXYW(const GenoVector<4, T> & set) {
 			v[2] = set.v[0];
 			v[0] = set.v[1];
 			v[1] = set.v[2];
@@ -778,7 +804,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setZXWY(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setZXWY(const GenoVector<4, T> & set) {
 			v[2] = set.v[0];
 			v[0] = set.v[1];
 			v[3] = set.v[2];
@@ -786,7 +812,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setZYXW(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setZYXW(const GenoVector<4, T> & set) {
 			v[2] = set.v[0];
 			v[1] = set.v[1];
 			v[0] = set.v[2];
@@ -794,7 +820,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setZYWX(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setZYWX(const GenoVector<4, T> & set) {
 			v[2] = set.v[0];
 			v[1] = set.v[1];
 			v[3] = set.v[2];
@@ -802,7 +828,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setZWXY(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setZWXY(const GenoVector<4, T> & set) {
 			v[2] = set.v[0];
 			v[3] = set.v[1];
 			v[0] = set.v[2];
@@ -810,7 +836,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setZWYX(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setZWYX(const GenoVector<4, T> & set) {
 			v[2] = set.v[0];
 			v[3] = set.v[1];
 			v[1] = set.v[2];
@@ -818,7 +844,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setWXYZ(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setWXYZ(const GenoVector<4, T> & set) {
 			v[3] = set.v[0];
 			v[0] = set.v[1];
 			v[1] = set.v[2];
@@ -826,7 +852,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setWXZY(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setWXZY(const GenoVector<4, T> & set) {
 			v[3] = set.v[0];
 			v[0] = set.v[1];
 			v[2] = set.v[2];
@@ -834,7 +860,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setWYXZ(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setWYXZ(const GenoVector<4, T> & set) {
 			v[3] = set.v[0];
 			v[1] = set.v[1];
 			v[0] = set.v[2];
@@ -842,7 +868,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setWYZX(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setWYZX(const GenoVector<4, T> & set) {
 			v[3] = set.v[0];
 			v[1] = set.v[1];
 			v[2] = set.v[2];
@@ -850,7 +876,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setWZXY(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setWZXY(const GenoVector<4, T> & set) {
 			v[3] = set.v[0];
 			v[2] = set.v[1];
 			v[0] = set.v[2];
@@ -858,7 +884,7 @@ class GenoVector<4, T> {
 			return *this;
 		}
 
-		GenoVector<4, T> & setWZYX(const GenoVector<4, T> & set) {
+		constexpr GenoVector<4, T> & setWZYX(const GenoVector<4, T> & set) {
 			v[3] = set.v[0];
 			v[2] = set.v[1];
 			v[1] = set.v[2];
@@ -866,2408 +892,2525 @@ class GenoVector<4, T> {
 			return *this;
 		}
 		
-		GenoVector<4, T> & translateX(T translateX) {
+		constexpr GenoVector<4, T> & translateX(T translateX) {
 			v[0] += translateX;
+			return *this;
 		}
 
-		GenoVector<4, T> & translateY(T translateY) {
+		constexpr GenoVector<4, T> & translateY(T translateY) {
 			v[1] += translateY;
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZ(T translateZ) {
+		constexpr GenoVector<4, T> & translateZ(T translateZ) {
 			v[2] += translateZ;
+			return *this;
 		}
 
-		GenoVector<4, T> & translateW(T translateW) {
+		constexpr GenoVector<4, T> & translateW(T translateW) {
 			v[3] += translateW;
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXY(T translateX, T translateY) {
+		constexpr GenoVector<4, T> & translateXY(T translateX, T translateY) {
 			v[0] += translateX;
 			v[1] += translateY;
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXY(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<4, T> & translateXY(const GenoVector<2, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXZ(T translateX, T translateZ) {
+		constexpr GenoVector<4, T> & translateXZ(T translateX, T translateZ) {
 			v[0] += translateX;
 			v[2] += translateZ;
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXZ(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<4, T> & translateXZ(const GenoVector<2, T> & translate) {
 			v[0] += translate.v[0];
 			v[2] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXW(T translateX, T translateW) {
+		constexpr GenoVector<4, T> & translateXW(T translateX, T translateW) {
 			v[0] += translateX;
 			v[3] += translateW;
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXW(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<4, T> & translateXW(const GenoVector<2, T> & translate) {
 			v[0] += translate.v[0];
 			v[3] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYX(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<4, T> & translateYX(const GenoVector<2, T> & translate) {
 			v[1] += translate.v[0];
 			v[0] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYZ(T translateY, T translateZ) {
+		constexpr GenoVector<4, T> & translateYZ(T translateY, T translateZ) {
 			v[1] += translateY;
 			v[2] += translateZ;
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYZ(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<4, T> & translateYZ(const GenoVector<2, T> & translate) {
 			v[1] += translate.v[0];
 			v[2] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYW(T translateY, T translateW) {
+		constexpr GenoVector<4, T> & translateYW(T translateY, T translateW) {
 			v[1] += translateY;
 			v[3] += translateW;
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYW(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<4, T> & translateYW(const GenoVector<2, T> & translate) {
 			v[1] += translate.v[0];
 			v[3] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZX(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<4, T> & translateZX(const GenoVector<2, T> & translate) {
 			v[2] += translate.v[0];
 			v[0] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZY(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<4, T> & translateZY(const GenoVector<2, T> & translate) {
 			v[2] += translate.v[0];
 			v[1] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZW(T translateZ, T translateW) {
+		constexpr GenoVector<4, T> & translateZW(T translateZ, T translateW) {
 			v[2] += translateZ;
 			v[3] += translateW;
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZW(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<4, T> & translateZW(const GenoVector<2, T> & translate) {
 			v[2] += translate.v[0];
 			v[3] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateWX(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<4, T> & translateWX(const GenoVector<2, T> & translate) {
 			v[3] += translate.v[0];
 			v[0] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateWY(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<4, T> & translateWY(const GenoVector<2, T> & translate) {
 			v[3] += translate.v[0];
 			v[1] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateWZ(const GenoVector<2, T> & translate) {
+		constexpr GenoVector<4, T> & translateWZ(const GenoVector<2, T> & translate) {
 			v[3] += translate.v[0];
 			v[2] += translate.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXYZ(T translateX, T translateY, T translateZ) {
+		constexpr GenoVector<4, T> & translateXYZ(T translateX, T translateY, T translateZ) {
 			v[0] += translateX;
 			v[1] += translateY;
 			v[2] += translateZ;
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXYZ(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateXYZ(const GenoVector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			v[2] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXYW(T translateX, T translateY, T translateW) {
+		constexpr GenoVector<4, T> & translateXYW(T translateX, T translateY, T translateW) {
 			v[0] += translateX;
 			v[1] += translateY;
 			v[3] += translateW;
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXYW(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateXYW(const GenoVector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			v[3] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXZY(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateXZY(const GenoVector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[2] += translate.v[1];
 			v[1] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXZW(T translateX, T translateZ, T translateW) {
+		constexpr GenoVector<4, T> & translateXZW(T translateX, T translateZ, T translateW) {
 			v[0] += translateX;
 			v[2] += translateZ;
 			v[3] += translateW;
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXZW(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateXZW(const GenoVector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[2] += translate.v[1];
 			v[3] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXWY(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateXWY(const GenoVector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[3] += translate.v[1];
 			v[1] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXWZ(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateXWZ(const GenoVector<3, T> & translate) {
 			v[0] += translate.v[0];
 			v[3] += translate.v[1];
 			v[2] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYXZ(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateYXZ(const GenoVector<3, T> & translate) {
 			v[1] += translate.v[0];
 			v[0] += translate.v[1];
 			v[2] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYXW(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateYXW(const GenoVector<3, T> & translate) {
 			v[1] += translate.v[0];
 			v[0] += translate.v[1];
 			v[3] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYZX(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateYZX(const GenoVector<3, T> & translate) {
 			v[1] += translate.v[0];
 			v[2] += translate.v[1];
 			v[0] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYZW(T translateY, T translateZ, T translateW) {
+		constexpr GenoVector<4, T> & translateYZW(T translateY, T translateZ, T translateW) {
 			v[1] += translateY;
 			v[2] += translateZ;
 			v[3] += translateW;
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYZW(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateYZW(const GenoVector<3, T> & translate) {
 			v[1] += translate.v[0];
 			v[2] += translate.v[1];
 			v[3] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYWX(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateYWX(const GenoVector<3, T> & translate) {
 			v[1] += translate.v[0];
 			v[3] += translate.v[1];
 			v[0] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYWZ(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateYWZ(const GenoVector<3, T> & translate) {
 			v[1] += translate.v[0];
 			v[3] += translate.v[1];
 			v[2] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZXY(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateZXY(const GenoVector<3, T> & translate) {
 			v[2] += translate.v[0];
 			v[0] += translate.v[1];
 			v[1] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZXW(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateZXW(const GenoVector<3, T> & translate) {
 			v[2] += translate.v[0];
 			v[0] += translate.v[1];
 			v[3] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZYX(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateZYX(const GenoVector<3, T> & translate) {
 			v[2] += translate.v[0];
 			v[1] += translate.v[1];
 			v[0] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZYW(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateZYW(const GenoVector<3, T> & translate) {
 			v[2] += translate.v[0];
 			v[1] += translate.v[1];
 			v[3] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZWX(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateZWX(const GenoVector<3, T> & translate) {
 			v[2] += translate.v[0];
 			v[3] += translate.v[1];
 			v[0] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZWY(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateZWY(const GenoVector<3, T> & translate) {
 			v[2] += translate.v[0];
 			v[3] += translate.v[1];
 			v[1] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateWXY(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateWXY(const GenoVector<3, T> & translate) {
 			v[3] += translate.v[0];
 			v[0] += translate.v[1];
 			v[1] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateWXZ(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateWXZ(const GenoVector<3, T> & translate) {
 			v[3] += translate.v[0];
 			v[0] += translate.v[1];
 			v[2] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateWYX(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateWYX(const GenoVector<3, T> & translate) {
 			v[3] += translate.v[0];
 			v[1] += translate.v[1];
 			v[0] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateWYZ(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateWYZ(const GenoVector<3, T> & translate) {
 			v[3] += translate.v[0];
 			v[1] += translate.v[1];
 			v[2] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateWZX(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateWZX(const GenoVector<3, T> & translate) {
 			v[3] += translate.v[0];
 			v[2] += translate.v[1];
 			v[0] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateWZY(const GenoVector<3, T> & translate) {
+		constexpr GenoVector<4, T> & translateWZY(const GenoVector<3, T> & translate) {
 			v[3] += translate.v[0];
 			v[2] += translate.v[1];
 			v[1] += translate.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXYZW(T translateX, T translateY, T translateZ, T translateW) {
+		constexpr GenoVector<4, T> & translateXYZW(T translateX, T translateY, T translateZ, T translateW) {
 			v[0] += translateX;
 			v[1] += translateY;
 			v[2] += translateZ;
 			v[3] += translateW;
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXYZW(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateXYZW(const GenoVector<4, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			v[2] += translate.v[2];
 			v[3] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXYWZ(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateXYWZ(const GenoVector<4, T> & translate) {
 			v[0] += translate.v[0];
 			v[1] += translate.v[1];
 			v[3] += translate.v[2];
 			v[2] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXZYW(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateXZYW(const GenoVector<4, T> & translate) {
 			v[0] += translate.v[0];
 			v[2] += translate.v[1];
 			v[1] += translate.v[2];
 			v[3] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXZWY(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateXZWY(const GenoVector<4, T> & translate) {
 			v[0] += translate.v[0];
 			v[2] += translate.v[1];
 			v[3] += translate.v[2];
 			v[1] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXWYZ(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateXWYZ(const GenoVector<4, T> & translate) {
 			v[0] += translate.v[0];
 			v[3] += translate.v[1];
 			v[1] += translate.v[2];
 			v[2] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateXWZY(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateXWZY(const GenoVector<4, T> & translate) {
 			v[0] += translate.v[0];
 			v[3] += translate.v[1];
 			v[2] += translate.v[2];
 			v[1] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYXZW(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateYXZW(const GenoVector<4, T> & translate) {
 			v[1] += translate.v[0];
 			v[0] += translate.v[1];
 			v[2] += translate.v[2];
 			v[3] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYXWZ(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateYXWZ(const GenoVector<4, T> & translate) {
 			v[1] += translate.v[0];
 			v[0] += translate.v[1];
 			v[3] += translate.v[2];
 			v[2] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYZXW(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateYZXW(const GenoVector<4, T> & translate) {
 			v[1] += translate.v[0];
 			v[2] += translate.v[1];
 			v[0] += translate.v[2];
 			v[3] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYZWX(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateYZWX(const GenoVector<4, T> & translate) {
 			v[1] += translate.v[0];
 			v[2] += translate.v[1];
 			v[3] += translate.v[2];
 			v[0] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYWXZ(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateYWXZ(const GenoVector<4, T> & translate) {
 			v[1] += translate.v[0];
 			v[3] += translate.v[1];
 			v[0] += translate.v[2];
 			v[2] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateYWZX(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateYWZX(const GenoVector<4, T> & translate) {
 			v[1] += translate.v[0];
 			v[3] += translate.v[1];
 			v[2] += translate.v[2];
 			v[0] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZXYW(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateZXYW(const GenoVector<4, T> & translate) {
 			v[2] += translate.v[0];
 			v[0] += translate.v[1];
 			v[1] += translate.v[2];
 			v[3] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZXWY(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateZXWY(const GenoVector<4, T> & translate) {
 			v[2] += translate.v[0];
 			v[0] += translate.v[1];
 			v[3] += translate.v[2];
 			v[1] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZYXW(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateZYXW(const GenoVector<4, T> & translate) {
 			v[2] += translate.v[0];
 			v[1] += translate.v[1];
 			v[0] += translate.v[2];
 			v[3] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZYWX(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateZYWX(const GenoVector<4, T> & translate) {
 			v[2] += translate.v[0];
 			v[1] += translate.v[1];
 			v[3] += translate.v[2];
 			v[0] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZWXY(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateZWXY(const GenoVector<4, T> & translate) {
 			v[2] += translate.v[0];
 			v[3] += translate.v[1];
 			v[0] += translate.v[2];
 			v[1] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateZWYX(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateZWYX(const GenoVector<4, T> & translate) {
 			v[2] += translate.v[0];
 			v[3] += translate.v[1];
 			v[1] += translate.v[2];
 			v[0] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateWXYZ(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateWXYZ(const GenoVector<4, T> & translate) {
 			v[3] += translate.v[0];
 			v[0] += translate.v[1];
 			v[1] += translate.v[2];
 			v[2] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateWXZY(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateWXZY(const GenoVector<4, T> & translate) {
 			v[3] += translate.v[0];
 			v[0] += translate.v[1];
 			v[2] += translate.v[2];
 			v[1] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateWYXZ(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateWYXZ(const GenoVector<4, T> & translate) {
 			v[3] += translate.v[0];
 			v[1] += translate.v[1];
 			v[0] += translate.v[2];
 			v[2] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateWYZX(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateWYZX(const GenoVector<4, T> & translate) {
 			v[3] += translate.v[0];
 			v[1] += translate.v[1];
 			v[2] += translate.v[2];
 			v[0] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateWZXY(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateWZXY(const GenoVector<4, T> & translate) {
 			v[3] += translate.v[0];
 			v[2] += translate.v[1];
 			v[0] += translate.v[2];
 			v[1] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & translateWZYX(const GenoVector<4, T> & translate) {
+		constexpr GenoVector<4, T> & translateWZYX(const GenoVector<4, T> & translate) {
 			v[3] += translate.v[0];
 			v[2] += translate.v[1];
 			v[1] += translate.v[2];
 			v[0] += translate.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleX(T scaleX) {
+		constexpr GenoVector<4, T> & scaleX(T scaleX) {
 			v[0] *= scaleX;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleY(T scaleY) {
+		constexpr GenoVector<4, T> & scaleY(T scaleY) {
 			v[1] *= scaleY;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZ(T scaleZ) {
+		constexpr GenoVector<4, T> & scaleZ(T scaleZ) {
 			v[2] *= scaleZ;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleW(T scaleW) {
+		constexpr GenoVector<4, T> & scaleW(T scaleW) {
 			v[3] *= scaleW;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXY(T scale) {
+		constexpr GenoVector<4, T> & scaleXY(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXY(T scaleX, T scaleY) {
+		constexpr GenoVector<4, T> & scaleXY(T scaleX, T scaleY) {
 			v[0] *= scaleX;
 			v[1] *= scaleY;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXY(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<4, T> & scaleXY(const GenoVector<2, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXZ(T scale) {
+		constexpr GenoVector<4, T> & scaleXZ(T scale) {
 			v[0] *= scale;
 			v[2] *= scale;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXZ(T scaleX, T scaleZ) {
+		constexpr GenoVector<4, T> & scaleXZ(T scaleX, T scaleZ) {
 			v[0] *= scaleX;
 			v[2] *= scaleZ;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXZ(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<4, T> & scaleXZ(const GenoVector<2, T> & scale) {
 			v[0] *= scale.v[0];
 			v[2] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXW(T scale) {
+		constexpr GenoVector<4, T> & scaleXW(T scale) {
 			v[0] *= scale;
 			v[3] *= scale;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXW(T scaleX, T scaleW) {
+		constexpr GenoVector<4, T> & scaleXW(T scaleX, T scaleW) {
 			v[0] *= scaleX;
 			v[3] *= scaleW;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXW(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<4, T> & scaleXW(const GenoVector<2, T> & scale) {
 			v[0] *= scale.v[0];
 			v[3] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYX(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<4, T> & scaleYX(const GenoVector<2, T> & scale) {
 			v[1] *= scale.v[0];
 			v[0] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYZ(T scale) {
+		constexpr GenoVector<4, T> & scaleYZ(T scale) {
 			v[1] *= scale;
 			v[2] *= scale;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYZ(T scaleY, T scaleZ) {
+		constexpr GenoVector<4, T> & scaleYZ(T scaleY, T scaleZ) {
 			v[1] *= scaleY;
 			v[2] *= scaleZ;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYZ(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<4, T> & scaleYZ(const GenoVector<2, T> & scale) {
 			v[1] *= scale.v[0];
 			v[2] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYW(T scale) {
+		constexpr GenoVector<4, T> & scaleYW(T scale) {
 			v[1] *= scale;
 			v[3] *= scale;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYW(T scaleY, T scaleW) {
+		constexpr GenoVector<4, T> & scaleYW(T scaleY, T scaleW) {
 			v[1] *= scaleY;
 			v[3] *= scaleW;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYW(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<4, T> & scaleYW(const GenoVector<2, T> & scale) {
 			v[1] *= scale.v[0];
 			v[3] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZX(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<4, T> & scaleZX(const GenoVector<2, T> & scale) {
 			v[2] *= scale.v[0];
 			v[0] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZY(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<4, T> & scaleZY(const GenoVector<2, T> & scale) {
 			v[2] *= scale.v[0];
 			v[1] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZW(T scale) {
+		constexpr GenoVector<4, T> & scaleZW(T scale) {
 			v[2] *= scale;
 			v[3] *= scale;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZW(T scaleZ, T scaleW) {
+		constexpr GenoVector<4, T> & scaleZW(T scaleZ, T scaleW) {
 			v[2] *= scaleZ;
 			v[3] *= scaleW;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZW(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<4, T> & scaleZW(const GenoVector<2, T> & scale) {
 			v[2] *= scale.v[0];
 			v[3] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleWX(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<4, T> & scaleWX(const GenoVector<2, T> & scale) {
 			v[3] *= scale.v[0];
 			v[0] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleWY(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<4, T> & scaleWY(const GenoVector<2, T> & scale) {
 			v[3] *= scale.v[0];
 			v[1] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleWZ(const GenoVector<2, T> & scale) {
+		constexpr GenoVector<4, T> & scaleWZ(const GenoVector<2, T> & scale) {
 			v[3] *= scale.v[0];
 			v[2] *= scale.v[1];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXYZ(T scale) {
+		constexpr GenoVector<4, T> & scaleXYZ(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 			v[2] *= scale;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXYZ(T scaleX, T scaleY, T scaleZ) {
+		constexpr GenoVector<4, T> & scaleXYZ(T scaleX, T scaleY, T scaleZ) {
 			v[0] *= scaleX;
 			v[1] *= scaleY;
 			v[2] *= scaleZ;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXYZ(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleXYZ(const GenoVector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[2] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXYW(T scale) {
+		constexpr GenoVector<4, T> & scaleXYW(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 			v[3] *= scale;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXYW(T scaleX, T scaleY, T scaleW) {
+		constexpr GenoVector<4, T> & scaleXYW(T scaleX, T scaleY, T scaleW) {
 			v[0] *= scaleX;
 			v[1] *= scaleY;
 			v[3] *= scaleW;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXYW(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleXYW(const GenoVector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[3] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXZY(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleXZY(const GenoVector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[1] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXZW(T scale) {
+		constexpr GenoVector<4, T> & scaleXZW(T scale) {
 			v[0] *= scale;
 			v[2] *= scale;
 			v[3] *= scale;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXZW(T scaleX, T scaleZ, T scaleW) {
+		constexpr GenoVector<4, T> & scaleXZW(T scaleX, T scaleZ, T scaleW) {
 			v[0] *= scaleX;
 			v[2] *= scaleZ;
 			v[3] *= scaleW;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXZW(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleXZW(const GenoVector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[3] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXWY(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleXWY(const GenoVector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[1] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXWZ(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleXWZ(const GenoVector<3, T> & scale) {
 			v[0] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[2] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYXZ(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleYXZ(const GenoVector<3, T> & scale) {
 			v[1] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[2] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYXW(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleYXW(const GenoVector<3, T> & scale) {
 			v[1] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[3] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYZX(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleYZX(const GenoVector<3, T> & scale) {
 			v[1] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[0] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYZW(T scale) {
+		constexpr GenoVector<4, T> & scaleYZW(T scale) {
 			v[1] *= scale;
 			v[2] *= scale;
 			v[3] *= scale;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYZW(T scaleY, T scaleZ, T scaleW) {
+		constexpr GenoVector<4, T> & scaleYZW(T scaleY, T scaleZ, T scaleW) {
 			v[1] *= scaleY;
 			v[2] *= scaleZ;
 			v[3] *= scaleW;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYZW(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleYZW(const GenoVector<3, T> & scale) {
 			v[1] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[3] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYWX(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleYWX(const GenoVector<3, T> & scale) {
 			v[1] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[0] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYWZ(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleYWZ(const GenoVector<3, T> & scale) {
 			v[1] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[2] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZXY(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleZXY(const GenoVector<3, T> & scale) {
 			v[2] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[1] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZXW(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleZXW(const GenoVector<3, T> & scale) {
 			v[2] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[3] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZYX(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleZYX(const GenoVector<3, T> & scale) {
 			v[2] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[0] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZYW(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleZYW(const GenoVector<3, T> & scale) {
 			v[2] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[3] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZWX(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleZWX(const GenoVector<3, T> & scale) {
 			v[2] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[0] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZWY(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleZWY(const GenoVector<3, T> & scale) {
 			v[2] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[1] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleWXY(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleWXY(const GenoVector<3, T> & scale) {
 			v[3] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[1] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleWXZ(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleWXZ(const GenoVector<3, T> & scale) {
 			v[3] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[2] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleWYX(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleWYX(const GenoVector<3, T> & scale) {
 			v[3] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[0] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleWYZ(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleWYZ(const GenoVector<3, T> & scale) {
 			v[3] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[2] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleWZX(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleWZX(const GenoVector<3, T> & scale) {
 			v[3] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[0] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleWZY(const GenoVector<3, T> & scale) {
+		constexpr GenoVector<4, T> & scaleWZY(const GenoVector<3, T> & scale) {
 			v[3] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[1] *= scale.v[2];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXYZW(T scale) {
+		constexpr GenoVector<4, T> & scaleXYZW(T scale) {
 			v[0] *= scale;
 			v[1] *= scale;
 			v[2] *= scale;
 			v[3] *= scale;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXYZW(T scaleX, T scaleY, T scaleZ, T scaleW) {
+		constexpr GenoVector<4, T> & scaleXYZW(T scaleX, T scaleY, T scaleZ, T scaleW) {
 			v[0] *= scaleX;
 			v[1] *= scaleY;
 			v[2] *= scaleZ;
 			v[3] *= scaleW;
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXYZW(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleXYZW(const GenoVector<4, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[2] *= scale.v[2];
 			v[3] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXYWZ(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleXYWZ(const GenoVector<4, T> & scale) {
 			v[0] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[3] *= scale.v[2];
 			v[2] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXZYW(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleXZYW(const GenoVector<4, T> & scale) {
 			v[0] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[1] *= scale.v[2];
 			v[3] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXZWY(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleXZWY(const GenoVector<4, T> & scale) {
 			v[0] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[3] *= scale.v[2];
 			v[1] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXWYZ(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleXWYZ(const GenoVector<4, T> & scale) {
 			v[0] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[1] *= scale.v[2];
 			v[2] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleXWZY(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleXWZY(const GenoVector<4, T> & scale) {
 			v[0] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[2] *= scale.v[2];
 			v[1] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYXZW(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleYXZW(const GenoVector<4, T> & scale) {
 			v[1] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[2] *= scale.v[2];
 			v[3] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYXWZ(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleYXWZ(const GenoVector<4, T> & scale) {
 			v[1] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[3] *= scale.v[2];
 			v[2] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYZXW(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleYZXW(const GenoVector<4, T> & scale) {
 			v[1] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[0] *= scale.v[2];
 			v[3] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYZWX(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleYZWX(const GenoVector<4, T> & scale) {
 			v[1] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[3] *= scale.v[2];
 			v[0] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYWXZ(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleYWXZ(const GenoVector<4, T> & scale) {
 			v[1] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[0] *= scale.v[2];
 			v[2] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleYWZX(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleYWZX(const GenoVector<4, T> & scale) {
 			v[1] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[2] *= scale.v[2];
 			v[0] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZXYW(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleZXYW(const GenoVector<4, T> & scale) {
 			v[2] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[1] *= scale.v[2];
 			v[3] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZXWY(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleZXWY(const GenoVector<4, T> & scale) {
 			v[2] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[3] *= scale.v[2];
 			v[1] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZYXW(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleZYXW(const GenoVector<4, T> & scale) {
 			v[2] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[0] *= scale.v[2];
 			v[3] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZYWX(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleZYWX(const GenoVector<4, T> & scale) {
 			v[2] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[3] *= scale.v[2];
 			v[0] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZWXY(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleZWXY(const GenoVector<4, T> & scale) {
 			v[2] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[0] *= scale.v[2];
 			v[1] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleZWYX(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleZWYX(const GenoVector<4, T> & scale) {
 			v[2] *= scale.v[0];
 			v[3] *= scale.v[1];
 			v[1] *= scale.v[2];
 			v[0] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleWXYZ(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleWXYZ(const GenoVector<4, T> & scale) {
 			v[3] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[1] *= scale.v[2];
 			v[2] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleWXZY(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleWXZY(const GenoVector<4, T> & scale) {
 			v[3] *= scale.v[0];
 			v[0] *= scale.v[1];
 			v[2] *= scale.v[2];
 			v[1] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleWYXZ(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleWYXZ(const GenoVector<4, T> & scale) {
 			v[3] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[0] *= scale.v[2];
 			v[2] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleWYZX(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleWYZX(const GenoVector<4, T> & scale) {
 			v[3] *= scale.v[0];
 			v[1] *= scale.v[1];
 			v[2] *= scale.v[2];
 			v[0] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleWZXY(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleWZXY(const GenoVector<4, T> & scale) {
 			v[3] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[0] *= scale.v[2];
 			v[1] *= scale.v[3];
+			return *this;
 		}
 
-		GenoVector<4, T> & scaleWZYX(const GenoVector<4, T> & scale) {
+		constexpr GenoVector<4, T> & scaleWZYX(const GenoVector<4, T> & scale) {
 			v[3] *= scale.v[0];
 			v[2] *= scale.v[1];
 			v[1] *= scale.v[2];
 			v[0] *= scale.v[3];
+			return *this;
 		}
 
-		T getX() const {
+		constexpr T getX() const {
 			return v[0];
 		}
 
-		T getY() const {
+		constexpr T getY() const {
 			return v[1];
 		}
 
-		T getZ() const {
+		constexpr T getZ() const {
 			return v[2];
 		}
 
-		T getW() const {
+		constexpr T getW() const {
 			return v[3];
 		}
 
-		GenoVector<2, T> getXX() const {
+		constexpr GenoVector<2, T> getXX() const {
 			return { v[0], v[0] };
 		}
 
-		GenoVector<2, T> getXY() const {
+		constexpr GenoVector<2, T> getXY() const {
 			return { v[0], v[1] };
 		}
 
-		GenoVector<2, T> getXZ() const {
+		constexpr GenoVector<2, T> getXZ() const {
 			return { v[0], v[2] };
 		}
 
-		GenoVector<2, T> getXW() const {
+		constexpr GenoVector<2, T> getXW() const {
 			return { v[0], v[3] };
 		}
 
-		GenoVector<2, T> getYX() const {
+		constexpr GenoVector<2, T> getYX() const {
 			return { v[1], v[0] };
 		}
 
-		GenoVector<2, T> getYY() const {
+		constexpr GenoVector<2, T> getYY() const {
 			return { v[1], v[1] };
 		}
 
-		GenoVector<2, T> getYZ() const {
+		constexpr GenoVector<2, T> getYZ() const {
 			return { v[1], v[2] };
 		}
 
-		GenoVector<2, T> getYW() const {
+		constexpr GenoVector<2, T> getYW() const {
 			return { v[1], v[3] };
 		}
 
-		GenoVector<2, T> getZX() const {
+		constexpr GenoVector<2, T> getZX() const {
 			return { v[2], v[0] };
 		}
 
-		GenoVector<2, T> getZY() const {
+		constexpr GenoVector<2, T> getZY() const {
 			return { v[2], v[1] };
 		}
 
-		GenoVector<2, T> getZZ() const {
+		constexpr GenoVector<2, T> getZZ() const {
 			return { v[2], v[2] };
 		}
 
-		GenoVector<2, T> getZW() const {
+		constexpr GenoVector<2, T> getZW() const {
 			return { v[2], v[3] };
 		}
 
-		GenoVector<2, T> getWX() const {
+		constexpr GenoVector<2, T> getWX() const {
 			return { v[3], v[0] };
 		}
 
-		GenoVector<2, T> getWY() const {
+		constexpr GenoVector<2, T> getWY() const {
 			return { v[3], v[1] };
 		}
 
-		GenoVector<2, T> getWZ() const {
+		constexpr GenoVector<2, T> getWZ() const {
 			return { v[3], v[2] };
 		}
 
-		GenoVector<2, T> getWW() const {
+		constexpr GenoVector<2, T> getWW() const {
 			return { v[3], v[3] };
 		}
 
-		GenoVector<3, T> getXXX() const {
+		constexpr GenoVector<3, T> getXXX() const {
 			return { v[0], v[0], v[0] };
 		}
 
-		GenoVector<3, T> getXXY() const {
+		constexpr GenoVector<3, T> getXXY() const {
 			return { v[0], v[0], v[1] };
 		}
 
-		GenoVector<3, T> getXXZ() const {
+		constexpr GenoVector<3, T> getXXZ() const {
 			return { v[0], v[0], v[2] };
 		}
 
-		GenoVector<3, T> getXXW() const {
+		constexpr GenoVector<3, T> getXXW() const {
 			return { v[0], v[0], v[3] };
 		}
 
-		GenoVector<3, T> getXYX() const {
+		constexpr GenoVector<3, T> getXYX() const {
 			return { v[0], v[1], v[0] };
 		}
 
-		GenoVector<3, T> getXYY() const {
+		constexpr GenoVector<3, T> getXYY() const {
 			return { v[0], v[1], v[1] };
 		}
 
-		GenoVector<3, T> getXYZ() const {
+		constexpr GenoVector<3, T> getXYZ() const {
 			return { v[0], v[1], v[2] };
 		}
 
-		GenoVector<3, T> getXYW() const {
+		constexpr GenoVector<3, T> getXYW() const {
 			return { v[0], v[1], v[3] };
 		}
 
-		GenoVector<3, T> getXZX() const {
+		constexpr GenoVector<3, T> getXZX() const {
 			return { v[0], v[2], v[0] };
 		}
 
-		GenoVector<3, T> getXZY() const {
+		constexpr GenoVector<3, T> getXZY() const {
 			return { v[0], v[2], v[1] };
 		}
 
-		GenoVector<3, T> getXZZ() const {
+		constexpr GenoVector<3, T> getXZZ() const {
 			return { v[0], v[2], v[2] };
 		}
 
-		GenoVector<3, T> getXZW() const {
+		constexpr GenoVector<3, T> getXZW() const {
 			return { v[0], v[2], v[3] };
 		}
 
-		GenoVector<3, T> getXWX() const {
+		constexpr GenoVector<3, T> getXWX() const {
 			return { v[0], v[3], v[0] };
 		}
 
-		GenoVector<3, T> getXWY() const {
+		constexpr GenoVector<3, T> getXWY() const {
 			return { v[0], v[3], v[1] };
 		}
 
-		GenoVector<3, T> getXWZ() const {
+		constexpr GenoVector<3, T> getXWZ() const {
 			return { v[0], v[3], v[2] };
 		}
 
-		GenoVector<3, T> getXWW() const {
+		constexpr GenoVector<3, T> getXWW() const {
 			return { v[0], v[3], v[3] };
 		}
 
-		GenoVector<3, T> getYXX() const {
+		constexpr GenoVector<3, T> getYXX() const {
 			return { v[1], v[0], v[0] };
 		}
 
-		GenoVector<3, T> getYXY() const {
+		constexpr GenoVector<3, T> getYXY() const {
 			return { v[1], v[0], v[1] };
 		}
 
-		GenoVector<3, T> getYXZ() const {
+		constexpr GenoVector<3, T> getYXZ() const {
 			return { v[1], v[0], v[2] };
 		}
 
-		GenoVector<3, T> getYXW() const {
+		constexpr GenoVector<3, T> getYXW() const {
 			return { v[1], v[0], v[3] };
 		}
 
-		GenoVector<3, T> getYYX() const {
+		constexpr GenoVector<3, T> getYYX() const {
 			return { v[1], v[1], v[0] };
 		}
 
-		GenoVector<3, T> getYYY() const {
+		constexpr GenoVector<3, T> getYYY() const {
 			return { v[1], v[1], v[1] };
 		}
 
-		GenoVector<3, T> getYYZ() const {
+		constexpr GenoVector<3, T> getYYZ() const {
 			return { v[1], v[1], v[2] };
 		}
 
-		GenoVector<3, T> getYYW() const {
+		constexpr GenoVector<3, T> getYYW() const {
 			return { v[1], v[1], v[3] };
 		}
 
-		GenoVector<3, T> getYZX() const {
+		constexpr GenoVector<3, T> getYZX() const {
 			return { v[1], v[2], v[0] };
 		}
 
-		GenoVector<3, T> getYZY() const {
+		constexpr GenoVector<3, T> getYZY() const {
 			return { v[1], v[2], v[1] };
 		}
 
-		GenoVector<3, T> getYZZ() const {
+		constexpr GenoVector<3, T> getYZZ() const {
 			return { v[1], v[2], v[2] };
 		}
 
-		GenoVector<3, T> getYZW() const {
+		constexpr GenoVector<3, T> getYZW() const {
 			return { v[1], v[2], v[3] };
 		}
 
-		GenoVector<3, T> getYWX() const {
+		constexpr GenoVector<3, T> getYWX() const {
 			return { v[1], v[3], v[0] };
 		}
 
-		GenoVector<3, T> getYWY() const {
+		constexpr GenoVector<3, T> getYWY() const {
 			return { v[1], v[3], v[1] };
 		}
 
-		GenoVector<3, T> getYWZ() const {
+		constexpr GenoVector<3, T> getYWZ() const {
 			return { v[1], v[3], v[2] };
 		}
 
-		GenoVector<3, T> getYWW() const {
+		constexpr GenoVector<3, T> getYWW() const {
 			return { v[1], v[3], v[3] };
 		}
 
-		GenoVector<3, T> getZXX() const {
+		constexpr GenoVector<3, T> getZXX() const {
 			return { v[2], v[0], v[0] };
 		}
 
-		GenoVector<3, T> getZXY() const {
+		constexpr GenoVector<3, T> getZXY() const {
 			return { v[2], v[0], v[1] };
 		}
 
-		GenoVector<3, T> getZXZ() const {
+		constexpr GenoVector<3, T> getZXZ() const {
 			return { v[2], v[0], v[2] };
 		}
 
-		GenoVector<3, T> getZXW() const {
+		constexpr GenoVector<3, T> getZXW() const {
 			return { v[2], v[0], v[3] };
 		}
 
-		GenoVector<3, T> getZYX() const {
+		constexpr GenoVector<3, T> getZYX() const {
 			return { v[2], v[1], v[0] };
 		}
 
-		GenoVector<3, T> getZYY() const {
+		constexpr GenoVector<3, T> getZYY() const {
 			return { v[2], v[1], v[1] };
 		}
 
-		GenoVector<3, T> getZYZ() const {
+		constexpr GenoVector<3, T> getZYZ() const {
 			return { v[2], v[1], v[2] };
 		}
 
-		GenoVector<3, T> getZYW() const {
+		constexpr GenoVector<3, T> getZYW() const {
 			return { v[2], v[1], v[3] };
 		}
 
-		GenoVector<3, T> getZZX() const {
+		constexpr GenoVector<3, T> getZZX() const {
 			return { v[2], v[2], v[0] };
 		}
 
-		GenoVector<3, T> getZZY() const {
+		constexpr GenoVector<3, T> getZZY() const {
 			return { v[2], v[2], v[1] };
 		}
 
-		GenoVector<3, T> getZZZ() const {
+		constexpr GenoVector<3, T> getZZZ() const {
 			return { v[2], v[2], v[2] };
 		}
 
-		GenoVector<3, T> getZZW() const {
+		constexpr GenoVector<3, T> getZZW() const {
 			return { v[2], v[2], v[3] };
 		}
 
-		GenoVector<3, T> getZWX() const {
+		constexpr GenoVector<3, T> getZWX() const {
 			return { v[2], v[3], v[0] };
 		}
 
-		GenoVector<3, T> getZWY() const {
+		constexpr GenoVector<3, T> getZWY() const {
 			return { v[2], v[3], v[1] };
 		}
 
-		GenoVector<3, T> getZWZ() const {
+		constexpr GenoVector<3, T> getZWZ() const {
 			return { v[2], v[3], v[2] };
 		}
 
-		GenoVector<3, T> getZWW() const {
+		constexpr GenoVector<3, T> getZWW() const {
 			return { v[2], v[3], v[3] };
 		}
 
-		GenoVector<3, T> getWXX() const {
+		constexpr GenoVector<3, T> getWXX() const {
 			return { v[3], v[0], v[0] };
 		}
 
-		GenoVector<3, T> getWXY() const {
+		constexpr GenoVector<3, T> getWXY() const {
 			return { v[3], v[0], v[1] };
 		}
 
-		GenoVector<3, T> getWXZ() const {
+		constexpr GenoVector<3, T> getWXZ() const {
 			return { v[3], v[0], v[2] };
 		}
 
-		GenoVector<3, T> getWXW() const {
+		constexpr GenoVector<3, T> getWXW() const {
 			return { v[3], v[0], v[3] };
 		}
 
-		GenoVector<3, T> getWYX() const {
+		constexpr GenoVector<3, T> getWYX() const {
 			return { v[3], v[1], v[0] };
 		}
 
-		GenoVector<3, T> getWYY() const {
+		constexpr GenoVector<3, T> getWYY() const {
 			return { v[3], v[1], v[1] };
 		}
 
-		GenoVector<3, T> getWYZ() const {
+		constexpr GenoVector<3, T> getWYZ() const {
 			return { v[3], v[1], v[2] };
 		}
 
-		GenoVector<3, T> getWYW() const {
+		constexpr GenoVector<3, T> getWYW() const {
 			return { v[3], v[1], v[3] };
 		}
 
-		GenoVector<3, T> getWZX() const {
+		constexpr GenoVector<3, T> getWZX() const {
 			return { v[3], v[2], v[0] };
 		}
 
-		GenoVector<3, T> getWZY() const {
+		constexpr GenoVector<3, T> getWZY() const {
 			return { v[3], v[2], v[1] };
 		}
 
-		GenoVector<3, T> getWZZ() const {
+		constexpr GenoVector<3, T> getWZZ() const {
 			return { v[3], v[2], v[2] };
 		}
 
-		GenoVector<3, T> getWZW() const {
+		constexpr GenoVector<3, T> getWZW() const {
 			return { v[3], v[2], v[3] };
 		}
 
-		GenoVector<3, T> getWWX() const {
+		constexpr GenoVector<3, T> getWWX() const {
 			return { v[3], v[3], v[0] };
 		}
 
-		GenoVector<3, T> getWWY() const {
+		constexpr GenoVector<3, T> getWWY() const {
 			return { v[3], v[3], v[1] };
 		}
 
-		GenoVector<3, T> getWWZ() const {
+		constexpr GenoVector<3, T> getWWZ() const {
 			return { v[3], v[3], v[2] };
 		}
 
-		GenoVector<3, T> getWWW() const {
+		constexpr GenoVector<3, T> getWWW() const {
 			return { v[3], v[3], v[3] };
 		}
 
-		GenoVector<4, T> getXXXX() const {
+		constexpr GenoVector<4, T> getXXXX() const {
 			return { v[0], v[0], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getXXXY() const {
+		constexpr GenoVector<4, T> getXXXY() const {
 			return { v[0], v[0], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getXXXZ() const {
+		constexpr GenoVector<4, T> getXXXZ() const {
 			return { v[0], v[0], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getXXXW() const {
+		constexpr GenoVector<4, T> getXXXW() const {
 			return { v[0], v[0], v[0], v[3] };
 		}
 
-		GenoVector<4, T> getXXYX() const {
+		constexpr GenoVector<4, T> getXXYX() const {
 			return { v[0], v[0], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getXXYY() const {
+		constexpr GenoVector<4, T> getXXYY() const {
 			return { v[0], v[0], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getXXYZ() const {
+		constexpr GenoVector<4, T> getXXYZ() const {
 			return { v[0], v[0], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getXXYW() const {
+		constexpr GenoVector<4, T> getXXYW() const {
 			return { v[0], v[0], v[1], v[3] };
 		}
 
-		GenoVector<4, T> getXXZX() const {
+		constexpr GenoVector<4, T> getXXZX() const {
 			return { v[0], v[0], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getXXZY() const {
+		constexpr GenoVector<4, T> getXXZY() const {
 			return { v[0], v[0], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getXXZZ() const {
+		constexpr GenoVector<4, T> getXXZZ() const {
 			return { v[0], v[0], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getXXZW() const {
+		constexpr GenoVector<4, T> getXXZW() const {
 			return { v[0], v[0], v[2], v[3] };
 		}
 
-		GenoVector<4, T> getXXWX() const {
+		constexpr GenoVector<4, T> getXXWX() const {
 			return { v[0], v[0], v[3], v[0] };
 		}
 
-		GenoVector<4, T> getXXWY() const {
+		constexpr GenoVector<4, T> getXXWY() const {
 			return { v[0], v[0], v[3], v[1] };
 		}
 
-		GenoVector<4, T> getXXWZ() const {
+		constexpr GenoVector<4, T> getXXWZ() const {
 			return { v[0], v[0], v[3], v[2] };
 		}
 
-		GenoVector<4, T> getXXWW() const {
+		constexpr GenoVector<4, T> getXXWW() const {
 			return { v[0], v[0], v[3], v[3] };
 		}
 
-		GenoVector<4, T> getXYXX() const {
+		constexpr GenoVector<4, T> getXYXX() const {
 			return { v[0], v[1], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getXYXY() const {
+		constexpr GenoVector<4, T> getXYXY() const {
 			return { v[0], v[1], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getXYXZ() const {
+		constexpr GenoVector<4, T> getXYXZ() const {
 			return { v[0], v[1], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getXYXW() const {
+		constexpr GenoVector<4, T> getXYXW() const {
 			return { v[0], v[1], v[0], v[3] };
 		}
 
-		GenoVector<4, T> getXYYX() const {
+		constexpr GenoVector<4, T> getXYYX() const {
 			return { v[0], v[1], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getXYYY() const {
+		constexpr GenoVector<4, T> getXYYY() const {
 			return { v[0], v[1], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getXYYZ() const {
+		constexpr GenoVector<4, T> getXYYZ() const {
 			return { v[0], v[1], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getXYYW() const {
+		constexpr GenoVector<4, T> getXYYW() const {
 			return { v[0], v[1], v[1], v[3] };
 		}
 
-		GenoVector<4, T> getXYZX() const {
+		constexpr GenoVector<4, T> getXYZX() const {
 			return { v[0], v[1], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getXYZY() const {
+		constexpr GenoVector<4, T> getXYZY() const {
 			return { v[0], v[1], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getXYZZ() const {
+		constexpr GenoVector<4, T> getXYZZ() const {
 			return { v[0], v[1], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getXYZW() const {
+		constexpr GenoVector<4, T> getXYZW() const {
 			return { v[0], v[1], v[2], v[3] };
 		}
 
-		GenoVector<4, T> getXYWX() const {
+		constexpr GenoVector<4, T> getXYWX() const {
 			return { v[0], v[1], v[3], v[0] };
 		}
 
-		GenoVector<4, T> getXYWY() const {
+		constexpr GenoVector<4, T> getXYWY() const {
 			return { v[0], v[1], v[3], v[1] };
 		}
 
-		GenoVector<4, T> getXYWZ() const {
+		constexpr GenoVector<4, T> getXYWZ() const {
 			return { v[0], v[1], v[3], v[2] };
 		}
 
-		GenoVector<4, T> getXYWW() const {
+		constexpr GenoVector<4, T> getXYWW() const {
 			return { v[0], v[1], v[3], v[3] };
 		}
 
-		GenoVector<4, T> getXZXX() const {
+		constexpr GenoVector<4, T> getXZXX() const {
 			return { v[0], v[2], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getXZXY() const {
+		constexpr GenoVector<4, T> getXZXY() const {
 			return { v[0], v[2], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getXZXZ() const {
+		constexpr GenoVector<4, T> getXZXZ() const {
 			return { v[0], v[2], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getXZXW() const {
+		constexpr GenoVector<4, T> getXZXW() const {
 			return { v[0], v[2], v[0], v[3] };
 		}
 
-		GenoVector<4, T> getXZYX() const {
+		constexpr GenoVector<4, T> getXZYX() const {
 			return { v[0], v[2], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getXZYY() const {
+		constexpr GenoVector<4, T> getXZYY() const {
 			return { v[0], v[2], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getXZYZ() const {
+		constexpr GenoVector<4, T> getXZYZ() const {
 			return { v[0], v[2], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getXZYW() const {
+		constexpr GenoVector<4, T> getXZYW() const {
 			return { v[0], v[2], v[1], v[3] };
 		}
 
-		GenoVector<4, T> getXZZX() const {
+		constexpr GenoVector<4, T> getXZZX() const {
 			return { v[0], v[2], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getXZZY() const {
+		constexpr GenoVector<4, T> getXZZY() const {
 			return { v[0], v[2], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getXZZZ() const {
+		constexpr GenoVector<4, T> getXZZZ() const {
 			return { v[0], v[2], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getXZZW() const {
+		constexpr GenoVector<4, T> getXZZW() const {
 			return { v[0], v[2], v[2], v[3] };
 		}
 
-		GenoVector<4, T> getXZWX() const {
+		constexpr GenoVector<4, T> getXZWX() const {
 			return { v[0], v[2], v[3], v[0] };
 		}
 
-		GenoVector<4, T> getXZWY() const {
+		constexpr GenoVector<4, T> getXZWY() const {
 			return { v[0], v[2], v[3], v[1] };
 		}
 
-		GenoVector<4, T> getXZWZ() const {
+		constexpr GenoVector<4, T> getXZWZ() const {
 			return { v[0], v[2], v[3], v[2] };
 		}
 
-		GenoVector<4, T> getXZWW() const {
+		constexpr GenoVector<4, T> getXZWW() const {
 			return { v[0], v[2], v[3], v[3] };
 		}
 
-		GenoVector<4, T> getXWXX() const {
+		constexpr GenoVector<4, T> getXWXX() const {
 			return { v[0], v[3], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getXWXY() const {
+		constexpr GenoVector<4, T> getXWXY() const {
 			return { v[0], v[3], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getXWXZ() const {
+		constexpr GenoVector<4, T> getXWXZ() const {
 			return { v[0], v[3], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getXWXW() const {
+		constexpr GenoVector<4, T> getXWXW() const {
 			return { v[0], v[3], v[0], v[3] };
 		}
 
-		GenoVector<4, T> getXWYX() const {
+		constexpr GenoVector<4, T> getXWYX() const {
 			return { v[0], v[3], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getXWYY() const {
+		constexpr GenoVector<4, T> getXWYY() const {
 			return { v[0], v[3], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getXWYZ() const {
+		constexpr GenoVector<4, T> getXWYZ() const {
 			return { v[0], v[3], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getXWYW() const {
+		constexpr GenoVector<4, T> getXWYW() const {
 			return { v[0], v[3], v[1], v[3] };
 		}
 
-		GenoVector<4, T> getXWZX() const {
+		constexpr GenoVector<4, T> getXWZX() const {
 			return { v[0], v[3], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getXWZY() const {
+		constexpr GenoVector<4, T> getXWZY() const {
 			return { v[0], v[3], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getXWZZ() const {
+		constexpr GenoVector<4, T> getXWZZ() const {
 			return { v[0], v[3], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getXWZW() const {
+		constexpr GenoVector<4, T> getXWZW() const {
 			return { v[0], v[3], v[2], v[3] };
 		}
 
-		GenoVector<4, T> getXWWX() const {
+		constexpr GenoVector<4, T> getXWWX() const {
 			return { v[0], v[3], v[3], v[0] };
 		}
 
-		GenoVector<4, T> getXWWY() const {
+		constexpr GenoVector<4, T> getXWWY() const {
 			return { v[0], v[3], v[3], v[1] };
 		}
 
-		GenoVector<4, T> getXWWZ() const {
+		constexpr GenoVector<4, T> getXWWZ() const {
 			return { v[0], v[3], v[3], v[2] };
 		}
 
-		GenoVector<4, T> getXWWW() const {
+		constexpr GenoVector<4, T> getXWWW() const {
 			return { v[0], v[3], v[3], v[3] };
 		}
 
-		GenoVector<4, T> getYXXX() const {
+		constexpr GenoVector<4, T> getYXXX() const {
 			return { v[1], v[0], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getYXXY() const {
+		constexpr GenoVector<4, T> getYXXY() const {
 			return { v[1], v[0], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getYXXZ() const {
+		constexpr GenoVector<4, T> getYXXZ() const {
 			return { v[1], v[0], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getYXXW() const {
+		constexpr GenoVector<4, T> getYXXW() const {
 			return { v[1], v[0], v[0], v[3] };
 		}
 
-		GenoVector<4, T> getYXYX() const {
+		constexpr GenoVector<4, T> getYXYX() const {
 			return { v[1], v[0], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getYXYY() const {
+		constexpr GenoVector<4, T> getYXYY() const {
 			return { v[1], v[0], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getYXYZ() const {
+		constexpr GenoVector<4, T> getYXYZ() const {
 			return { v[1], v[0], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getYXYW() const {
+		constexpr GenoVector<4, T> getYXYW() const {
 			return { v[1], v[0], v[1], v[3] };
 		}
 
-		GenoVector<4, T> getYXZX() const {
+		constexpr GenoVector<4, T> getYXZX() const {
 			return { v[1], v[0], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getYXZY() const {
+		constexpr GenoVector<4, T> getYXZY() const {
 			return { v[1], v[0], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getYXZZ() const {
+		constexpr GenoVector<4, T> getYXZZ() const {
 			return { v[1], v[0], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getYXZW() const {
+		constexpr GenoVector<4, T> getYXZW() const {
 			return { v[1], v[0], v[2], v[3] };
 		}
 
-		GenoVector<4, T> getYXWX() const {
+		constexpr GenoVector<4, T> getYXWX() const {
 			return { v[1], v[0], v[3], v[0] };
 		}
 
-		GenoVector<4, T> getYXWY() const {
+		constexpr GenoVector<4, T> getYXWY() const {
 			return { v[1], v[0], v[3], v[1] };
 		}
 
-		GenoVector<4, T> getYXWZ() const {
+		constexpr GenoVector<4, T> getYXWZ() const {
 			return { v[1], v[0], v[3], v[2] };
 		}
 
-		GenoVector<4, T> getYXWW() const {
+		constexpr GenoVector<4, T> getYXWW() const {
 			return { v[1], v[0], v[3], v[3] };
 		}
 
-		GenoVector<4, T> getYYXX() const {
+		constexpr GenoVector<4, T> getYYXX() const {
 			return { v[1], v[1], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getYYXY() const {
+		constexpr GenoVector<4, T> getYYXY() const {
 			return { v[1], v[1], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getYYXZ() const {
+		constexpr GenoVector<4, T> getYYXZ() const {
 			return { v[1], v[1], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getYYXW() const {
+		constexpr GenoVector<4, T> getYYXW() const {
 			return { v[1], v[1], v[0], v[3] };
 		}
 
-		GenoVector<4, T> getYYYX() const {
+		constexpr GenoVector<4, T> getYYYX() const {
 			return { v[1], v[1], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getYYYY() const {
+		constexpr GenoVector<4, T> getYYYY() const {
 			return { v[1], v[1], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getYYYZ() const {
+		constexpr GenoVector<4, T> getYYYZ() const {
 			return { v[1], v[1], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getYYYW() const {
+		constexpr GenoVector<4, T> getYYYW() const {
 			return { v[1], v[1], v[1], v[3] };
 		}
 
-		GenoVector<4, T> getYYZX() const {
+		constexpr GenoVector<4, T> getYYZX() const {
 			return { v[1], v[1], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getYYZY() const {
+		constexpr GenoVector<4, T> getYYZY() const {
 			return { v[1], v[1], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getYYZZ() const {
+		constexpr GenoVector<4, T> getYYZZ() const {
 			return { v[1], v[1], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getYYZW() const {
+		constexpr GenoVector<4, T> getYYZW() const {
 			return { v[1], v[1], v[2], v[3] };
 		}
 
-		GenoVector<4, T> getYYWX() const {
+		constexpr GenoVector<4, T> getYYWX() const {
 			return { v[1], v[1], v[3], v[0] };
 		}
 
-		GenoVector<4, T> getYYWY() const {
+		constexpr GenoVector<4, T> getYYWY() const {
 			return { v[1], v[1], v[3], v[1] };
 		}
 
-		GenoVector<4, T> getYYWZ() const {
+		constexpr GenoVector<4, T> getYYWZ() const {
 			return { v[1], v[1], v[3], v[2] };
 		}
 
-		GenoVector<4, T> getYYWW() const {
+		constexpr GenoVector<4, T> getYYWW() const {
 			return { v[1], v[1], v[3], v[3] };
 		}
 
-		GenoVector<4, T> getYZXX() const {
+		constexpr GenoVector<4, T> getYZXX() const {
 			return { v[1], v[2], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getYZXY() const {
+		constexpr GenoVector<4, T> getYZXY() const {
 			return { v[1], v[2], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getYZXZ() const {
+		constexpr GenoVector<4, T> getYZXZ() const {
 			return { v[1], v[2], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getYZXW() const {
+		constexpr GenoVector<4, T> getYZXW() const {
 			return { v[1], v[2], v[0], v[3] };
 		}
 
-		GenoVector<4, T> getYZYX() const {
+		constexpr GenoVector<4, T> getYZYX() const {
 			return { v[1], v[2], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getYZYY() const {
+		constexpr GenoVector<4, T> getYZYY() const {
 			return { v[1], v[2], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getYZYZ() const {
+		constexpr GenoVector<4, T> getYZYZ() const {
 			return { v[1], v[2], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getYZYW() const {
+		constexpr GenoVector<4, T> getYZYW() const {
 			return { v[1], v[2], v[1], v[3] };
 		}
 
-		GenoVector<4, T> getYZZX() const {
+		constexpr GenoVector<4, T> getYZZX() const {
 			return { v[1], v[2], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getYZZY() const {
+		constexpr GenoVector<4, T> getYZZY() const {
 			return { v[1], v[2], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getYZZZ() const {
+		constexpr GenoVector<4, T> getYZZZ() const {
 			return { v[1], v[2], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getYZZW() const {
+		constexpr GenoVector<4, T> getYZZW() const {
 			return { v[1], v[2], v[2], v[3] };
 		}
 
-		GenoVector<4, T> getYZWX() const {
+		constexpr GenoVector<4, T> getYZWX() const {
 			return { v[1], v[2], v[3], v[0] };
 		}
 
-		GenoVector<4, T> getYZWY() const {
+		constexpr GenoVector<4, T> getYZWY() const {
 			return { v[1], v[2], v[3], v[1] };
 		}
 
-		GenoVector<4, T> getYZWZ() const {
+		constexpr GenoVector<4, T> getYZWZ() const {
 			return { v[1], v[2], v[3], v[2] };
 		}
 
-		GenoVector<4, T> getYZWW() const {
+		constexpr GenoVector<4, T> getYZWW() const {
 			return { v[1], v[2], v[3], v[3] };
 		}
 
-		GenoVector<4, T> getYWXX() const {
+		constexpr GenoVector<4, T> getYWXX() const {
 			return { v[1], v[3], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getYWXY() const {
+		constexpr GenoVector<4, T> getYWXY() const {
 			return { v[1], v[3], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getYWXZ() const {
+		constexpr GenoVector<4, T> getYWXZ() const {
 			return { v[1], v[3], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getYWXW() const {
+		constexpr GenoVector<4, T> getYWXW() const {
 			return { v[1], v[3], v[0], v[3] };
 		}
 
-		GenoVector<4, T> getYWYX() const {
+		constexpr GenoVector<4, T> getYWYX() const {
 			return { v[1], v[3], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getYWYY() const {
+		constexpr GenoVector<4, T> getYWYY() const {
 			return { v[1], v[3], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getYWYZ() const {
+		constexpr GenoVector<4, T> getYWYZ() const {
 			return { v[1], v[3], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getYWYW() const {
+		constexpr GenoVector<4, T> getYWYW() const {
 			return { v[1], v[3], v[1], v[3] };
 		}
 
-		GenoVector<4, T> getYWZX() const {
+		constexpr GenoVector<4, T> getYWZX() const {
 			return { v[1], v[3], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getYWZY() const {
+		constexpr GenoVector<4, T> getYWZY() const {
 			return { v[1], v[3], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getYWZZ() const {
+		constexpr GenoVector<4, T> getYWZZ() const {
 			return { v[1], v[3], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getYWZW() const {
+		constexpr GenoVector<4, T> getYWZW() const {
 			return { v[1], v[3], v[2], v[3] };
 		}
 
-		GenoVector<4, T> getYWWX() const {
+		constexpr GenoVector<4, T> getYWWX() const {
 			return { v[1], v[3], v[3], v[0] };
 		}
 
-		GenoVector<4, T> getYWWY() const {
+		constexpr GenoVector<4, T> getYWWY() const {
 			return { v[1], v[3], v[3], v[1] };
 		}
 
-		GenoVector<4, T> getYWWZ() const {
+		constexpr GenoVector<4, T> getYWWZ() const {
 			return { v[1], v[3], v[3], v[2] };
 		}
 
-		GenoVector<4, T> getYWWW() const {
+		constexpr GenoVector<4, T> getYWWW() const {
 			return { v[1], v[3], v[3], v[3] };
 		}
 
-		GenoVector<4, T> getZXXX() const {
+		constexpr GenoVector<4, T> getZXXX() const {
 			return { v[2], v[0], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getZXXY() const {
+		constexpr GenoVector<4, T> getZXXY() const {
 			return { v[2], v[0], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getZXXZ() const {
+		constexpr GenoVector<4, T> getZXXZ() const {
 			return { v[2], v[0], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getZXXW() const {
+		constexpr GenoVector<4, T> getZXXW() const {
 			return { v[2], v[0], v[0], v[3] };
 		}
 
-		GenoVector<4, T> getZXYX() const {
+		constexpr GenoVector<4, T> getZXYX() const {
 			return { v[2], v[0], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getZXYY() const {
+		constexpr GenoVector<4, T> getZXYY() const {
 			return { v[2], v[0], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getZXYZ() const {
+		constexpr GenoVector<4, T> getZXYZ() const {
 			return { v[2], v[0], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getZXYW() const {
+		constexpr GenoVector<4, T> getZXYW() const {
 			return { v[2], v[0], v[1], v[3] };
 		}
 
-		GenoVector<4, T> getZXZX() const {
+		constexpr GenoVector<4, T> getZXZX() const {
 			return { v[2], v[0], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getZXZY() const {
+		constexpr GenoVector<4, T> getZXZY() const {
 			return { v[2], v[0], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getZXZZ() const {
+		constexpr GenoVector<4, T> getZXZZ() const {
 			return { v[2], v[0], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getZXZW() const {
+		constexpr GenoVector<4, T> getZXZW() const {
 			return { v[2], v[0], v[2], v[3] };
 		}
 
-		GenoVector<4, T> getZXWX() const {
+		constexpr GenoVector<4, T> getZXWX() const {
 			return { v[2], v[0], v[3], v[0] };
 		}
 
-		GenoVector<4, T> getZXWY() const {
+		constexpr GenoVector<4, T> getZXWY() const {
 			return { v[2], v[0], v[3], v[1] };
 		}
 
-		GenoVector<4, T> getZXWZ() const {
+		constexpr GenoVector<4, T> getZXWZ() const {
 			return { v[2], v[0], v[3], v[2] };
 		}
 
-		GenoVector<4, T> getZXWW() const {
+		constexpr GenoVector<4, T> getZXWW() const {
 			return { v[2], v[0], v[3], v[3] };
 		}
 
-		GenoVector<4, T> getZYXX() const {
+		constexpr GenoVector<4, T> getZYXX() const {
 			return { v[2], v[1], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getZYXY() const {
+		constexpr GenoVector<4, T> getZYXY() const {
 			return { v[2], v[1], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getZYXZ() const {
+		constexpr GenoVector<4, T> getZYXZ() const {
 			return { v[2], v[1], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getZYXW() const {
+		constexpr GenoVector<4, T> getZYXW() const {
 			return { v[2], v[1], v[0], v[3] };
 		}
 
-		GenoVector<4, T> getZYYX() const {
+		constexpr GenoVector<4, T> getZYYX() const {
 			return { v[2], v[1], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getZYYY() const {
+		constexpr GenoVector<4, T> getZYYY() const {
 			return { v[2], v[1], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getZYYZ() const {
+		constexpr GenoVector<4, T> getZYYZ() const {
 			return { v[2], v[1], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getZYYW() const {
+		constexpr GenoVector<4, T> getZYYW() const {
 			return { v[2], v[1], v[1], v[3] };
 		}
 
-		GenoVector<4, T> getZYZX() const {
+		constexpr GenoVector<4, T> getZYZX() const {
 			return { v[2], v[1], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getZYZY() const {
+		constexpr GenoVector<4, T> getZYZY() const {
 			return { v[2], v[1], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getZYZZ() const {
+		constexpr GenoVector<4, T> getZYZZ() const {
 			return { v[2], v[1], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getZYZW() const {
+		constexpr GenoVector<4, T> getZYZW() const {
 			return { v[2], v[1], v[2], v[3] };
 		}
 
-		GenoVector<4, T> getZYWX() const {
+		constexpr GenoVector<4, T> getZYWX() const {
 			return { v[2], v[1], v[3], v[0] };
 		}
 
-		GenoVector<4, T> getZYWY() const {
+		constexpr GenoVector<4, T> getZYWY() const {
 			return { v[2], v[1], v[3], v[1] };
 		}
 
-		GenoVector<4, T> getZYWZ() const {
+		constexpr GenoVector<4, T> getZYWZ() const {
 			return { v[2], v[1], v[3], v[2] };
 		}
 
-		GenoVector<4, T> getZYWW() const {
+		constexpr GenoVector<4, T> getZYWW() const {
 			return { v[2], v[1], v[3], v[3] };
 		}
 
-		GenoVector<4, T> getZZXX() const {
+		constexpr GenoVector<4, T> getZZXX() const {
 			return { v[2], v[2], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getZZXY() const {
+		constexpr GenoVector<4, T> getZZXY() const {
 			return { v[2], v[2], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getZZXZ() const {
+		constexpr GenoVector<4, T> getZZXZ() const {
 			return { v[2], v[2], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getZZXW() const {
+		constexpr GenoVector<4, T> getZZXW() const {
 			return { v[2], v[2], v[0], v[3] };
 		}
 
-		GenoVector<4, T> getZZYX() const {
+		constexpr GenoVector<4, T> getZZYX() const {
 			return { v[2], v[2], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getZZYY() const {
+		constexpr GenoVector<4, T> getZZYY() const {
 			return { v[2], v[2], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getZZYZ() const {
+		constexpr GenoVector<4, T> getZZYZ() const {
 			return { v[2], v[2], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getZZYW() const {
+		constexpr GenoVector<4, T> getZZYW() const {
 			return { v[2], v[2], v[1], v[3] };
 		}
 
-		GenoVector<4, T> getZZZX() const {
+		constexpr GenoVector<4, T> getZZZX() const {
 			return { v[2], v[2], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getZZZY() const {
+		constexpr GenoVector<4, T> getZZZY() const {
 			return { v[2], v[2], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getZZZZ() const {
+		constexpr GenoVector<4, T> getZZZZ() const {
 			return { v[2], v[2], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getZZZW() const {
+		constexpr GenoVector<4, T> getZZZW() const {
 			return { v[2], v[2], v[2], v[3] };
 		}
 
-		GenoVector<4, T> getZZWX() const {
+		constexpr GenoVector<4, T> getZZWX() const {
 			return { v[2], v[2], v[3], v[0] };
 		}
 
-		GenoVector<4, T> getZZWY() const {
+		constexpr GenoVector<4, T> getZZWY() const {
 			return { v[2], v[2], v[3], v[1] };
 		}
 
-		GenoVector<4, T> getZZWZ() const {
+		constexpr GenoVector<4, T> getZZWZ() const {
 			return { v[2], v[2], v[3], v[2] };
 		}
 
-		GenoVector<4, T> getZZWW() const {
+		constexpr GenoVector<4, T> getZZWW() const {
 			return { v[2], v[2], v[3], v[3] };
 		}
 
-		GenoVector<4, T> getZWXX() const {
+		constexpr GenoVector<4, T> getZWXX() const {
 			return { v[2], v[3], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getZWXY() const {
+		constexpr GenoVector<4, T> getZWXY() const {
 			return { v[2], v[3], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getZWXZ() const {
+		constexpr GenoVector<4, T> getZWXZ() const {
 			return { v[2], v[3], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getZWXW() const {
+		constexpr GenoVector<4, T> getZWXW() const {
 			return { v[2], v[3], v[0], v[3] };
 		}
 
-		GenoVector<4, T> getZWYX() const {
+		constexpr GenoVector<4, T> getZWYX() const {
 			return { v[2], v[3], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getZWYY() const {
+		constexpr GenoVector<4, T> getZWYY() const {
 			return { v[2], v[3], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getZWYZ() const {
+		constexpr GenoVector<4, T> getZWYZ() const {
 			return { v[2], v[3], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getZWYW() const {
+		constexpr GenoVector<4, T> getZWYW() const {
 			return { v[2], v[3], v[1], v[3] };
 		}
 
-		GenoVector<4, T> getZWZX() const {
+		constexpr GenoVector<4, T> getZWZX() const {
 			return { v[2], v[3], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getZWZY() const {
+		constexpr GenoVector<4, T> getZWZY() const {
 			return { v[2], v[3], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getZWZZ() const {
+		constexpr GenoVector<4, T> getZWZZ() const {
 			return { v[2], v[3], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getZWZW() const {
+		constexpr GenoVector<4, T> getZWZW() const {
 			return { v[2], v[3], v[2], v[3] };
 		}
 
-		GenoVector<4, T> getZWWX() const {
+		constexpr GenoVector<4, T> getZWWX() const {
 			return { v[2], v[3], v[3], v[0] };
 		}
 
-		GenoVector<4, T> getZWWY() const {
+		constexpr GenoVector<4, T> getZWWY() const {
 			return { v[2], v[3], v[3], v[1] };
 		}
 
-		GenoVector<4, T> getZWWZ() const {
+		constexpr GenoVector<4, T> getZWWZ() const {
 			return { v[2], v[3], v[3], v[2] };
 		}
 
-		GenoVector<4, T> getZWWW() const {
+		constexpr GenoVector<4, T> getZWWW() const {
 			return { v[2], v[3], v[3], v[3] };
 		}
 
-		GenoVector<4, T> getWXXX() const {
+		constexpr GenoVector<4, T> getWXXX() const {
 			return { v[3], v[0], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getWXXY() const {
+		constexpr GenoVector<4, T> getWXXY() const {
 			return { v[3], v[0], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getWXXZ() const {
+		constexpr GenoVector<4, T> getWXXZ() const {
 			return { v[3], v[0], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getWXXW() const {
+		constexpr GenoVector<4, T> getWXXW() const {
 			return { v[3], v[0], v[0], v[3] };
 		}
 
-		GenoVector<4, T> getWXYX() const {
+		constexpr GenoVector<4, T> getWXYX() const {
 			return { v[3], v[0], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getWXYY() const {
+		constexpr GenoVector<4, T> getWXYY() const {
 			return { v[3], v[0], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getWXYZ() const {
+		constexpr GenoVector<4, T> getWXYZ() const {
 			return { v[3], v[0], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getWXYW() const {
+		constexpr GenoVector<4, T> getWXYW() const {
 			return { v[3], v[0], v[1], v[3] };
 		}
 
-		GenoVector<4, T> getWXZX() const {
+		constexpr GenoVector<4, T> getWXZX() const {
 			return { v[3], v[0], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getWXZY() const {
+		constexpr GenoVector<4, T> getWXZY() const {
 			return { v[3], v[0], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getWXZZ() const {
+		constexpr GenoVector<4, T> getWXZZ() const {
 			return { v[3], v[0], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getWXZW() const {
+		constexpr GenoVector<4, T> getWXZW() const {
 			return { v[3], v[0], v[2], v[3] };
 		}
 
-		GenoVector<4, T> getWXWX() const {
+		constexpr GenoVector<4, T> getWXWX() const {
 			return { v[3], v[0], v[3], v[0] };
 		}
 
-		GenoVector<4, T> getWXWY() const {
+		constexpr GenoVector<4, T> getWXWY() const {
 			return { v[3], v[0], v[3], v[1] };
 		}
 
-		GenoVector<4, T> getWXWZ() const {
+		constexpr GenoVector<4, T> getWXWZ() const {
 			return { v[3], v[0], v[3], v[2] };
 		}
 
-		GenoVector<4, T> getWXWW() const {
+		constexpr GenoVector<4, T> getWXWW() const {
 			return { v[3], v[0], v[3], v[3] };
 		}
 
-		GenoVector<4, T> getWYXX() const {
+		constexpr GenoVector<4, T> getWYXX() const {
 			return { v[3], v[1], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getWYXY() const {
+		constexpr GenoVector<4, T> getWYXY() const {
 			return { v[3], v[1], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getWYXZ() const {
+		constexpr GenoVector<4, T> getWYXZ() const {
 			return { v[3], v[1], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getWYXW() const {
+		constexpr GenoVector<4, T> getWYXW() const {
 			return { v[3], v[1], v[0], v[3] };
 		}
 
-		GenoVector<4, T> getWYYX() const {
+		constexpr GenoVector<4, T> getWYYX() const {
 			return { v[3], v[1], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getWYYY() const {
+		constexpr GenoVector<4, T> getWYYY() const {
 			return { v[3], v[1], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getWYYZ() const {
+		constexpr GenoVector<4, T> getWYYZ() const {
 			return { v[3], v[1], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getWYYW() const {
+		constexpr GenoVector<4, T> getWYYW() const {
 			return { v[3], v[1], v[1], v[3] };
 		}
 
-		GenoVector<4, T> getWYZX() const {
+		constexpr GenoVector<4, T> getWYZX() const {
 			return { v[3], v[1], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getWYZY() const {
+		constexpr GenoVector<4, T> getWYZY() const {
 			return { v[3], v[1], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getWYZZ() const {
+		constexpr GenoVector<4, T> getWYZZ() const {
 			return { v[3], v[1], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getWYZW() const {
+		constexpr GenoVector<4, T> getWYZW() const {
 			return { v[3], v[1], v[2], v[3] };
 		}
 
-		GenoVector<4, T> getWYWX() const {
+		constexpr GenoVector<4, T> getWYWX() const {
 			return { v[3], v[1], v[3], v[0] };
 		}
 
-		GenoVector<4, T> getWYWY() const {
+		constexpr GenoVector<4, T> getWYWY() const {
 			return { v[3], v[1], v[3], v[1] };
 		}
 
-		GenoVector<4, T> getWYWZ() const {
+		constexpr GenoVector<4, T> getWYWZ() const {
 			return { v[3], v[1], v[3], v[2] };
 		}
 
-		GenoVector<4, T> getWYWW() const {
+		constexpr GenoVector<4, T> getWYWW() const {
 			return { v[3], v[1], v[3], v[3] };
 		}
 
-		GenoVector<4, T> getWZXX() const {
+		constexpr GenoVector<4, T> getWZXX() const {
 			return { v[3], v[2], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getWZXY() const {
+		constexpr GenoVector<4, T> getWZXY() const {
 			return { v[3], v[2], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getWZXZ() const {
+		constexpr GenoVector<4, T> getWZXZ() const {
 			return { v[3], v[2], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getWZXW() const {
+		constexpr GenoVector<4, T> getWZXW() const {
 			return { v[3], v[2], v[0], v[3] };
 		}
 
-		GenoVector<4, T> getWZYX() const {
+		constexpr GenoVector<4, T> getWZYX() const {
 			return { v[3], v[2], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getWZYY() const {
+		constexpr GenoVector<4, T> getWZYY() const {
 			return { v[3], v[2], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getWZYZ() const {
+		constexpr GenoVector<4, T> getWZYZ() const {
 			return { v[3], v[2], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getWZYW() const {
+		constexpr GenoVector<4, T> getWZYW() const {
 			return { v[3], v[2], v[1], v[3] };
 		}
 
-		GenoVector<4, T> getWZZX() const {
+		constexpr GenoVector<4, T> getWZZX() const {
 			return { v[3], v[2], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getWZZY() const {
+		constexpr GenoVector<4, T> getWZZY() const {
 			return { v[3], v[2], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getWZZZ() const {
+		constexpr GenoVector<4, T> getWZZZ() const {
 			return { v[3], v[2], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getWZZW() const {
+		constexpr GenoVector<4, T> getWZZW() const {
 			return { v[3], v[2], v[2], v[3] };
 		}
 
-		GenoVector<4, T> getWZWX() const {
+		constexpr GenoVector<4, T> getWZWX() const {
 			return { v[3], v[2], v[3], v[0] };
 		}
 
-		GenoVector<4, T> getWZWY() const {
+		constexpr GenoVector<4, T> getWZWY() const {
 			return { v[3], v[2], v[3], v[1] };
 		}
 
-		GenoVector<4, T> getWZWZ() const {
+		constexpr GenoVector<4, T> getWZWZ() const {
 			return { v[3], v[2], v[3], v[2] };
 		}
 
-		GenoVector<4, T> getWZWW() const {
+		constexpr GenoVector<4, T> getWZWW() const {
 			return { v[3], v[2], v[3], v[3] };
 		}
 
-		GenoVector<4, T> getWWXX() const {
+		constexpr GenoVector<4, T> getWWXX() const {
 			return { v[3], v[3], v[0], v[0] };
 		}
 
-		GenoVector<4, T> getWWXY() const {
+		constexpr GenoVector<4, T> getWWXY() const {
 			return { v[3], v[3], v[0], v[1] };
 		}
 
-		GenoVector<4, T> getWWXZ() const {
+		constexpr GenoVector<4, T> getWWXZ() const {
 			return { v[3], v[3], v[0], v[2] };
 		}
 
-		GenoVector<4, T> getWWXW() const {
+		constexpr GenoVector<4, T> getWWXW() const {
 			return { v[3], v[3], v[0], v[3] };
 		}
 
-		GenoVector<4, T> getWWYX() const {
+		constexpr GenoVector<4, T> getWWYX() const {
 			return { v[3], v[3], v[1], v[0] };
 		}
 
-		GenoVector<4, T> getWWYY() const {
+		constexpr GenoVector<4, T> getWWYY() const {
 			return { v[3], v[3], v[1], v[1] };
 		}
 
-		GenoVector<4, T> getWWYZ() const {
+		constexpr GenoVector<4, T> getWWYZ() const {
 			return { v[3], v[3], v[1], v[2] };
 		}
 
-		GenoVector<4, T> getWWYW() const {
+		constexpr GenoVector<4, T> getWWYW() const {
 			return { v[3], v[3], v[1], v[3] };
 		}
 
-		GenoVector<4, T> getWWZX() const {
+		constexpr GenoVector<4, T> getWWZX() const {
 			return { v[3], v[3], v[2], v[0] };
 		}
 
-		GenoVector<4, T> getWWZY() const {
+		constexpr GenoVector<4, T> getWWZY() const {
 			return { v[3], v[3], v[2], v[1] };
 		}
 
-		GenoVector<4, T> getWWZZ() const {
+		constexpr GenoVector<4, T> getWWZZ() const {
 			return { v[3], v[3], v[2], v[2] };
 		}
 
-		GenoVector<4, T> getWWZW() const {
+		constexpr GenoVector<4, T> getWWZW() const {
 			return { v[3], v[3], v[2], v[3] };
 		}
 
-		GenoVector<4, T> getWWWX() const {
+		constexpr GenoVector<4, T> getWWWX() const {
 			return { v[3], v[3], v[3], v[0] };
 		}
 
-		GenoVector<4, T> getWWWY() const {
+		constexpr GenoVector<4, T> getWWWY() const {
 			return { v[3], v[3], v[3], v[1] };
 		}
 
-		GenoVector<4, T> getWWWZ() const {
+		constexpr GenoVector<4, T> getWWWZ() const {
 			return { v[3], v[3], v[3], v[2] };
 		}
 
-		GenoVector<4, T> getWWWW() const {
+		constexpr GenoVector<4, T> getWWWW() const {
 			return { v[3], v[3], v[3], v[3] };
 		}
-
-		virtual ~GenoVector() noexcept {
-			clean();
-		}
 };
 
 template <typename T>
-GenoVector<4, T> operator-(const GenoVector<4, T> & vector) {
-	return {
-		-vector.v[0],
-		-vector.v[1],
-		-vector.v[2],
-		-vector.v[3]
-	};
+constexpr GenoVectorNegate<4, T, GenoVector<4, T>> operator-(const GenoVector<4, T> & vector) {
+	return { vector };
 }
 
 template <typename T>
-GenoVector<4, T> operator+(const GenoVector<4, T> & left, const GenoVector<4, T> & right) {
-	return {
-		left.v[0] + right.v[0],
-		left.v[1] + right.v[1],
-		left.v[2] + right.v[2],
-		left.v[3] + right.v[3]
-	};
+constexpr GenoVectorPair<4, T, GenoVectorExpressions::Add> operator+(const GenoVector<4, T> & left, const GenoVector<4, T> & right) {
+	return { left, right };
 }
 
 template <typename T>
-GenoVector<4, T> operator-(const GenoVector<4, T> & left, const GenoVector<4, T> & right) {
-	return {
-		left.v[0] - right.v[0],
-		left.v[1] - right.v[1],
-		left.v[2] - right.v[2],
-		left.v[3] - right.v[3]
-	};
+constexpr GenoVectorPair<4, T, GenoVectorExpressions::Subtract> operator-(const GenoVector<4, T> & left, const GenoVector<4, T> & right) {
+	return { left, right };
 }
 
 template <typename T>
-GenoVector<4, T> operator*(T left, const GenoVector<4, T> & right) {
-	return {
-		left * right.v[0],
-		left * right.v[1],
-		left * right.v[2],
-		left * right.v[3]
-	};
+constexpr GenoVectorPreScaled<4, T> operator*(T left, const GenoVector<4, T> & right) {
+	return { { left }, right };
 }
 
 template <typename T>
-GenoVector<4, T> operator*(const GenoVector<4, T> & left, T right) {
-	return {
-		left.v[0] * right,
-		left.v[1] * right,
-		left.v[2] * right,
-		left.v[3] * right
-	};
+constexpr GenoVectorScaled<4, T, GenoVectorExpressions::Multiply> operator*(const GenoVector<4, T> & left, T right) {
+	return { left, { right } };
 }
 
 template <typename T>
-GenoVector<4, T> operator*(const GenoVector<4, T> & left, const GenoVector<4, T> & right) {
-	return {
-		left.v[0] * right.v[0],
-		left.v[1] * right.v[1],
-		left.v[2] * right.v[2],
-		left.v[3] * right.v[3]
-	};
+constexpr GenoVectorPair<4, T, GenoVectorExpressions::Multiply> operator*(const GenoVector<4, T> & left, const GenoVector<4, T> & right) {
+	return { left, right };
 }
 
 template <typename T>
-GenoVector<4, T> operator/(const GenoVector<4, T> & left, T right) {
-	return {
-		left.v[0] / right,
-		left.v[1] / right,
-		left.v[2] / right,
-		left.v[3] / right
-	};
+constexpr GenoVectorScaled<4, T, GenoVectorExpressions::Divide> operator/(const GenoVector<4, T> & left, T right) {
+	return { left, { right } };
 }
 
 template <typename T>
-GenoVector<4, T> operator/(const GenoVector<4, T> & left, const GenoVector<4, T> & right) {
-	return {
-		left.v[0] / right.v[0],
-		left.v[1] / right.v[1],
-		left.v[2] / right.v[2],
-		left.v[3] / right.v[3]
-	};
+constexpr GenoVectorPair<4, T, GenoVectorExpressions::Divide> operator/(const GenoVector<4, T> & left, const GenoVector<4, T> & right) {
+	return { left, right };
 }
 
 template <typename T>
@@ -3313,7 +3456,49 @@ GenoVector<4, T> & normalize(const GenoVector<4, T> & vector, GenoVector<4, T> &
 }
 
 template <typename T>
-GenoVector<4, T> negate(const GenoVector<4, T> & vector) {
+GenoVector<4, T> fastSetLength(const GenoVector<4, T> & vector, T length) {
+	auto scalar = length * fastInverseSqrt(vector.getLengthSquared());
+	return {
+		vector.v[0] * scalar,
+		vector.v[1] * scalar,
+		vector.v[2] * scalar,
+		vector.v[3] * scalar
+	};
+}
+
+template <typename T>
+GenoVector<4, T> & fastSetLength(const GenoVector<4, T> & vector, T length, GenoVector<4, T> & target) {
+	auto scalar = length * fastInverseSqrt(vector.getLengthSquared());
+	target.v[0] = vector.v[0] * scalar;
+	target.v[1] = vector.v[1] * scalar;
+	target.v[2] = vector.v[2] * scalar;
+	target.v[3] = vector.v[3] * scalar;
+	return target;
+}
+
+template <typename T>
+GenoVector<4, T> fastNormalize(const GenoVector<4, T> & vector) {
+	auto scalar = fastInverseSqrt(vector.getLengthSquared());
+	return {
+		vector.v[0] * scalar,
+		vector.v[1] * scalar,
+		vector.v[2] * scalar,
+		vector.v[3] * scalar
+	};
+}
+
+template <typename T>
+GenoVector<4, T> & fastNormalize(const GenoVector<4, T> & vector, GenoVector<4, T> & target) {
+	auto scalar = fastInverseSqrt(vector.getLengthSquared());
+	target.v[0] = vector.v[0] * scalar;
+	target.v[1] = vector.v[1] * scalar;
+	target.v[2] = vector.v[2] * scalar;
+	target.v[3] = vector.v[3] * scalar;
+	return target;
+}
+
+template <typename T>
+constexpr GenoVector<4, T> negate(const GenoVector<4, T> & vector) {
 	return {
 		-vector.v[0],
 		-vector.v[1],
@@ -3323,7 +3508,7 @@ GenoVector<4, T> negate(const GenoVector<4, T> & vector) {
 }
 
 template <typename T>
-GenoVector<4, T> & negate(const GenoVector<4, T> & vector, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> & negate(const GenoVector<4, T> & vector, GenoVector<4, T> & target) {
 	target.v[0] = -vector.v[0];
 	target.v[1] = -vector.v[1];
 	target.v[2] = -vector.v[2];
@@ -3332,7 +3517,7 @@ GenoVector<4, T> & negate(const GenoVector<4, T> & vector, GenoVector<4, T> & ta
 }
 
 template <typename T>
-T dot(const GenoVector<4, T> & left, const GenoVector<4, T> & right) {
+constexpr T dot(const GenoVector<4, T> & left, const GenoVector<4, T> & right) {
 	return (
 		left.v[0] * right.v[0] +
 		left.v[1] * right.v[1] +
@@ -3342,7 +3527,7 @@ T dot(const GenoVector<4, T> & left, const GenoVector<4, T> & right) {
 }
 
 template <typename T>
-GenoVector<4, T> project(const GenoVector<4, T> & vector, const GenoVector<4, T> & projection) {
+constexpr GenoVector<4, T> project(const GenoVector<4, T> & vector, const GenoVector<4, T> & projection) {
 	auto scalar = dot(vector, projection) / projection.getLengthSquared();
 	return {
 		scalar * projection.v[0],
@@ -3353,7 +3538,7 @@ GenoVector<4, T> project(const GenoVector<4, T> & vector, const GenoVector<4, T>
 }
 
 template <typename T>
-GenoVector<4, T> & project(const GenoVector<4, T> & vector, const GenoVector<4, T> & projection, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> & project(const GenoVector<4, T> & vector, const GenoVector<4, T> & projection, GenoVector<4, T> & target) {
 	auto scalar = dot(vector, projection) / projection.getLengthSquared();
 	target.v[0] = scalar * projection.v[0];
 	target.v[1] = scalar * projection.v[1];
@@ -3363,7 +3548,7 @@ GenoVector<4, T> & project(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template <typename T>
-GenoVector<4, T> lerp(const GenoVector<4, T> & start, const GenoVector<4, T> & end, double interpAmount) {
+constexpr GenoVector<4, T> lerp(const GenoVector<4, T> & start, const GenoVector<4, T> & end, double interpAmount) {
 	return {
 		(T) (start.v[0] + (end.v[0] - start.v[0]) * interpAmount),
 		(T) (start.v[1] + (end.v[1] - start.v[1]) * interpAmount),
@@ -3373,7 +3558,7 @@ GenoVector<4, T> lerp(const GenoVector<4, T> & start, const GenoVector<4, T> & e
 }
 
 template <typename T>
-GenoVector<4, T> & lerp(const GenoVector<4, T> & start, const GenoVector<4, T> & end, double interpAmount, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> & lerp(const GenoVector<4, T> & start, const GenoVector<4, T> & end, double interpAmount, GenoVector<4, T> & target) {
 	target.v[0] = (T) (start.v[0] + (end.v[0] - start.v[0]) * interpAmount);
 	target.v[1] = (T) (start.v[1] + (end.v[1] - start.v[1]) * interpAmount);
 	target.v[2] = (T) (start.v[2] + (end.v[2] - start.v[2]) * interpAmount);
@@ -3382,7 +3567,7 @@ GenoVector<4, T> & lerp(const GenoVector<4, T> & start, const GenoVector<4, T> &
 }
 
 template <typename T>
-GenoVector<4, T> translate(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translate(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0]	+ translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -3392,7 +3577,7 @@ GenoVector<4, T> translate(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template <typename T>
-GenoVector<4, T> & translate(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> & translate(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -3401,7 +3586,7 @@ GenoVector<4, T> & translate(const GenoVector<4, T> & vector, const GenoVector<4
 }
 
 template <typename T>
-GenoVector<4, T> scale(const GenoVector<4, T> & vector, T scale) {
+constexpr GenoVector<4, T> scale(const GenoVector<4, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale,
@@ -3411,7 +3596,7 @@ GenoVector<4, T> scale(const GenoVector<4, T> & vector, T scale) {
 }
 
 template <typename T>
-GenoVector<4, T> & scale(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> & scale(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2] * scale;
@@ -3420,7 +3605,7 @@ GenoVector<4, T> & scale(const GenoVector<4, T> & vector, T scale, GenoVector<4,
 }
 
 template <typename T>
-GenoVector<4, T> scale(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scale(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -3430,7 +3615,7 @@ GenoVector<4, T> scale(const GenoVector<4, T> & vector, const GenoVector<4, T> &
 }
 
 template <typename T>
-GenoVector<4, T> & scale(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> & scale(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -3439,7 +3624,7 @@ GenoVector<4, T> & scale(const GenoVector<4, T> & vector, const GenoVector<4, T>
 }
 
 template<typename T>
-GenoVector<4, T> setX(const GenoVector<4, T> & vector, T x) {
+constexpr GenoVector<4, T> setX(const GenoVector<4, T> & vector, T x) {
 	return {
 		x,
 		vector.v[1],
@@ -3449,7 +3634,7 @@ GenoVector<4, T> setX(const GenoVector<4, T> & vector, T x) {
 }
 
 template<typename T>
-GenoVector<4, T> setY(const GenoVector<4, T> & vector, T y) {
+constexpr GenoVector<4, T> setY(const GenoVector<4, T> & vector, T y) {
 	return {
 		vector.v[0],
 		y,
@@ -3459,7 +3644,7 @@ GenoVector<4, T> setY(const GenoVector<4, T> & vector, T y) {
 }
 
 template<typename T>
-GenoVector<4, T> setZ(const GenoVector<4, T> & vector, T z) {
+constexpr GenoVector<4, T> setZ(const GenoVector<4, T> & vector, T z) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -3469,7 +3654,7 @@ GenoVector<4, T> setZ(const GenoVector<4, T> & vector, T z) {
 }
 
 template<typename T>
-GenoVector<4, T> setW(const GenoVector<4, T> & vector, T w) {
+constexpr GenoVector<4, T> setW(const GenoVector<4, T> & vector, T w) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -3479,7 +3664,7 @@ GenoVector<4, T> setW(const GenoVector<4, T> & vector, T w) {
 }
 
 template<typename T>
-GenoVector<4, T> setXY(const GenoVector<4, T> & vector, T x, T y) {
+constexpr GenoVector<4, T> setXY(const GenoVector<4, T> & vector, T x, T y) {
 	return {
 		x,
 		y,
@@ -3489,7 +3674,7 @@ GenoVector<4, T> setXY(const GenoVector<4, T> & vector, T x, T y) {
 }
 
 template<typename T>
-GenoVector<4, T> setXY(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<4, T> setXY(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		   set.v[0],
 		   set.v[1],
@@ -3499,7 +3684,7 @@ GenoVector<4, T> setXY(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setXZ(const GenoVector<4, T> & vector, T x, T z) {
+constexpr GenoVector<4, T> setXZ(const GenoVector<4, T> & vector, T x, T z) {
 	return {
 		x,
 		vector.v[1],
@@ -3509,7 +3694,7 @@ GenoVector<4, T> setXZ(const GenoVector<4, T> & vector, T x, T z) {
 }
 
 template<typename T>
-GenoVector<4, T> setXZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<4, T> setXZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		   set.v[0],
 		vector.v[1],
@@ -3519,7 +3704,7 @@ GenoVector<4, T> setXZ(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setXW(const GenoVector<4, T> & vector, T x, T w) {
+constexpr GenoVector<4, T> setXW(const GenoVector<4, T> & vector, T x, T w) {
 	return {
 		x,
 		vector.v[1],
@@ -3529,7 +3714,7 @@ GenoVector<4, T> setXW(const GenoVector<4, T> & vector, T x, T w) {
 }
 
 template<typename T>
-GenoVector<4, T> setXW(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<4, T> setXW(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		   set.v[0],
 		vector.v[1],
@@ -3539,7 +3724,7 @@ GenoVector<4, T> setXW(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setYX(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<4, T> setYX(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		   set.v[1],
 		   set.v[0],
@@ -3549,7 +3734,7 @@ GenoVector<4, T> setYX(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setYZ(const GenoVector<4, T> & vector, T y, T z) {
+constexpr GenoVector<4, T> setYZ(const GenoVector<4, T> & vector, T y, T z) {
 	return {
 		vector.v[0],
 		y,
@@ -3559,7 +3744,7 @@ GenoVector<4, T> setYZ(const GenoVector<4, T> & vector, T y, T z) {
 }
 
 template<typename T>
-GenoVector<4, T> setYZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<4, T> setYZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[0],
@@ -3569,7 +3754,7 @@ GenoVector<4, T> setYZ(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setYW(const GenoVector<4, T> & vector, T y, T w) {
+constexpr GenoVector<4, T> setYW(const GenoVector<4, T> & vector, T y, T w) {
 	return {
 		vector.v[0],
 		y,
@@ -3579,7 +3764,7 @@ GenoVector<4, T> setYW(const GenoVector<4, T> & vector, T y, T w) {
 }
 
 template<typename T>
-GenoVector<4, T> setYW(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<4, T> setYW(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[0],
@@ -3589,7 +3774,7 @@ GenoVector<4, T> setYW(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setZX(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<4, T> setZX(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		   set.v[1],
 		vector.v[1],
@@ -3599,7 +3784,7 @@ GenoVector<4, T> setZX(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setZY(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<4, T> setZY(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[1],
@@ -3609,7 +3794,7 @@ GenoVector<4, T> setZY(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setZW(const GenoVector<4, T> & vector, T z, T w) {
+constexpr GenoVector<4, T> setZW(const GenoVector<4, T> & vector, T z, T w) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -3619,7 +3804,7 @@ GenoVector<4, T> setZW(const GenoVector<4, T> & vector, T z, T w) {
 }
 
 template<typename T>
-GenoVector<4, T> setZW(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<4, T> setZW(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -3629,7 +3814,7 @@ GenoVector<4, T> setZW(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setWX(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<4, T> setWX(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		   set.v[1],
 		vector.v[1],
@@ -3639,7 +3824,7 @@ GenoVector<4, T> setWX(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setWY(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<4, T> setWY(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[1],
@@ -3649,7 +3834,7 @@ GenoVector<4, T> setWY(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setWZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
+constexpr GenoVector<4, T> setWZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & set) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -3659,7 +3844,7 @@ GenoVector<4, T> setWZ(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setXYZ(const GenoVector<4, T> & vector, T x, T y, T z) {
+constexpr GenoVector<4, T> setXYZ(const GenoVector<4, T> & vector, T x, T y, T z) {
 	return {
 		x,
 		y,
@@ -3669,7 +3854,7 @@ GenoVector<4, T> setXYZ(const GenoVector<4, T> & vector, T x, T y, T z) {
 }
 
 template<typename T>
-GenoVector<4, T> setXYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setXYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[0],
 		   set.v[1],
@@ -3679,7 +3864,7 @@ GenoVector<4, T> setXYZ(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setXYW(const GenoVector<4, T> & vector, T x, T y, T w) {
+constexpr GenoVector<4, T> setXYW(const GenoVector<4, T> & vector, T x, T y, T w) {
 	return {
 		x,
 		y,
@@ -3689,7 +3874,7 @@ GenoVector<4, T> setXYW(const GenoVector<4, T> & vector, T x, T y, T w) {
 }
 
 template<typename T>
-GenoVector<4, T> setXYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setXYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[0],
 		   set.v[1],
@@ -3699,7 +3884,7 @@ GenoVector<4, T> setXYW(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setXZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setXZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[0],
 		   set.v[2],
@@ -3709,7 +3894,7 @@ GenoVector<4, T> setXZY(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setXZW(const GenoVector<4, T> & vector, T x, T z, T w) {
+constexpr GenoVector<4, T> setXZW(const GenoVector<4, T> & vector, T x, T z, T w) {
 	return {
 		x,
 		vector.v[1],
@@ -3719,7 +3904,7 @@ GenoVector<4, T> setXZW(const GenoVector<4, T> & vector, T x, T z, T w) {
 }
 
 template<typename T>
-GenoVector<4, T> setXZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setXZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[0],
 		vector.v[1],
@@ -3729,7 +3914,7 @@ GenoVector<4, T> setXZW(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setXWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setXWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[0],
 		   set.v[2],
@@ -3739,7 +3924,7 @@ GenoVector<4, T> setXWY(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setXWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setXWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[0],
 		vector.v[1],
@@ -3749,7 +3934,7 @@ GenoVector<4, T> setXWZ(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setYXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setYXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[1],
 		   set.v[0],
@@ -3759,7 +3944,7 @@ GenoVector<4, T> setYXZ(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setYXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setYXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[1],
 		   set.v[0],
@@ -3769,7 +3954,7 @@ GenoVector<4, T> setYXW(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setYZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setYZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[2],
 		   set.v[0],
@@ -3779,7 +3964,7 @@ GenoVector<4, T> setYZX(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setYZW(const GenoVector<4, T> & vector, T y, T z, T w) {
+constexpr GenoVector<4, T> setYZW(const GenoVector<4, T> & vector, T y, T z, T w) {
 	return {
 		vector.v[0],
 		y,
@@ -3789,7 +3974,7 @@ GenoVector<4, T> setYZW(const GenoVector<4, T> & vector, T y, T z, T w) {
 }
 
 template<typename T>
-GenoVector<4, T> setYZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setYZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[0],
@@ -3799,7 +3984,7 @@ GenoVector<4, T> setYZW(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setYWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setYWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[2],
 		   set.v[0],
@@ -3809,7 +3994,7 @@ GenoVector<4, T> setYWX(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setYWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setYWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[0],
@@ -3819,7 +4004,7 @@ GenoVector<4, T> setYWZ(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setZXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setZXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[1],
 		   set.v[2],
@@ -3829,7 +4014,7 @@ GenoVector<4, T> setZXY(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setZXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setZXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[1],
 		vector.v[1],
@@ -3839,7 +4024,7 @@ GenoVector<4, T> setZXW(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setZYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setZYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[2],
 		   set.v[1],
@@ -3849,7 +4034,7 @@ GenoVector<4, T> setZYX(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setZYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setZYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[1],
@@ -3859,7 +4044,7 @@ GenoVector<4, T> setZYW(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setZWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setZWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[2],
 		vector.v[1],
@@ -3869,7 +4054,7 @@ GenoVector<4, T> setZWX(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setZWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setZWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[2],
@@ -3879,7 +4064,7 @@ GenoVector<4, T> setZWY(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setWXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setWXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[1],
 		   set.v[2],
@@ -3889,7 +4074,7 @@ GenoVector<4, T> setWXY(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setWXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setWXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[1],
 		vector.v[1],
@@ -3899,7 +4084,7 @@ GenoVector<4, T> setWXZ(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setWYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setWYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[2],
 		   set.v[1],
@@ -3909,7 +4094,7 @@ GenoVector<4, T> setWYX(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setWYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setWYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[1],
@@ -3919,7 +4104,7 @@ GenoVector<4, T> setWYZ(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setWZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setWZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		   set.v[2],
 		vector.v[1],
@@ -3929,7 +4114,7 @@ GenoVector<4, T> setWZX(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setWZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
+constexpr GenoVector<4, T> setWZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set) {
 	return {
 		vector.v[0],
 		   set.v[2],
@@ -3939,7 +4124,7 @@ GenoVector<4, T> setWZY(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setX(const GenoVector<4, T> & vector, T x, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setX(const GenoVector<4, T> & vector, T x, GenoVector<4, T> & target) {
 	target.v[0] = x;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -3948,7 +4133,7 @@ GenoVector<4, T> setX(const GenoVector<4, T> & vector, T x, GenoVector<4, T> & t
 }
 
 template<typename T>
-GenoVector<4, T> setY(const GenoVector<4, T> & vector, T y, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setY(const GenoVector<4, T> & vector, T y, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = y;
 	target.v[2] = vector.v[2];
@@ -3957,7 +4142,7 @@ GenoVector<4, T> setY(const GenoVector<4, T> & vector, T y, GenoVector<4, T> & t
 }
 
 template<typename T>
-GenoVector<4, T> setZ(const GenoVector<4, T> & vector, T z, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setZ(const GenoVector<4, T> & vector, T z, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = z;
@@ -3966,7 +4151,7 @@ GenoVector<4, T> setZ(const GenoVector<4, T> & vector, T z, GenoVector<4, T> & t
 }
 
 template<typename T>
-GenoVector<4, T> setW(const GenoVector<4, T> & vector, T w, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setW(const GenoVector<4, T> & vector, T w, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -3975,7 +4160,7 @@ GenoVector<4, T> setW(const GenoVector<4, T> & vector, T w, GenoVector<4, T> & t
 }
 
 template<typename T>
-GenoVector<4, T> setXY(const GenoVector<4, T> & vector, T x, T y, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setXY(const GenoVector<4, T> & vector, T x, T y, GenoVector<4, T> & target) {
 	target.v[0] = x;
 	target.v[1] = y;
 	target.v[2] = vector.v[2];
@@ -3984,7 +4169,7 @@ GenoVector<4, T> setXY(const GenoVector<4, T> & vector, T x, T y, GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> setXY(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setXY(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] = vector.v[2];
@@ -3993,7 +4178,7 @@ GenoVector<4, T> setXY(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setXZ(const GenoVector<4, T> & vector, T x, T z, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setXZ(const GenoVector<4, T> & vector, T x, T z, GenoVector<4, T> & target) {
 	target.v[0] = x;
 	target.v[1] = vector.v[1];
 	target.v[2] = z;
@@ -4002,7 +4187,7 @@ GenoVector<4, T> setXZ(const GenoVector<4, T> & vector, T x, T z, GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> setXZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setXZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[1];
@@ -4011,7 +4196,7 @@ GenoVector<4, T> setXZ(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setXW(const GenoVector<4, T> & vector, T x, T w, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setXW(const GenoVector<4, T> & vector, T x, T w, GenoVector<4, T> & target) {
 	target.v[0] = x;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -4020,7 +4205,7 @@ GenoVector<4, T> setXW(const GenoVector<4, T> & vector, T x, T w, GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> setXW(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setXW(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -4029,7 +4214,7 @@ GenoVector<4, T> setXW(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setYX(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setYX(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] =    set.v[0];
 	target.v[2] = vector.v[2];
@@ -4038,7 +4223,7 @@ GenoVector<4, T> setYX(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setYZ(const GenoVector<4, T> & vector, T y, T z, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setYZ(const GenoVector<4, T> & vector, T y, T z, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = y;
 	target.v[2] = z;
@@ -4047,7 +4232,7 @@ GenoVector<4, T> setYZ(const GenoVector<4, T> & vector, T y, T z, GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> setYZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setYZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[0];
 	target.v[2] =    set.v[1];
@@ -4056,7 +4241,7 @@ GenoVector<4, T> setYZ(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setYW(const GenoVector<4, T> & vector, T y, T w, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setYW(const GenoVector<4, T> & vector, T y, T w, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = y;
 	target.v[2] = vector.v[2];
@@ -4065,7 +4250,7 @@ GenoVector<4, T> setYW(const GenoVector<4, T> & vector, T y, T w, GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> setYW(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setYW(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[0];
 	target.v[2] = vector.v[2];
@@ -4074,7 +4259,7 @@ GenoVector<4, T> setYW(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setZX(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setZX(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[0];
@@ -4083,7 +4268,7 @@ GenoVector<4, T> setZX(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setZY(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setZY(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] =    set.v[0];
@@ -4092,7 +4277,7 @@ GenoVector<4, T> setZY(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setZW(const GenoVector<4, T> & vector, T z, T w, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setZW(const GenoVector<4, T> & vector, T z, T w, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = z;
@@ -4101,7 +4286,7 @@ GenoVector<4, T> setZW(const GenoVector<4, T> & vector, T z, T w, GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> setZW(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setZW(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[0];
@@ -4110,7 +4295,7 @@ GenoVector<4, T> setZW(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setWX(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setWX(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -4119,7 +4304,7 @@ GenoVector<4, T> setWX(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setWY(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setWY(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] = vector.v[2];
@@ -4128,7 +4313,7 @@ GenoVector<4, T> setWY(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setWZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setWZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & set, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[1];
@@ -4137,7 +4322,7 @@ GenoVector<4, T> setWZ(const GenoVector<4, T> & vector, const GenoVector<2, T> &
 }
 
 template<typename T>
-GenoVector<4, T> setXYZ(const GenoVector<4, T> & vector, T x, T y, T z, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setXYZ(const GenoVector<4, T> & vector, T x, T y, T z, GenoVector<4, T> & target) {
 	target.v[0] = x;
 	target.v[1] = y;
 	target.v[2] = z;
@@ -4146,7 +4331,7 @@ GenoVector<4, T> setXYZ(const GenoVector<4, T> & vector, T x, T y, T z, GenoVect
 }
 
 template<typename T>
-GenoVector<4, T> setXYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setXYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] =    set.v[2];
@@ -4155,7 +4340,7 @@ GenoVector<4, T> setXYZ(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setXYW(const GenoVector<4, T> & vector, T x, T y, T w, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setXYW(const GenoVector<4, T> & vector, T x, T y, T w, GenoVector<4, T> & target) {
 	target.v[0] = x;
 	target.v[1] = y;
 	target.v[2] = vector.v[2];
@@ -4164,7 +4349,7 @@ GenoVector<4, T> setXYW(const GenoVector<4, T> & vector, T x, T y, T w, GenoVect
 }
 
 template<typename T>
-GenoVector<4, T> setXYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setXYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] = vector.v[2];
@@ -4173,7 +4358,7 @@ GenoVector<4, T> setXYW(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setXZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setXZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] =    set.v[2];
 	target.v[2] =    set.v[1];
@@ -4182,7 +4367,7 @@ GenoVector<4, T> setXZY(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setXZW(const GenoVector<4, T> & vector, T x, T z, T w, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setXZW(const GenoVector<4, T> & vector, T x, T z, T w, GenoVector<4, T> & target) {
 	target.v[0] = x;
 	target.v[1] = vector.v[1];
 	target.v[2] = z;
@@ -4191,7 +4376,7 @@ GenoVector<4, T> setXZW(const GenoVector<4, T> & vector, T x, T z, T w, GenoVect
 }
 
 template<typename T>
-GenoVector<4, T> setXZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setXZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[1];
@@ -4200,7 +4385,7 @@ GenoVector<4, T> setXZW(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setXWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setXWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] =    set.v[2];
 	target.v[2] = vector.v[2];
@@ -4209,7 +4394,7 @@ GenoVector<4, T> setXWY(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setXWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setXWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[2];
@@ -4218,7 +4403,7 @@ GenoVector<4, T> setXWZ(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setYXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setYXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] =    set.v[0];
 	target.v[2] =    set.v[2];
@@ -4227,7 +4412,7 @@ GenoVector<4, T> setYXZ(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setYXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setYXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] =    set.v[0];
 	target.v[2] = vector.v[2];
@@ -4236,7 +4421,7 @@ GenoVector<4, T> setYXW(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setYZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setYZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[2];
 	target.v[1] =    set.v[0];
 	target.v[2] =    set.v[1];
@@ -4245,7 +4430,7 @@ GenoVector<4, T> setYZX(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setYZW(const GenoVector<4, T> & vector, T y, T z, T w, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setYZW(const GenoVector<4, T> & vector, T y, T z, T w, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = y;
 	target.v[2] = z;
@@ -4254,7 +4439,7 @@ GenoVector<4, T> setYZW(const GenoVector<4, T> & vector, T y, T z, T w, GenoVect
 }
 
 template<typename T>
-GenoVector<4, T> setYZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setYZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[0];
 	target.v[2] =    set.v[1];
@@ -4263,7 +4448,7 @@ GenoVector<4, T> setYZW(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setYWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setYWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[2];
 	target.v[1] =    set.v[0];
 	target.v[2] = vector.v[2];
@@ -4272,7 +4457,7 @@ GenoVector<4, T> setYWX(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setYWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setYWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[0];
 	target.v[2] =    set.v[2];
@@ -4281,7 +4466,7 @@ GenoVector<4, T> setYWZ(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setZXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setZXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] =    set.v[2];
 	target.v[2] =    set.v[0];
@@ -4290,7 +4475,7 @@ GenoVector<4, T> setZXY(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setZXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setZXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[0];
@@ -4299,7 +4484,7 @@ GenoVector<4, T> setZXW(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setZYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setZYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[2];
 	target.v[1] =    set.v[1];
 	target.v[2] =    set.v[0];
@@ -4308,7 +4493,7 @@ GenoVector<4, T> setZYX(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setZYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setZYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] =    set.v[0];
@@ -4317,7 +4502,7 @@ GenoVector<4, T> setZYW(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setZWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setZWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[2];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[0];
@@ -4326,7 +4511,7 @@ GenoVector<4, T> setZWX(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setZWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setZWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[2];
 	target.v[2] =    set.v[0];
@@ -4335,7 +4520,7 @@ GenoVector<4, T> setZWY(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setWXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setWXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] =    set.v[2];
 	target.v[2] = vector.v[2];
@@ -4344,7 +4529,7 @@ GenoVector<4, T> setWXY(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setWXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setWXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[2];
@@ -4353,7 +4538,7 @@ GenoVector<4, T> setWXZ(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setWYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setWYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[2];
 	target.v[1] =    set.v[1];
 	target.v[2] = vector.v[2];
@@ -4362,7 +4547,7 @@ GenoVector<4, T> setWYX(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setWYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setWYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[1];
 	target.v[2] =    set.v[2];
@@ -4371,7 +4556,7 @@ GenoVector<4, T> setWYZ(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setWZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setWZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] =    set.v[2];
 	target.v[1] = vector.v[1];
 	target.v[2] =    set.v[1];
@@ -4380,7 +4565,7 @@ GenoVector<4, T> setWZX(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> setWZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> setWZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & set, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] =    set.v[2];
 	target.v[2] =    set.v[1];
@@ -4389,7 +4574,7 @@ GenoVector<4, T> setWZY(const GenoVector<4, T> & vector, const GenoVector<3, T>
 }
 
 template<typename T>
-GenoVector<4, T> translateX(const GenoVector<4, T> & vector, T translateX) {
+constexpr GenoVector<4, T> translateX(const GenoVector<4, T> & vector, T translateX) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1],
@@ -4399,7 +4584,7 @@ GenoVector<4, T> translateX(const GenoVector<4, T> & vector, T translateX) {
 }
 
 template<typename T>
-GenoVector<4, T> translateY(const GenoVector<4, T> & vector, T translateY) {
+constexpr GenoVector<4, T> translateY(const GenoVector<4, T> & vector, T translateY) {
 	return {
 		vector.v[0],
 		vector.v[1] + translateY,
@@ -4409,7 +4594,7 @@ GenoVector<4, T> translateY(const GenoVector<4, T> & vector, T translateY) {
 }
 
 template<typename T>
-GenoVector<4, T> translateZ(const GenoVector<4, T> & vector, T translateZ) {
+constexpr GenoVector<4, T> translateZ(const GenoVector<4, T> & vector, T translateZ) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -4419,7 +4604,7 @@ GenoVector<4, T> translateZ(const GenoVector<4, T> & vector, T translateZ) {
 }
 
 template<typename T>
-GenoVector<4, T> translateW(const GenoVector<4, T> & vector, T translateW) {
+constexpr GenoVector<4, T> translateW(const GenoVector<4, T> & vector, T translateW) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -4429,7 +4614,7 @@ GenoVector<4, T> translateW(const GenoVector<4, T> & vector, T translateW) {
 }
 
 template<typename T>
-GenoVector<4, T> translateXY(const GenoVector<4, T> & vector, T translateX, T translateY) {
+constexpr GenoVector<4, T> translateXY(const GenoVector<4, T> & vector, T translateX, T translateY) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1] + translateY,
@@ -4439,7 +4624,7 @@ GenoVector<4, T> translateXY(const GenoVector<4, T> & vector, T translateX, T tr
 }
 
 template<typename T>
-GenoVector<4, T> translateXY(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<4, T> translateXY(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -4449,7 +4634,7 @@ GenoVector<4, T> translateXY(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateXZ(const GenoVector<4, T> & vector, T translateX, T translateZ) {
+constexpr GenoVector<4, T> translateXZ(const GenoVector<4, T> & vector, T translateX, T translateZ) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1],
@@ -4459,7 +4644,7 @@ GenoVector<4, T> translateXZ(const GenoVector<4, T> & vector, T translateX, T tr
 }
 
 template<typename T>
-GenoVector<4, T> translateXZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<4, T> translateXZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1],
@@ -4469,7 +4654,7 @@ GenoVector<4, T> translateXZ(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateXW(const GenoVector<4, T> & vector, T translateX, T translateW) {
+constexpr GenoVector<4, T> translateXW(const GenoVector<4, T> & vector, T translateX, T translateW) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1],
@@ -4479,7 +4664,7 @@ GenoVector<4, T> translateXW(const GenoVector<4, T> & vector, T translateX, T tr
 }
 
 template<typename T>
-GenoVector<4, T> translateXW(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<4, T> translateXW(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1],
@@ -4489,7 +4674,7 @@ GenoVector<4, T> translateXW(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateYX(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<4, T> translateYX(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[0],
@@ -4499,7 +4684,7 @@ GenoVector<4, T> translateYX(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateYZ(const GenoVector<4, T> & vector, T translateY, T translateZ) {
+constexpr GenoVector<4, T> translateYZ(const GenoVector<4, T> & vector, T translateY, T translateZ) {
 	return {
 		vector.v[0],
 		vector.v[1] + translateY,
@@ -4509,7 +4694,7 @@ GenoVector<4, T> translateYZ(const GenoVector<4, T> & vector, T translateY, T tr
 }
 
 template<typename T>
-GenoVector<4, T> translateYZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<4, T> translateYZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[0],
@@ -4519,7 +4704,7 @@ GenoVector<4, T> translateYZ(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateYW(const GenoVector<4, T> & vector, T translateY, T translateW) {
+constexpr GenoVector<4, T> translateYW(const GenoVector<4, T> & vector, T translateY, T translateW) {
 	return {
 		vector.v[0],
 		vector.v[1] + translateY,
@@ -4529,7 +4714,7 @@ GenoVector<4, T> translateYW(const GenoVector<4, T> & vector, T translateY, T tr
 }
 
 template<typename T>
-GenoVector<4, T> translateYW(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<4, T> translateYW(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[0],
@@ -4539,7 +4724,7 @@ GenoVector<4, T> translateYW(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateZX(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<4, T> translateZX(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1],
@@ -4549,7 +4734,7 @@ GenoVector<4, T> translateZX(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateZY(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<4, T> translateZY(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[1],
@@ -4559,7 +4744,7 @@ GenoVector<4, T> translateZY(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateZW(const GenoVector<4, T> & vector, T translateZ, T translateW) {
+constexpr GenoVector<4, T> translateZW(const GenoVector<4, T> & vector, T translateZ, T translateW) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -4569,7 +4754,7 @@ GenoVector<4, T> translateZW(const GenoVector<4, T> & vector, T translateZ, T tr
 }
 
 template<typename T>
-GenoVector<4, T> translateZW(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<4, T> translateZW(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -4579,7 +4764,7 @@ GenoVector<4, T> translateZW(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateWX(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<4, T> translateWX(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1],
@@ -4589,7 +4774,7 @@ GenoVector<4, T> translateWX(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateWY(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<4, T> translateWY(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[1],
@@ -4599,7 +4784,7 @@ GenoVector<4, T> translateWY(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateWZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
+constexpr GenoVector<4, T> translateWZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -4609,7 +4794,7 @@ GenoVector<4, T> translateWZ(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateXYZ(const GenoVector<4, T> & vector, T translateX, T translateY, T translateZ) {
+constexpr GenoVector<4, T> translateXYZ(const GenoVector<4, T> & vector, T translateX, T translateY, T translateZ) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1] + translateY,
@@ -4619,7 +4804,7 @@ GenoVector<4, T> translateXYZ(const GenoVector<4, T> & vector, T translateX, T t
 }
 
 template<typename T>
-GenoVector<4, T> translateXYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateXYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -4629,7 +4814,7 @@ GenoVector<4, T> translateXYZ(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateXYW(const GenoVector<4, T> & vector, T translateX, T translateY, T translateW) {
+constexpr GenoVector<4, T> translateXYW(const GenoVector<4, T> & vector, T translateX, T translateY, T translateW) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1] + translateY,
@@ -4639,7 +4824,7 @@ GenoVector<4, T> translateXYW(const GenoVector<4, T> & vector, T translateX, T t
 }
 
 template<typename T>
-GenoVector<4, T> translateXYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateXYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -4649,7 +4834,7 @@ GenoVector<4, T> translateXYW(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateXZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateXZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[2],
@@ -4659,7 +4844,7 @@ GenoVector<4, T> translateXZY(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateXZW(const GenoVector<4, T> & vector, T translateX, T translateZ, T translateW) {
+constexpr GenoVector<4, T> translateXZW(const GenoVector<4, T> & vector, T translateX, T translateZ, T translateW) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1],
@@ -4669,7 +4854,7 @@ GenoVector<4, T> translateXZW(const GenoVector<4, T> & vector, T translateX, T t
 }
 
 template<typename T>
-GenoVector<4, T> translateXZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateXZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1],
@@ -4679,7 +4864,7 @@ GenoVector<4, T> translateXZW(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateXWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateXWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[2],
@@ -4689,7 +4874,7 @@ GenoVector<4, T> translateXWY(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateXWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateXWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1],
@@ -4699,7 +4884,7 @@ GenoVector<4, T> translateXWZ(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateYXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateYXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[0],
@@ -4709,7 +4894,7 @@ GenoVector<4, T> translateYXZ(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateYXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateYXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[0],
@@ -4719,7 +4904,7 @@ GenoVector<4, T> translateYXW(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateYZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateYZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[0],
@@ -4729,7 +4914,7 @@ GenoVector<4, T> translateYZX(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateYZW(const GenoVector<4, T> & vector, T translateY, T translateZ, T translateW) {
+constexpr GenoVector<4, T> translateYZW(const GenoVector<4, T> & vector, T translateY, T translateZ, T translateW) {
 	return {
 		vector.v[0],
 		vector.v[1] + translateY,
@@ -4739,7 +4924,7 @@ GenoVector<4, T> translateYZW(const GenoVector<4, T> & vector, T translateY, T t
 }
 
 template<typename T>
-GenoVector<4, T> translateYZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateYZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[0],
@@ -4749,7 +4934,7 @@ GenoVector<4, T> translateYZW(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateYWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateYWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[0],
@@ -4759,7 +4944,7 @@ GenoVector<4, T> translateYWX(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateYWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateYWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[0],
@@ -4769,7 +4954,7 @@ GenoVector<4, T> translateYWZ(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateZXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateZXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[2],
@@ -4779,7 +4964,7 @@ GenoVector<4, T> translateZXY(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateZXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateZXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1],
@@ -4789,7 +4974,7 @@ GenoVector<4, T> translateZXW(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateZYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateZYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[1],
@@ -4799,7 +4984,7 @@ GenoVector<4, T> translateZYX(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateZYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateZYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[1],
@@ -4809,7 +4994,7 @@ GenoVector<4, T> translateZYW(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateZWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateZWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1],
@@ -4819,7 +5004,7 @@ GenoVector<4, T> translateZWX(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateZWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateZWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[2],
@@ -4829,7 +5014,7 @@ GenoVector<4, T> translateZWY(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateWXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateWXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[2],
@@ -4839,7 +5024,7 @@ GenoVector<4, T> translateWXY(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateWXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateWXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1],
@@ -4849,7 +5034,7 @@ GenoVector<4, T> translateWXZ(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateWYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateWYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[1],
@@ -4859,7 +5044,7 @@ GenoVector<4, T> translateWYX(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateWYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateWYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[1],
@@ -4869,7 +5054,7 @@ GenoVector<4, T> translateWYZ(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateWZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateWZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1],
@@ -4879,7 +5064,7 @@ GenoVector<4, T> translateWZX(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateWZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
+constexpr GenoVector<4, T> translateWZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate) {
 	return {
 		vector.v[0],
 		vector.v[1] + translate.v[2],
@@ -4889,7 +5074,7 @@ GenoVector<4, T> translateWZY(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateXYZW(const GenoVector<4, T> & vector, T translateX, T translateY, T translateZ, T translateW) {
+constexpr GenoVector<4, T> translateXYZW(const GenoVector<4, T> & vector, T translateX, T translateY, T translateZ, T translateW) {
 	return {
 		vector.v[0] + translateX,
 		vector.v[1] + translateY,
@@ -4899,7 +5084,7 @@ GenoVector<4, T> translateXYZW(const GenoVector<4, T> & vector, T translateX, T
 }
 
 template<typename T>
-GenoVector<4, T> translateXYZW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateXYZW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -4909,7 +5094,7 @@ GenoVector<4, T> translateXYZW(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateXYWZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateXYWZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[1],
@@ -4919,7 +5104,7 @@ GenoVector<4, T> translateXYWZ(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateXZYW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateXZYW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[2],
@@ -4929,7 +5114,7 @@ GenoVector<4, T> translateXZYW(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateXZWY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateXZWY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[3],
@@ -4939,7 +5124,7 @@ GenoVector<4, T> translateXZWY(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateXWYZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateXWYZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[2],
@@ -4949,7 +5134,7 @@ GenoVector<4, T> translateXWYZ(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateXWZY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateXWZY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[0],
 		vector.v[1] + translate.v[3],
@@ -4959,7 +5144,7 @@ GenoVector<4, T> translateXWZY(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateYXZW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateYXZW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[0],
@@ -4969,7 +5154,7 @@ GenoVector<4, T> translateYXZW(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateYXWZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateYXWZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[0],
@@ -4979,7 +5164,7 @@ GenoVector<4, T> translateYXWZ(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateYZXW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateYZXW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[0],
@@ -4989,7 +5174,7 @@ GenoVector<4, T> translateYZXW(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateYZWX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateYZWX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[3],
 		vector.v[1] + translate.v[0],
@@ -4999,7 +5184,7 @@ GenoVector<4, T> translateYZWX(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateYWXZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateYWXZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[0],
@@ -5009,7 +5194,7 @@ GenoVector<4, T> translateYWXZ(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateYWZX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateYWZX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[3],
 		vector.v[1] + translate.v[0],
@@ -5019,7 +5204,7 @@ GenoVector<4, T> translateYWZX(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateZXYW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateZXYW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[2],
@@ -5029,7 +5214,7 @@ GenoVector<4, T> translateZXYW(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateZXWY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateZXWY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[3],
@@ -5039,7 +5224,7 @@ GenoVector<4, T> translateZXWY(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateZYXW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateZYXW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[1],
@@ -5049,7 +5234,7 @@ GenoVector<4, T> translateZYXW(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateZYWX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateZYWX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[3],
 		vector.v[1] + translate.v[1],
@@ -5059,7 +5244,7 @@ GenoVector<4, T> translateZYWX(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateZWXY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateZWXY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[3],
@@ -5069,7 +5254,7 @@ GenoVector<4, T> translateZWXY(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateZWYX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateZWYX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[3],
 		vector.v[1] + translate.v[2],
@@ -5079,7 +5264,7 @@ GenoVector<4, T> translateZWYX(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateWXYZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateWXYZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[2],
@@ -5089,7 +5274,7 @@ GenoVector<4, T> translateWXYZ(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateWXZY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateWXZY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[1],
 		vector.v[1] + translate.v[3],
@@ -5099,7 +5284,7 @@ GenoVector<4, T> translateWXZY(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateWYXZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateWYXZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[1],
@@ -5109,7 +5294,7 @@ GenoVector<4, T> translateWYXZ(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateWYZX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateWYZX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[3],
 		vector.v[1] + translate.v[1],
@@ -5119,7 +5304,7 @@ GenoVector<4, T> translateWYZX(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateWZXY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateWZXY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[2],
 		vector.v[1] + translate.v[3],
@@ -5129,7 +5314,7 @@ GenoVector<4, T> translateWZXY(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateWZYX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
+constexpr GenoVector<4, T> translateWZYX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate) {
 	return {
 		vector.v[0] + translate.v[3],
 		vector.v[1] + translate.v[2],
@@ -5139,7 +5324,7 @@ GenoVector<4, T> translateWZYX(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateX(const GenoVector<4, T> & vector, T translateX, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateX(const GenoVector<4, T> & vector, T translateX, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -5148,7 +5333,7 @@ GenoVector<4, T> translateX(const GenoVector<4, T> & vector, T translateX, GenoV
 }
 
 template<typename T>
-GenoVector<4, T> translateY(const GenoVector<4, T> & vector, T translateY, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateY(const GenoVector<4, T> & vector, T translateY, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2];
@@ -5157,7 +5342,7 @@ GenoVector<4, T> translateY(const GenoVector<4, T> & vector, T translateY, GenoV
 }
 
 template<typename T>
-GenoVector<4, T> translateZ(const GenoVector<4, T> & vector, T translateZ, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZ(const GenoVector<4, T> & vector, T translateZ, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translateZ;
@@ -5166,7 +5351,7 @@ GenoVector<4, T> translateZ(const GenoVector<4, T> & vector, T translateZ, GenoV
 }
 
 template<typename T>
-GenoVector<4, T> translateW(const GenoVector<4, T> & vector, T translateW, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateW(const GenoVector<4, T> & vector, T translateW, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -5175,7 +5360,7 @@ GenoVector<4, T> translateW(const GenoVector<4, T> & vector, T translateW, GenoV
 }
 
 template<typename T>
-GenoVector<4, T> translateXY(const GenoVector<4, T> & vector, T translateX, T translateY, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXY(const GenoVector<4, T> & vector, T translateX, T translateY, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2];
@@ -5184,7 +5369,7 @@ GenoVector<4, T> translateXY(const GenoVector<4, T> & vector, T translateX, T tr
 }
 
 template<typename T>
-GenoVector<4, T> translateXY(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXY(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2];
@@ -5193,7 +5378,7 @@ GenoVector<4, T> translateXY(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateXZ(const GenoVector<4, T> & vector, T translateX, T translateZ, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXZ(const GenoVector<4, T> & vector, T translateX, T translateZ, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translateZ;
@@ -5202,7 +5387,7 @@ GenoVector<4, T> translateXZ(const GenoVector<4, T> & vector, T translateX, T tr
 }
 
 template<typename T>
-GenoVector<4, T> translateXZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5211,7 +5396,7 @@ GenoVector<4, T> translateXZ(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateXW(const GenoVector<4, T> & vector, T translateX, T translateW, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXW(const GenoVector<4, T> & vector, T translateX, T translateW, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -5220,7 +5405,7 @@ GenoVector<4, T> translateXW(const GenoVector<4, T> & vector, T translateX, T tr
 }
 
 template<typename T>
-GenoVector<4, T> translateXW(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXW(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -5229,7 +5414,7 @@ GenoVector<4, T> translateXW(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateYX(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYX(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2];
@@ -5238,7 +5423,7 @@ GenoVector<4, T> translateYX(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateYZ(const GenoVector<4, T> & vector, T translateY, T translateZ, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYZ(const GenoVector<4, T> & vector, T translateY, T translateZ, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2] + translateZ;
@@ -5247,7 +5432,7 @@ GenoVector<4, T> translateYZ(const GenoVector<4, T> & vector, T translateY, T tr
 }
 
 template<typename T>
-GenoVector<4, T> translateYZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5256,7 +5441,7 @@ GenoVector<4, T> translateYZ(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateYW(const GenoVector<4, T> & vector, T translateY, T translateW, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYW(const GenoVector<4, T> & vector, T translateY, T translateW, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2];
@@ -5265,7 +5450,7 @@ GenoVector<4, T> translateYW(const GenoVector<4, T> & vector, T translateY, T tr
 }
 
 template<typename T>
-GenoVector<4, T> translateYW(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYW(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2];
@@ -5274,7 +5459,7 @@ GenoVector<4, T> translateYW(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateZX(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZX(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5283,7 +5468,7 @@ GenoVector<4, T> translateZX(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateZY(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZY(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5292,7 +5477,7 @@ GenoVector<4, T> translateZY(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateZW(const GenoVector<4, T> & vector, T translateZ, T translateW, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZW(const GenoVector<4, T> & vector, T translateZ, T translateW, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translateZ;
@@ -5301,7 +5486,7 @@ GenoVector<4, T> translateZW(const GenoVector<4, T> & vector, T translateZ, T tr
 }
 
 template<typename T>
-GenoVector<4, T> translateZW(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZW(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5310,7 +5495,7 @@ GenoVector<4, T> translateZW(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateWX(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateWX(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -5319,7 +5504,7 @@ GenoVector<4, T> translateWX(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateWY(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateWY(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2];
@@ -5328,7 +5513,7 @@ GenoVector<4, T> translateWY(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateWZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateWZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5337,7 +5522,7 @@ GenoVector<4, T> translateWZ(const GenoVector<4, T> & vector, const GenoVector<2
 }
 
 template<typename T>
-GenoVector<4, T> translateXYZ(const GenoVector<4, T> & vector, T translateX, T translateY, T translateZ, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXYZ(const GenoVector<4, T> & vector, T translateX, T translateY, T translateZ, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2] + translateZ;
@@ -5346,7 +5531,7 @@ GenoVector<4, T> translateXYZ(const GenoVector<4, T> & vector, T translateX, T t
 }
 
 template<typename T>
-GenoVector<4, T> translateXYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5355,7 +5540,7 @@ GenoVector<4, T> translateXYZ(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateXYW(const GenoVector<4, T> & vector, T translateX, T translateY, T translateW, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXYW(const GenoVector<4, T> & vector, T translateX, T translateY, T translateW, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2];
@@ -5364,7 +5549,7 @@ GenoVector<4, T> translateXYW(const GenoVector<4, T> & vector, T translateX, T t
 }
 
 template<typename T>
-GenoVector<4, T> translateXYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2];
@@ -5373,7 +5558,7 @@ GenoVector<4, T> translateXYW(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateXZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5382,7 +5567,7 @@ GenoVector<4, T> translateXZY(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateXZW(const GenoVector<4, T> & vector, T translateX, T translateZ, T translateW, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXZW(const GenoVector<4, T> & vector, T translateX, T translateZ, T translateW, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translateZ;
@@ -5391,7 +5576,7 @@ GenoVector<4, T> translateXZW(const GenoVector<4, T> & vector, T translateX, T t
 }
 
 template<typename T>
-GenoVector<4, T> translateXZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5400,7 +5585,7 @@ GenoVector<4, T> translateXZW(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateXWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2];
@@ -5409,7 +5594,7 @@ GenoVector<4, T> translateXWY(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateXWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5418,7 +5603,7 @@ GenoVector<4, T> translateXWZ(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateYXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5427,7 +5612,7 @@ GenoVector<4, T> translateYXZ(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateYXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2];
@@ -5436,7 +5621,7 @@ GenoVector<4, T> translateYXW(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateYZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5445,7 +5630,7 @@ GenoVector<4, T> translateYZX(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateYZW(const GenoVector<4, T> & vector, T translateY, T translateZ, T translateW, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYZW(const GenoVector<4, T> & vector, T translateY, T translateZ, T translateW, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2] + translateZ;
@@ -5454,7 +5639,7 @@ GenoVector<4, T> translateYZW(const GenoVector<4, T> & vector, T translateY, T t
 }
 
 template<typename T>
-GenoVector<4, T> translateYZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5463,7 +5648,7 @@ GenoVector<4, T> translateYZW(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateYWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2];
@@ -5472,7 +5657,7 @@ GenoVector<4, T> translateYWX(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateYWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5481,7 +5666,7 @@ GenoVector<4, T> translateYWZ(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateZXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5490,7 +5675,7 @@ GenoVector<4, T> translateZXY(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateZXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5499,7 +5684,7 @@ GenoVector<4, T> translateZXW(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateZYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5508,7 +5693,7 @@ GenoVector<4, T> translateZYX(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateZYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5517,7 +5702,7 @@ GenoVector<4, T> translateZYW(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateZWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5526,7 +5711,7 @@ GenoVector<4, T> translateZWX(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateZWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5535,7 +5720,7 @@ GenoVector<4, T> translateZWY(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateWXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateWXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2];
@@ -5544,7 +5729,7 @@ GenoVector<4, T> translateWXY(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateWXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateWXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5553,7 +5738,7 @@ GenoVector<4, T> translateWXZ(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateWYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateWYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2];
@@ -5562,7 +5747,7 @@ GenoVector<4, T> translateWYX(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateWYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateWYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5571,7 +5756,7 @@ GenoVector<4, T> translateWYZ(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateWZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateWZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5580,7 +5765,7 @@ GenoVector<4, T> translateWZX(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateWZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateWZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5589,7 +5774,7 @@ GenoVector<4, T> translateWZY(const GenoVector<4, T> & vector, const GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> translateXYZW(const GenoVector<4, T> & vector, T translateX, T translateY, T translateZ, T translateW, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXYZW(const GenoVector<4, T> & vector, T translateX, T translateY, T translateZ, T translateW, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translateX;
 	target.v[1] = vector.v[1] + translateY;
 	target.v[2] = vector.v[2] + translateZ;
@@ -5598,7 +5783,7 @@ GenoVector<4, T> translateXYZW(const GenoVector<4, T> & vector, T translateX, T
 }
 
 template<typename T>
-GenoVector<4, T> translateXYZW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXYZW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5607,7 +5792,7 @@ GenoVector<4, T> translateXYZW(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateXYWZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXYWZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[3];
@@ -5616,7 +5801,7 @@ GenoVector<4, T> translateXYWZ(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateXZYW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXZYW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5625,7 +5810,7 @@ GenoVector<4, T> translateXZYW(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateXZWY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXZWY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[3];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5634,7 +5819,7 @@ GenoVector<4, T> translateXZWY(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateXWYZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXWYZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[3];
@@ -5643,7 +5828,7 @@ GenoVector<4, T> translateXWYZ(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateXWZY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateXWZY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[0];
 	target.v[1] = vector.v[1] + translate.v[3];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5652,7 +5837,7 @@ GenoVector<4, T> translateXWZY(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateYXZW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYXZW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5661,7 +5846,7 @@ GenoVector<4, T> translateYXZW(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateYXWZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYXWZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[3];
@@ -5670,7 +5855,7 @@ GenoVector<4, T> translateYXWZ(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateYZXW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYZXW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5679,7 +5864,7 @@ GenoVector<4, T> translateYZXW(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateYZWX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYZWX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[3];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5688,7 +5873,7 @@ GenoVector<4, T> translateYZWX(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateYWXZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYWXZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[3];
@@ -5697,7 +5882,7 @@ GenoVector<4, T> translateYWXZ(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateYWZX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateYWZX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[3];
 	target.v[1] = vector.v[1] + translate.v[0];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5706,7 +5891,7 @@ GenoVector<4, T> translateYWZX(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateZXYW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZXYW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5715,7 +5900,7 @@ GenoVector<4, T> translateZXYW(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateZXWY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZXWY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[3];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5724,7 +5909,7 @@ GenoVector<4, T> translateZXWY(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateZYXW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZYXW(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5733,7 +5918,7 @@ GenoVector<4, T> translateZYXW(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateZYWX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZYWX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[3];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5742,7 +5927,7 @@ GenoVector<4, T> translateZYWX(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateZWXY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZWXY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[3];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5751,7 +5936,7 @@ GenoVector<4, T> translateZWXY(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateZWYX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateZWYX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[3];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[0];
@@ -5760,7 +5945,7 @@ GenoVector<4, T> translateZWYX(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateWXYZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateWXYZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[3];
@@ -5769,7 +5954,7 @@ GenoVector<4, T> translateWXYZ(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateWXZY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateWXZY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[1];
 	target.v[1] = vector.v[1] + translate.v[3];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5778,7 +5963,7 @@ GenoVector<4, T> translateWXZY(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateWYXZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateWYXZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[3];
@@ -5787,7 +5972,7 @@ GenoVector<4, T> translateWYXZ(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateWYZX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateWYZX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[3];
 	target.v[1] = vector.v[1] + translate.v[1];
 	target.v[2] = vector.v[2] + translate.v[2];
@@ -5796,7 +5981,7 @@ GenoVector<4, T> translateWYZX(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateWZXY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateWZXY(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[2];
 	target.v[1] = vector.v[1] + translate.v[3];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5805,7 +5990,7 @@ GenoVector<4, T> translateWZXY(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> translateWZYX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> translateWZYX(const GenoVector<4, T> & vector, const GenoVector<4, T> & translate, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] + translate.v[3];
 	target.v[1] = vector.v[1] + translate.v[2];
 	target.v[2] = vector.v[2] + translate.v[1];
@@ -5814,7 +5999,7 @@ GenoVector<4, T> translateWZYX(const GenoVector<4, T> & vector, const GenoVector
 }
 
 template<typename T>
-GenoVector<4, T> scaleX(const GenoVector<4, T> & vector, T scaleX) {
+constexpr GenoVector<4, T> scaleX(const GenoVector<4, T> & vector, T scaleX) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1],
@@ -5824,7 +6009,7 @@ GenoVector<4, T> scaleX(const GenoVector<4, T> & vector, T scaleX) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleY(const GenoVector<4, T> & vector, T scaleY) {
+constexpr GenoVector<4, T> scaleY(const GenoVector<4, T> & vector, T scaleY) {
 	return {
 		vector.v[0],
 		vector.v[1] * scaleY,
@@ -5834,7 +6019,7 @@ GenoVector<4, T> scaleY(const GenoVector<4, T> & vector, T scaleY) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleZ(const GenoVector<4, T> & vector, T scaleZ) {
+constexpr GenoVector<4, T> scaleZ(const GenoVector<4, T> & vector, T scaleZ) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -5844,7 +6029,7 @@ GenoVector<4, T> scaleZ(const GenoVector<4, T> & vector, T scaleZ) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleW(const GenoVector<4, T> & vector, T scaleW) {
+constexpr GenoVector<4, T> scaleW(const GenoVector<4, T> & vector, T scaleW) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -5854,7 +6039,7 @@ GenoVector<4, T> scaleW(const GenoVector<4, T> & vector, T scaleW) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, T scale) {
+constexpr GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale,
@@ -5864,7 +6049,7 @@ GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, T scaleX, T scaleY) {
+constexpr GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, T scaleX, T scaleY) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1] * scaleY,
@@ -5874,7 +6059,7 @@ GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, T scaleX, T scaleY) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -5884,7 +6069,7 @@ GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, T scale) {
+constexpr GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1],
@@ -5894,7 +6079,7 @@ GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, T scaleX, T scaleZ) {
+constexpr GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, T scaleX, T scaleZ) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1],
@@ -5904,7 +6089,7 @@ GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, T scaleX, T scaleZ) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1],
@@ -5914,7 +6099,7 @@ GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, T scale) {
+constexpr GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1],
@@ -5924,7 +6109,7 @@ GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, T scaleX, T scaleW) {
+constexpr GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, T scaleX, T scaleW) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1],
@@ -5934,7 +6119,7 @@ GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, T scaleX, T scaleW) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1],
@@ -5944,7 +6129,7 @@ GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleYX(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<4, T> scaleYX(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[0],
@@ -5954,7 +6139,7 @@ GenoVector<4, T> scaleYX(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, T scale) {
+constexpr GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, T scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale,
@@ -5964,7 +6149,7 @@ GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, T scaleY, T scaleZ) {
+constexpr GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, T scaleY, T scaleZ) {
 	return {
 		vector.v[0],
 		vector.v[1] * scaleY,
@@ -5974,7 +6159,7 @@ GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, T scaleY, T scaleZ) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[0],
@@ -5984,7 +6169,7 @@ GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, T scale) {
+constexpr GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, T scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale,
@@ -5994,7 +6179,7 @@ GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, T scaleY, T scaleW) {
+constexpr GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, T scaleY, T scaleW) {
 	return {
 		vector.v[0],
 		vector.v[1] * scaleY,
@@ -6004,7 +6189,7 @@ GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, T scaleY, T scaleW) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[0],
@@ -6014,7 +6199,7 @@ GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleZX(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<4, T> scaleZX(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1],
@@ -6024,7 +6209,7 @@ GenoVector<4, T> scaleZX(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleZY(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<4, T> scaleZY(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[1],
@@ -6034,7 +6219,7 @@ GenoVector<4, T> scaleZY(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, T scale) {
+constexpr GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, T scale) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -6044,7 +6229,7 @@ GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, T scaleZ, T scaleW) {
+constexpr GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, T scaleZ, T scaleW) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -6054,7 +6239,7 @@ GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, T scaleZ, T scaleW) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -6064,7 +6249,7 @@ GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleWX(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<4, T> scaleWX(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1],
@@ -6074,7 +6259,7 @@ GenoVector<4, T> scaleWX(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleWY(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<4, T> scaleWY(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[1],
@@ -6084,7 +6269,7 @@ GenoVector<4, T> scaleWY(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleWZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
+constexpr GenoVector<4, T> scaleWZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1],
@@ -6094,7 +6279,7 @@ GenoVector<4, T> scaleWZ(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, T scale) {
+constexpr GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale,
@@ -6104,7 +6289,7 @@ GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, T scaleX, T scaleY, T scaleZ) {
+constexpr GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, T scaleX, T scaleY, T scaleZ) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1] * scaleY,
@@ -6114,7 +6299,7 @@ GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, T scaleX, T scaleY, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -6124,7 +6309,7 @@ GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, T scale) {
+constexpr GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale,
@@ -6134,7 +6319,7 @@ GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, T scaleX, T scaleY, T scaleW) {
+constexpr GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, T scaleX, T scaleY, T scaleW) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1] * scaleY,
@@ -6144,7 +6329,7 @@ GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, T scaleX, T scaleY, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -6154,7 +6339,7 @@ GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleXZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[2],
@@ -6164,7 +6349,7 @@ GenoVector<4, T> scaleXZY(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, T scale) {
+constexpr GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1],
@@ -6174,7 +6359,7 @@ GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, T scaleX, T scaleZ, T scaleW) {
+constexpr GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, T scaleX, T scaleZ, T scaleW) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1],
@@ -6184,7 +6369,7 @@ GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, T scaleX, T scaleZ, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1],
@@ -6194,7 +6379,7 @@ GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleXWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[2],
@@ -6204,7 +6389,7 @@ GenoVector<4, T> scaleXWY(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleXWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1],
@@ -6214,7 +6399,7 @@ GenoVector<4, T> scaleXWZ(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleYXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleYXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[0],
@@ -6224,7 +6409,7 @@ GenoVector<4, T> scaleYXZ(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleYXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleYXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[0],
@@ -6234,7 +6419,7 @@ GenoVector<4, T> scaleYXW(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleYZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[0],
@@ -6244,7 +6429,7 @@ GenoVector<4, T> scaleYZX(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, T scale) {
+constexpr GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, T scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale,
@@ -6254,7 +6439,7 @@ GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, T scaleY, T scaleZ, T scaleW) {
+constexpr GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, T scaleY, T scaleZ, T scaleW) {
 	return {
 		vector.v[0],
 		vector.v[1] * scaleY,
@@ -6264,7 +6449,7 @@ GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, T scaleY, T scaleZ, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[0],
@@ -6274,7 +6459,7 @@ GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleYWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleYWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[0],
@@ -6284,7 +6469,7 @@ GenoVector<4, T> scaleYWX(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleYWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleYWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[0],
@@ -6294,7 +6479,7 @@ GenoVector<4, T> scaleYWZ(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleZXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleZXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[2],
@@ -6304,7 +6489,7 @@ GenoVector<4, T> scaleZXY(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleZXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleZXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1],
@@ -6314,7 +6499,7 @@ GenoVector<4, T> scaleZXW(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleZYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleZYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[1],
@@ -6324,7 +6509,7 @@ GenoVector<4, T> scaleZYX(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleZYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleZYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[1],
@@ -6334,7 +6519,7 @@ GenoVector<4, T> scaleZYW(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleZWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleZWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1],
@@ -6344,7 +6529,7 @@ GenoVector<4, T> scaleZWX(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleZWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleZWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[2],
@@ -6354,7 +6539,7 @@ GenoVector<4, T> scaleZWY(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleWXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleWXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[2],
@@ -6364,7 +6549,7 @@ GenoVector<4, T> scaleWXY(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleWXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleWXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1],
@@ -6374,7 +6559,7 @@ GenoVector<4, T> scaleWXZ(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleWYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleWYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[1],
@@ -6384,7 +6569,7 @@ GenoVector<4, T> scaleWYX(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleWYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleWYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[1],
@@ -6394,7 +6579,7 @@ GenoVector<4, T> scaleWYZ(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleWZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleWZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1],
@@ -6404,7 +6589,7 @@ GenoVector<4, T> scaleWZX(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleWZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
+constexpr GenoVector<4, T> scaleWZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale) {
 	return {
 		vector.v[0],
 		vector.v[1] * scale.v[2],
@@ -6414,7 +6599,7 @@ GenoVector<4, T> scaleWZY(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, T scale) {
+constexpr GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, T scale) {
 	return {
 		vector.v[0] * scale,
 		vector.v[1] * scale,
@@ -6424,7 +6609,7 @@ GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, T scale) {
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, T scaleX, T scaleY, T scaleZ, T scaleW) {
+constexpr GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, T scaleX, T scaleY, T scaleZ, T scaleW) {
 	return {
 		vector.v[0] * scaleX,
 		vector.v[1] * scaleY,
@@ -6434,7 +6619,7 @@ GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, T scaleX, T scaleY,
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -6444,7 +6629,7 @@ GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYWZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleXYWZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[1],
@@ -6454,7 +6639,7 @@ GenoVector<4, T> scaleXYWZ(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZYW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleXZYW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[2],
@@ -6464,7 +6649,7 @@ GenoVector<4, T> scaleXZYW(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZWY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleXZWY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[3],
@@ -6474,7 +6659,7 @@ GenoVector<4, T> scaleXZWY(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleXWYZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleXWYZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[2],
@@ -6484,7 +6669,7 @@ GenoVector<4, T> scaleXWYZ(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleXWZY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleXWZY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[0],
 		vector.v[1] * scale.v[3],
@@ -6494,7 +6679,7 @@ GenoVector<4, T> scaleXWZY(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleYXZW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleYXZW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[0],
@@ -6504,7 +6689,7 @@ GenoVector<4, T> scaleYXZW(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleYXWZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleYXWZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[0],
@@ -6514,7 +6699,7 @@ GenoVector<4, T> scaleYXWZ(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZXW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleYZXW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[0],
@@ -6524,7 +6709,7 @@ GenoVector<4, T> scaleYZXW(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZWX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleYZWX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[3],
 		vector.v[1] * scale.v[0],
@@ -6534,7 +6719,7 @@ GenoVector<4, T> scaleYZWX(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleYWXZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleYWXZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[0],
@@ -6544,7 +6729,7 @@ GenoVector<4, T> scaleYWXZ(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleYWZX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleYWZX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[3],
 		vector.v[1] * scale.v[0],
@@ -6554,7 +6739,7 @@ GenoVector<4, T> scaleYWZX(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleZXYW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleZXYW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[2],
@@ -6564,7 +6749,7 @@ GenoVector<4, T> scaleZXYW(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleZXWY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleZXWY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[3],
@@ -6574,7 +6759,7 @@ GenoVector<4, T> scaleZXWY(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleZYXW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleZYXW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[1],
@@ -6584,7 +6769,7 @@ GenoVector<4, T> scaleZYXW(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleZYWX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleZYWX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[3],
 		vector.v[1] * scale.v[1],
@@ -6594,7 +6779,7 @@ GenoVector<4, T> scaleZYWX(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleZWXY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleZWXY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[3],
@@ -6604,7 +6789,7 @@ GenoVector<4, T> scaleZWXY(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleZWYX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleZWYX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[3],
 		vector.v[1] * scale.v[2],
@@ -6614,7 +6799,7 @@ GenoVector<4, T> scaleZWYX(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleWXYZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleWXYZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[2],
@@ -6624,7 +6809,7 @@ GenoVector<4, T> scaleWXYZ(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleWXZY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleWXZY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[1],
 		vector.v[1] * scale.v[3],
@@ -6634,7 +6819,7 @@ GenoVector<4, T> scaleWXZY(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleWYXZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleWYXZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[1],
@@ -6644,7 +6829,7 @@ GenoVector<4, T> scaleWYXZ(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleWYZX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleWYZX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[3],
 		vector.v[1] * scale.v[1],
@@ -6654,7 +6839,7 @@ GenoVector<4, T> scaleWYZX(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleWZXY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleWZXY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[2],
 		vector.v[1] * scale.v[3],
@@ -6664,7 +6849,7 @@ GenoVector<4, T> scaleWZXY(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleWZYX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
+constexpr GenoVector<4, T> scaleWZYX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale) {
 	return {
 		vector.v[0] * scale.v[3],
 		vector.v[1] * scale.v[2],
@@ -6674,7 +6859,7 @@ GenoVector<4, T> scaleWZYX(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleX(const GenoVector<4, T> & vector, T scaleX, const GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleX(const GenoVector<4, T> & vector, T scaleX, const GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -6683,7 +6868,7 @@ GenoVector<4, T> scaleX(const GenoVector<4, T> & vector, T scaleX, const GenoVec
 }
 
 template<typename T>
-GenoVector<4, T> scaleY(const GenoVector<4, T> & vector, T scaleY, const GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleY(const GenoVector<4, T> & vector, T scaleY, const GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2];
@@ -6692,7 +6877,7 @@ GenoVector<4, T> scaleY(const GenoVector<4, T> & vector, T scaleY, const GenoVec
 }
 
 template<typename T>
-GenoVector<4, T> scaleZ(const GenoVector<4, T> & vector, T scaleZ, const GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZ(const GenoVector<4, T> & vector, T scaleZ, const GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scaleZ;
@@ -6701,7 +6886,7 @@ GenoVector<4, T> scaleZ(const GenoVector<4, T> & vector, T scaleZ, const GenoVec
 }
 
 template<typename T>
-GenoVector<4, T> scaleW(const GenoVector<4, T> & vector, T scaleW, const GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleW(const GenoVector<4, T> & vector, T scaleW, const GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -6710,7 +6895,7 @@ GenoVector<4, T> scaleW(const GenoVector<4, T> & vector, T scaleW, const GenoVec
 }
 
 template<typename T>
-GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2];
@@ -6719,7 +6904,7 @@ GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, T scale, GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, T scaleX, T scaleY, const GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, T scaleX, T scaleY, const GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2];
@@ -6728,7 +6913,7 @@ GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, T scaleX, T scaleY, co
 }
 
 template<typename T>
-GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2];
@@ -6737,7 +6922,7 @@ GenoVector<4, T> scaleXY(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale;
@@ -6746,7 +6931,7 @@ GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, T scale, GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, T scaleX, T scaleZ, const GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, T scaleX, T scaleZ, const GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scaleZ;
@@ -6755,7 +6940,7 @@ GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, T scaleX, T scaleZ, co
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -6764,7 +6949,7 @@ GenoVector<4, T> scaleXZ(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -6773,7 +6958,7 @@ GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, T scale, GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, T scaleX, T scaleW, const GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, T scaleX, T scaleW, const GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -6782,7 +6967,7 @@ GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, T scaleX, T scaleW, co
 }
 
 template<typename T>
-GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -6791,7 +6976,7 @@ GenoVector<4, T> scaleXW(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleYX(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYX(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2];
@@ -6800,7 +6985,7 @@ GenoVector<4, T> scaleYX(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2] * scale;
@@ -6809,7 +6994,7 @@ GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, T scale, GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, T scaleY, T scaleZ, const GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, T scaleY, T scaleZ, const GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2] * scaleZ;
@@ -6818,7 +7003,7 @@ GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, T scaleY, T scaleZ, co
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -6827,7 +7012,7 @@ GenoVector<4, T> scaleYZ(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2];
@@ -6836,7 +7021,7 @@ GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, T scale, GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, T scaleY, T scaleW, const GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, T scaleY, T scaleW, const GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2];
@@ -6845,7 +7030,7 @@ GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, T scaleY, T scaleW, co
 }
 
 template<typename T>
-GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2];
@@ -6854,7 +7039,7 @@ GenoVector<4, T> scaleYW(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleZX(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZX(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -6863,7 +7048,7 @@ GenoVector<4, T> scaleZX(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleZY(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZY(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -6872,7 +7057,7 @@ GenoVector<4, T> scaleZY(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale;
@@ -6881,7 +7066,7 @@ GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, T scale, GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, T scaleZ, T scaleW, const GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, T scaleZ, T scaleW, const GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scaleZ;
@@ -6890,7 +7075,7 @@ GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, T scaleZ, T scaleW, co
 }
 
 template<typename T>
-GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -6899,7 +7084,7 @@ GenoVector<4, T> scaleZW(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleWX(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleWX(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2];
@@ -6908,7 +7093,7 @@ GenoVector<4, T> scaleWX(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleWY(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleWY(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2];
@@ -6917,7 +7102,7 @@ GenoVector<4, T> scaleWY(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleWZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleWZ(const GenoVector<4, T> & vector, const GenoVector<2, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -6926,7 +7111,7 @@ GenoVector<4, T> scaleWZ(const GenoVector<4, T> & vector, const GenoVector<2, T>
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2] * scale;
@@ -6935,7 +7120,7 @@ GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, T scale, GenoVector<4
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, T scaleX, T scaleY, T scaleZ, const GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, T scaleX, T scaleY, T scaleZ, const GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2] * scaleZ;
@@ -6944,7 +7129,7 @@ GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, T scaleX, T scaleY, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -6953,7 +7138,7 @@ GenoVector<4, T> scaleXYZ(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2];
@@ -6962,7 +7147,7 @@ GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, T scale, GenoVector<4
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, T scaleX, T scaleY, T scaleW, const GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, T scaleX, T scaleY, T scaleW, const GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2];
@@ -6971,7 +7156,7 @@ GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, T scaleX, T scaleY, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2];
@@ -6980,7 +7165,7 @@ GenoVector<4, T> scaleXYW(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -6989,7 +7174,7 @@ GenoVector<4, T> scaleXZY(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale;
@@ -6998,7 +7183,7 @@ GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, T scale, GenoVector<4
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, T scaleX, T scaleZ, T scaleW, const GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, T scaleX, T scaleZ, T scaleW, const GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scaleZ;
@@ -7007,7 +7192,7 @@ GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, T scaleX, T scaleZ, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7016,7 +7201,7 @@ GenoVector<4, T> scaleXZW(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2];
@@ -7025,7 +7210,7 @@ GenoVector<4, T> scaleXWY(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7034,7 +7219,7 @@ GenoVector<4, T> scaleXWZ(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleYXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7043,7 +7228,7 @@ GenoVector<4, T> scaleYXZ(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleYXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2];
@@ -7052,7 +7237,7 @@ GenoVector<4, T> scaleYXW(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7061,7 +7246,7 @@ GenoVector<4, T> scaleYZX(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2] * scale;
@@ -7070,7 +7255,7 @@ GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, T scale, GenoVector<4
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, T scaleY, T scaleZ, T scaleW, const GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, T scaleY, T scaleZ, T scaleW, const GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2] * scaleZ;
@@ -7079,7 +7264,7 @@ GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, T scaleY, T scaleZ, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7088,7 +7273,7 @@ GenoVector<4, T> scaleYZW(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleYWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2];
@@ -7097,7 +7282,7 @@ GenoVector<4, T> scaleYWX(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleYWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYWZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7106,7 +7291,7 @@ GenoVector<4, T> scaleYWZ(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleZXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7115,7 +7300,7 @@ GenoVector<4, T> scaleZXY(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleZXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZXW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7124,7 +7309,7 @@ GenoVector<4, T> scaleZXW(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleZYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7133,7 +7318,7 @@ GenoVector<4, T> scaleZYX(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleZYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZYW(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7142,7 +7327,7 @@ GenoVector<4, T> scaleZYW(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleZWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZWX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7151,7 +7336,7 @@ GenoVector<4, T> scaleZWX(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleZWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZWY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7160,7 +7345,7 @@ GenoVector<4, T> scaleZWY(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleWXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleWXY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2];
@@ -7169,7 +7354,7 @@ GenoVector<4, T> scaleWXY(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleWXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleWXZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7178,7 +7363,7 @@ GenoVector<4, T> scaleWXZ(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleWYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleWYX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2];
@@ -7187,7 +7372,7 @@ GenoVector<4, T> scaleWYX(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleWYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleWYZ(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7196,7 +7381,7 @@ GenoVector<4, T> scaleWYZ(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleWZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleWZX(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7205,7 +7390,7 @@ GenoVector<4, T> scaleWZX(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleWZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleWZY(const GenoVector<4, T> & vector, const GenoVector<3, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7214,7 +7399,7 @@ GenoVector<4, T> scaleWZY(const GenoVector<4, T> & vector, const GenoVector<3, T
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, T scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale;
 	target.v[1] = vector.v[1] * scale;
 	target.v[2] = vector.v[2] * scale;
@@ -7223,7 +7408,7 @@ GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, T scale, GenoVector<
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, T scaleX, T scaleY, T scaleZ, T scaleW, const GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, T scaleX, T scaleY, T scaleZ, T scaleW, const GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scaleX;
 	target.v[1] = vector.v[1] * scaleY;
 	target.v[2] = vector.v[2] * scaleZ;
@@ -7232,7 +7417,7 @@ GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, T scaleX, T scaleY,
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7241,7 +7426,7 @@ GenoVector<4, T> scaleXYZW(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleXYWZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXYWZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[3];
@@ -7250,7 +7435,7 @@ GenoVector<4, T> scaleXYWZ(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZYW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXZYW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7259,7 +7444,7 @@ GenoVector<4, T> scaleXZYW(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleXZWY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXZWY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[3];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7268,7 +7453,7 @@ GenoVector<4, T> scaleXZWY(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleXWYZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXWYZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[3];
@@ -7277,7 +7462,7 @@ GenoVector<4, T> scaleXWYZ(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleXWZY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleXWZY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[0];
 	target.v[1] = vector.v[1] * scale.v[3];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7286,7 +7471,7 @@ GenoVector<4, T> scaleXWZY(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleYXZW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYXZW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7295,7 +7480,7 @@ GenoVector<4, T> scaleYXZW(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleYXWZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYXWZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[3];
@@ -7304,7 +7489,7 @@ GenoVector<4, T> scaleYXWZ(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZXW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYZXW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7313,7 +7498,7 @@ GenoVector<4, T> scaleYZXW(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleYZWX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYZWX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[3];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7322,7 +7507,7 @@ GenoVector<4, T> scaleYZWX(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleYWXZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYWXZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[3];
@@ -7331,7 +7516,7 @@ GenoVector<4, T> scaleYWXZ(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleYWZX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleYWZX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[3];
 	target.v[1] = vector.v[1] * scale.v[0];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7340,7 +7525,7 @@ GenoVector<4, T> scaleYWZX(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleZXYW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZXYW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7349,7 +7534,7 @@ GenoVector<4, T> scaleZXYW(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleZXWY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZXWY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[3];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7358,7 +7543,7 @@ GenoVector<4, T> scaleZXWY(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleZYXW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZYXW(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7367,7 +7552,7 @@ GenoVector<4, T> scaleZYXW(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleZYWX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZYWX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[3];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7376,7 +7561,7 @@ GenoVector<4, T> scaleZYWX(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleZWXY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZWXY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[3];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7385,7 +7570,7 @@ GenoVector<4, T> scaleZWXY(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleZWYX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleZWYX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[3];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[0];
@@ -7394,7 +7579,7 @@ GenoVector<4, T> scaleZWYX(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleWXYZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleWXYZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[3];
@@ -7403,7 +7588,7 @@ GenoVector<4, T> scaleWXYZ(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleWXZY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleWXZY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[1];
 	target.v[1] = vector.v[1] * scale.v[3];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7412,7 +7597,7 @@ GenoVector<4, T> scaleWXZY(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleWYXZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleWYXZ(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[3];
@@ -7421,7 +7606,7 @@ GenoVector<4, T> scaleWYXZ(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleWYZX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleWYZX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[3];
 	target.v[1] = vector.v[1] * scale.v[1];
 	target.v[2] = vector.v[2] * scale.v[2];
@@ -7430,7 +7615,7 @@ GenoVector<4, T> scaleWYZX(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleWZXY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleWZXY(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[2];
 	target.v[1] = vector.v[1] * scale.v[3];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7439,7 +7624,7 @@ GenoVector<4, T> scaleWZXY(const GenoVector<4, T> & vector, const GenoVector<4,
 }
 
 template<typename T>
-GenoVector<4, T> scaleWZYX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
+constexpr GenoVector<4, T> scaleWZYX(const GenoVector<4, T> & vector, const GenoVector<4, T> & scale, GenoVector<4, T> & target) {
 	target.v[0] = vector.v[0] * scale.v[3];
 	target.v[1] = vector.v[1] * scale.v[2];
 	target.v[2] = vector.v[2] * scale.v[1];
@@ -7465,5 +7650,12 @@ using GenoVector4ul = GenoVector4<uint64>;
 using GenoVector4f  = GenoVector4<float >;
 using GenoVector4d  = GenoVector4<double>;
 
+/** Instantiated once in GenoMathInstantiations.cpp, which defines GENO_MATH_INSTANTIATIONS to skip these **/
+#ifndef GENO_MATH_INSTANTIATIONS
+	extern template class GenoVector<4, float >;
+	extern template class GenoVector<4, double>;
+	extern template class GenoVector<4,  int32>;
+#endif // GENO_MATH_INSTANTIATIONS
+
 #define GNARLY_GENOME_VECTOR4_FORWARD
 #endif // GNARLY_GENOME_VECTOR4
\ No newline at end of file
@@ -0,0 +1,223 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "../../GenoInts.h"
+
+#ifndef GNARLY_GENOME_VECTOR_FORWARD
+#define GNARLY_GENOME_VECTOR_FORWARD
+
+template <uint32 N, typename T>
+class GenoVector;
+
+#endif // GNARLY_GENOME_VECTOR_FORWARD
+
+#ifndef GNARLY_GENOME_VECTOR_EXPRESSION
+#define GNARLY_GENOME_VECTOR_EXPRESSION
+
+/**
+ * Lazy component wise arithmetic for GenoVector2, 3 and 4
+ *
+ * The free + - * / operators return expression nodes instead of vectors. A node holds vector operands by reference
+ * and sub expressions and scalars by value, and a GenoVector constructed or assigned from it evaluates each component
+ * once, straight into its own storage, with no intermediate vectors. Nodes refer to their operands so they must not
+ * outlive the full expression: store results in a GenoVector, not in auto. Call eval() to use a node where a template
+ * needs to deduce a GenoVector, or to call member functions on the result
+**/
+template <uint32 N, typename T, typename E>
+class GenoVectorExpression {
+	public:
+		constexpr T get(uint32 index) const {
+			return static_cast<const E &>(*this).get(index);
+		}
+
+		constexpr GenoVector<N, T> eval() const {
+			return GenoVector<N, T>(*this);
+		}
+};
+
+namespace GenoVectorExpressions {
+	template <typename T>
+	struct Scalar {
+		T value;
+	};
+
+	/** How a node stores and reads an operand, sub expressions are stored by value **/
+	template <typename O>
+	struct Operand {
+		using Stored = O;
+		template <typename T>
+		static constexpr T get(const O & operand, uint32 index) {
+			return operand.get(index);
+		}
+	};
+
+	template <uint32 N, typename T>
+	struct Operand<GenoVector<N, T>> {
+		using Stored = const GenoVector<N, T> &;
+		template <typename T2>
+		static constexpr T get(const GenoVector<N, T> & operand, uint32 index) {
+			return operand.v[index];
+		}
+	};
+
+	template <typename T2>
+	struct Operand<Scalar<T2>> {
+		using Stored = Scalar<T2>;
+		template <typename T>
+		static constexpr T get(const Scalar<T2> & operand, uint32) {
+			return operand.value;
+		}
+	};
+
+	struct Add      { template <typename T> static constexpr T apply(T left, T right) { return left + right; } };
+	struct Subtract { template <typename T> static constexpr T apply(T left, T right) { return left - right; } };
+	struct Multiply { template <typename T> static constexpr T apply(T left, T right) { return left * right; } };
+	struct Divide   { template <typename T> static constexpr T apply(T left, T right) { return left / right; } };
+}
+
+template <uint32 N, typename T, typename Op, typename L, typename R>
+class GenoVectorBinary : public GenoVectorExpression<N, T, GenoVectorBinary<N, T, Op, L, R>> {
+	private:
+		typename GenoVectorExpressions::Operand<L>::Stored left;
+		typename GenoVectorExpressions::Operand<R>::Stored right;
+	public:
+		constexpr GenoVectorBinary(const L & left, const R & right) :
+			left(left),
+			right(right) {}
+
+		constexpr T get(uint32 index) const {
+			return Op::template apply<T>(
+				GenoVectorExpressions::Operand<L>::template get<T>(left, index),
+				GenoVectorExpressions::Operand<R>::template get<T>(right, index)
+			);
+		}
+};
+
+template <uint32 N, typename T, typename O>
+class GenoVectorNegate : public GenoVectorExpression<N, T, GenoVectorNegate<N, T, O>> {
+	private:
+		typename GenoVectorExpressions::Operand<O>::Stored operand;
+	public:
+		constexpr GenoVectorNegate(const O & operand) :
+			operand(operand) {}
+
+		constexpr T get(uint32 index) const {
+			return -GenoVectorExpressions::Operand<O>::template get<T>(operand, index);
+		}
+};
+
+/** The nodes the GenoVector2, 3 and 4 operators build from plain vectors **/
+template <uint32 N, typename T, typename Op>
+using GenoVectorPair = GenoVectorBinary<N, T, Op, GenoVector<N, T>, GenoVector<N, T>>;
+
+template <uint32 N, typename T, typename Op>
+using GenoVectorScaled = GenoVectorBinary<N, T, Op, GenoVector<N, T>, GenoVectorExpressions::Scalar<T>>;
+
+template <uint32 N, typename T>
+using GenoVectorPreScaled = GenoVectorBinary<N, T, GenoVectorExpressions::Multiply, GenoVectorExpressions::Scalar<T>, GenoVector<N, T>>;
+
+template <uint32 N, typename T, typename L, typename R>
+constexpr GenoVectorBinary<N, T, GenoVectorExpressions::Add, L, R> operator+(const GenoVectorExpression<N, T, L> & left, const GenoVectorExpression<N, T, R> & right) {
+	return { static_cast<const L &>(left), static_cast<const R &>(right) };
+}
+
+template <uint32 N, typename T, typename L>
+constexpr GenoVectorBinary<N, T, GenoVectorExpressions::Add, L, GenoVector<N, T>> operator+(const GenoVectorExpression<N, T, L> & left, const GenoVector<N, T> & right) {
+	return { static_cast<const L &>(left), right };
+}
+
+template <uint32 N, typename T, typename R>
+constexpr GenoVectorBinary<N, T, GenoVectorExpressions::Add, GenoVector<N, T>, R> operator+(const GenoVector<N, T> & left, const GenoVectorExpression<N, T, R> & right) {
+	return { left, static_cast<const R &>(right) };
+}
+
+template <uint32 N, typename T, typename L, typename R>
+constexpr GenoVectorBinary<N, T, GenoVectorExpressions::Subtract, L, R> operator-(const GenoVectorExpression<N, T, L> & left, const GenoVectorExpression<N, T, R> & right) {
+	return { static_cast<const L &>(left), static_cast<const R &>(right) };
+}
+
+template <uint32 N, typename T, typename L>
+constexpr GenoVectorBinary<N, T, GenoVectorExpressions::Subtract, L, GenoVector<N, T>> operator-(const GenoVectorExpression<N, T, L> & left, const GenoVector<N, T> & right) {
+	return { static_cast<const L &>(left), right };
+}
+
+template <uint32 N, typename T, typename R>
+constexpr GenoVectorBinary<N, T, GenoVectorExpressions::Subtract, GenoVector<N, T>, R> operator-(const GenoVector<N, T> & left, const GenoVectorExpression<N, T, R> & right) {
+	return { left, static_cast<const R &>(right) };
+}
+
+template <uint32 N, typename T, typename L, typename R>
+constexpr GenoVectorBinary<N, T, GenoVectorExpressions::Multiply, L, R> operator*(const GenoVectorExpression<N, T, L> & left, const GenoVectorExpression<N, T, R> & right) {
+	return { static_cast<const L &>(left), static_cast<const R &>(right) };
+}
+
+template <uint32 N, typename T, typename L>
+constexpr GenoVectorBinary<N, T, GenoVectorExpressions::Multiply, L, GenoVector<N, T>> operator*(const GenoVectorExpression<N, T, L> & left, const GenoVector<N, T> & right) {
+	return { static_cast<const L &>(left), right };
+}
+
+template <uint32 N, typename T, typename R>
+constexpr GenoVectorBinary<N, T, GenoVectorExpressions::Multiply, GenoVector<N, T>, R> operator*(const GenoVector<N, T> & left, const GenoVectorExpression<N, T, R> & right) {
+	return { left, static_cast<const R &>(right) };
+}
+
+template <uint32 N, typename T, typename L, typename R>
+constexpr GenoVectorBinary<N, T, GenoVectorExpressions::Divide, L, R> operator/(const GenoVectorExpression<N, T, L> & left, const GenoVectorExpression<N, T, R> & right) {
+	return { static_cast<const L &>(left), static_cast<const R &>(right) };
+}
+
+template <uint32 N, typename T, typename L>
+constexpr GenoVectorBinary<N, T, GenoVectorExpressions::Divide, L, GenoVector<N, T>> operator/(const GenoVectorExpression<N, T, L> & left, const GenoVector<N, T> & right) {
+	return { static_cast<const L &>(left), right };
+}
+
+template <uint32 N, typename T, typename R>
+constexpr GenoVectorBinary<N, T, GenoVectorExpressions::Divide, GenoVector<N, T>, R> operator/(const GenoVector<N, T> & left, const GenoVectorExpression<N, T, R> & right) {
+	return { left, static_cast<const R &>(right) };
+}
+
+template <uint32 N, typename T, typename E>
+constexpr GenoVectorNegate<N, T, E> operator-(const GenoVectorExpression<N, T, E> & expression) {
+	return { static_cast<const E &>(expression) };
+}
+
+template <uint32 N, typename T, typename E>
+constexpr GenoVectorBinary<N, T, GenoVectorExpressions::Multiply, E, GenoVectorExpressions::Scalar<T>> operator*(const GenoVectorExpression<N, T, E> & left, T right) {
+	return { static_cast<const E &>(left), { right } };
+}
+
+template <uint32 N, typename T, typename E>
+constexpr GenoVectorBinary<N, T, GenoVectorExpressions::Multiply, GenoVectorExpressions::Scalar<T>, E> operator*(T left, const GenoVectorExpression<N, T, E> & right) {
+	return { { left }, static_cast<const E &>(right) };
+}
+
+template <uint32 N, typename T, typename E>
+constexpr GenoVectorBinary<N, T, GenoVectorExpressions::Divide, E, GenoVectorExpressions::Scalar<T>> operator/(const GenoVectorExpression<N, T, E> & left, T right) {
+	return { static_cast<const E &>(left), { right } };
+}
+
+#define GNARLY_GENOME_VECTOR_EXPRESSION_FORWARD
+#endif // GNARLY_GENOME_VECTOR_EXPRESSION
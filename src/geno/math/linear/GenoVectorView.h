@@ -0,0 +1,138 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "../../GenoInts.h"
+
+#ifndef GNARLY_GENOME_VECTOR_FORWARD
+#define GNARLY_GENOME_VECTOR_FORWARD
+
+template <uint32 N, typename T>
+class GenoVector;
+
+#endif // GNARLY_GENOME_VECTOR_FORWARD
+
+#ifndef GNARLY_GENOME_VECTOR_VIEW
+#define GNARLY_GENOME_VECTOR_VIEW
+
+#include <ostream>
+#include <type_traits>
+
+#include "GenoVector.h"
+
+/**
+ * Non-owning window onto N contiguous components stored elsewhere (a matrix column, a vertex buffer, ...).
+ * Writes go straight through to the aliased memory. Converting to a GenoVector copies the components out.
+ * A view of const T is read only.
+**/
+template <uint32 N, typename T>
+class GenoVectorView {
+
+	static_assert(N > 0, "Vector dimensions must be greater than 0!");
+
+	public:
+		T * v;
+
+		GenoVectorView(T * v) noexcept :
+			v(v) {}
+
+		GenoVectorView(GenoVector<N, T> & vector) noexcept :
+			v(vector.v) {}
+
+		GenoVectorView(const GenoVectorView<N, T> & view) noexcept :
+			v(view.v) {}
+
+		GenoVectorView<N, T> & operator=(const GenoVectorView<N, T> & view) {
+			for (uint32 i = 0; i < N; ++i)
+				v[i] = view.v[i];
+			return *this;
+		}
+
+		GenoVectorView<N, T> & operator=(const GenoVector<N, T> & vector) {
+			for (uint32 i = 0; i < N; ++i)
+				v[i] = vector.v[i];
+			return *this;
+		}
+
+		GenoVectorView<N, T> & operator+=(const GenoVector<N, T> & vector) {
+			for (uint32 i = 0; i < N; ++i)
+				v[i] += vector.v[i];
+			return *this;
+		}
+
+		GenoVectorView<N, T> & operator-=(const GenoVector<N, T> & vector) {
+			for (uint32 i = 0; i < N; ++i)
+				v[i] -= vector.v[i];
+			return *this;
+		}
+
+		GenoVectorView<N, T> & operator*=(T scalar) {
+			for (uint32 i = 0; i < N; ++i)
+				v[i] *= scalar;
+			return *this;
+		}
+
+		GenoVectorView<N, T> & operator/=(T scalar) {
+			for (uint32 i = 0; i < N; ++i)
+				v[i] /= scalar;
+			return *this;
+		}
+
+		T & operator[](uint32 index) const noexcept {
+			return v[index];
+		}
+
+		operator GenoVector<N, typename std::remove_const<T>::type>() const {
+			GenoVector<N, typename std::remove_const<T>::type> vector;
+			for (uint32 i = 0; i < N; ++i)
+				vector.v[i] = v[i];
+			return vector;
+		}
+};
+
+template <uint32 N, typename T>
+std::ostream & operator<<(std::ostream & stream, const GenoVectorView<N, T> & view) {
+	stream << '<';
+	for (uint32 i = 0; i < N; ++i) {
+		stream << view.v[i];
+		if (i < N - 1)
+			stream << ", ";
+	}
+	return stream << '>';
+}
+
+template <typename T> using GenoVector2View = GenoVectorView<2, T>;
+template <typename T> using GenoVector3View = GenoVectorView<3, T>;
+template <typename T> using GenoVector4View = GenoVectorView<4, T>;
+
+using GenoVector2fView = GenoVector2View<float >;
+using GenoVector2dView = GenoVector2View<double>;
+using GenoVector3fView = GenoVector3View<float >;
+using GenoVector3dView = GenoVector3View<double>;
+using GenoVector4fView = GenoVector4View<float >;
+using GenoVector4dView = GenoVector4View<double>;
+
+#define GNARLY_GENOME_VECTOR_VIEW_FORWARD
+#endif // GNARLY_GENOME_VECTOR_VIEW
@@ -0,0 +1,208 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_GENOME_CONCURRENT_QUEUE
+#define GNARLY_GENOME_CONCURRENT_QUEUE
+
+#include <new>
+#include <atomic>
+#include <utility>
+
+#include "../GenoInts.h"
+
+/**
+ * A bounded lock free multi producer multi consumer queue
+ *
+ * Every cell of the ring carries a sequence number that tells producers and consumers whose turn it is, so a push or
+ * a pop is a single compare and swap on the shared position with no locks. Pushes fail when the queue is full rather
+ * than reallocating
+**/
+template <typename T>
+class GenoConcurrentQueue {
+	private:
+		struct GenoConcurrentQueueCell {
+			std::atomic<uint32> sequence;
+			alignas(T) uint8 storage[sizeof(T)];
+
+			T * get() {
+				return reinterpret_cast<T *>(storage);
+			}
+		};
+
+		uint32 mask;
+		GenoConcurrentQueueCell * cells;
+
+		alignas(64) std::atomic<uint32> pushPosition;
+		alignas(64) std::atomic<uint32> popPosition;
+
+		/** Claims up to count consecutive free cells and returns the first position through position **/
+		uint32 claim(std::atomic<uint32> & shared, uint32 offset, uint32 count, uint32 & position) {
+			position = shared.load(std::memory_order_relaxed);
+			while (true) {
+				uint32 available = 0;
+				while (available < count) {
+					uint32 sequence = cells[(position + available) & mask].sequence.load(std::memory_order_acquire);
+					if (sequence != position + available + offset)
+						break;
+					++available;
+				}
+				if (available == 0) {
+					// A sequence behind the position means the cell is still in use, the queue is full or empty
+					uint32 sequence = cells[position & mask].sequence.load(std::memory_order_acquire);
+					if ((int32) (sequence - (position + offset)) < 0)
+						return 0;
+					position = shared.load(std::memory_order_relaxed);
+				}
+				else if (shared.compare_exchange_weak(position, position + available, std::memory_order_relaxed))
+					return available;
+			}
+		}
+
+	public:
+		/**
+		 * Creates a queue
+		 *
+		 * @param capacity - The maximum number of elements in the queue, rounded up to a power of two
+		**/
+		GenoConcurrentQueue(uint32 capacity = 1024) :
+			pushPosition(0),
+			popPosition(0) {
+			uint32 size = 2;
+			while (size < capacity)
+				size <<= 1;
+			mask = size - 1;
+			cells = new GenoConcurrentQueueCell[size];
+			for (uint32 i = 0; i < size; ++i)
+				cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		GenoConcurrentQueue(const GenoConcurrentQueue<T> & queue) = delete;
+		GenoConcurrentQueue<T> & operator=(const GenoConcurrentQueue<T> & queue) = delete;
+
+		/**
+		 * Pushes an element to the back of the queue
+		 *
+		 * @param element - The element to push
+		 *
+		 * @return Whether there was room for the element
+		**/
+		bool tryPush(const T & element) {
+			return tryPushBulk(&element, 1) == 1;
+		}
+
+		/**
+		 * Moves an element to the back of the queue
+		 *
+		 * @param element - The element to push, left untouched if the queue is full
+		 *
+		 * @return Whether there was room for the element
+		**/
+		bool tryPush(T && element) {
+			uint32 position;
+			if (claim(pushPosition, 0, 1, position) == 0)
+				return false;
+			GenoConcurrentQueueCell & cell = cells[position & mask];
+			new (cell.storage) T(std::move(element));
+			cell.sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * Pushes as many elements as fit with a single claim on the queue
+		 *
+		 * @param elements - The elements to push
+		 * @param count - The number of elements
+		 *
+		 * @return The number of elements pushed from the front of elements
+		**/
+		uint32 tryPushBulk(const T * elements, uint32 count) {
+			uint32 position;
+			uint32 claimed = claim(pushPosition, 0, count, position);
+			for (uint32 i = 0; i < claimed; ++i) {
+				GenoConcurrentQueueCell & cell = cells[(position + i) & mask];
+				new (cell.storage) T(elements[i]);
+				cell.sequence.store(position + i + 1, std::memory_order_release);
+			}
+			return claimed;
+		}
+
+		/**
+		 * Pops the element at the front of the queue
+		 *
+		 * @param element - Receives the popped element
+		 *
+		 * @return Whether there was an element to pop
+		**/
+		bool tryPop(T & element) {
+			return tryPopBulk(&element, 1) == 1;
+		}
+
+		/**
+		 * Pops as many elements as are ready with a single claim on the queue
+		 *
+		 * @param elements - Receives the popped elements
+		 * @param count - The maximum number of elements to pop
+		 *
+		 * @return The number of elements popped into the front of elements
+		**/
+		uint32 tryPopBulk(T * elements, uint32 count) {
+			uint32 position;
+			uint32 claimed = claim(popPosition, 1, count, position);
+			for (uint32 i = 0; i < claimed; ++i) {
+				GenoConcurrentQueueCell & cell = cells[(position + i) & mask];
+				elements[i] = std::move(*cell.get());
+				cell.get()->~T();
+				cell.sequence.store(position + i + mask + 1, std::memory_order_release);
+			}
+			return claimed;
+		}
+
+		/**
+		 * Returns the number of elements in the queue, only a snapshot while other threads are pushing or popping
+		**/
+		uint32 getSize() const {
+			uint32 pop  = popPosition.load(std::memory_order_relaxed);
+			uint32 push = pushPosition.load(std::memory_order_relaxed);
+			return (int32) (push - pop) > 0 ? push - pop : 0;
+		}
+
+		/**
+		 * Returns the maximum number of elements in the queue
+		**/
+		uint32 getCapacity() const {
+			return mask + 1;
+		}
+
+		~GenoConcurrentQueue() {
+			uint32 push = pushPosition.load(std::memory_order_relaxed);
+			for (uint32 i = popPosition.load(std::memory_order_relaxed); i != push; ++i)
+				cells[i & mask].get()->~T();
+			delete [] cells;
+		}
+};
+
+#define GNARLY_GENOME_CONCURRENT_QUEUE_FORWARD
+#endif // GNARLY_GENOME_CONCURRENT_QUEUE
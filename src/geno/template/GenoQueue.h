@@ -71,10 +71,14 @@ class GenoQueue {
 	public:
 		GenoQueue(uint32 capacity = 16) :
 			capacity(capacity),
+			read(0),
+			write(0),
+			length(0),
 			array(new T[capacity]) {}
 
 		GenoQueue(std::initializer_list<T> list) :
 			capacity(list.size() * 2),
+			read(0),
 			write(list.size()),
 			length(list.size()),
 			array(new T[capacity]) {
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <thread>
+#include <chrono>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+	#define GENO_CLOCK_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+	#define GENO_CLOCK_TSC
+#endif
+
+#include "GenoPacer.h"
+#include "GenoClock.h"
+
+namespace {
+	uint64 readCounter();
+}
+
+GenoClock::GenoClock() {}
+
+void GenoClock::wait(uint64 duration, bool precise) {
+	if (precise)
+		GenoPacer::sleepUntil(GenoPacer::getTicks() + duration);
+	else
+		std::this_thread::sleep_for(std::chrono::nanoseconds(duration));
+}
+
+GenoClock::~GenoClock() {}
+
+GenoMonotonicClock::GenoMonotonicClock() :
+	origin(GenoPacer::getTicks()) {}
+
+uint64 GenoMonotonicClock::getTime() {
+	return GenoPacer::getTicks() - origin;
+}
+
+GenoMonotonicClock::~GenoMonotonicClock() {}
+
+GenoTscClock::GenoTscClock(uint64 calibrationTime) {
+#if defined(GENO_CLOCK_TSC)
+	uint64 startTicks = GenoPacer::getTicks();
+	uint64 startCounter = readCounter();
+	uint64 endTicks = startTicks;
+	while (endTicks - startTicks < calibrationTime)
+		endTicks = GenoPacer::getTicks();
+	uint64 endCounter = readCounter();
+	nanosPerTick = (double) (endTicks - startTicks) / (endCounter - startCounter);
+#else
+	nanosPerTick = 1;
+#endif
+	origin = readCounter();
+}
+
+uint64 GenoTscClock::getTime() {
+	return (uint64) ((readCounter() - origin) * nanosPerTick);
+}
+
+double GenoTscClock::getNanosPerTick() {
+	return nanosPerTick;
+}
+
+GenoTscClock::~GenoTscClock() {}
+
+GenoVirtualClock::GenoVirtualClock(uint64 time) :
+	time(time) {}
+
+uint64 GenoVirtualClock::getTime() {
+	return time.load(std::memory_order_relaxed);
+}
+
+void GenoVirtualClock::wait(uint64 duration, bool) {
+	advance(duration);
+}
+
+void GenoVirtualClock::advance(uint64 duration) {
+	time.fetch_add(duration, std::memory_order_relaxed);
+}
+
+void GenoVirtualClock::setTime(uint64 time) {
+	this->time.store(time, std::memory_order_relaxed);
+}
+
+GenoVirtualClock::~GenoVirtualClock() {}
+
+namespace {
+	uint64 readCounter() {
+#if defined(GENO_CLOCK_TSC)
+		return __rdtsc();
+#else
+		return GenoPacer::getTicks();
+#endif
+	}
+}
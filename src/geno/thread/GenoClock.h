@@ -0,0 +1,121 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_GENOME_CLOCK
+#define GNARLY_GENOME_CLOCK
+
+#include <atomic>
+
+#include "../GenoInts.h"
+
+/**
+ * A source of time for GenoTime, in nanoseconds since the clock was created
+**/
+class GenoClock {
+	protected:
+		GenoClock();
+	public:
+		/**
+		 * Returns the time in nanoseconds
+		**/
+		virtual uint64 getTime() = 0;
+
+		/**
+		 * Waits for the given number of nanoseconds to pass on this clock. Real clocks sleep, with GenoPacer when
+		 * precise is set
+		**/
+		virtual void wait(uint64 duration, bool precise);
+
+		virtual ~GenoClock();
+};
+
+/**
+ * Reads CLOCK_MONOTONIC directly (steady_clock where it is not available)
+**/
+class GenoMonotonicClock : public GenoClock {
+	private:
+		uint64 origin;
+	public:
+		GenoMonotonicClock();
+		uint64 getTime() override;
+		~GenoMonotonicClock();
+};
+
+/**
+ * Reads the CPU's time stamp counter, converted to nanoseconds with a rate measured against the monotonic clock
+ * at construction. Assumes an invariant TSC, as on any x86 CPU of the last decade, and falls back to the
+ * monotonic clock on other architectures
+**/
+class GenoTscClock : public GenoClock {
+	private:
+		uint64 origin;
+		double nanosPerTick;
+	public:
+		/**
+		 * Calibrates the clock, busy waiting for the calibration time
+		 *
+		 * @param calibrationTime - How long to measure the counter's rate for in nanoseconds
+		**/
+		GenoTscClock(uint64 calibrationTime = 10000000);
+		uint64 getTime() override;
+
+		/**
+		 * Returns the measured length of one counter tick in nanoseconds
+		**/
+		double getNanosPerTick();
+
+		~GenoTscClock();
+};
+
+/**
+ * A clock that only moves when told to. Waiting on it moves it forward instantly, so a GenoLoop running on it
+ * runs as fast as its callbacks allow while seeing the same times it would in real time
+**/
+class GenoVirtualClock : public GenoClock {
+	private:
+		std::atomic<uint64> time;
+	public:
+		GenoVirtualClock(uint64 time = 0);
+		uint64 getTime() override;
+		void wait(uint64 duration, bool precise) override;
+
+		/**
+		 * Moves the clock forward
+		 *
+		 * @param duration - The amount to move by in nanoseconds
+		**/
+		void advance(uint64 duration);
+
+		/**
+		 * Sets the clock's time in nanoseconds
+		**/
+		void setTime(uint64 time);
+
+		~GenoVirtualClock();
+};
+
+#define GNARLY_GENOME_CLOCK_FORWARD
+#endif // GNARLY_GENOME_CLOCK
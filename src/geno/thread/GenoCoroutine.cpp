@@ -0,0 +1,219 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <iostream>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+#include "GenoCoroutine.h"
+
+namespace {
+	/** Frames are pooled in size classes of this many bytes **/
+	const std::size_t FRAME_GRANULARITY = 64;
+
+	/** The largest pooled frame, bigger frames come straight from the heap **/
+	const std::size_t MAX_POOLED_FRAME = 1024;
+
+	/** The number of frames allocated at a time when a size class runs dry **/
+	const uint32 FRAME_BLOCK_SIZE = 16;
+
+	struct GenoFreeFrame {
+		GenoFreeFrame * next;
+	};
+
+	std::mutex frameMutex;
+	GenoFreeFrame * freeFrames[MAX_POOLED_FRAME / FRAME_GRANULARITY];
+
+	thread_local GenoCoroutineScheduler * currentScheduler = 0;
+
+	/** Removes the first element that matches by swapping the last one into its place **/
+	template <typename T, typename Predicate>
+	bool removeFirst(std::vector<T> & elements, Predicate predicate) {
+		for (uint32 i = 0; i < elements.size(); ++i) {
+			if (predicate(elements[i])) {
+				elements[i] = elements.back();
+				elements.pop_back();
+				return true;
+			}
+		}
+		return false;
+	}
+}
+
+void * GenoCoroutine::promise_type::operator new(std::size_t size) {
+	if (size > MAX_POOLED_FRAME)
+		return ::operator new(size);
+	std::size_t sizeClass = (size - 1) / FRAME_GRANULARITY;
+	std::lock_guard<std::mutex> lock(frameMutex);
+	if (freeFrames[sizeClass] == 0) {
+		// Pooled frames are never returned to the heap, the number alive at once is what the pool grows to
+		std::size_t frameSize = (sizeClass + 1) * FRAME_GRANULARITY;
+		uint8 * block = (uint8 *) ::operator new(frameSize * FRAME_BLOCK_SIZE);
+		for (uint32 i = 0; i < FRAME_BLOCK_SIZE; ++i) {
+			auto frame = (GenoFreeFrame *) (block + i * frameSize);
+			frame->next = freeFrames[sizeClass];
+			freeFrames[sizeClass] = frame;
+		}
+	}
+	GenoFreeFrame * frame = freeFrames[sizeClass];
+	freeFrames[sizeClass] = frame->next;
+	return frame;
+}
+
+void GenoCoroutine::promise_type::operator delete(void * frame, std::size_t size) {
+	if (size > MAX_POOLED_FRAME) {
+		::operator delete(frame);
+		return;
+	}
+	std::size_t sizeClass = (size - 1) / FRAME_GRANULARITY;
+	std::lock_guard<std::mutex> lock(frameMutex);
+	auto freeFrame = (GenoFreeFrame *) frame;
+	freeFrame->next = freeFrames[sizeClass];
+	freeFrames[sizeClass] = freeFrame;
+}
+
+void GenoCoroutine::destroy() {
+	if (handle) {
+		if (handle.promise().scheduler != 0)
+			handle.promise().scheduler->cancel(handle);
+		handle.destroy();
+		handle = 0;
+	}
+}
+
+void GenoCoroutine::GenoFrameAwaiter::await_suspend(Handle handle) {
+	scheduler = GenoCoroutineScheduler::requireCurrent();
+	scheduler->waitFrame(handle);
+}
+
+double GenoCoroutine::GenoFrameAwaiter::await_resume() const {
+	return scheduler->getDelta();
+}
+
+void GenoCoroutine::GenoTimeAwaiter::await_suspend(Handle handle) {
+	GenoCoroutineScheduler * scheduler = GenoCoroutineScheduler::requireCurrent();
+	scheduler->waitUntil(scheduler->getTime() + time, handle);
+}
+
+GenoCoroutineScheduler::GenoCoroutineScheduler() :
+	time(0),
+	delta(0) {}
+
+GenoCoroutineScheduler * GenoCoroutineScheduler::getCurrent() {
+	return currentScheduler;
+}
+
+GenoCoroutineScheduler * GenoCoroutineScheduler::requireCurrent() {
+	if (currentScheduler == 0) {
+		std::cerr << "Genome Error (GenoCoroutine): co_await needs a scheduler, await only inside GenoLoop::start or after GenoCoroutineScheduler::setCurrent!" << std::endl;
+		std::abort();
+	}
+	return currentScheduler;
+}
+
+GenoCoroutineScheduler * GenoCoroutineScheduler::setCurrent(GenoCoroutineScheduler * scheduler) {
+	GenoCoroutineScheduler * previous = currentScheduler;
+	currentScheduler = scheduler;
+	return previous;
+}
+
+void GenoCoroutineScheduler::wait(Handle handle) {
+	handle.promise().scheduler = this;
+}
+
+void GenoCoroutineScheduler::waitFrame(Handle handle) {
+	wait(handle);
+	frameWaiters.push_back(handle);
+}
+
+void GenoCoroutineScheduler::waitUntil(double wakeTime, Handle handle) {
+	wait(handle);
+	timers.push_back({ wakeTime, handle });
+}
+
+void GenoCoroutineScheduler::waitFor(bool (*isReady)(const void * data), const void * data, Handle handle) {
+	wait(handle);
+	polls.push_back({ isReady, data, handle });
+}
+
+void GenoCoroutineScheduler::cancel(Handle handle) {
+	handle.promise().scheduler = 0;
+	// A coroutine resumed earlier in this update may have destroyed one that is about to be resumed
+	for (Handle & resume : resuming)
+		if (resume == handle)
+			resume = 0;
+	if (removeFirst(frameWaiters, [handle](Handle waiter) { return waiter == handle; }))
+		return;
+	if (removeFirst(timers, [handle](const GenoTimer & timer) { return timer.handle == handle; }))
+		return;
+	removeFirst(polls, [handle](const GenoPoll & poll) { return poll.handle == handle; });
+}
+
+void GenoCoroutineScheduler::update(double delta) {
+	this->delta = delta;
+	time += delta;
+
+	// Coroutines that wait again while they are resumed land in the emptied lists and wait for the next update
+	resuming.swap(frameWaiters);
+	for (uint32 i = 0; i < timers.size(); ++i) {
+		if (timers[i].wakeTime <= time) {
+			resuming.push_back(timers[i].handle);
+			timers[i--] = timers.back();
+			timers.pop_back();
+		}
+	}
+	for (uint32 i = 0; i < polls.size(); ++i) {
+		if (polls[i].isReady(polls[i].data)) {
+			resuming.push_back(polls[i].handle);
+			polls[i--] = polls.back();
+			polls.pop_back();
+		}
+	}
+
+	GenoCoroutineScheduler * previous = setCurrent(this);
+	for (uint32 i = 0; i < resuming.size(); ++i) {
+		Handle handle = resuming[i];
+		if (handle) {
+			handle.promise().scheduler = 0;
+			handle.resume();
+		}
+	}
+	resuming.clear();
+	setCurrent(previous);
+}
+
+double GenoCoroutineScheduler::getTime() const {
+	return time;
+}
+
+double GenoCoroutineScheduler::getDelta() const {
+	return delta;
+}
+
+uint32 GenoCoroutineScheduler::getNumWaiting() const {
+	return frameWaiters.size() + timers.size() + polls.size();
+}
@@ -0,0 +1,337 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_GENOME_COROUTINE
+#define GNARLY_GENOME_COROUTINE
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+
+#include "../GenoInts.h"
+#include "GenoThreadPool.h"
+
+class GenoCoroutineScheduler;
+
+/**
+ * A coroutine that runs on the thread of a GenoLoop
+ *
+ * A coroutine starts running as soon as it is called and keeps running until its first co_await. It can wait for the
+ * next frame, for an amount of loop time, for a GenoJobHandle or for another GenoCoroutine, and is resumed by the
+ * scheduler of the loop that is running on the thread, so no thread blocks while it waits. Destroying a coroutine
+ * that is still waiting cancels it. Coroutine frames come from a pool
+ *
+ * Waiting on a frame, on time or on a job needs a scheduler on the calling thread, so the coroutine must reach those
+ * co_awaits inside GenoLoop::start or after GenoCoroutineScheduler::setCurrent. Reaching one anywhere else aborts
+**/
+class GenoCoroutine {
+	public:
+		struct promise_type;
+		typedef std::coroutine_handle<promise_type> Handle;
+
+		struct promise_type {
+			GenoCoroutineScheduler * scheduler;
+			std::coroutine_handle<> continuation;
+
+			struct FinalAwaiter {
+				bool await_ready() const noexcept {
+					return false;
+				}
+
+				std::coroutine_handle<> await_suspend(Handle handle) noexcept {
+					std::coroutine_handle<> continuation = handle.promise().continuation;
+					return continuation ? continuation : std::noop_coroutine();
+				}
+
+				void await_resume() const noexcept {}
+			};
+
+			static void * operator new(std::size_t size);
+			static void operator delete(void * frame, std::size_t size);
+
+			promise_type() :
+				scheduler(0) {}
+
+			GenoCoroutine get_return_object() {
+				return GenoCoroutine(Handle::from_promise(*this));
+			}
+
+			std::suspend_never initial_suspend() const noexcept {
+				return {};
+			}
+
+			FinalAwaiter final_suspend() const noexcept {
+				return {};
+			}
+
+			void return_void() const noexcept {}
+
+			void unhandled_exception() const {
+				throw;
+			}
+		};
+
+	private:
+		Handle handle;
+
+		explicit GenoCoroutine(Handle handle) :
+			handle(handle) {}
+
+		void destroy();
+
+		struct GenoFrameAwaiter {
+			GenoCoroutineScheduler * scheduler;
+
+			bool await_ready() const noexcept {
+				return false;
+			}
+
+			void await_suspend(Handle handle);
+			double await_resume() const;
+		};
+
+		struct GenoTimeAwaiter {
+			double time;
+
+			bool await_ready() const noexcept {
+				return time <= 0;
+			}
+
+			void await_suspend(Handle handle);
+
+			void await_resume() const noexcept {}
+		};
+
+		struct GenoCoroutineAwaiter {
+			Handle child;
+
+			bool await_ready() const noexcept {
+				return child.done();
+			}
+
+			void await_suspend(std::coroutine_handle<> handle) noexcept {
+				child.promise().continuation = handle;
+			}
+
+			void await_resume() const noexcept {}
+		};
+	public:
+		GenoCoroutine() :
+			handle(0) {}
+
+		GenoCoroutine(const GenoCoroutine &) = delete;
+		GenoCoroutine & operator=(const GenoCoroutine &) = delete;
+
+		GenoCoroutine(GenoCoroutine && coroutine) noexcept :
+			handle(coroutine.handle) {
+			coroutine.handle = 0;
+		}
+
+		GenoCoroutine & operator=(GenoCoroutine && coroutine) noexcept {
+			destroy();
+			handle = coroutine.handle;
+			coroutine.handle = 0;
+			return *this;
+		}
+
+		/**
+		 * Returns whether the coroutine has run to completion, an empty coroutine counts as done
+		**/
+		bool isDone() const {
+			return !handle || handle.done();
+		}
+
+		/**
+		 * Awaits until the next frame of the loop, or its next fixed step when it runs them, the result is that delta
+		**/
+		static GenoFrameAwaiter nextFrame() {
+			return { 0 };
+		}
+
+		/**
+		 * Awaits until an amount of loop time has passed
+		 *
+		 * @param time - The time to wait in seconds of loop delta
+		**/
+		static GenoTimeAwaiter seconds(double time) {
+			return { time };
+		}
+
+		/**
+		 * Awaits until another coroutine has run to completion
+		**/
+		GenoCoroutineAwaiter operator co_await() const noexcept {
+			return { handle };
+		}
+
+		~GenoCoroutine() {
+			destroy();
+		}
+};
+
+/**
+ * Resumes waiting coroutines once per frame, or once per fixed step when the loop runs them, driven by GenoLoop
+**/
+class GenoCoroutineScheduler {
+	private:
+		typedef GenoCoroutine::Handle Handle;
+
+		struct GenoTimer {
+			double wakeTime;
+			Handle handle;
+		};
+
+		struct GenoPoll {
+			bool (*isReady)(const void * data);
+			const void * data;
+			Handle handle;
+		};
+
+		double time;
+		double delta;
+		std::vector<Handle> frameWaiters;
+		std::vector<GenoTimer> timers;
+		std::vector<GenoPoll> polls;
+		std::vector<Handle> resuming;
+
+		void wait(Handle handle);
+	public:
+		GenoCoroutineScheduler();
+
+		GenoCoroutineScheduler(const GenoCoroutineScheduler &) = delete;
+		GenoCoroutineScheduler & operator=(const GenoCoroutineScheduler &) = delete;
+
+		/**
+		 * Returns the scheduler coroutines on the calling thread wait on, set while a GenoLoop is running
+		**/
+		static GenoCoroutineScheduler * getCurrent();
+
+		/**
+		 * Returns the current scheduler, aborting with an error if the calling thread has none
+		**/
+		static GenoCoroutineScheduler * requireCurrent();
+
+		/**
+		 * Sets the scheduler coroutines on the calling thread wait on
+		 *
+		 * @return The previous scheduler
+		**/
+		static GenoCoroutineScheduler * setCurrent(GenoCoroutineScheduler * scheduler);
+
+		/**
+		 * Resumes a coroutine on the next update
+		**/
+		void waitFrame(Handle handle);
+
+		/**
+		 * Resumes a coroutine on the first update at or after a point in loop time
+		**/
+		void waitUntil(double wakeTime, Handle handle);
+
+		/**
+		 * Resumes a coroutine on the first update at which isReady(data) returns true
+		**/
+		void waitFor(bool (*isReady)(const void * data), const void * data, Handle handle);
+
+		/**
+		 * Forgets a waiting coroutine so it is never resumed
+		**/
+		void cancel(Handle handle);
+
+		/**
+		 * Advances loop time and resumes every coroutine that is done waiting
+		 *
+		 * @param delta - The time since the last update in seconds
+		**/
+		void update(double delta);
+
+		/**
+		 * Returns the loop time in seconds, the sum of every update's delta
+		**/
+		double getTime() const;
+
+		/**
+		 * Returns the delta of the last update
+		**/
+		double getDelta() const;
+
+		/**
+		 * Returns the number of coroutines waiting on the scheduler
+		**/
+		uint32 getNumWaiting() const;
+};
+
+template <typename R>
+struct GenoJobHandleAwaiter {
+	GenoJobHandle<R> & jobHandle;
+
+	static bool isReady(const void * data) {
+		return ((const GenoJobHandle<R> *) data)->isReady();
+	}
+
+	bool await_ready() const {
+		return jobHandle.isReady();
+	}
+
+	void await_suspend(GenoCoroutine::Handle handle) {
+		GenoCoroutineScheduler::requireCurrent()->waitFor(isReady, &jobHandle, handle);
+	}
+
+	typename std::add_lvalue_reference<R>::type await_resume() {
+		return jobHandle.get();
+	}
+};
+
+/**
+ * Awaits until a job submitted with GenoThreadPool::submit() has finished, the result is a reference to its result
+**/
+template <typename R>
+GenoJobHandleAwaiter<R> operator co_await(GenoJobHandle<R> & jobHandle) {
+	return { jobHandle };
+}
+
+/**
+ * Awaits until a job submitted with GenoThreadPool::submit() has finished, the result is its result which is moved
+ * out because the handle dies with the expression
+**/
+template <typename R>
+auto operator co_await(GenoJobHandle<R> && jobHandle) {
+	struct GenoTemporaryJobHandleAwaiter : GenoJobHandleAwaiter<R> {
+		R await_resume() {
+			if constexpr (std::is_void<R>::value)
+				this->jobHandle.get();
+			else
+				return std::move(this->jobHandle.get());
+		}
+	};
+	return GenoTemporaryJobHandleAwaiter{ { jobHandle } };
+}
+
+#define GNARLY_GENOME_COROUTINE_FORWARD
+#endif // GNARLY_GENOME_COROUTINE
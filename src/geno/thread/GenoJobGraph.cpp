@@ -0,0 +1,151 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "GenoJobGraph.h"
+
+void GenoJobGraph::runJob(GenoThreadPoolJobData data) {
+	auto job   = (GenoJobGraphJob *) data;
+	auto graph = job->graph;
+	if (!graph->cancelled.load(std::memory_order_relaxed))
+		job->job(job->data);
+	graph->finish((GenoJobGraphNode) (job - graph->jobs.data()));
+}
+
+void GenoJobGraph::schedule(GenoJobGraphNode node) {
+	if (jobs[node].mainThread) {
+		std::lock_guard<std::mutex> lock(stateMutex);
+		mainThreadJobs.push_back(node);
+		stateChanged.notify_all();
+	}
+	else
+		pool->submitJob(runJob, &jobs[node]);
+}
+
+void GenoJobGraph::finish(GenoJobGraphNode node) {
+	for (GenoJobGraphNode dependent : jobs[node].dependents)
+		if (remainingDependencies[dependent].fetch_sub(1) == 1)
+			schedule(dependent);
+	uint32 unfinished = unfinishedJobs.load();
+	while (unfinished > 1 && !unfinishedJobs.compare_exchange_weak(unfinished, unfinished - 1));
+	// The last job clears the count under the lock, so wait() cannot return and let the graph be destroyed while
+	// this is still notifying
+	if (unfinished == 1) {
+		std::lock_guard<std::mutex> lock(stateMutex);
+		unfinishedJobs.store(0);
+		stateChanged.notify_all();
+	}
+}
+
+GenoJobGraph::GenoJobGraph(GenoThreadPool * pool) :
+	pool(pool),
+	counterCapacity(0),
+	remainingDependencies(0),
+	unfinishedJobs(0),
+	cancelled(false) {}
+
+GenoJobGraphNode GenoJobGraph::addJob(GenoThreadPoolJob job, GenoThreadPoolJobData data, bool mainThread) {
+	jobs.push_back({ this, job, data, mainThread, 0, {} });
+	return (GenoJobGraphNode) (jobs.size() - 1);
+}
+
+void GenoJobGraph::addDependency(GenoJobGraphNode before, GenoJobGraphNode after) {
+	jobs[before].dependents.push_back(after);
+	++jobs[after].dependencyCount;
+}
+
+GenoJobGraphNode GenoJobGraph::then(GenoJobGraphNode before, GenoThreadPoolJob job, GenoThreadPoolJobData data, bool mainThread) {
+	auto after = addJob(job, data, mainThread);
+	addDependency(before, after);
+	return after;
+}
+
+uint32 GenoJobGraph::getNumJobs() const {
+	return (uint32) jobs.size();
+}
+
+bool GenoJobGraph::submit() {
+	if (unfinishedJobs.load() > 0)
+		return false;
+	uint32 numJobs = (uint32) jobs.size();
+	if (numJobs == 0)
+		return true;
+	if (counterCapacity < numJobs) {
+		delete [] remainingDependencies;
+		counterCapacity = numJobs;
+		remainingDependencies = new std::atomic<uint32>[counterCapacity];
+	}
+	for (uint32 i = 0; i < numJobs; ++i)
+		remainingDependencies[i].store(jobs[i].dependencyCount, std::memory_order_relaxed);
+	cancelled.store(false);
+	unfinishedJobs.store(numJobs);
+	for (uint32 i = 0; i < numJobs; ++i)
+		if (jobs[i].dependencyCount == 0)
+			schedule(i);
+	return true;
+}
+
+void GenoJobGraph::cancel() {
+	cancelled.store(true);
+}
+
+bool GenoJobGraph::isCancelled() const {
+	return cancelled.load();
+}
+
+bool GenoJobGraph::isDone() const {
+	return unfinishedJobs.load() == 0;
+}
+
+uint32 GenoJobGraph::runMainThreadJobs() {
+	uint32 numRun = 0;
+	while (true) {
+		GenoJobGraphNode node;
+		{
+			std::lock_guard<std::mutex> lock(stateMutex);
+			if (mainThreadJobs.empty())
+				return numRun;
+			node = mainThreadJobs.back();
+			mainThreadJobs.pop_back();
+		}
+		runJob(&jobs[node]);
+		++numRun;
+	}
+}
+
+void GenoJobGraph::wait() {
+	while (true) {
+		runMainThreadJobs();
+		std::unique_lock<std::mutex> lock(stateMutex);
+		stateChanged.wait(lock, [this]() { return unfinishedJobs.load() == 0 || !mainThreadJobs.empty(); });
+		if (mainThreadJobs.empty())
+			return;
+	}
+}
+
+GenoJobGraph::~GenoJobGraph() {
+	wait();
+	delete [] remainingDependencies;
+}
@@ -0,0 +1,174 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_GENOME_JOB_GRAPH
+#define GNARLY_GENOME_JOB_GRAPH
+
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <condition_variable>
+
+#include "../GenoInts.h"
+#include "GenoThreadPool.h"
+
+typedef uint32 GenoJobGraphNode;
+
+/**
+ * A set of jobs with dependencies between them, run on a GenoThreadPool
+ *
+ * Each job is handed to the pool the moment its last dependency finishes, so there are no barriers between stages.
+ * Jobs flagged as main thread jobs are queued instead and run by whichever thread calls runMainThreadJobs() or wait().
+ * The graph is built once and can be submitted again every time the previous run finishes without allocating.
+ *
+ *     auto decode = graph.addJob(decodeImage, &player);
+ *     auto pad    = graph.then(decode, padSpritesheet, &player);
+ *     graph.then(pad, uploadTexture, &player, true);
+ *     graph.submit();
+ *
+ * The graph must not contain cycles and must not be changed while it is running
+**/
+class GenoJobGraph {
+	private:
+		struct GenoJobGraphJob {
+			GenoJobGraph * graph;
+			GenoThreadPoolJob job;
+			GenoThreadPoolJobData data;
+			bool mainThread;
+			uint32 dependencyCount;
+			std::vector<GenoJobGraphNode> dependents;
+		};
+
+		GenoThreadPool * pool;
+		std::vector<GenoJobGraphJob> jobs;
+
+		uint32 counterCapacity;
+		std::atomic<uint32> * remainingDependencies;
+		std::atomic<uint32> unfinishedJobs;
+		std::atomic_bool cancelled;
+
+		std::mutex stateMutex;
+		std::condition_variable stateChanged;
+		std::vector<GenoJobGraphNode> mainThreadJobs;
+
+		static void runJob(GenoThreadPoolJobData data);
+
+		void schedule(GenoJobGraphNode node);
+		void finish(GenoJobGraphNode node);
+	public:
+		/**
+		 * Creates an empty job graph
+		 *
+		 * @param pool - The thread pool the jobs run on
+		**/
+		GenoJobGraph(GenoThreadPool * pool);
+
+		GenoJobGraph(const GenoJobGraph &) = delete;
+		GenoJobGraph & operator=(const GenoJobGraph &) = delete;
+
+		/**
+		 * Adds a job with no dependencies
+		 *
+		 * @param job - The job to run
+		 * @param data - The data for the job
+		 * @param mainThread - Whether the job has to run on the thread calling runMainThreadJobs() or wait()
+		 *
+		 * @return The node of the job
+		**/
+		GenoJobGraphNode addJob(GenoThreadPoolJob job, GenoThreadPoolJobData data = 0, bool mainThread = false);
+
+		/**
+		 * Makes one job wait for another
+		 *
+		 * @param before - The job that has to finish first
+		 * @param after - The job that waits for it
+		**/
+		void addDependency(GenoJobGraphNode before, GenoJobGraphNode after);
+
+		/**
+		 * Adds a job that runs once another job finishes
+		 *
+		 * @param before - The job to continue from
+		 * @param job - The job to run
+		 * @param data - The data for the job
+		 * @param mainThread - Whether the job has to run on the thread calling runMainThreadJobs() or wait()
+		 *
+		 * @return The node of the continuation
+		**/
+		GenoJobGraphNode then(GenoJobGraphNode before, GenoThreadPoolJob job, GenoThreadPoolJobData data = 0, bool mainThread = false);
+
+		/**
+		 * Returns the number of jobs in the graph
+		**/
+		uint32 getNumJobs() const;
+
+		/**
+		 * Starts every job that has no dependencies
+		 *
+		 * @return False if the previous run has not finished yet, in which case nothing is submitted
+		**/
+		bool submit();
+
+		/**
+		 * Skips every job of the current run that has not started yet
+		 *
+		 * Jobs that are already running finish normally. Skipped jobs still count as finished for their dependents,
+		 * which are skipped in turn, so the run completes quickly
+		**/
+		void cancel();
+
+		/**
+		 * Returns whether the current run was cancelled
+		**/
+		bool isCancelled() const;
+
+		/**
+		 * Returns whether every job of the current run has finished
+		**/
+		bool isDone() const;
+
+		/**
+		 * Runs the main thread jobs that are ready without blocking
+		 *
+		 * @return The number of jobs that were run
+		**/
+		uint32 runMainThreadJobs();
+
+		/**
+		 * Blocks until every job of the current run has finished, running main thread jobs as they become ready
+		**/
+		void wait();
+
+		/**
+		 * Destroys the job graph
+		 *
+		 * Waits until the current run has finished
+		**/
+		~GenoJobGraph();
+};
+
+#define GNARLY_GENOME_JOB_GRAPH_FORWARD
+#endif // GNARLY_GENOME_JOB_GRAPH
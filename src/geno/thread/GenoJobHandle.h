@@ -0,0 +1,174 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_GENOME_JOB_HANDLE
+#define GNARLY_GENOME_JOB_HANDLE
+
+#include <new>
+#include <cassert>
+#include <utility>
+#include <type_traits>
+
+#include "GenoThreadPool.h"
+
+/**
+ * A handle to a callable submitted with GenoThreadPool::submit()
+ *
+ * Handles can be moved but not copied. Dropping a handle does not cancel the job
+**/
+template <typename R>
+class GenoJobHandle {
+	private:
+		using Task = GenoThreadPool::GenoThreadPoolTask;
+
+		Task * task;
+
+		GenoJobHandle(Task * task) :
+			task(task) {}
+
+		void release() {
+			if (task != 0)
+				task->pool->releaseTask(task);
+			task = 0;
+		}
+
+		friend class GenoThreadPool;
+	public:
+		GenoJobHandle() :
+			task(0) {}
+
+		GenoJobHandle(const GenoJobHandle<R> &) = delete;
+		GenoJobHandle<R> & operator=(const GenoJobHandle<R> &) = delete;
+
+		GenoJobHandle(GenoJobHandle<R> && handle) noexcept :
+			task(handle.task) {
+			handle.task = 0;
+		}
+
+		GenoJobHandle<R> & operator=(GenoJobHandle<R> && handle) noexcept {
+			release();
+			task = handle.task;
+			handle.task = 0;
+			return *this;
+		}
+
+		/**
+		 * Returns whether the handle refers to a job
+		**/
+		bool isValid() const {
+			return task != 0;
+		}
+
+		/**
+		 * Returns whether the job has finished, a handle without a job is always ready
+		**/
+		bool isReady() const {
+			return task == 0 || task->ready.load(std::memory_order_acquire);
+		}
+
+		/**
+		 * Waits until the job has finished, running other queued jobs in the meantime. Does nothing for a handle
+		 * without a job
+		**/
+		void wait() {
+			if (!isReady())
+				task->pool->waitForTask(task);
+		}
+
+		/**
+		 * Waits until the job has finished and returns its result, the handle must refer to a job unless R is void
+		**/
+		typename std::add_lvalue_reference<R>::type get() {
+			wait();
+			if constexpr (!std::is_void<R>::value) {
+				assert(isValid() && "GenoJobHandle::get() called on a handle without a job");
+				if constexpr (Task::fitsInline<R>())
+					return *std::launder((R *) task->storage);
+				else
+					return **std::launder((R **) task->storage);
+			}
+		}
+
+		~GenoJobHandle() {
+			release();
+		}
+};
+
+template <typename Function, typename R>
+void GenoThreadPool::invokeTask(GenoThreadPoolTask * task) {
+	constexpr bool inlineFunction = GenoThreadPoolTask::fitsInline<Function>();
+	constexpr bool inlineResult   = GenoThreadPoolTask::fitsInline<R>();
+	Function * function = inlineFunction ? std::launder((Function *) task->storage) : *std::launder((Function **) task->storage);
+	if constexpr (std::is_void<R>::value) {
+		(*function)();
+		if constexpr (inlineFunction)
+			function->~Function();
+		else
+			delete function;
+	}
+	else {
+		// The result takes over the storage of the callable so it is moved out first
+		R result = (*function)();
+		if constexpr (inlineFunction)
+			function->~Function();
+		else
+			delete function;
+		if constexpr (inlineResult)
+			new (task->storage) R(std::move(result));
+		else
+			*(R **) task->storage = new R(std::move(result));
+	}
+}
+
+template <typename R>
+void GenoThreadPool::destroyTaskResult(GenoThreadPoolTask * task) {
+	if constexpr (GenoThreadPoolTask::fitsInline<R>())
+		std::launder((R *) task->storage)->~R();
+	else
+		delete *std::launder((R **) task->storage);
+}
+
+template <typename Function>
+GenoJobHandle<decltype(std::declval<Function &>()())> GenoThreadPool::submit(Function && function) {
+	using Callable = typename std::decay<Function>::type;
+	using R = decltype(std::declval<Function &>()());
+	static_assert(!std::is_reference<R>::value, "GenoThreadPool::submit() cannot store a reference result, return a value or a pointer instead!");
+	GenoThreadPoolTask * task = acquireTask();
+	if constexpr (GenoThreadPoolTask::fitsInline<Callable>())
+		new (task->storage) Callable(std::forward<Function>(function));
+	else
+		*(Callable **) task->storage = new Callable(std::forward<Function>(function));
+	task->invoke = invokeTask<Callable, R>;
+	if constexpr (std::is_void<R>::value)
+		task->destroyResult = 0;
+	else
+		task->destroyResult = destroyTaskResult<R>;
+	submitJob(runTask, task);
+	return GenoJobHandle<R>(task);
+}
+
+#define GNARLY_GENOME_JOB_HANDLE_FORWARD
+#endif // GNARLY_GENOME_JOB_HANDLE
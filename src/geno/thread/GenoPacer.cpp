@@ -0,0 +1,91 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <thread>
+#include <chrono>
+
+#if defined(__linux__)
+	#include <cerrno>
+	#include <time.h>
+#endif
+
+#include "GenoPacer.h"
+
+namespace {
+	constexpr double MIN_MARGIN = 50000;
+	constexpr double MAX_MARGIN = 2000000;
+
+	thread_local double margin = 500000;
+
+	void sleepUntilCoarse(uint64 deadline);
+}
+
+uint64 GenoPacer::getTicks() {
+#if defined(__linux__)
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64) now.tv_sec * 1000000000 + now.tv_nsec;
+#else
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+void GenoPacer::sleepUntil(uint64 deadline) {
+	uint64 wake = deadline - (uint64) margin;
+	if (deadline > (uint64) margin && getTicks() < wake) {
+		sleepUntilCoarse(wake);
+		double late = (double) (getTicks() - wake);
+		// Wakeups later than any margin could cover are the thread being preempted, not timer slack, and are left out
+		if (late < MAX_MARGIN) {
+			// Rises quickly to cover a late wakeup and comes back down slowly, so one spike does not keep it high for long
+			double target = late * 1.5 + MIN_MARGIN;
+			margin += (target - margin) * (target > margin ? 0.25 : 0.02);
+			if (margin < MIN_MARGIN)
+				margin = MIN_MARGIN;
+			else if (margin > MAX_MARGIN)
+				margin = MAX_MARGIN;
+		}
+	}
+	while (getTicks() < deadline)
+		std::this_thread::yield();
+}
+
+uint64 GenoPacer::getMargin() {
+	return (uint64) margin;
+}
+
+namespace {
+	void sleepUntilCoarse(uint64 deadline) {
+#if defined(__linux__)
+		timespec wake;
+		wake.tv_sec  = deadline / 1000000000;
+		wake.tv_nsec = deadline % 1000000000;
+		while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, 0) == EINTR);
+#else
+		std::this_thread::sleep_until(std::chrono::steady_clock::time_point(std::chrono::nanoseconds(deadline)));
+#endif
+	}
+}
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_GENOME_PACER
+#define GNARLY_GENOME_PACER
+
+#include "../GenoInts.h"
+
+/**
+ * Paces threads to absolute deadlines on the monotonic clock. Sleeps until shortly before the deadline and spins
+ * the rest of the way, so a late wakeup from the scheduler lands inside the spin instead of past the deadline
+**/
+class GenoPacer final {
+	public:
+
+		/**
+		 * Returns the monotonic time in nanoseconds
+		**/
+		static uint64 getTicks();
+
+		/**
+		 * Sleeps the current thread until the deadline. The spin margin calibrates itself per thread from how late
+		 * each sleep wakes up
+		 *
+		 * @param deadline - The monotonic time in nanoseconds to wake at
+		**/
+		static void sleepUntil(uint64 deadline);
+
+		/**
+		 * Returns the current thread's spin margin in nanoseconds
+		**/
+		static uint64 getMargin();
+};
+
+#define GNARLY_GENOME_PACER_FORWARD
+#endif // GNARLY_GENOME_PACER
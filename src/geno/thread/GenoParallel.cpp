@@ -0,0 +1,74 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <thread>
+
+#include "GenoParallel.h"
+
+namespace GenoParallel {
+	namespace {
+		void runAvailableChunks(GenoParallelState & state) {
+			uint32 chunk;
+			while ((chunk = state.nextChunk.fetch_add(1, std::memory_order_relaxed)) < state.numChunks)
+				state.runChunk(state.function, chunk);
+		}
+
+		void runHelper(GenoThreadPoolJobData data) {
+			GenoParallelState & state = *(GenoParallelState *) data;
+			runAvailableChunks(state);
+			// The last access to state, the caller may return as soon as every helper has checked in
+			state.finishedHelpers.fetch_add(1, std::memory_order_release);
+		}
+	}
+
+	uint32 getNumChunks(GenoThreadPool * pool, uint32 count, uint32 grain) {
+		if (pool == 0 || pool->getNumThreads() == 0)
+			return 1;
+		if (grain == 0) {
+			// A few chunks per thread so threads that start late or get preempted can be balanced out
+			grain = count / ((pool->getNumThreads() + 1) * 4);
+			if (grain < MIN_AUTO_GRAIN)
+				grain = MIN_AUTO_GRAIN;
+		}
+		uint32 numChunks = count / grain + (count % grain != 0);
+		return numChunks == 0 ? 1 : numChunks;
+	}
+
+	void run(GenoThreadPool * pool, GenoParallelState & state) {
+		state.nextChunk.store(0, std::memory_order_relaxed);
+		state.finishedHelpers.store(0, std::memory_order_relaxed);
+		uint32 numHelpers = state.numChunks - 1;
+		if (numHelpers > pool->getNumThreads())
+			numHelpers = pool->getNumThreads();
+		for (uint32 i = 0; i < numHelpers; ++i)
+			pool->submitJob(runHelper, &state);
+		runAvailableChunks(state);
+		// Helpers that have not started yet still hold a pointer to state, running queued jobs picks them up
+		while (state.finishedHelpers.load(std::memory_order_acquire) < numHelpers)
+			if (!pool->runPendingJob())
+				std::this_thread::yield();
+	}
+}
@@ -0,0 +1,187 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_GENOME_PARALLEL
+#define GNARLY_GENOME_PARALLEL
+
+#include <new>
+#include <atomic>
+#include <utility>
+
+#include "../GenoInts.h"
+#include "GenoThreadPool.h"
+
+namespace GenoParallel {
+
+	/** The smallest automatic grain, below it splitting costs more than cheap per element work saves **/
+	const uint32 MIN_AUTO_GRAIN = 256;
+
+	/** The most chunks a parallelReduce() is split into, the partial results live on the caller's stack **/
+	const uint32 MAX_REDUCE_CHUNKS = 64;
+
+	struct GenoParallelState {
+		std::atomic<uint32> nextChunk;
+		std::atomic<uint32> finishedHelpers;
+		uint32 numChunks;
+		void (*runChunk)(void * function, uint32 chunk);
+		void * function;
+	};
+
+	/**
+	 * Returns the number of chunks a range of count elements is split into
+	 *
+	 * @param grain - The number of elements per chunk, 0 picks one from the size of the pool
+	**/
+	uint32 getNumChunks(GenoThreadPool * pool, uint32 count, uint32 grain);
+
+	/**
+	 * Runs every chunk of state across the pool and the calling thread, returns once all chunks have finished
+	**/
+	void run(GenoThreadPool * pool, GenoParallelState & state);
+
+	template <typename ChunkFunction>
+	void runChunks(GenoThreadPool * pool, uint32 numChunks, ChunkFunction & chunkFunction) {
+		if (numChunks == 1) {
+			chunkFunction(0);
+			return;
+		}
+		GenoParallelState state;
+		state.numChunks = numChunks;
+		state.function  = &chunkFunction;
+		state.runChunk  = [](void * function, uint32 chunk) { (*(ChunkFunction *) function)(chunk); };
+		run(pool, state);
+	}
+}
+
+/**
+ * Calls function(chunkBegin, chunkEnd) for consecutive chunks of [begin, end) across the pool, the calling thread works
+ * on chunks too and the call returns once the whole range is done
+ *
+ * A pool with a single worker or a range that fits in one grain runs as one chunk on the calling thread, handing work
+ * to one worker costs more than it overlaps
+ *
+ * @param pool - The pool to split the work across, 0 runs the whole range on the calling thread
+ * @param begin - The first index
+ * @param end - One past the last index
+ * @param grain - The number of indices per chunk, 0 picks one from the size of the range and the pool
+ * @param function - The function to call for each chunk
+**/
+template <typename Function>
+void parallelForRange(GenoThreadPool * pool, uint32 begin, uint32 end, uint32 grain, Function && function) {
+	if (end <= begin)
+		return;
+	uint32 count = end - begin;
+	if (pool == 0 || pool->getNumThreads() <= 1 || count <= (grain == 0 ? GenoParallel::MIN_AUTO_GRAIN : grain)) {
+		function(begin, end);
+		return;
+	}
+	uint32 numChunks = GenoParallel::getNumChunks(pool, count, grain);
+	uint32 chunkSize = (count + numChunks - 1) / numChunks;
+	numChunks = (count + chunkSize - 1) / chunkSize;
+	auto chunkFunction = [&](uint32 chunk) {
+		uint32 chunkBegin = begin + chunk * chunkSize;
+		uint32 chunkEnd   = chunk == numChunks - 1 ? end : chunkBegin + chunkSize;
+		function(chunkBegin, chunkEnd);
+	};
+	GenoParallel::runChunks(pool, numChunks, chunkFunction);
+}
+
+/**
+ * Calls function(i) for every i in [begin, end) across the pool, the calling thread works on the range too and the call
+ * returns once the whole range is done
+ *
+ * Runs serially under the same conditions as parallelForRange(). function is copied once per chunk and every chunk calls its own copy, so writes a mutable function makes to its own
+ * captures are lost when the call returns. Write results through pointers captured by value instead, which also lets
+ * the compiler keep them in registers, byte stores through a pointer captured by reference force it to reload the
+ * pointer after every store
+ *
+ * @param pool - The pool to split the work across, 0 runs the whole range on the calling thread
+ * @param begin - The first index
+ * @param end - One past the last index
+ * @param grain - The number of indices per chunk, 0 picks one from the size of the range and the pool
+ * @param function - The function to call for each index
+**/
+template <typename Function>
+void parallelFor(GenoThreadPool * pool, uint32 begin, uint32 end, uint32 grain, Function && function) {
+	parallelForRange(pool, begin, end, grain, [&](uint32 chunkBegin, uint32 chunkEnd) {
+		// A local copy lets the compiler keep the captures in registers across the loop
+		auto chunkFunction = function;
+		for (uint32 i = chunkBegin; i < chunkEnd; ++i)
+			chunkFunction(i);
+	});
+}
+
+/**
+ * Folds map(i) for every i in [begin, end) with combine across the pool
+ *
+ * Each chunk is folded on its own and the partial results are combined in index order, so the result does not depend
+ * on the number of threads or on scheduling as long as the chunking stays the same. Unlike parallelForRange() a pool
+ * with a single worker still gets the full chunking for that reason
+ *
+ * @param pool - The pool to split the work across, 0 runs the whole range on the calling thread
+ * @param begin - The first index
+ * @param end - One past the last index
+ * @param grain - The number of indices per chunk, 0 picks one from the size of the range and the pool
+ * @param identity - The result of an empty range, every chunk starts from it
+ * @param map - The function producing the value of an index
+ * @param combine - The function combining two values
+ *
+ * @return The combined value
+**/
+template <typename T, typename Map, typename Combine>
+T parallelReduce(GenoThreadPool * pool, uint32 begin, uint32 end, uint32 grain, const T & identity, Map && map, Combine && combine) {
+	if (end <= begin)
+		return identity;
+	uint32 count     = end - begin;
+	uint32 numChunks = GenoParallel::getNumChunks(pool, count, grain);
+	if (numChunks > GenoParallel::MAX_REDUCE_CHUNKS)
+		numChunks = GenoParallel::MAX_REDUCE_CHUNKS;
+	uint32 chunkSize = (count + numChunks - 1) / numChunks;
+	numChunks = (count + chunkSize - 1) / chunkSize;
+
+	alignas(T) uint8 storage[sizeof(T) * GenoParallel::MAX_REDUCE_CHUNKS];
+	T * partials = (T *) storage;
+	auto chunkFunction = [&](uint32 chunk) {
+		uint32 chunkBegin = begin + chunk * chunkSize;
+		uint32 chunkEnd   = chunk == numChunks - 1 ? end : chunkBegin + chunkSize;
+		T partial = identity;
+		for (uint32 i = chunkBegin; i < chunkEnd; ++i)
+			partial = combine(partial, map(i));
+		new (partials + chunk) T(std::move(partial));
+	};
+	GenoParallel::runChunks(pool, numChunks, chunkFunction);
+
+	T result = std::move(partials[0]);
+	partials[0].~T();
+	for (uint32 i = 1; i < numChunks; ++i) {
+		result = combine(result, partials[i]);
+		partials[i].~T();
+	}
+	return result;
+}
+
+#define GNARLY_GENOME_PARALLEL_FORWARD
+#endif // GNARLY_GENOME_PARALLEL
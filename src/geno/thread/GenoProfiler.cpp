@@ -0,0 +1,170 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <string>
+#include <fstream>
+
+#include "GenoPacer.h"
+#include "GenoProfiler.h"
+
+namespace {
+	/** Zones kept per thread, a power of two **/
+	constexpr uint32 BUFFER_CAPACITY = 1 << 16;
+
+	// Relaxed atomics so a dump can read while the owning thread writes, they compile to plain stores
+	struct GenoProfileRecord {
+		std::atomic<const char *> name;
+		std::atomic<uint64> start;
+		std::atomic<uint64> end;
+	};
+
+	struct GenoProfileZone {
+		const char * name;
+		uint64 start;
+		uint64 end;
+	};
+
+	struct GenoProfileBuffer {
+		std::atomic<uint64> written;
+		uint32 threadId;
+		std::string name;
+		GenoProfileRecord records[BUFFER_CAPACITY];
+	};
+
+	// Buffers outlive their threads so zones from finished threads still dump
+	std::mutex buffersLock;
+	std::vector<GenoProfileBuffer *> buffers;
+	thread_local GenoProfileBuffer * localBuffer = 0;
+
+	// Ticks are converted to nanoseconds at dump time, against the monotonic clock since the program started
+	const uint64 originTicks = GenoProfiler::getTicks();
+	const uint64 originNanos = GenoPacer::getTicks();
+	constexpr uint64 MIN_CALIBRATION = 10000000;
+
+	GenoProfileBuffer * getBuffer();
+	void writeString(std::ofstream & file, const char * string);
+}
+
+void GenoProfiler::record(const char * name, uint64 start, uint64 end) {
+	GenoProfileBuffer * buffer = getBuffer();
+	uint64 written = buffer->written.load(std::memory_order_relaxed);
+	GenoProfileRecord & record = buffer->records[written & (BUFFER_CAPACITY - 1)];
+	record.name.store(name, std::memory_order_relaxed);
+	record.start.store(start, std::memory_order_relaxed);
+	record.end.store(end, std::memory_order_relaxed);
+	buffer->written.store(written + 1, std::memory_order_release);
+}
+
+void GenoProfiler::setThreadName(const char * name) {
+	GenoProfileBuffer * buffer = getBuffer();
+	std::lock_guard<std::mutex> lock(buffersLock);
+	buffer->name = name;
+}
+
+bool GenoProfiler::dump(const char * path) {
+	std::ofstream file(path);
+	if (!file)
+		return false;
+
+	while (getMonotonicTicks() - originNanos < MIN_CALIBRATION);
+	uint64 endTicks = getTicks();
+	uint64 endNanos = getMonotonicTicks();
+	double microsPerTick = (double) (endNanos - originNanos) / (endTicks - originTicks) / 1000;
+
+	file << std::fixed;
+	file.precision(3);
+	file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+	const char * separator = "";
+
+	std::vector<GenoProfileZone> zones(BUFFER_CAPACITY);
+	std::lock_guard<std::mutex> lock(buffersLock);
+	for (GenoProfileBuffer * buffer : buffers) {
+		file << separator << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId << ",\"args\":{\"name\":";
+		writeString(file, buffer->name.empty() ? "unnamed" : buffer->name.c_str());
+		file << "}}";
+		separator = ",";
+
+		// Copies like a seqlock read: anything the owner may have overwritten during the copy is dropped
+		uint64 end = buffer->written.load(std::memory_order_acquire);
+		uint64 copied = end > BUFFER_CAPACITY ? end - BUFFER_CAPACITY : 0;
+		for (uint64 i = copied; i < end; ++i) {
+			GenoProfileRecord & record = buffer->records[i & (BUFFER_CAPACITY - 1)];
+			zones[i - copied] = {
+				record.name.load(std::memory_order_relaxed),
+				record.start.load(std::memory_order_relaxed),
+				record.end.load(std::memory_order_relaxed)
+			};
+		}
+		std::atomic_thread_fence(std::memory_order_acquire);
+		uint64 overwritten = buffer->written.load(std::memory_order_relaxed);
+		// The owner writes slot written & mask before bumping written, so the slot after the newest may be mid write
+		uint64 begin = copied;
+		if (overwritten >= BUFFER_CAPACITY && overwritten + 1 - BUFFER_CAPACITY > begin)
+			begin = overwritten + 1 - BUFFER_CAPACITY;
+
+		for (uint64 i = begin; i < end; ++i) {
+			const GenoProfileZone & zone = zones[i - copied];
+			file << ",\n{\"name\":";
+			writeString(file, zone.name);
+			file << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId
+			     << ",\"ts\":" << (zone.start - originTicks) * microsPerTick
+			     << ",\"dur\":" << (zone.end - zone.start) * microsPerTick << "}";
+		}
+	}
+	file << "\n]}\n";
+	return (bool) file;
+}
+
+uint64 GenoProfiler::getMonotonicTicks() {
+	return GenoPacer::getTicks();
+}
+
+namespace {
+	GenoProfileBuffer * getBuffer() {
+		if (localBuffer == 0) {
+			GenoProfileBuffer * buffer = new GenoProfileBuffer();
+			std::lock_guard<std::mutex> lock(buffersLock);
+			buffer->threadId = buffers.size() + 1;
+			buffers.push_back(buffer);
+			localBuffer = buffer;
+		}
+		return localBuffer;
+	}
+
+	void writeString(std::ofstream & file, const char * string) {
+		file << '"';
+		for (; *string != 0; ++string) {
+			if (*string == '"' || *string == '\\')
+				file << '\\';
+			if ((unsigned char) *string >= ' ')
+				file << *string;
+		}
+		file << '"';
+	}
+}
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_GENOME_PROFILER
+#define GNARLY_GENOME_PROFILER
+
+/**
+ * Scoped zone profiling, compiled in only when GENO_PROFILE is defined
+ *
+ * GENO_PROFILE_ZONE("name") times the rest of the enclosing scope into the calling thread's ring buffer.
+ * GENO_PROFILE_THREAD("name") names the calling thread in the trace. Without GENO_PROFILE both expand to nothing
+ * and their arguments are never evaluated. Zone names are stored by pointer, so they must be string literals or
+ * otherwise outlive the dump
+**/
+
+#include "../GenoInts.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+	#define GENO_PROFILE_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+	#define GENO_PROFILE_TSC
+#endif
+
+class GenoProfiler final {
+	public:
+
+		/**
+		 * Returns the profiler's timestamp, in time stamp counter ticks on x86 and nanoseconds elsewhere
+		**/
+		static uint64 getTicks() {
+#if defined(GENO_PROFILE_TSC)
+			return __rdtsc();
+#else
+			return getMonotonicTicks();
+#endif
+		}
+
+		/**
+		 * Records a zone in the calling thread's ring buffer, overwriting the oldest once full
+		**/
+		static void record(const char * name, uint64 start, uint64 end);
+
+		/**
+		 * Names the calling thread in the trace, the name is copied
+		**/
+		static void setThreadName(const char * name);
+
+		/**
+		 * Writes every thread's recorded zones to a Chrome trace event JSON file that Perfetto and chrome://tracing
+		 * open, an empty trace when profiling is compiled out. Zones keep recording while it runs. Returns false if
+		 * the file could not be written
+		 *
+		 * @param path - The file to write
+		**/
+		static bool dump(const char * path);
+
+	private:
+		static uint64 getMonotonicTicks();
+};
+
+#if defined(GENO_PROFILE)
+
+class GenoProfileScope {
+	private:
+		const char * name;
+		uint64 start;
+	public:
+		GenoProfileScope(const char * name) :
+			name(name),
+			start(GenoProfiler::getTicks()) {}
+		~GenoProfileScope() {
+			GenoProfiler::record(name, start, GenoProfiler::getTicks());
+		}
+};
+
+#define GENO_PROFILE_JOIN_LINE(name, line) name##line
+#define GENO_PROFILE_SCOPE_NAME(line) GENO_PROFILE_JOIN_LINE(genoProfileScope, line)
+
+#define GENO_PROFILE_ZONE(name) GenoProfileScope GENO_PROFILE_SCOPE_NAME(__LINE__)(name)
+#define GENO_PROFILE_THREAD(name) GenoProfiler::setThreadName(name)
+
+#else
+
+#define GENO_PROFILE_ZONE(name)
+#define GENO_PROFILE_THREAD(name)
+
+#endif
+
+#define GNARLY_GENOME_PROFILER_FORWARD
+#endif // GNARLY_GENOME_PROFILER
@@ -25,80 +25,460 @@
  *******************************************************************************/
 
 #include <mutex>
+#include <chrono>
 #include <memory>
+#include <string>
+#include <cstring>
 
+#if defined(_WIN32)
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <windows.h>
+#elif defined(__linux__)
+	#include <pthread.h>
+	#include <sched.h>
+	#include <unistd.h>
+	#include <sys/resource.h>
+	#include <sys/syscall.h>
+#endif
+
+#include "GenoProfiler.h"
 #include "GenoThreadPool.h"
 
+namespace {
+	/** The number of empty job requests a worker makes before it parks **/
+	const uint32 SPIN_COUNT = 64;
+
+	/** Workers sample the depth of their deque once every this many jobs, a power of two **/
+	const uint32 DEPTH_SAMPLE_INTERVAL = 16;
+
+	/** The number of submit() tasks allocated at a time **/
+	const uint32 TASK_BLOCK_SIZE = 64;
+
+	/** The pool and worker the current thread belongs to, if any **/
+	thread_local GenoThreadPool * localPool = 0;
+	thread_local uint32 localThreadId = 0;
+
+	uint64 getTime() {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	/** Adds to a counter that only the calling thread writes **/
+	void addCount(std::atomic<uint64> & counter, uint64 value) {
+		counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+	}
+
+	/** Locks mutex and, if it was contended, adds the time spent blocked to lockWaitTime **/
+	void lockTimed(std::mutex & mutex, std::atomic<uint64> * lockWaitTime) {
+		if (mutex.try_lock())
+			return;
+		uint64 start = getTime();
+		mutex.lock();
+		if (lockWaitTime != 0)
+			addCount(*lockWaitTime, getTime() - start);
+	}
+
+	uint32 getDepthBucket(uint32 depth) {
+		uint32 bucket = 0;
+		for (++depth; depth > 1 && bucket < GENO_THREAD_POOL_DEPTH_BUCKETS - 1; depth >>= 1)
+			++bucket;
+		return bucket;
+	}
+}
+
+void GenoThreadPool::GenoThreadPoolDeque::pushBack(const GenoThreadPoolJobPackage & job, std::atomic<uint64> * lockWaitTime) {
+	lockTimed(mutex, lockWaitTime);
+	std::lock_guard<std::mutex> lock(mutex, std::adopt_lock);
+	uint32 count = size.load(std::memory_order_relaxed);
+	if (count == capacity) {
+		GenoThreadPoolJobPackage * newJobs = new GenoThreadPoolJobPackage[capacity * 2];
+		for (uint32 i = 0; i < count; ++i)
+			newJobs[i] = jobs[(head + i) & (capacity - 1)];
+		delete [] jobs;
+		jobs = newJobs;
+		head = 0;
+		capacity *= 2;
+	}
+	jobs[(head + count) & (capacity - 1)] = job;
+	size.store(count + 1, std::memory_order_relaxed);
+}
+
+bool GenoThreadPool::GenoThreadPoolDeque::popBack(GenoThreadPoolJobPackage & job, std::atomic<uint64> * lockWaitTime) {
+	lockTimed(mutex, lockWaitTime);
+	std::lock_guard<std::mutex> lock(mutex, std::adopt_lock);
+	uint32 count = size.load(std::memory_order_relaxed);
+	if (count == 0)
+		return false;
+	--count;
+	job = jobs[(head + count) & (capacity - 1)];
+	size.store(count, std::memory_order_relaxed);
+	return true;
+}
+
+bool GenoThreadPool::GenoThreadPoolDeque::popFront(GenoThreadPoolJobPackage & job, std::atomic<uint64> * lockWaitTime) {
+	lockTimed(mutex, lockWaitTime);
+	std::lock_guard<std::mutex> lock(mutex, std::adopt_lock);
+	uint32 count = size.load(std::memory_order_relaxed);
+	if (count == 0)
+		return false;
+	job = jobs[head];
+	head = (head + 1) & (capacity - 1);
+	size.store(count - 1, std::memory_order_relaxed);
+	return true;
+}
+
+void GenoThreadPool::placeThread(uint32 threadId) {
+	uint32 numCores = physicalThreadCount();
+	// Reserving every core would leave the workers nowhere to run
+	uint32 reservedCores = placement.reservedCores < numCores ? placement.reservedCores : 0;
+	uint32 freeCores = numCores - reservedCores;
+	bool placeCores = freeCores > 0 && (reservedCores > 0 || placement.pinThreads);
+	uint32 core = reservedCores + threadId % (freeCores > 0 ? freeCores : 1);
+	std::string name = placement.name != 0 ? std::string(placement.name) + ' ' + std::to_string(threadId) : std::string();
+	GENO_PROFILE_THREAD(name.empty() ? "geno worker" : name.c_str());
+
+#if defined(_WIN32)
+	HANDLE thread = GetCurrentThread();
+	if (placeCores && numCores <= sizeof(DWORD_PTR) * 8) {
+		DWORD_PTR mask = 0;
+		for (uint32 i = reservedCores; i < numCores; ++i)
+			if (!placement.pinThreads || i == core)
+				mask |= (DWORD_PTR) 1 << i;
+		SetThreadAffinityMask(thread, mask);
+	}
+	if (!name.empty()) {
+		std::wstring wideName(name.begin(), name.end());
+		SetThreadDescription(thread, wideName.c_str());
+	}
+	if (placement.background)
+		SetThreadPriority(thread, THREAD_PRIORITY_BELOW_NORMAL);
+#elif defined(__linux__)
+	if (placeCores) {
+		cpu_set_t cores;
+		CPU_ZERO(&cores);
+		for (uint32 i = reservedCores; i < numCores; ++i)
+			if (!placement.pinThreads || i == core)
+				CPU_SET(i, &cores);
+		pthread_setaffinity_np(pthread_self(), sizeof(cores), &cores);
+	}
+	// Linux truncates thread names to 15 characters
+	if (!name.empty())
+		pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+	// Every Linux thread has its own nice value, the lowest priority short of SCHED_IDLE
+	if (placement.background)
+		setpriority(PRIO_PROCESS, (id_t) syscall(SYS_gettid), 19);
+#endif
+}
+
 void GenoThreadPool::threadLoop(uint32 threadId, GenoThreadPool * pool) {
+	localPool     = pool;
+	localThreadId = threadId;
+	pool->placeThread(threadId);
+	GenoThreadPoolCounters & counters = pool->counters[threadId];
+	GenoThreadPoolDeque & deque = pool->deques[threadId];
+	uint64 jobsExecuted = 0;
+	uint32 misses = 0;
+	// The clock is only read when the worker switches between running jobs and looking for them, reading it around
+	// every job would double the cost of tiny jobs
+	bool busy = false;
+	uint64 switchTime = getTime();
 	while (pool->isActive.load()) {
-		GenoThreadPoolJobPackage * job = pool->requestJob(threadId);
-		if (job != 0) {
-			job->job(job->data);
-			pool->activeThreads[threadId].store(false);
+		GenoThreadPoolJobPackage job;
+		if (pool->requestJob(threadId, job)) {
+			if (!busy) {
+				uint64 time = getTime();
+				addCount(counters.idleTime, time - switchTime);
+				counters.busySince.store(time, std::memory_order_relaxed);
+				switchTime = time;
+				busy = true;
+			}
+			if ((jobsExecuted & (DEPTH_SAMPLE_INTERVAL - 1)) == 0)
+				addCount(counters.queueDepths[getDepthBucket(deque.size.load(std::memory_order_relaxed))], 1);
+			{
+				GENO_PROFILE_ZONE("GenoThreadPool job");
+				job.job(job.data);
+			}
+			pool->completeJob();
+			// Jobs the worker helps with from inside runPendingJob() add to the counter too
+			jobsExecuted = counters.jobsExecuted.load(std::memory_order_relaxed) + 1;
+			counters.jobsExecuted.store(jobsExecuted, std::memory_order_relaxed);
+			misses = 0;
+			continue;
 		}
-		else
-			std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(1));
+		if (busy) {
+			uint64 time = getTime();
+			addCount(counters.busyTime, time - switchTime);
+			counters.busySince.store(0, std::memory_order_relaxed);
+			switchTime = time;
+			busy = false;
+		}
+		// Yield for a short while first so bursts of jobs don't pay for a park and wake each
+		if (++misses < SPIN_COUNT)
+			std::this_thread::yield();
+		else {
+			pool->park();
+			misses = 0;
+		}
+	}
+	addCount(busy ? counters.busyTime : counters.idleTime, getTime() - switchTime);
+	counters.busySince.store(0, std::memory_order_relaxed);
+}
+
+bool GenoThreadPool::requestJob(uint32 threadId, GenoThreadPoolJobPackage & job) {
+	GenoThreadPoolCounters & workerCounters = counters[threadId];
+	if (deques[threadId].popBack(job, &workerCounters.lockWaitTime) || submitted.tryPop(job))
+		return true;
+	// Steal the oldest job of the first other worker that has one, the size check keeps idle thieves off the locks
+	for (uint32 i = 1; i < numThreads; ++i) {
+		GenoThreadPoolDeque & victim = deques[(threadId + i) % numThreads];
+		if (victim.size.load(std::memory_order_relaxed) > 0) {
+			addCount(workerCounters.stealAttempts, 1);
+			if (victim.popFront(job, &workerCounters.lockWaitTime)) {
+				addCount(workerCounters.steals, 1);
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+bool GenoThreadPool::hasQueuedJobs() const {
+	if (submitted.getSize() > 0)
+		return true;
+	for (uint32 i = 0; i < numThreads; ++i)
+		if (deques[i].size.load(std::memory_order_relaxed) > 0)
+			return true;
+	return false;
+}
+
+void GenoThreadPool::park() {
+	std::unique_lock<std::mutex> lock(parkMutex);
+	parkedThreads.fetch_add(1);
+	if (isActive.load() && !hasQueuedJobs())
+		parked.wait(lock);
+	parkedThreads.fetch_sub(1);
+}
+
+void GenoThreadPool::wakeWorker() {
+	// A read-modify-write rather than a load, it orders against the one in park() so either this sees the parked
+	// thread or the parked thread sees the job that was just queued
+	if (parkedThreads.fetch_add(0) > 0) {
+		std::lock_guard<std::mutex> lock(parkMutex);
+		parked.notify_one();
+	}
+}
+
+void GenoThreadPool::completeJob() {
+	if (pendingJobs.fetch_sub(1) == 1) {
+		std::lock_guard<std::mutex> lock(completionMutex);
+		completed.notify_all();
 	}
 }
 
-GenoThreadPool::GenoThreadPoolJobPackage * GenoThreadPool::requestJob(uint32 threadId) {
-	std::lock_guard<std::mutex> lock(jobMutex);
-	if (jobCount > 0) {
-		activeThreads[threadId].store(true);
-		--jobCount;
-		return &jobs[jobCount];
+void GenoThreadPool::runTask(GenoThreadPoolJobData data) {
+	auto task = (GenoThreadPoolTask *) data;
+	auto pool = task->pool;
+	task->invoke(task);
+	task->ready.store(true);
+	// Same pairing as wakeWorker, a handle that is about to block either sees ready or gets notified
+	if (pool->waitingHandles.fetch_add(0) > 0) {
+		std::lock_guard<std::mutex> lock(pool->completionMutex);
+		pool->completed.notify_all();
+	}
+	pool->releaseTask(task);
+}
+
+void GenoThreadPool::allocateTasks() {
+	GenoThreadPoolTask * block = new GenoThreadPoolTask[TASK_BLOCK_SIZE];
+	taskBlocks.push_back(block);
+	for (uint32 i = 0; i < TASK_BLOCK_SIZE; ++i) {
+		block[i].next = freeTasks;
+		freeTasks = block + i;
+	}
+}
+
+GenoThreadPool::GenoThreadPoolTask * GenoThreadPool::acquireTask() {
+	GenoThreadPoolTask * task;
+	{
+		std::lock_guard<std::mutex> lock(taskMutex);
+		if (freeTasks == 0)
+			allocateTasks();
+		task = freeTasks;
+		freeTasks = task->next;
+	}
+	task->pool = this;
+	task->references.store(2, std::memory_order_relaxed);
+	task->ready.store(false, std::memory_order_relaxed);
+	return task;
+}
+
+void GenoThreadPool::releaseTask(GenoThreadPoolTask * task) {
+	if (task->references.fetch_sub(1) == 1) {
+		if (task->destroyResult != 0)
+			task->destroyResult(task);
+		std::lock_guard<std::mutex> lock(taskMutex);
+		task->next = freeTasks;
+		freeTasks = task;
+	}
+}
+
+void GenoThreadPool::waitForTask(GenoThreadPoolTask * task) {
+	while (!task->ready.load()) {
+		if (runPendingJob())
+			continue;
+		std::unique_lock<std::mutex> lock(completionMutex);
+		waitingHandles.fetch_add(1);
+		completed.wait(lock, [task]() { return task->ready.load(); });
+		waitingHandles.fetch_sub(1);
 	}
-	else
-		return 0;
 }
 
 uint32 GenoThreadPool::physicalThreadCount() {
 	return std::thread::hardware_concurrency();
 }
 
+uint32 GenoThreadPool::getNumThreads() const {
+	return numThreads;
+}
+
 GenoThreadPool::GenoThreadPool(uint32 numThreads, uint32 initialQueueCapacity) :
+	GenoThreadPool(GenoThreadPoolCreateInfo{ numThreads, initialQueueCapacity, 0, 0, false, false }) {}
+
+GenoThreadPool::GenoThreadPool(const GenoThreadPoolCreateInfo & info) :
 	isActive(true),
-	numThreads(numThreads),
+	numThreads(info.numThreads),
+	placement(info),
 	threads(new std::thread[numThreads]),
-	activeThreads(new std::atomic_bool[numThreads]),
-	jobCount(0),
-	jobCapacity(initialQueueCapacity == 0 ? 16 : initialQueueCapacity),
-	jobs(new GenoThreadPoolJobPackage[jobCapacity]) {
+	deques(new GenoThreadPoolDeque[numThreads]),
+	counters(new GenoThreadPoolCounters[numThreads]),
+	helpedJobs(0),
+	submitted(SUBMIT_QUEUE_CAPACITY),
+	nextDeque(0),
+	parkedThreads(0),
+	pendingJobs(0),
+	waitingHandles(0),
+	freeTasks(0) {
+	if (info.name != 0) {
+		char * name = new char[strlen(info.name) + 1];
+		strcpy(name, info.name);
+		placement.name = name;
+	}
+	uint32 capacity = 16;
+	while (capacity < info.initialQueueCapacity)
+		capacity *= 2;
 	for (uint32 i = 0; i < numThreads; ++i) {
-		threads[i] = std::thread(threadLoop, i, this);
-		activeThreads[i].store(false);
+		deques[i].size.store(0);
+		deques[i].head = 0;
+		deques[i].capacity = capacity;
+		deques[i].jobs = new GenoThreadPoolJobPackage[capacity];
+		GenoThreadPoolCounters & workerCounters = counters[i];
+		workerCounters.jobsExecuted.store(0);
+		workerCounters.busyTime.store(0);
+		workerCounters.idleTime.store(0);
+		workerCounters.lockWaitTime.store(0);
+		workerCounters.stealAttempts.store(0);
+		workerCounters.steals.store(0);
+		workerCounters.busySince.store(0);
+		for (uint32 j = 0; j < GENO_THREAD_POOL_DEPTH_BUCKETS; ++j)
+			workerCounters.queueDepths[j].store(0);
 	}
+	allocateTasks();
+	for (uint32 i = 0; i < numThreads; ++i)
+		threads[i] = std::thread(threadLoop, i, this);
 }
 
 void GenoThreadPool::submitJob(GenoThreadPoolJob job, GenoThreadPoolJobData data) {
-	std::lock_guard<std::mutex> lock(jobMutex);
-	if (jobCount >= jobCapacity) {
-		jobCapacity *= 2;
-		GenoThreadPoolJobPackage * newJobs = new GenoThreadPoolJobPackage[jobCapacity];
-		memcpy(newJobs, jobs, sizeof(GenoThreadPoolJobPackage) * jobCount);
-		delete [] jobs;
-		jobs = newJobs;
+	if (numThreads == 0) {
+		job(data);
+		return;
+	}
+	pendingJobs.fetch_add(1);
+	if (localPool == this)
+		deques[localThreadId].pushBack({ job, data }, &counters[localThreadId].lockWaitTime);
+	else if (!submitted.tryPush({ job, data }))
+		deques[nextDeque.fetch_add(1, std::memory_order_relaxed) % numThreads].pushBack({ job, data }, 0);
+	wakeWorker();
+}
+
+bool GenoThreadPool::runPendingJob() {
+	GenoThreadPoolJobPackage job;
+	bool found = false;
+	if (localPool == this)
+		found = requestJob(localThreadId, job);
+	else if (!(found = submitted.tryPop(job))) {
+		uint32 first = nextDeque.load(std::memory_order_relaxed);
+		for (uint32 i = 0; i < numThreads && !found; ++i) {
+			GenoThreadPoolDeque & victim = deques[(first + i) % numThreads];
+			found = victim.size.load(std::memory_order_relaxed) > 0 && victim.popFront(job, 0);
+		}
 	}
-	jobs[jobCount] = { job, data };
-	++jobCount;
+	if (found) {
+		{
+			GENO_PROFILE_ZONE("GenoThreadPool job");
+			job.job(job.data);
+		}
+		completeJob();
+		// A worker helping from inside a job is already busy, only the count is its own
+		if (localPool == this)
+			addCount(counters[localThreadId].jobsExecuted, 1);
+		else
+			helpedJobs.fetch_add(1, std::memory_order_relaxed);
+	}
+	return found;
 }
 
 void GenoThreadPool::wait() {
-	while (jobCount > 0)
-		std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(1));
+	std::unique_lock<std::mutex> lock(completionMutex);
+	completed.wait(lock, [this]() { return pendingJobs.load() == 0; });
+}
+
+GenoThreadPoolStats GenoThreadPool::getStats() const {
+	GenoThreadPoolStats stats;
+	stats.workers.resize(numThreads);
+	stats.total = {};
 	for (uint32 i = 0; i < numThreads; ++i) {
-		if (activeThreads[i].load()) {
-			std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(1));
-			i = 0;
+		const GenoThreadPoolCounters & workerCounters = counters[i];
+		GenoThreadPoolWorkerStats & worker = stats.workers[i];
+		worker.jobsExecuted  = workerCounters.jobsExecuted.load(std::memory_order_relaxed);
+		worker.busyTime      = workerCounters.busyTime.load(std::memory_order_relaxed);
+		worker.idleTime      = workerCounters.idleTime.load(std::memory_order_relaxed);
+		worker.lockWaitTime  = workerCounters.lockWaitTime.load(std::memory_order_relaxed);
+		worker.stealAttempts = workerCounters.stealAttempts.load(std::memory_order_relaxed);
+		worker.steals        = workerCounters.steals.load(std::memory_order_relaxed);
+		worker.busySince     = workerCounters.busySince.load(std::memory_order_relaxed);
+		stats.total.jobsExecuted  += worker.jobsExecuted;
+		stats.total.busyTime      += worker.busyTime;
+		stats.total.idleTime      += worker.idleTime;
+		stats.total.lockWaitTime  += worker.lockWaitTime;
+		stats.total.stealAttempts += worker.stealAttempts;
+		stats.total.steals        += worker.steals;
+		for (uint32 j = 0; j < GENO_THREAD_POOL_DEPTH_BUCKETS; ++j) {
+			worker.queueDepths[j] = workerCounters.queueDepths[j].load(std::memory_order_relaxed);
+			stats.total.queueDepths[j] += worker.queueDepths[j];
 		}
 	}
+	stats.helpedJobs  = helpedJobs.load(std::memory_order_relaxed);
+	stats.pendingJobs = pendingJobs.load(std::memory_order_relaxed);
+	return stats;
 }
 
 GenoThreadPool::~GenoThreadPool() {
+	// Queued jobs run before the workers stop, a dropped submit() job would never destroy its callable
+	while (runPendingJob());
+	wait();
 	isActive.store(false);
-	for (uint32 i = 0; i < numThreads; ++i)
+	{
+		std::lock_guard<std::mutex> lock(parkMutex);
+		parked.notify_all();
+	}
+	for (uint32 i = 0; i < numThreads; ++i) {
 		threads[i].join();
+		delete [] deques[i].jobs;
+	}
 	delete [] threads;
-	delete [] activeThreads;
-	delete [] jobs;
-}
\ No newline at end of file
+	delete [] deques;
+	delete [] counters;
+	delete [] placement.name;
+	for (GenoThreadPoolTask * block : taskBlocks)
+		delete [] block;
+}
@@ -30,14 +30,85 @@
 #include <mutex>
 #include <thread>
 #include <atomic>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include <condition_variable>
 
 #include "../GenoInts.h"
+#include "../template/GenoConcurrentQueue.h"
 
 typedef void * GenoThreadPoolJobData;
 typedef void (*GenoThreadPoolJob)(GenoThreadPoolJobData data);
 
+template <typename R>
+class GenoJobHandle;
+
+/**
+ * Where and how a thread pool's workers run, placement is best effort and silently skipped where the platform does
+ * not support it
+**/
+struct GenoThreadPoolCreateInfo {
+	/** The number of threads in the pool **/
+	uint32 numThreads;
+	/** The initial capacity of each worker's deque **/
+	uint32 initialQueueCapacity;
+	/** Workers are named "<name> <index>" for debuggers and profilers, 0 leaves them unnamed **/
+	const char * name;
+	/** The number of cores, counting up from core 0, that workers stay off so the main thread has them to itself **/
+	uint32 reservedCores;
+	/** Whether each worker is pinned to one core of its own, otherwise workers may move across every unreserved core **/
+	bool pinThreads;
+	/** Whether workers run below normal priority, for pools of background work such as asset loading **/
+	bool background;
+};
+
+/** The number of buckets in a worker's queue depth histogram **/
+const uint32 GENO_THREAD_POOL_DEPTH_BUCKETS = 8;
+
+/**
+ * The counters of one worker thread, times are in nanoseconds
+**/
+struct GenoThreadPoolWorkerStats {
+	/** The number of jobs the worker has run **/
+	uint64 jobsExecuted;
+	/** The time spent running back to back jobs, credited when the worker runs out of jobs **/
+	uint64 busyTime;
+	/** The time spent yielding or parked, credited when the worker finds its next job **/
+	uint64 idleTime;
+	/** The steady clock time in nanoseconds at which the worker's current run of jobs started, 0 while it is idle **/
+	uint64 busySince;
+	/** The time spent blocked on deque locks that another thread was holding **/
+	uint64 lockWaitTime;
+	/** The number of other workers' deques the worker tried to steal from, and how many of those tries got a job **/
+	uint64 stealAttempts;
+	uint64 steals;
+	/** The depth of the worker's own deque sampled every 16th job, bucket i counts depths in [2^i - 1, 2^(i + 1) - 1) and the last bucket counts everything deeper **/
+	uint64 queueDepths[GENO_THREAD_POOL_DEPTH_BUCKETS];
+};
+
+/**
+ * A snapshot of a thread pool's counters
+**/
+struct GenoThreadPoolStats {
+	/** The counters of each worker **/
+	std::vector<GenoThreadPoolWorkerStats> workers;
+	/** The sum of every worker's counters **/
+	GenoThreadPoolWorkerStats total;
+	/** The number of jobs run by threads outside the pool through runPendingJob() or while waiting on a handle **/
+	uint64 helpedJobs;
+	/** The number of jobs that have been submitted but have not finished **/
+	uint32 pendingJobs;
+};
+
 /**
- * A thread pool
+ * A work stealing thread pool
+ *
+ * Every worker owns a deque. Jobs submitted from inside a running job go to the back of that worker's own deque,
+ * jobs submitted from any other thread go to a shared lock free queue, and are dealt round robin across the workers
+ * only when that queue is full. A worker runs its own jobs newest first, then takes from the shared queue, then steals
+ * the oldest job of another worker, and parks on a condition variable once there is nothing left to take
 **/
 class GenoThreadPool {
 	private:
@@ -46,19 +117,102 @@ class GenoThreadPool {
 			GenoThreadPoolJobData data;
 		};
 
+		struct alignas(64) GenoThreadPoolDeque {
+			std::mutex mutex;
+			std::atomic<uint32> size;
+			uint32 head;
+			uint32 capacity;
+			GenoThreadPoolJobPackage * jobs;
+
+			void pushBack(const GenoThreadPoolJobPackage & job, std::atomic<uint64> * lockWaitTime);
+			bool popBack(GenoThreadPoolJobPackage & job, std::atomic<uint64> * lockWaitTime);
+			bool popFront(GenoThreadPoolJobPackage & job, std::atomic<uint64> * lockWaitTime);
+		};
+
+		/** A worker's counters, only ever written by the worker itself so updates need no read-modify-write **/
+		struct alignas(64) GenoThreadPoolCounters {
+			std::atomic<uint64> jobsExecuted;
+			std::atomic<uint64> busyTime;
+			std::atomic<uint64> idleTime;
+			std::atomic<uint64> lockWaitTime;
+			std::atomic<uint64> stealAttempts;
+			std::atomic<uint64> steals;
+			std::atomic<uint64> busySince;
+			std::atomic<uint64> queueDepths[GENO_THREAD_POOL_DEPTH_BUCKETS];
+		};
+
+		/** The shared state of a submit() call, callables and results that fit are stored inline **/
+		struct GenoThreadPoolTask {
+			const static uint32 INLINE_SIZE = 48;
+
+			template <typename T>
+			constexpr static bool fitsInline() {
+				if constexpr (std::is_void<T>::value)
+					return true;
+				else
+					return sizeof(T) <= INLINE_SIZE && alignof(T) <= alignof(std::max_align_t);
+			}
+
+			alignas(std::max_align_t) uint8 storage[INLINE_SIZE];
+			void (*invoke)(GenoThreadPoolTask * task);
+			void (*destroyResult)(GenoThreadPoolTask * task);
+			GenoThreadPool * pool;
+			GenoThreadPoolTask * next;
+			std::atomic<uint32> references;
+			std::atomic_bool ready;
+		};
+
+		template <typename R>
+		friend class GenoJobHandle;
+
+		/** The capacity of the shared queue for jobs submitted from outside the pool **/
+		const static uint32 SUBMIT_QUEUE_CAPACITY = 4096;
+
 		std::atomic_bool isActive;
 		uint32 numThreads;
-		std::mutex jobMutex;
+		GenoThreadPoolCreateInfo placement;
 		std::thread * threads;
-		std::atomic_bool * activeThreads;
+		GenoThreadPoolDeque * deques;
+		GenoThreadPoolCounters * counters;
+		std::atomic<uint64> helpedJobs;
+
+		GenoConcurrentQueue<GenoThreadPoolJobPackage> submitted;
+		std::atomic<uint32> nextDeque;
+
+		std::mutex parkMutex;
+		std::condition_variable parked;
+		std::atomic<uint32> parkedThreads;
 
-		uint32 jobCount;
-		uint32 jobCapacity;
-		GenoThreadPoolJobPackage * jobs;
+		std::mutex completionMutex;
+		std::condition_variable completed;
+		std::atomic<uint32> pendingJobs;
+		std::atomic<uint32> waitingHandles;
+
+		std::mutex taskMutex;
+		GenoThreadPoolTask * freeTasks;
+		std::vector<GenoThreadPoolTask *> taskBlocks;
 
 		static void threadLoop(uint32 threadId, GenoThreadPool * pool);
 
-		GenoThreadPoolJobPackage * requestJob(uint32 threadId);
+		void placeThread(uint32 threadId);
+		bool requestJob(uint32 threadId, GenoThreadPoolJobPackage & job);
+		bool hasQueuedJobs() const;
+		void park();
+		void wakeWorker();
+		void completeJob();
+
+		static void runTask(GenoThreadPoolJobData data);
+
+		void allocateTasks();
+		GenoThreadPoolTask * acquireTask();
+		void releaseTask(GenoThreadPoolTask * task);
+		void waitForTask(GenoThreadPoolTask * task);
+
+		template <typename Function, typename R>
+		static void invokeTask(GenoThreadPoolTask * task);
+
+		template <typename R>
+		static void destroyTaskResult(GenoThreadPoolTask * task);
 	public:
 		/**
 		 * Returns the number of physical threads the system has if possible
@@ -69,30 +223,73 @@ class GenoThreadPool {
 		 * Creates a thread pool
 		 *
 		 * @param numThreads - The number of threads in the pool, defaults to physicalThreadCount()
-		 * @param initialQueueCapacity - The initial capacity of the job queue. Queue will grow to fit but resizing is expensive
+		 * @param initialQueueCapacity - The initial capacity of each worker's deque. Deques grow to fit but resizing is expensive
 		**/
 		GenoThreadPool(uint32 numThreads = physicalThreadCount(), uint32 initialQueueCapacity = 16);
 
+		/**
+		 * Creates a thread pool with control over where its workers run
+		 *
+		 * @param info - The number of threads, their names, cores and priority, the name is copied
+		**/
+		GenoThreadPool(const GenoThreadPoolCreateInfo & info);
+
+		/**
+		 * Returns the number of threads in the pool
+		**/
+		uint32 getNumThreads() const;
+
 		/**
 		 * Submits a job to the thread pool
 		 *
+		 * Runs the job immediately on the calling thread if the pool has no threads
+		 *
 		 * @param job - The job to be queued
 		 * @param data - The data for the queued job
 		**/
 		void submitJob(GenoThreadPoolJob job, GenoThreadPoolJobData data = 0);
 
+		/**
+		 * Submits any callable to the thread pool
+		 *
+		 * Callables and results of up to 48 bytes are stored inline in pooled task state so submitting them does not
+		 * allocate. Larger ones are moved to the heap. Callables returning a reference are rejected at compile time
+		 *
+		 * @param function - The callable to be queued
+		 *
+		 * @return A handle to wait for the callable and retrieve its result, it must not outlive the pool
+		**/
+		template <typename Function>
+		GenoJobHandle<decltype(std::declval<Function &>()())> submit(Function && function);
+
+		/**
+		 * Runs one queued job on the calling thread
+		 *
+		 * @return Whether there was a job to run
+		**/
+		bool runPendingJob();
+
 		/**
 		 * Waits until all submitted jobs have finished
 		**/
 		void wait();
 
+		/**
+		 * Reads every worker's counters while the pool keeps running
+		 *
+		 * Each counter is read on its own so the snapshot is not taken at a single instant, but no counter is torn
+		**/
+		GenoThreadPoolStats getStats() const;
+
 		/**
 		 * Destroys the thread pool
 		 *
-		 * Waits until all jobs have been completed before exiting
+		 * Runs every queued job, helping on the calling thread, and waits for them to finish before stopping the workers
 		**/
 		~GenoThreadPool();
 };
 
+#include "GenoJobHandle.h"
+
 #define GNARLY_GENOME_THREAD_POOL_FORWARD
 #endif // GNARLY_GENOME_THREAD_POOL
\ No newline at end of file
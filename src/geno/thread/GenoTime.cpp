@@ -24,20 +24,44 @@
  *
  *******************************************************************************/
 
-#include <thread>
-#include <chrono>
-#include <GLFW/glfw3.h>
+#include <cmath>
 
+#include "GenoClock.h"
 #include "GenoTime.h"
 
+namespace {
+	GenoMonotonicClock defaultClock;
+}
+
+bool GenoTime::precisePacing = false;
+GenoClock * GenoTime::clock = &defaultClock;
+
 double GenoTime::getTime(GenoTimeScale scale) {
-	return glfwGetTime() * scale;
+	return clock->getTime() * ((double) scale / nanoseconds);
+}
+
+uint64 GenoTime::getTicks() {
+	return clock->getTime();
 }
 
 void GenoTime::sleep(double time, GenoTimeScale scale) {
-	std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(time * milliseconds / scale));
+	if (time > 0)
+		// Rounds up, a virtual clock would otherwise never reach a deadline a fraction of a nanosecond away
+		clock->wait((uint64) ceil(time * nanoseconds / scale), precisePacing);
 }
 
 void GenoTime::sleepUntil(double time, GenoTimeScale scale) {
-	std::this_thread::sleep_for(std::chrono::duration<double, std::milli>((time - getTime(scale)) * milliseconds / scale));
+	sleep(time - getTime(scale), scale);
+}
+
+void GenoTime::setPacing(bool pacing) {
+	precisePacing = pacing;
+}
+
+void GenoTime::setClock(GenoClock * clock) {
+	GenoTime::clock = clock != 0 ? clock : &defaultClock;
+}
+
+GenoClock * GenoTime::getClock() {
+	return clock;
 }
\ No newline at end of file
@@ -24,22 +24,40 @@
  *
  *******************************************************************************/
 
+#ifndef GNARLY_GENOME_CLOCK_FORWARD
+#define GNARLY_GENOME_CLOCK_FORWARD
+
+class GenoClock;
+
+#endif // GNARLY_GENOME_CLOCK_FORWARD
+
 #ifndef GNARLY_GENOME_TIME
 #define GNARLY_GENOME_TIME
 
 #include "../GenoInts.h"
 
+#define GENO_TIME_PACING_SLEEP   false
+#define GENO_TIME_PACING_PRECISE true
+
 enum GenoTimeScale : uint32 { seconds = 1, milliseconds = 1000, microseconds = 1000000, nanoseconds = 1000000000 };
 
 class GenoTime final {
+	private:
+		static bool precisePacing;
+		static GenoClock * clock;
 	public:
 
 		/**
-		 * Returns the time since the initialization of the engine
+		 * Returns the time on the current clock, by default the time since the program started
 		 *
 		 * @param scale - The time scale in which to return the time
 		**/
 		static double getTime(GenoTimeScale scale = milliseconds);
+
+		/**
+		 * Returns the time on the current clock in whole nanoseconds
+		**/
+		static uint64 getTicks();
 	
 		/**
 		 * Sleeps the current thread for the specified amount of time
@@ -54,6 +72,26 @@ class GenoTime final {
 		 * @param scale - The time scale of the time provided
 		**/
 		static void sleepUntil(double time, GenoTimeScale scale = milliseconds);
+
+		/**
+		 * Sets how sleep and sleepUntil wait. GENO_TIME_PACING_SLEEP hands the whole wait to the OS, which can wake
+		 * more than a millisecond late. GENO_TIME_PACING_PRECISE sleeps to just before the target and spins the rest
+		 * (see GenoPacer), trading a little CPU time for wakeups within microseconds
+		**/
+		static void setPacing(bool pacing);
+
+		/**
+		 * Sets the clock that getTime reads and sleep waits on. A GenoVirtualClock lets a GenoLoop run without a
+		 * window and faster than real time
+		 *
+		 * @param clock - The clock, not owned, or 0 for the default GenoMonotonicClock
+		**/
+		static void setClock(GenoClock * clock);
+
+		/**
+		 * Returns the current clock
+		**/
+		static GenoClock * getClock();
 };
 
 #define GNARLY_GENOME_TIME_FORWARD
@@ -25,13 +25,14 @@
  *******************************************************************************/
 
 #include <iostream>
-#include <chrono>
 
 #include "geno/GenoInts.h"
 #include "geno/GenoMacros.h"
 
+#include "geno/math/linear/GenoVector2.h"
 #include "geno/math/linear/GenoMatrix4.h"
 #include "geno/thread/GenoTime.h"
+#include "geno/thread/GenoProfiler.h"
 #include "geno/engine/GenoEngine.h"
 #include "geno/engine/GenoLoop.h"
 #include "geno/engine/GenoInput.h"
@@ -43,10 +44,10 @@
 #include "geno/shaders/GenoShader2c.h"
 
 #include "plateral/Scene.h"
+#include "plateral/PerfHud.h"
 
 bool init();
 void begin();
-void loop();
 void update();
 void render();
 void cleanup();
@@ -55,8 +56,14 @@ bool toggle = true;
 
 GenoWindow * window;
 GenoCamera2D * camera;
+GenoVector2f previousCameraPosition;
+
+constexpr GenoMatrix4f PROJECTION = GenoMatrix4f::makeOrthographic(0, 32, 18, 0, 0, 1);
+static_assert(PROJECTION.m[0 ] ==  2 / 32.0f && PROJECTION.m[5 ] == -2 / 18.0f &&
+              PROJECTION.m[12] == -1        && PROJECTION.m[13] ==  1, "Camera must map the 32x18 world to clip space with y pointing down!");
 
 Scene * scene;
+PerfHud * hud;
 
 int32 main(int32 argc, char ** argv) {
 
@@ -64,19 +71,6 @@ int32 main(int32 argc, char ** argv) {
 	begin();
 	cleanup();
 
-	/////// TIME TRIALS - LEAVE FOR FUTURE USE ///////
-/*
-	const uint32 NUM_ITERATIONS = 1000000;
-	
-	auto begin1 = std::chrono::high_resolution_clock::now();
-	auto end1 = std::chrono::high_resolution_clock::now();
-
-	auto begin2 = std::chrono::high_resolution_clock::now();
-	auto end2 = std::chrono::high_resolution_clock::now();
-	
-	std::cout << std::chrono::duration_cast<std::chrono::microseconds>(end1 - begin1).count() << std::endl;
-	std::cout << std::chrono::duration_cast<std::chrono::microseconds>(end2 - begin2).count() << std::endl;
-*/
 	return 0;
 }
 
@@ -87,13 +81,16 @@ bool init() {
 	GenoVideoMode * videoMode = monitor->getDefaultVideoMode();
 
 	GenoLoopCreateInfo loopInfo = {};
-	loopInfo.targetFps   = videoMode->getRefreshRate();
-	loopInfo.deltaScale  = 1;
-	loopInfo.callback    = loop;
-	loopInfo.numSubLoops = 0;
-	loopInfo.subLoops    = 0;
+	loopInfo.targetFps     = videoMode->getRefreshRate();
+	loopInfo.deltaScale    = 1;
+	loopInfo.callback      = render;
+	loopInfo.numSubLoops   = 0;
+	loopInfo.subLoops      = 0;
+	loopInfo.fixedFps      = 240;
+	loopInfo.fixedCallback = update;
 
 	GenoEngine::setLoop(loopInfo);
+	GenoTime::setPacing(GENO_TIME_PACING_PRECISE);
 
 	int32 winHints[] = {
 		GLFW_CONTEXT_VERSION_MAJOR, 3,
@@ -137,6 +134,8 @@ bool init() {
 	camera = new GenoCamera2D(0, 32, 18, 0, 0, 1);
 
 	scene = new Scene(camera);
+	hud = new PerfHud(camera, 1000.0f / videoMode->getRefreshRate(), 240);
+	previousCameraPosition = camera->position;
 	
 	srand((uint32) GenoTime::getTime(milliseconds));
 
@@ -147,25 +146,38 @@ void begin() {
 	GenoEngine::startLoop();
 }
 
-void loop() {
-	update();
-	render();
-}
-
 void update() {
 	if (window->shouldClose())
 		GenoEngine::stopLoop();
+	if (GenoInput::getKeyState(GLFW_KEY_F3) == GENO_INPUT_PRESSED)
+		hud->toggle();
+	if (GenoInput::getKeyState(GLFW_KEY_F4) == GENO_INPUT_PRESSED)
+		GenoProfiler::dump("trace.json");
+	previousCameraPosition = camera->position;
 	scene->update();
+	// A new level moves the camera in one go, there is nothing to interpolate from
+	if (scene->hasLoaded())
+		previousCameraPosition = camera->position;
 	camera->update();
 }
 
 void render() {
+	// Renders from between the last two steps and puts the camera back for the next one
+	GenoVector2f cameraPosition = camera->position;
+	camera->position = lerp(previousCameraPosition, cameraPosition, GenoEngine::getLoop()->getAlpha());
+	camera->update();
+
 	GenoFramebuffer::clear();
 	scene->render();
+	hud->render();
 	window->swap();
+
+	camera->position = cameraPosition;
+	camera->update();
 }
 
 void cleanup() {
+	delete hud;
 	delete scene;
 
 	delete camera;
@@ -40,9 +40,9 @@ void ColRect::render() {
 	shader->enable();
 	shader->setColor(color);
 	if (gui)
-		shader->setMvp(translate2D(camera->getProjection(), position).scale2D(dimensions));
+		shader->setMvp(translate2D(camera->getAffineProjection(), position).scale2D(dimensions));
 	else
-		shader->setMvp(translate2D(camera->getVPMatrix(), position).scale2D(dimensions));
+		shader->setMvp(translate2D(camera->getAffineVP(), position).scale2D(dimensions));
 	vao->render();
 }
 
@@ -26,35 +26,62 @@
 
 #include <iostream>
 
+#include "../geno/engine/GenoEngine.h"
+#include "../geno/engine/GenoLoop.h"
+
 #include "Collidable.h"
 
 GenoVao * Collidable::vao = 0;
 
+constexpr float QUAD_VERTICES[] = {
+	1, 0, 0, // Top left
+	1, 1, 0, // Bottom left
+	0, 1, 0, // Bottom right
+	0, 0, 0  // Top right
+};
+constexpr uint32 QUAD_INDICES[] = {
+	0, 1, 3,
+	1, 2, 3
+};
+constexpr float QUAD_TEX_COORDS[] = {
+	1, 0,
+	1, 1,
+	0, 1,
+	0, 0
+};
+
+constexpr bool isUnitQuad() {
+	for (uint32 i = 0; i < 4; ++i) {
+		GenoVector2f vertex   = { QUAD_VERTICES[i * 3], QUAD_VERTICES[i * 3 + 1] };
+		GenoVector2f texCoord = { QUAD_TEX_COORDS[i * 2], QUAD_TEX_COORDS[i * 2 + 1] };
+		GenoVector2f opposite = { QUAD_VERTICES[(i + 2) % 4 * 3], QUAD_VERTICES[(i + 2) % 4 * 3 + 1] };
+		GenoVector2f diagonal = vertex - opposite;
+		if (vertex.x() != texCoord.x() || vertex.y() != texCoord.y() || diagonal.x() * diagonal.x() != 1 || diagonal.y() * diagonal.y() != 1)
+			return false;
+	}
+	return true;
+}
+
+static_assert(isUnitQuad(), "Collidable quad must span the unit square with matching texture coordinates!");
+
 Collidable::Collidable(GenoCamera2D * camera, const GenoVector2f & position, const GenoVector2f & dimensions, const GenoVector2f & velocity) :
 	camera(camera),
 	position(position),
+	previousPosition(position),
 	dimensions(dimensions),
 	velocity(velocity) {
 	if (vao == 0) {
-		float vertices[] = {
-			1, 0, 0, // Top left
-			1, 1, 0, // Bottom left
-			0, 1, 0, // Bottom right
-			0, 0, 0  // Top right
-		};
-		uint32 indices[] = {
-			0, 1, 3,
-			1, 2, 3
-		};
-		float texCoords[] = {
-			1, 0,
-			1, 1,
-			0, 1,
-			0, 0
-		};
-		vao = new GenoVao(4, vertices, 6, indices);
-		vao->addAttrib(4, 2, texCoords);
+		vao = new GenoVao(4, QUAD_VERTICES, 6, QUAD_INDICES);
+		vao->addAttrib(4, 2, QUAD_TEX_COORDS);
 	}
 }
 
+void Collidable::savePosition() {
+	previousPosition = position;
+}
+
+GenoVector2f Collidable::getRenderPosition() const {
+	return lerp(previousPosition, position, GenoEngine::getLoop()->getAlpha());
+}
+
 Collidable::~Collidable() {}
\ No newline at end of file
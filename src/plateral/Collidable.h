@@ -38,10 +38,17 @@ class Collidable {
 		GenoCamera2D * camera;
 	public:
 		GenoVector2f position;
+		GenoVector2f previousPosition;
 		GenoVector2f dimensions;
 		GenoVector2f velocity;
 
 		Collidable(GenoCamera2D * camera, const GenoVector2f & position, const GenoVector2f & dimensions, const GenoVector2f & velocity);
+
+		/** Remembers the position before a fixed step moves it, or after a jump so render does not slide there **/
+		void savePosition();
+		/** The position between the last two fixed steps that render draws at **/
+		GenoVector2f getRenderPosition() const;
+
 		~Collidable();
 };
 
@@ -25,10 +25,13 @@
  *******************************************************************************/
 
 #include <iostream>
+#include <memory>
 
 #include "../geno/GenoMacros.h"
 #include "../geno/engine/GenoEngine.h"
 #include "../geno/engine/GenoMonitor.h"
+#include "../geno/data/GenoImage.h"
+#include "../geno/thread/GenoThreadPool.h"
 
 #include "EndScreen.h"
 
@@ -36,23 +39,59 @@ GenoShader2t  * EndScreen::shader     = 0;
 GenoTexture2D * EndScreen::endScreen1 = 0;
 GenoTexture2D * EndScreen::endScreen2 = 0;
 
+namespace {
+	// Owned by the job's result so a load the EndScreen is destroyed before awaiting still frees its image
+	std::unique_ptr<GenoImage> loadImage(const char * path) {
+		GenoImageCreateInfo imageInfo = {};
+		imageInfo.type = GENO_IMAGE_TYPE_PNG;
+		imageInfo.path = path;
+		return std::unique_ptr<GenoImage>(GenoImage::create(imageInfo));
+	}
+}
+
 EndScreen::EndScreen(GenoCamera2D * camera) :
 	Collidable(camera, { 0.0f, 0 }, camera->getDimensions(), { 0.0f, 0 }),
 	overlay(camera, { 0.0f, 0.0f }, camera->getDimensions(), { 0, 0, 0, 1 }, true),
-	two(false),
 	complete(false),
-	time(0) {
+	two(false) {
 
-	if (shader == 0) {
+	if (shader == 0)
 		shader = new GenoShader2t();
 
-		uint32 textureParams[] = {
-			GL_TEXTURE_MIN_FILTER, GL_LINEAR,
-			GL_TEXTURE_MAG_FILTER, GL_LINEAR,
-			GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE,
-			GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE
-		};
-	
+	timeline = play();
+}
+
+GenoTexture2D * EndScreen::createTexture(GenoImage * image) {
+	if (image == 0)
+		return 0;
+
+	uint32 textureParams[] = {
+		GL_TEXTURE_MIN_FILTER, GL_LINEAR,
+		GL_TEXTURE_MAG_FILTER, GL_LINEAR,
+		GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE,
+		GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE
+	};
+
+	GenoTexture2DCreateInfo textureInfo = {};
+	textureInfo.type        = GENO_TEXTURE2D_TYPE_CREATE;
+	textureInfo.numParams   = GENO_ARRAY_SIZE(textureParams) / 2;
+	textureInfo.params      = textureParams;
+	textureInfo.width       = image->getWidth();
+	textureInfo.height      = image->getHeight();
+	textureInfo.data        = image->getBytes();
+
+	return GenoTexture2D::create(textureInfo);
+}
+
+GenoCoroutine EndScreen::fade(float from, float to) {
+	constexpr double FADE_TIME = 0.5;
+	for (double time = 0; time < FADE_TIME; time += co_await GenoCoroutine::nextFrame())
+		overlay.color.w() = from + (to - from) * (time / FADE_TIME);
+	overlay.color.w() = to;
+}
+
+GenoCoroutine EndScreen::play() {
+	if (endScreen1 == 0) {
 		float width = GenoMonitors::getPrimaryMonitor()->getDefaultVideoMode()->getWidth();
 
 		const char * path1 = 0;
@@ -71,42 +110,32 @@ EndScreen::EndScreen(GenoCamera2D * camera) :
 		else
 			path2 = "res/img/EndScreen21080p.png";
 
-		GenoTexture2DCreateInfo textureInfo = {};
-		textureInfo.type        = GENO_TEXTURE2D_TYPE_PNG;
-		textureInfo.numParams   = GENO_ARRAY_SIZE(textureParams) / 2;
-		textureInfo.params      = textureParams;
-		textureInfo.texture     = path1;
-
-		endScreen1 = GenoTexture2D::create(textureInfo);
-
-		textureInfo.texture = path2;
-
-		endScreen2 = GenoTexture2D::create(textureInfo);
+		// The PNGs decode on the pool while the overlay keeps the screen black, only the uploads happen on this thread
+		GenoThreadPool * pool = GenoEngine::getThreadPool();
+		auto image1 = pool->submit([path1]() { return loadImage(path1); });
+		auto image2 = pool->submit([path2]() { return loadImage(path2); });
+		endScreen1 = createTexture((co_await image1).get());
+		endScreen2 = createTexture((co_await image2).get());
 	}
+
+	co_await fade(1, 0);
+	co_await GenoCoroutine::seconds(2);
+	co_await fade(0, 1);
+	two = true;
+	co_await fade(1, 0);
+	co_await GenoCoroutine::seconds(2);
+	co_await fade(0, 1);
+	complete = true;
 }
 
 void EndScreen::render() {
-	time += GenoEngine::getLoop()->getDelta();
-	if (time < 0.5)
-		overlay.color.w() = 1 - time * 2;
-	else if (time >= 2.5 && time < 3)
-		overlay.color.w() = (time - 2.5) * 2;
-	else if (time >= 3 && time < 3.5) {
-		two = true;
-		overlay.color.w() = 1 - (time - 3) * 2;
+	GenoTexture2D * texture = two ? endScreen2 : endScreen1;
+	if (texture != 0) {
+		texture->bind();
+		shader->enable();
+		shader->setMvp(scale2D(camera->getAffineProjection(), camera->getDimensions()));
+		vao->render();
 	}
-	else if (time >= 5.5 && time < 6)
-		overlay.color.w() = (time - 5.5) * 2;
-	else if (time >= 6)
-		complete = true;
-
-	if (two)
-		endScreen2->bind();
-	else
-		endScreen1->bind();
-	shader->enable();
-	shader->setMvp(scale2D(camera->getProjection(), camera->getDimensions()));
-	vao->render();
 	overlay.render();
 }
 
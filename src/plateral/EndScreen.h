@@ -30,20 +30,27 @@
 #include "../geno/engine/GenoCamera2D.h"
 #include "../geno/gl/GenoTexture2D.h"
 #include "../geno/shaders/GenoShader2t.h"
+#include "../geno/thread/GenoCoroutine.h"
 #include "Collidable.h"
 
 #include "ColRect.h"
 
+class GenoImage;
+
 class EndScreen : public Collidable {
 	private:
 		static GenoShader2t * shader;
 		static GenoTexture2D * endScreen1;
 		static GenoTexture2D * endScreen2;
 
-		float time;
 		ColRect overlay;
 		bool complete;
 		bool two;
+		GenoCoroutine timeline;
+
+		static GenoTexture2D * createTexture(GenoImage * image);
+		GenoCoroutine fade(float from, float to);
+		GenoCoroutine play();
 
 	public:
 		EndScreen(GenoCamera2D * camera);
@@ -66,7 +66,7 @@ Goal::Goal(GenoCamera2D * camera, const GenoVector2f & position) :
 void Goal::render() {
 	texture->bind();
 	shader->enable();
-	shader->setMvp(translate2D(camera->getVPMatrix(), position).scale2D(dimensions));
+	shader->setMvp(translate2D(camera->getAffineVP(), position).scale2D(dimensions));
 	vao->render();
 }
 
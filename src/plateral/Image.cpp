@@ -83,7 +83,7 @@ GenoTexture2D * Image::getTexture() {
 void Image::render() {
 	texture->bind();
 	shader->enable();
-	shader->setMvp(translate2D(camera->getVPMatrix(), position).scale2D(dimensions));
+	shader->setMvp(translate2D(camera->getAffineVP(), position).scale2D(dimensions));
 	vao->render();
 }
 
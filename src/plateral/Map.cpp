@@ -30,6 +30,8 @@
 #include "../geno/math/linear/GenoVector2.h"
 #include "../geno/engine/GenoEngine.h"
 #include "../geno/engine/GenoInput.h"
+#include "../geno/thread/GenoParallel.h"
+#include "../geno/thread/GenoProfiler.h"
 
 #include "Map.h"
 
@@ -74,13 +76,15 @@ Map::Map(GenoCamera2D * camera, const char * path) :
 	goal(camera, { 0.0f, 0.0f}),
 	overlay(camera, { 0.0f, 0.0f }, camera->getDimensions(), {0, 0, 0, 1}, true),
 	time(0),
-	goalOverlay(camera, { 0.0f, 0.0f }, { 1, 2 }, {0, 0, 0, 0}, false) {
+	goalOverlay(camera, { 0.0f, 0.0f }, { 1, 2 }, {0, 0, 0, 0}, false),
+	goalOpen(false) {
 	player = new Player(camera);
 	// ------------ LOADING ------------
 	std::ifstream level(path);
 	numBlocks = readUInt(level);
 	killFloor = readFloat(level);
 	player->position = { readFloat(level), readFloat(level) };
+	player->savePosition();
 	goal.position = { readFloat(level), readFloat(level) };
 	goalOverlay.position = goal.position;
 	uint32 numPlatforms = readUInt(level);
@@ -88,6 +92,8 @@ Map::Map(GenoCamera2D * camera, const char * path) :
 		GenoVector2f position   = GenoVector2f{ readFloat(level), readFloat(level) };
 		GenoVector2f dimensions = GenoVector2f{ readFloat(level), readFloat(level) };
 		constant.emplace_back(camera, position, dimensions);
+		constantPositions.push(position);
+		constantDimensions.push(dimensions);
 	}
 	// ----------------------------------
 	camera->position = player->position + (player->dimensions - camera->getDimensions()) * 0.5f;
@@ -156,13 +162,60 @@ void Map::checkThrownCollision(const Collidable & platform) {
 	}
 }
 
+// Platforms never move once placed, so the batches only need a broad phase pass
+// each time the collider moves. Resolving one overlap can push the collider into
+// a later platform, which is why the search restarts from the current position.
+void Map::collidePlayer(const std::vector<Platform> & platforms, const GenoVector2fBatch & positions, const GenoVector2fBatch & dimensions) {
+	GENO_PROFILE_ZONE("Map::collidePlayer");
+	uint32 i = findOverlap(positions, dimensions, 0, player->getCollisionPosition(), player->getCollisionDimensions());
+	while (i < platforms.size()) {
+		checkPlayerCollision(platforms[i], true);
+		i = findOverlap(positions, dimensions, i + 1, player->getCollisionPosition(), player->getCollisionDimensions());
+	}
+}
+
+void Map::collideThrown(const std::vector<Platform> & platforms, const GenoVector2fBatch & positions, const GenoVector2fBatch & dimensions) {
+	GENO_PROFILE_ZONE("Map::collideThrown");
+	uint32 i = findOverlap(positions, dimensions, 0, thrown.data.position, thrown.data.dimensions);
+	while (i < platforms.size()) {
+		checkThrownCollision(platforms[i]);
+		i = findOverlap(positions, dimensions, i + 1, thrown.data.position, thrown.data.dimensions);
+	}
+}
+
 constexpr float OPEN_TIME = 0.5;
 constexpr float ENTER_TIME = 1;
 constexpr float CLOSE_TIME = 1.5;
+constexpr float FADE_TIME = 0.5;
+
+GenoCoroutine Map::enterGoal() {
+	constexpr float CLOSE_AMOUNT = 0.9;
+
+	float startX   = player->position.x();
+	float saveDims = goal.dimensions.x();
+
+	double time = co_await GenoCoroutine::nextFrame();
+	player->position.y() = goal.position.y();
+	for (; time < OPEN_TIME; time += co_await GenoCoroutine::nextFrame()) {
+		player->position.x() = (goal.position.x() + (saveDims - player->dimensions.x()) * 0.5f - startX) * (time / OPEN_TIME) + startX;
+		goal.dimensions.x() = 1 - (time / OPEN_TIME) * CLOSE_AMOUNT;
+	}
+	goalOpen = true;
+	for (; time < ENTER_TIME; time += co_await GenoCoroutine::nextFrame())
+		goalOverlay.color.w() = (time - OPEN_TIME) / (ENTER_TIME - OPEN_TIME);
+	for (; time < CLOSE_TIME; time += co_await GenoCoroutine::nextFrame())
+		goal.dimensions.x() = (time - ENTER_TIME) / (CLOSE_TIME - ENTER_TIME) * CLOSE_AMOUNT;
+	for (; time < FADE_TIME + CLOSE_TIME; time += co_await GenoCoroutine::nextFrame())
+		overlay.color.w() = (time - FADE_TIME) / CLOSE_TIME;
+	substate = 4;
+}
 
 void Map::update() {
-	constexpr float FADE_TIME = 0.5;
+	GENO_PROFILE_ZONE("Map::update");
 	float delta = GenoEngine::getLoop()->getDelta();
+	player->savePosition();
+	if (!thrown.null)
+		thrown.data.savePosition();
 	if (substate == 0) {
 		GenoInput::setEnabled(false);
 		time += delta;
@@ -187,20 +240,18 @@ void Map::update() {
 		player->update();
 
 		// Player Collision
-		for (auto & platform : constant)
-			checkPlayerCollision(platform, true);
-		for (auto & platform : spawned)
-			checkPlayerCollision(platform, true);
+		collidePlayer(constant, constantPositions, constantDimensions);
+		collidePlayer(spawned,  spawnedPositions,  spawnedDimensions);
 
 		if (!thrown.null) {
 			thrown.data.update();
 			// Thrown Collision
-			for (auto & platform : constant)
-				checkThrownCollision(platform);
-			for (auto & platform : spawned)
-				checkThrownCollision(platform);
+			collideThrown(constant, constantPositions, constantDimensions);
+			collideThrown(spawned,  spawnedPositions,  spawnedDimensions);
 			if (GenoInput::getMouseButtonState(GLFW_MOUSE_BUTTON_1) == GENO_INPUT_PRESSED) {
 				spawned.push_back(thrown.data.finalize());
+				spawnedPositions.push(thrown.data.position);
+				spawnedDimensions.push(thrown.data.dimensions);
 				thrown.null = true;
 			}
 		}
@@ -224,25 +275,23 @@ void Map::update() {
 			constexpr float MAX_DISTANCE = 4;
 			
 			GenoVector2f mouse = GenoInput::getMouseCoords(camera);
-			for (uint32 i = 0; i < spawned.size(); ++i) {
+			uint32 i = findOverlap(spawnedPositions, spawnedDimensions, 0, mouse, { 0.0f, 0.0f });
+			if (i < spawned.size()) {
 				auto & platform = spawned[i];
-				if (mouse.x() > platform.position.x() && mouse.x() < platform.position.x() + platform.dimensions.x()
-					&& mouse.y() > platform.position.y() && mouse.y() < platform.position.y() + platform.dimensions.y()) {
-					GenoVector2f direction = (player->position - platform.position + (player->dimensions - platform.dimensions) * 0.5f);
-					float speed = (fmax(0, MAX_DISTANCE - direction.getLength()) / MAX_DISTANCE) * MAX_FORCE;
-					player->velocity += direction.setLength(speed);
-
-					if (!thrown.null) {
-						GenoVector2f direction = (thrown.data.position - platform.position + (thrown.data.dimensions - platform.dimensions) * 0.5f);
-						float speed = (fmax(0, MAX_DISTANCE - direction.getLength()) / MAX_DISTANCE) * MAX_FORCE;
-						thrown.data.velocity += direction.setLength(speed);
-					}
-
-					detonations.push_back(platform.detonate());
-					spawned.erase(spawned.begin() + i);
+				GenoVector2f direction = (player->position - platform.position + (player->dimensions - platform.dimensions) * 0.5f);
+				float speed = (fmax(0, MAX_DISTANCE - direction.getLength()) / MAX_DISTANCE) * MAX_FORCE;
+				player->velocity += direction.setLength(speed);
 
-					break;
+				if (!thrown.null) {
+					GenoVector2f direction = (thrown.data.position - platform.position + (thrown.data.dimensions - platform.dimensions) * 0.5f);
+					float speed = (fmax(0, MAX_DISTANCE - direction.getLength()) / MAX_DISTANCE) * MAX_FORCE;
+					thrown.data.velocity += direction.setLength(speed);
 				}
+
+				detonations.push_back(platform.detonate());
+				spawned.erase(spawned.begin() + i);
+				spawnedPositions.erase(i);
+				spawnedDimensions.erase(i);
 			}
 			if (mouse.x() > thrown.data.position.x() && mouse.x() < thrown.data.position.x() + thrown.data.dimensions.x()
 				&& mouse.y() > thrown.data.position.y() && mouse.y() < thrown.data.position.y() + thrown.data.dimensions.y() && !thrown.null) {
@@ -255,8 +304,12 @@ void Map::update() {
 			}
 		}
 
+		// Only large levels have enough detonations to pass the automatic grain and actually split
+		Platform * detonated = detonations.data();
+		parallelFor(GenoEngine::getThreadPool(), 0, detonations.size(), 0, [detonated](uint32 i) {
+			detonated[i].update();
+		});
 		for (uint32 i = 0; i < detonations.size(); ++i) {
-			detonations[i].update();
 			if (detonations[i].isComplete()) {
 				detonations.erase(detonations.begin() + i);
 				--i;
@@ -292,52 +345,20 @@ void Map::update() {
 			if (checkPlayerCollision(goal, false) && fabs(player->position.y() - goal.position.y()) < 0.0001) {
 				state = 2;
 				substate = 2;
-				time = 0;
-				startX = player->position.x();
-				saveDims = goal.dimensions.x();
+				// Resumes at the end of every step from this one on, substate 2 skips the rest of update() until it is over
+				timeline = enterGoal();
 			}
 		}
 		/////////////////////////////////////////////////////////
 		/////////////////////////////////////////////////////////
 	}
-	else {
-		constexpr float CLOSE_AMOUNT = 0.9;
-
-		time += delta;
-
-		player->position.y() = goal.position.y();
-		if (time < OPEN_TIME) {
-			player->position.x() = (goal.position.x() + (saveDims - player->dimensions.x()) * 0.5f - startX) * (time / OPEN_TIME) + startX;
-			goal.dimensions.x() = 1 - (time / OPEN_TIME) * CLOSE_AMOUNT;
-		}
-		else if (time < ENTER_TIME) {
-			constexpr float ENTER_LTIME = ENTER_TIME - OPEN_TIME;
-			float ltime = time - OPEN_TIME;
-			goalOverlay.color.w() = (ltime / ENTER_LTIME);
-		}
-		else if (time < CLOSE_TIME) {
-			constexpr float CLOSE_LTIME = CLOSE_TIME - ENTER_TIME;
-			float ltime = time - ENTER_TIME;
-			goal.dimensions.x() = (ltime / CLOSE_LTIME) * CLOSE_AMOUNT;
-		}
-		else if (time < FADE_TIME + CLOSE_TIME)
-			overlay.color.w() = (time - FADE_TIME) / CLOSE_TIME;
-		else
-			substate = 4;
-	}
 }
 
 void Map::render() {
-	if (substate == 2) {
-		if (time < OPEN_TIME) {
-			goal.render();
-			player->render();
-		}
-		else {
-			player->render();
-			goalOverlay.render();
-			goal.render();
-		}
+	if (substate == 2 && goalOpen) {
+		player->render();
+		goalOverlay.render();
+		goal.render();
 	}
 	else {
 		goal.render();
@@ -31,6 +31,8 @@
 
 #include "../geno/GenoInts.h"
 #include "../geno/engine/GenoCamera2D.h"
+#include "../geno/math/linear/GenoVector2fBatch.h"
+#include "../geno/thread/GenoCoroutine.h"
 #include "Platform.h"
 #include "Player.h"
 #include "Optional.h"
@@ -42,6 +44,10 @@ class Map {
 		GenoCamera2D * camera;
 		std::vector<Platform> constant;
 		std::vector<Platform> spawned;
+		GenoVector2fBatch constantPositions;
+		GenoVector2fBatch constantDimensions;
+		GenoVector2fBatch spawnedPositions;
+		GenoVector2fBatch spawnedDimensions;
 		std::vector<Platform> detonations;
 		Goal goal;
 		Optional<Platform> thrown;
@@ -56,12 +62,15 @@ class Map {
 		float time;
 		ColRect overlay;
 
-		float startX;
-		float saveDims;
 		ColRect goalOverlay;
+		bool goalOpen;
+		GenoCoroutine timeline;
 
 		bool checkPlayerCollision(const Collidable & platform, bool push);
 		void checkThrownCollision(const Collidable & platform);
+		void collidePlayer(const std::vector<Platform> & platforms, const GenoVector2fBatch & positions, const GenoVector2fBatch & dimensions);
+		void collideThrown(const std::vector<Platform> & platforms, const GenoVector2fBatch & positions, const GenoVector2fBatch & dimensions);
+		GenoCoroutine enterGoal();
 
 	public:
 		static constexpr float GRAVITY = 30;
@@ -0,0 +1,261 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstdio>
+
+#include "../geno/engine/GenoEngine.h"
+#include "../geno/engine/GenoLoop.h"
+#include "../geno/engine/GenoFrameStats.h"
+#include "../geno/thread/GenoTime.h"
+
+#include "PerfHud.h"
+
+namespace {
+	constexpr float PIXEL       = 0.075f;
+	constexpr float MARGIN      = 0.25f;
+	constexpr uint32 COLUMNS    = 38;
+	constexpr uint32 LINES      = 7;
+	constexpr float LINE_HEIGHT = PIXEL * 7;
+	constexpr float WIDTH       = PIXEL * 4 * COLUMNS;
+
+	constexpr float GRAPH_Y      = MARGIN + LINE_HEIGHT * LINES + PIXEL * 2;
+	constexpr float GRAPH_HEIGHT = 3;
+
+	// Text changes too fast to read if it follows every frame
+	constexpr double REFRESH_TIME = 250;
+
+	void setQuad(float * vertices, float x, float y, float width, float height);
+	void addQuad(std::vector<float> & vertices, float x, float y, float width, float height);
+	std::vector<uint32> getIndices(uint32 quads);
+	void addText(std::vector<float> & vertices, const char * text, float x, float y);
+}
+
+GenoShader2c * PerfHud::shader = 0;
+
+PerfHud::PerfHud(GenoCamera2D * camera, float budget, uint32 window) :
+	camera(camera),
+	budget(budget),
+	window(window),
+	visible(false),
+	lastRefresh(0),
+	text(0),
+	fastVertices(window * 12),
+	slowVertices(window * 12) {
+	if (shader == 0)
+		shader = new GenoShader2c();
+
+	std::vector<float> vertices;
+	addQuad(vertices, MARGIN - PIXEL * 2, MARGIN - PIXEL * 2, WIDTH + PIXEL * 4, GRAPH_Y + GRAPH_HEIGHT - MARGIN + PIXEL * 4);
+	std::vector<uint32> indices = getIndices(1);
+	background = new GenoVao(4, vertices.data(), 6, indices.data());
+
+	// The graph spans twice the budget, so the budget sits halfway up
+	vertices.clear();
+	addQuad(vertices, MARGIN, GRAPH_Y + GRAPH_HEIGHT * 0.5f, WIDTH, PIXEL * 0.5f);
+	budgetLine = new GenoVao(4, vertices.data(), 6, indices.data());
+
+	indices = getIndices(window);
+	fastBars = new GenoVao(window * 4, fastVertices.data(), window * 6, indices.data());
+	slowBars = new GenoVao(window * 4, slowVertices.data(), window * 6, indices.data());
+}
+
+void PerfHud::refreshText() {
+	GenoLoop * loop = GenoEngine::getLoop();
+	GenoFrameStatsSummary summary = loop->getStats()->getSummary(window);
+
+	struct Row {
+		const char * name;
+		const GenoFrameStatSummary & stat;
+	};
+	const Row rows[] = {
+		{ "FRAME",   summary.frame   },
+		{ "UPDATE",  summary.update  },
+		{ "RENDER",  summary.render  },
+		{ "PRESENT", summary.present },
+		{ "SLEEP",   summary.sleep   }
+	};
+
+	std::vector<float> vertices;
+	char line[COLUMNS + 1];
+	snprintf(line, sizeof(line), "FPS %u  FRAMES %u", loop->getFPS(), summary.frames);
+	addText(vertices, line, MARGIN, MARGIN);
+	snprintf(line, sizeof(line), "%-8s%6s%6s%6s%6s%6s", "", "MIN", "AVG", "P95", "P99", "MAX");
+	addText(vertices, line, MARGIN, MARGIN + LINE_HEIGHT);
+	for (uint32 i = 0; i < LINES - 2; ++i) {
+		const GenoFrameStatSummary & stat = rows[i].stat;
+		snprintf(line, sizeof(line), "%-8s%6.2f%6.2f%6.2f%6.2f%6.2f", rows[i].name, stat.min, stat.avg, stat.p95, stat.p99, stat.max);
+		addText(vertices, line, MARGIN, MARGIN + LINE_HEIGHT * (i + 2));
+	}
+
+	uint32 quads = vertices.size() / 12;
+	std::vector<uint32> indices = getIndices(quads);
+	delete text;
+	text = new GenoVao(quads * 4, vertices.data(), quads * 6, indices.data());
+}
+
+void PerfHud::refreshGraph() {
+	GenoFrameStats * stats = GenoEngine::getLoop()->getStats();
+	float barWidth = WIDTH / window;
+	for (uint32 i = 0; i < window; ++i) {
+		float frame = 0;
+		if (window - 1 - i < stats->getCount())
+			frame = stats->get(window - 1 - i).frame;
+		float height = frame / (budget * 2);
+		if (height > 1)
+			height = 1;
+		height *= GRAPH_HEIGHT;
+
+		// Each bar is in one of the two meshes and flat in the other
+		bool slow = frame > budget * 1.25f;
+		float x = MARGIN + barWidth * i;
+		float y = GRAPH_Y + GRAPH_HEIGHT - height;
+		setQuad(fastVertices.data() + i * 12, x, y, barWidth, slow ? 0 : height);
+		setQuad(slowVertices.data() + i * 12, x, y, barWidth, slow ? height : 0);
+	}
+	fastBars->rebuffer(0, window * 4, 3, fastVertices.data());
+	slowBars->rebuffer(0, window * 4, 3, slowVertices.data());
+}
+
+void PerfHud::toggle() {
+	visible = !visible;
+}
+
+bool PerfHud::isVisible() {
+	return visible;
+}
+
+void PerfHud::render() {
+	if (!visible)
+		return;
+
+	double time = GenoTime::getTime(milliseconds);
+	if (text == 0 || time - lastRefresh >= REFRESH_TIME) {
+		refreshText();
+		lastRefresh = time;
+	}
+	refreshGraph();
+
+	shader->enable();
+	shader->setMvp(camera->getAffineProjection());
+	shader->setColor(0, 0, 0, 0.6f);
+	background->render();
+	shader->setColor(0.2f, 0.9f, 0.3f, 1);
+	fastBars->render();
+	shader->setColor(1, 0.25f, 0.2f, 1);
+	slowBars->render();
+	shader->setColor(1, 1, 1, 0.5f);
+	budgetLine->render();
+	shader->setColor(1, 1, 1, 1);
+	text->render();
+}
+
+PerfHud::~PerfHud() {
+	delete background;
+	delete text;
+	delete fastBars;
+	delete slowBars;
+	delete budgetLine;
+}
+
+namespace {
+	/** 3x5 glyphs, one row of three bits per line from the top, the high bit on the left **/
+	uint16 getGlyph(char c) {
+		constexpr uint16 DIGITS[] = {
+			0b111'101'101'101'111, 0b010'110'010'010'111, 0b111'001'111'100'111, 0b111'001'111'001'111,
+			0b101'101'111'001'001, 0b111'100'111'001'111, 0b111'100'111'101'111, 0b111'001'001'001'001,
+			0b111'101'111'101'111, 0b111'101'111'001'111
+		};
+		if (c >= '0' && c <= '9')
+			return DIGITS[c - '0'];
+		switch (c) {
+			case '.': return 0b000'000'000'000'010;
+			case 'A': return 0b010'101'111'101'101;
+			case 'D': return 0b110'101'101'101'110;
+			case 'E': return 0b111'100'110'100'111;
+			case 'F': return 0b111'100'110'100'100;
+			case 'G': return 0b011'100'101'101'011;
+			case 'I': return 0b111'010'010'010'111;
+			case 'L': return 0b100'100'100'100'111;
+			case 'M': return 0b101'111'111'101'101;
+			case 'N': return 0b110'101'101'101'101;
+			case 'P': return 0b110'101'110'100'100;
+			case 'R': return 0b110'101'110'101'101;
+			case 'S': return 0b011'100'010'001'110;
+			case 'T': return 0b111'010'010'010'010;
+			case 'U': return 0b101'101'101'101'111;
+			case 'V': return 0b101'101'101'101'010;
+			case 'X': return 0b101'101'010'101'101;
+			default:  return 0;
+		}
+	}
+
+	void setQuad(float * vertices, float x, float y, float width, float height) {
+		const float corners[] = {
+			x + width, y,          0,
+			x + width, y + height, 0,
+			x,         y + height, 0,
+			x,         y,          0
+		};
+		for (uint32 i = 0; i < 12; ++i)
+			vertices[i] = corners[i];
+	}
+
+	void addQuad(std::vector<float> & vertices, float x, float y, float width, float height) {
+		vertices.resize(vertices.size() + 12);
+		setQuad(vertices.data() + vertices.size() - 12, x, y, width, height);
+	}
+
+	std::vector<uint32> getIndices(uint32 quads) {
+		std::vector<uint32> indices;
+		indices.reserve(quads * 6);
+		for (uint32 i = 0; i < quads; ++i) {
+			const uint32 quad[] = { 0, 1, 3, 1, 2, 3 };
+			for (uint32 index : quad)
+				indices.push_back(i * 4 + index);
+		}
+		return indices;
+	}
+
+	/** Each row of a glyph becomes one quad per run of lit pixels **/
+	void addText(std::vector<float> & vertices, const char * text, float x, float y) {
+		for (; *text != 0; ++text, x += PIXEL * 4) {
+			uint16 glyph = getGlyph(*text);
+			for (uint32 row = 0; row < 5; ++row) {
+				uint32 bits = (glyph >> ((4 - row) * 3)) & 0b111;
+				for (uint32 column = 0; column < 3;) {
+					if ((bits & (0b100 >> column)) == 0) {
+						++column;
+						continue;
+					}
+					uint32 start = column;
+					while (column < 3 && (bits & (0b100 >> column)) != 0)
+						++column;
+					addQuad(vertices, x + start * PIXEL, y + row * PIXEL, (column - start) * PIXEL, PIXEL);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,72 @@
+/*******************************************************************************
+ *
+ * Copyright (c) 2019 Gnarly Narwhal
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files(the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#ifndef GNARLY_PLATERAL_PERF_HUD
+#define GNARLY_PLATERAL_PERF_HUD
+
+#include <vector>
+
+#include "../geno/engine/GenoCamera2D.h"
+#include "../geno/gl/GenoVao.h"
+#include "../geno/shaders/GenoShader2c.h"
+
+/**
+ * An overlay of the main loop's GenoFrameStats: min / avg / p95 / p99 / max of each frame time in a bitmap font,
+ * and a graph of recent frame times against the frame budget
+**/
+class PerfHud {
+	private:
+		static GenoShader2c * shader;
+
+		GenoCamera2D * camera;
+		float budget;
+		uint32 window;
+		bool visible;
+		double lastRefresh;
+
+		GenoVao * background;
+		GenoVao * text;
+		GenoVao * fastBars;
+		GenoVao * slowBars;
+		GenoVao * budgetLine;
+		std::vector<float> fastVertices;
+		std::vector<float> slowVertices;
+
+		void refreshText();
+		void refreshGraph();
+	public:
+		/**
+		 * @param budget - The time one frame should take in milliseconds
+		 * @param window - How many frames the summary and graph cover
+		**/
+		PerfHud(GenoCamera2D * camera, float budget, uint32 window);
+		void toggle();
+		bool isVisible();
+		void render();
+		~PerfHud();
+};
+
+#endif // GNARLY_PLATERAL_PERF_HUD
@@ -73,24 +73,27 @@ void Platform::update() {
 }
 
 void Platform::render() {
+	GenoVector2f renderPosition = getRenderPosition();
 	shader->enable();
 	shader->setColor(color);
-	shader->setMvp(translate2D(camera->getVPMatrix(), position - GenoVector2f{ scale, scale }).scale2D(dimensions + GenoVector2f{ scale, scale } * 2.0f));
+	shader->setMvp(translate2D(camera->getAffineVP(), renderPosition - GenoVector2f{ scale, scale }).scale2D(dimensions + GenoVector2f{ scale, scale } * 2.0f));
 	vao->render();
 	shader->setColor({ 0, 0, 0, 1 });
-	shader->setMvp(translate2D(camera->getVPMatrix(), position + GenoVector2f{ 0.0625f, 0.0625f } - GenoVector2f{ scale, scale }).scale2D(dimensions - (GenoVector2f{ 0.0625f, 0.0625f } - GenoVector2f{ scale, scale }) * 2.0f));
+	shader->setMvp(translate2D(camera->getAffineVP(), renderPosition + GenoVector2f{ 0.0625f, 0.0625f } - GenoVector2f{ scale, scale }).scale2D(dimensions - (GenoVector2f{ 0.0625f, 0.0625f } - GenoVector2f{ scale, scale }) * 2.0f));
 	vao->render();
 }
 
 Platform & Platform::finalize() {
 	state = STATE_STATIC;
 	velocity = { 0.0f, 0.0f };
+	savePosition();
 	return *this;
 }
 
 Platform & Platform::detonate() {
 	state = STATE_EXPLODING;
 	velocity = { 0.0f, 0.0f };
+	savePosition();
 	return *this;
 }
 
@@ -145,6 +148,7 @@ void Platform::reset(const GenoVector2f & position, const GenoVector2f & velocit
 	color = hsvToRgb(rand() % 361, 1, 1);
 	this->position = position;
 	this->velocity = velocity;
+	savePosition();
 }
 
 bool Platform::isComplete() {
@@ -37,6 +37,27 @@
 GenoShader2ss   * Player::shader  = 0;
 GenoSpritesheet * Player::texture = 0;
 
+constexpr uint32 NUM_SPRITES_X = 8;
+constexpr uint32 NUM_SPRITES_Y = 4;
+
+constexpr bool framesStayInCells(float width, float height) {
+	for (uint32 y = 0; y < NUM_SPRITES_Y; ++y) {
+		for (uint32 x = 0; x < NUM_SPRITES_X; ++x) {
+			GenoMatrix4f transform = GenoSpritesheet::makeTransform(x, y, 1.0f / NUM_SPRITES_X, 1.0f / NUM_SPRITES_Y,
+			                                                        1 / (width  + NUM_SPRITES_X * 2),
+			                                                        1 / (height + NUM_SPRITES_Y * 2));
+			if (transform.m[12] <= (float) x / NUM_SPRITES_X || transform.m[12] + transform.m[0] >= (float) (x + 1) / NUM_SPRITES_X ||
+			    transform.m[13] <= (float) y / NUM_SPRITES_Y || transform.m[13] + transform.m[5] >= (float) (y + 1) / NUM_SPRITES_Y)
+				return false;
+		}
+	}
+	return true;
+}
+
+static_assert(framesStayInCells(960,  480), "Player1080p.png frames bleed into their neighbours!");
+static_assert(framesStayInCells(1280, 640), "Player1440p.png frames bleed into their neighbours!");
+static_assert(framesStayInCells(1920, 960), "Player4k.png frames bleed into their neighbours!");
+
 Player::Player(GenoCamera2D * camera) :
 	Collidable(camera, { 0.0f, 0.0f }, { 2.0f, 2.0f }, { 0.0f, 0.0f }),
 	hitboxScale(0.5f, 1) {
@@ -64,9 +85,10 @@ Player::Player(GenoCamera2D * camera) :
 		textureInfo.numParams   = GENO_ARRAY_SIZE(textureParams) / 2;
 		textureInfo.params      = textureParams;
 		textureInfo.texture     = path;
-		textureInfo.numSpritesX = 8;
-		textureInfo.numSpritesY = 4;
+		textureInfo.numSpritesX = NUM_SPRITES_X;
+		textureInfo.numSpritesY = NUM_SPRITES_Y;
 		textureInfo.addPadding  = true;
+		textureInfo.pool        = GenoEngine::getThreadPool();
 
 		texture = GenoSpritesheet::create(textureInfo);
 	}
@@ -197,7 +219,7 @@ void Player::render() {
 	texture->bind();
 	shader->enable();
 	shader->setTextureTransform(texture->getTransform(state));
-	shader->setMvp(translate2D(camera->getVPMatrix(), position + scaleXY(dimensions, 1 - direction, 0.0f)).scale2D(scaleX(dimensions, direction * 2 - 1)));
+	shader->setMvp(translate2D(camera->getAffineVP(), getRenderPosition() + scaleXY(dimensions, 1 - direction, 0.0f)).scale2D(scaleX(dimensions, direction * 2 - 1)));
 	vao->render();
 }
 
@@ -35,7 +35,8 @@ extern uint32 readUInt(std::istream & stream);
 
 Scene::Scene(GenoCamera2D * camera) :
 	camera(camera),
-	curLevel(0) {
+	curLevel(0),
+	loaded(true) {
 	std::ifstream data("res/levels/count.txt");
 	numLevels = readUInt(data);
 	levels = new std::string[numLevels];
@@ -48,6 +49,7 @@ Scene::Scene(GenoCamera2D * camera) :
 }
 
 void Scene::update() {
+	loaded = false;
 	if (endScreen == 0) {
 		map->update();
 		if (map->getState() > 0) {
@@ -58,6 +60,7 @@ void Scene::update() {
 			else {
 				delete map;
 				map = new Map(camera, levels[curLevel].c_str());
+				loaded = true;
 			}
 		}
 	}
@@ -68,10 +71,15 @@ void Scene::update() {
 			delete map;
 			curLevel = 0;
 			map = new Map(camera, levels[curLevel].c_str());
+			loaded = true;
 		}
 	}
 }
 
+bool Scene::hasLoaded() {
+	return loaded;
+}
+
 void Scene::render() {
 	if (curLevel < numLevels)
 		map->render();
@@ -40,10 +40,17 @@ class Scene {
 		std::string * levels;
 		uint32 curLevel;
 		uint32 numLevels;
+		bool loaded;
 
 	public:
 		Scene(GenoCamera2D * camera);
 		void update();
+
+		/**
+		 * Returns whether the last update loaded a level, placing the camera somewhere new
+		**/
+		bool hasLoaded();
+
 		void render();
 		~Scene();
 };